@@ -39,13 +39,78 @@
 #include "../model/SubSurface_Impl.hpp"
 
 #include "../utilities/plot/ProgressBar.hpp"
+#include "../utilities/geometry/Geometry.hpp"
+#include "../utilities/geometry/Vector3d.hpp"
 
 #include <QThread>
 
+#include <boost/math/constants/constants.hpp>
+
+#include <set>
+
 namespace openstudio {
 namespace airflow {
 
-SurfaceNetworkBuilder::SurfaceNetworkBuilder(ProgressBar *progressBar) : m_progressBar(progressBar)
+SurfaceGeometry::SurfaceGeometry() : valid(false), grossArea(0.0), azimuth(0.0), tilt(0.0), averageZ(0.0)
+{
+}
+
+SurfaceGeometry::SurfaceGeometry(const std::vector<Point3d> &vertices) : valid(false), grossArea(0.0), azimuth(0.0),
+  tilt(0.0), averageZ(0.0)
+{
+  // These follow the PlanarSurface computations
+  boost::optional<double> area = getArea(vertices);
+  if(area) {
+    grossArea = *area;
+  }
+  if(!vertices.empty()) {
+    for(const Point3d &point : vertices) {
+      averageZ += point.z();
+    }
+    averageZ /= vertices.size();
+  }
+  boost::optional<Vector3d> normal = getOutwardNormal(vertices);
+  if(normal) {
+    valid = true;
+    tilt = getAngle(*normal, Vector3d(0.0, 0.0, 1.0));
+    azimuth = getAngle(*normal, Vector3d(0.0, 1.0, 0.0));
+    if(normal->x() < 0.0) {
+      azimuth = -azimuth + 2.0*boost::math::constants::pi<double>();
+    }
+  }
+}
+
+// Everything needed to link a surface, gathered from the model before anything is linked
+struct SurfaceNetworkBuilder::SurfaceSnapshot
+{
+  enum Kind {Skip, Exterior, Interior};
+
+  explicit SurfaceSnapshot(const model::Surface &surface) : surface(surface), kind(Skip)
+  {
+  }
+
+  void log(LogLevel level, const std::string &message)
+  {
+    messages.push_back(std::make_pair(level, message));
+  }
+
+  model::Surface surface;
+  Kind kind;
+  boost::optional<model::Space> space;
+  boost::optional<model::ThermalZone> thermalZone;
+  boost::optional<model::Surface> adjacentSurface;
+  boost::optional<model::Space> adjacentSpace;
+  boost::optional<model::ThermalZone> adjacentZone;
+  // Subsurfaces and, for interior surfaces, their adjacent subsurfaces (empty if they cannot be linked)
+  std::vector<model::SubSurface> subSurfaces;
+  std::vector<boost::optional<model::SubSurface> > adjacentSubSurfaces;
+  SurfaceGeometry geometry;
+  SurfaceGeometry adjacentGeometry;
+  // Messages to be logged when the surface is linked
+  std::vector<std::pair<LogLevel, std::string> > messages;
+};
+
+SurfaceNetworkBuilder::SurfaceNetworkBuilder(ProgressBar *progressBar) : m_progressBar(progressBar), m_current(nullptr)
 {
   m_logSink.setLogLevel(Info);
   m_logSink.setChannelRegex(boost::regex("openstudio\\.model\\.SurfaceNetworkBuilder"));
@@ -100,121 +165,140 @@ bool SurfaceNetworkBuilder::linkInteriorSubSurface(model::ThermalZone zone, mode
 
 bool SurfaceNetworkBuilder::build(model::Model &model)
 {
-  bool first = true;
   bool nowarnings = true;
-  QVector<openstudio::Handle> used;
+  std::set<openstudio::Handle> used;
 
   m_logSink.setThreadId(QThread::currentThread());
   m_logSink.resetStringStream();
 
   std::vector<model::Surface> surfaces = model.getConcreteModelObjects<model::Surface>();
 
-  initProgress(surfaces.size(),"Processing surfaces for network creation");
-
-  for (model::Surface surface : surfaces) {
-    if(!first) {
-      progress();
-    }
-    first=false;
+  // Take a snapshot of everything that is needed from the model
+  std::vector<SurfaceSnapshot> snapshots;
+  snapshots.reserve(surfaces.size());
+  for (const model::Surface &surface : surfaces) {
+    snapshots.push_back(SurfaceSnapshot(surface));
+    SurfaceSnapshot &snapshot = snapshots.back();
     std::string bc = surface.outsideBoundaryCondition();
-    if(bc == "Outdoors") {
-      // Get the associated thermal zone
-      boost::optional<openstudio::model::Space> space = surface.space();
-      if(!space) {
-        LOG(Warn, "Unattached surface '" << openstudio::toString(surface.handle()) << "'");
-        nowarnings = false;
-        continue;
-      }
-      boost::optional<openstudio::model::ThermalZone> thermalZone = space->thermalZone();
-      if(!thermalZone) {
-        LOG(Warn, "Unzoned space '" << openstudio::toString(space->handle()) << "'");
-        nowarnings = false;
-        continue;
-      }
+    bool interior = bc == "Surface";
+    if(bc != "Outdoors" && !(interior && used.find(surface.handle()) == used.end())) {
+      continue;
+    }
+    // Get the associated thermal zone
+    snapshot.space = surface.space();
+    if(!snapshot.space) {
+      snapshot.log(Warn, "Unattached surface '" + openstudio::toString(surface.handle()) + "'");
+      nowarnings = false;
+      continue;
+    }
+    snapshot.thermalZone = snapshot.space->thermalZone();
+    if(!snapshot.thermalZone) {
+      snapshot.log(Warn, "Unzoned space '" + openstudio::toString(snapshot.space->handle()) + "'");
+      nowarnings = false;
+      continue;
+    }
+    if(!interior) {
       // If we made it to here, then the exterior surface is good.
-      linkExteriorSurface(thermalZone.get(),space.get(),surface);
-      for(model::SubSurface subSurface : surface.subSurfaces()) {
-        linkExteriorSubSurface(thermalZone.get(),space.get(),surface,subSurface);
-      }
-    } else if(!used.contains(surface.handle()) && bc == "Surface") {
-      // Get the associated thermal zone
-      boost::optional<openstudio::model::Space> space = surface.space();
-      if(!space) {
-        LOG(Warn, "Unattached surface '" << openstudio::toString(surface.handle()) << "'");
-        nowarnings = false;
-        continue;
-      }
-      boost::optional<openstudio::model::ThermalZone> thermalZone = space->thermalZone();
-      if(!thermalZone) {
-        LOG(Warn, "Unzoned space '" << openstudio::toString(space->handle()) << "'");
-        nowarnings = false;
-        continue;
-      }
-      boost::optional<openstudio::model::Surface> adjacentSurface = surface.adjacentSurface();
-      if(!adjacentSurface) {
-        LOG(Error, "Unable to find adjacent surface for surface '" << openstudio::toString(surface.handle()) << "'");
-        nowarnings = false;
-        continue;
-      }
-      boost::optional<openstudio::model::Space> adjacentSpace = adjacentSurface->space();
-      if(!adjacentSpace) {
-        LOG(Error, "Unattached adjacent surface '" << openstudio::toString(adjacentSurface->handle()) << "'");
+      snapshot.kind = SurfaceSnapshot::Exterior;
+      snapshot.subSurfaces = surface.subSurfaces();
+      snapshot.geometry = SurfaceGeometry(surface.vertices());
+      continue;
+    }
+    snapshot.adjacentSurface = surface.adjacentSurface();
+    if(!snapshot.adjacentSurface) {
+      snapshot.log(Error, "Unable to find adjacent surface for surface '" + openstudio::toString(surface.handle()) + "'");
+      nowarnings = false;
+      continue;
+    }
+    snapshot.adjacentSpace = snapshot.adjacentSurface->space();
+    if(!snapshot.adjacentSpace) {
+      snapshot.log(Error, "Unattached adjacent surface '" + openstudio::toString(snapshot.adjacentSurface->handle()) + "'");
+      nowarnings = false;
+      continue;
+    }
+    snapshot.adjacentZone = snapshot.adjacentSpace->thermalZone();
+    if(!snapshot.adjacentZone) {
+      snapshot.log(Warn, "Unzoned adjacent space '" + openstudio::toString(snapshot.adjacentSpace->handle()) + "'");
+      nowarnings = false;
+      continue;
+    }
+    // We could punt the checking of subsurfaces until later, but it is best to get this out of the way now
+    snapshot.subSurfaces = surface.subSurfaces();
+    for(const model::SubSurface &subSurface : snapshot.subSurfaces) {
+      boost::optional<model::SubSurface> adjacentSubSurface = subSurface.adjacentSubSurface();
+      if(!adjacentSubSurface) {
+        snapshot.log(Warn, "Unable to find adjacent subsurface for subsurface of '" + openstudio::toString(surface.handle()) + "'");
         nowarnings = false;
-        continue;
-      }
-      boost::optional<openstudio::model::ThermalZone> adjacentZone = adjacentSpace->thermalZone();
-      if(!thermalZone) {
-        LOG(Warn, "Unzoned adjacent space '" << openstudio::toString(adjacentSpace->handle()) << "'");
+      } else if(adjacentSubSurface->surface() != snapshot.adjacentSurface) {
+        snapshot.log(Warn, "Adjacent subsurface for subsurface of '" + openstudio::toString(surface.handle())
+          + "' is not attached to the expected surface");
         nowarnings = false;
-        continue;
-      }
-      // We could punt the checking of subsurfaces until later, but it is best to get this out of the way now
-      for(model::SubSurface subSurface : surface.subSurfaces()) {
-        boost::optional<model::SubSurface> adjacentSubSurface = subSurface.adjacentSubSurface();
-        if(!adjacentSubSurface) {
-          LOG(Warn, "Unable to find adjacent subsurface for subsurface of '" << openstudio::toString(surface.handle()) << "'");
-          nowarnings = false;
-          continue;
-        }
-        if(adjacentSubSurface->surface() != adjacentSurface) {
-          LOG(Warn, "Adjacent subsurface for subsurface of '" << openstudio::toString(surface.handle()) << "' is not attached to the expected surface");
-          nowarnings = false;
-          continue;
-        }
+        adjacentSubSurface.reset();
       }
-      // Ok, now we a surface, a space, a zone, an adjacent surface, an adjacent space, and an adjacent zone. Finally.
-      used.push_back(adjacentSurface->handle());
-      if(thermalZone == adjacentZone) {
-        continue;
+      snapshot.adjacentSubSurfaces.push_back(adjacentSubSurface);
+    }
+    // Ok, now we a surface, a space, a zone, an adjacent surface, an adjacent space, and an adjacent zone. Finally.
+    used.insert(snapshot.adjacentSurface->handle());
+    if(snapshot.thermalZone == snapshot.adjacentZone) {
+      continue;
+    }
+    // Now have a surface that is fully connected and separates two zones so it can be linked
+    snapshot.kind = SurfaceSnapshot::Interior;
+    snapshot.geometry = SurfaceGeometry(surface.vertices());
+    snapshot.adjacentGeometry = SurfaceGeometry(snapshot.adjacentSurface->vertices());
+  }
+
+  // Link everything in the original surface order
+  initProgress(snapshots.size(),"Processing surfaces for network creation");
+
+  bool first = true;
+  for (const SurfaceSnapshot &snapshot : snapshots) {
+    if(!first) {
+      progress();
+    }
+    first=false;
+    for(const std::pair<LogLevel, std::string> &message : snapshot.messages) {
+      LOG(message.first, message.second);
+    }
+    m_current = &snapshot;
+    if(snapshot.kind == SurfaceSnapshot::Exterior) {
+      linkExteriorSurface(snapshot.thermalZone.get(),snapshot.space.get(),snapshot.surface);
+      for(const model::SubSurface &subSurface : snapshot.subSurfaces) {
+        linkExteriorSubSurface(snapshot.thermalZone.get(),snapshot.space.get(),snapshot.surface,subSurface);
       }
-      // Now have a surface that is fully connected and separates two zones so it can be linked
-      linkInteriorSurface(thermalZone.get(),space.get(),surface,adjacentSurface.get(),adjacentSpace.get(),adjacentZone.get());
-      // Link subsurfaces
-      for(model::SubSurface subSurface : surface.subSurfaces()) {
-        // Now we need to check the connections as we did with the surface
-        boost::optional<model::SubSurface> adjacentSubSurface = subSurface.adjacentSubSurface();
-        if(!adjacentSubSurface) {
-          LOG(Warn, "Unable to find adjacent subsurface for subsurface of '" << openstudio::toString(surface.handle()) << "'");
-          nowarnings = false;
-          continue;
-        }
-        if(adjacentSubSurface->surface() != adjacentSurface) {
-          LOG(Warn, "Adjacent subsurface for subsurface of '" << openstudio::toString(surface.handle()) << "' is not attached to the expected surface");
-          nowarnings = false;
-          continue;
+    } else if(snapshot.kind == SurfaceSnapshot::Interior) {
+      linkInteriorSurface(snapshot.thermalZone.get(),snapshot.space.get(),snapshot.surface,snapshot.adjacentSurface.get(),
+        snapshot.adjacentSpace.get(),snapshot.adjacentZone.get());
+      // Link the fully connected subsurfaces
+      for(unsigned i = 0; i < snapshot.subSurfaces.size(); i++) {
+        if(snapshot.adjacentSubSurfaces[i]) {
+          linkInteriorSubSurface(snapshot.thermalZone.get(),snapshot.space.get(),snapshot.surface,snapshot.subSurfaces[i],
+            snapshot.adjacentSubSurfaces[i].get(),snapshot.adjacentSurface.get(),snapshot.adjacentSpace.get(),
+            snapshot.adjacentZone.get());
         }
-        // If we made it here, then the subsurface is fully connected and can be linked
-        linkInteriorSubSurface(thermalZone.get(),space.get(),surface,subSurface,adjacentSubSurface.get(),adjacentSurface.get(),
-          adjacentSpace.get(),adjacentZone.get());
       }
     }
+    m_current = nullptr;
   }
-  if(surfaces.size()>0) {
+  if(snapshots.size()>0) {
     progress();
   }
   return nowarnings;
 }
 
+SurfaceGeometry SurfaceNetworkBuilder::surfaceGeometry(const model::Surface &surface) const
+{
+  if(m_current && m_current->kind != SurfaceSnapshot::Skip) {
+    if(surface == m_current->surface) {
+      return m_current->geometry;
+    }
+    if(m_current->adjacentSurface && surface == m_current->adjacentSurface.get()) {
+      return m_current->adjacentGeometry;
+    }
+  }
+  return SurfaceGeometry(surface.vertices());
+}
+
 std::vector<LogMessage> SurfaceNetworkBuilder::warnings() const
 {
   std::vector<LogMessage> result;
@@ -35,6 +35,7 @@
 
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/StringStreamLogSink.hpp"
+#include "../utilities/geometry/Point3d.hpp"
 
 namespace openstudio {
 
@@ -49,6 +50,28 @@ class Surface;
 
 namespace airflow {
 
+/** SurfaceGeometry holds the geometric properties of a surface that are needed to build
+ *  an airflow network, computed from a snapshot of the surface's vertices.
+ */
+struct AIRFLOW_API SurfaceGeometry
+{
+  /** Construct an empty (invalid) geometry object. */
+  SurfaceGeometry();
+  /** Compute the geometry of the polygon defined by the vertices. */
+  explicit SurfaceGeometry(const std::vector<Point3d> &vertices);
+
+  /** True if the outward normal (and so the azimuth and tilt) could be computed. */
+  bool valid;
+  /** The gross area in m^2. */
+  double grossArea;
+  /** The azimuth in radians, measured clockwise from north. */
+  double azimuth;
+  /** The tilt in radians, measured from straight up. */
+  double tilt;
+  /** The average height of the vertices in m. */
+  double averageZ;
+};
+
 /** SurfaceNetworkBuilder objects walk the OpenStudio model as a network of surfaces.
  *
  *  The SurfaceNetworkBuilder object walks the OpenStudio model as a network of surface,
@@ -56,6 +79,11 @@ namespace airflow {
  *  once for each exterior surface or subsurface. The intended usage is to subclass for a
  *  specific application.
  *
+ *  The build is done in two passes. The model is first walked to take a snapshot of
+ *  each surface (the connected spaces, zones, adjacent surfaces, subsurfaces, and geometry).
+ *  The link functions are then called in the order of the model's surfaces. The link
+ *  functions may call surfaceGeometry to get the precomputed geometry.
+ *
  */
 class AIRFLOW_API SurfaceNetworkBuilder
 {
@@ -107,6 +135,10 @@ protected:
   void progress();
   void initProgress(int max, std::string label);
 
+  /** Returns the geometry of a surface. During build, this is the precomputed geometry of the
+   *  surface (or adjacent surface) being linked, otherwise it is computed on demand. */
+  SurfaceGeometry surfaceGeometry(const model::Surface &surface) const;
+
   virtual bool linkExteriorSurface(model::ThermalZone zone, model::Space space, model::Surface surface);
   virtual bool linkExteriorSubSurface(model::ThermalZone zone, model::Space space, model::Surface surface, model::SubSurface subSurface);
   virtual bool linkInteriorSurface(model::ThermalZone zone, model::Space space, model::Surface surface,
@@ -115,8 +147,11 @@ protected:
     model::SubSurface adjacentSubSurface, model::Surface adjacentSurface, model::Space adjacentSpace, model::ThermalZone adjacentZone);
 
 private:
+  struct SurfaceSnapshot;
+
   ProgressBar* m_progressBar;
   StringStreamLogSink m_logSink;
+  const SurfaceSnapshot *m_current;
 
   REGISTER_LOGGER("openstudio.airflow.SurfaceNetworkBuilder");
 };
@@ -0,0 +1,160 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2017, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "AirflowFixture.hpp"
+
+#include "../contam/SimFile.hpp"
+
+#include "../../utilities/core/Filesystem.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+
+TEST_F(AirflowFixture, SimFile_Read) {
+  {
+    openstudio::filesystem::ofstream lfr(openstudio::toPath("SimFile_Read.lfr"));
+    ASSERT_TRUE(lfr.is_open());
+    lfr << "day\ttime\tpath\tdP\tFlow0\tFlow1\n";
+    lfr << "1/1\t00:00:00\t1\t1.0\t1.0\t0.0\n";
+    lfr << "1/1\t00:00:00\t5\t-2.0\t0.0\t-1.0\n";
+    lfr << "1/1\t01:00:00\t1\t2.0\t2.0\t0.0\r\n";
+    lfr << "1/1\t01:00:00\t5\t-4.0\t0.0\t-2.0\r\n";
+    lfr << "1/1\t02:00:00\t1\t4.0\t4.0\t1.0\n";
+    lfr << "1/1\t02:00:00\t5\t-8.0\t0.0\t-4.0\n";
+  }
+  {
+    openstudio::filesystem::ofstream nfr(openstudio::toPath("SimFile_Read.nfr"));
+    ASSERT_TRUE(nfr.is_open());
+    nfr << "day\ttime\tnode\tT\tP\tD\n";
+    nfr << "1/1\t00:00:00\t0\t273.15\t0.0\t-\n";
+    nfr << "1/1\t00:00:00\t1\t293.15\t1.0\t1.2\n";
+    nfr << "1/1\t01:00:00\t0\t275.15\t0.0\t-\n";
+    nfr << "1/1\t01:00:00\t1\t295.15\t2.0\t1.2\n";
+    nfr << "1/1\t02:00:00\t0\t277.15\t0.0\t-\n";
+    nfr << "1/1\t02:00:00\t1\t297.15\t3.0\t1.2\n";
+  }
+
+  openstudio::contam::SimFile sim(openstudio::toPath("SimFile_Read.sim"));
+
+  ASSERT_EQ(3, sim.fileDateTimes().size());
+  ASSERT_EQ(2, sim.dateTimes().size());
+  EXPECT_EQ(openstudio::DateTime(openstudio::Date(openstudio::MonthOfYear::Jan, 1), openstudio::Time(0, 1)),
+    sim.dateTimes()[0]);
+  EXPECT_EQ(openstudio::DateTime(openstudio::Date(openstudio::MonthOfYear::Jan, 1), openstudio::Time(0, 2)),
+    sim.dateTimes()[1]);
+
+  ASSERT_EQ(2, sim.pathNrs().size());
+  EXPECT_EQ(1, sim.pathNrs()[0]);
+  EXPECT_EQ(5, sim.pathNrs()[1]);
+  ASSERT_EQ(2, sim.dP().size());
+  EXPECT_EQ(3, sim.dP()[1].size());
+  EXPECT_DOUBLE_EQ(-8.0, sim.dP()[1][2]);
+
+  boost::optional<openstudio::TimeSeries> flow = sim.pathFlow(1);
+  ASSERT_TRUE(flow);
+  ASSERT_EQ(2, flow->values().size());
+  EXPECT_DOUBLE_EQ(1.5, flow->values()[0]);
+  EXPECT_DOUBLE_EQ(3.5, flow->values()[1]);
+  boost::optional<openstudio::TimeSeries> dP = sim.pathDeltaP(5);
+  ASSERT_TRUE(dP);
+  EXPECT_DOUBLE_EQ(-6.0, dP->values()[1]);
+  EXPECT_FALSE(sim.pathFlow(2));
+
+  ASSERT_EQ(2, sim.nodeNrs().size());
+  boost::optional<openstudio::TimeSeries> temperature = sim.nodeTemperature(1);
+  ASSERT_TRUE(temperature);
+  EXPECT_DOUBLE_EQ(294.15, temperature->values()[0]);
+  // The ambient node density is not a number
+  boost::optional<openstudio::TimeSeries> density = sim.nodeDensity(0);
+  ASSERT_TRUE(density);
+  EXPECT_DOUBLE_EQ(0.0, density->values()[1]);
+}
+
+TEST_F(AirflowFixture, SimFile_ReadBad) {
+  {
+    openstudio::filesystem::ofstream lfr(openstudio::toPath("SimFile_ReadBad.lfr"));
+    ASSERT_TRUE(lfr.is_open());
+    lfr << "day\ttime\tpath\tdP\tFlow0\tFlow1\n";
+    lfr << "1/1\t00:00:00\t1\t1.0\t1.0\t0.0\n";
+    lfr << "1/1\t01:00:00\t1\tbad\t2.0\t0.0\n";
+  }
+
+  openstudio::contam::SimFile sim(openstudio::toPath("SimFile_ReadBad.sim"));
+  EXPECT_TRUE(sim.pathNrs().empty());
+  EXPECT_TRUE(sim.dP().empty());
+  EXPECT_FALSE(sim.pathFlow(1));
+}
+
+TEST_F(AirflowFixture, DISABLED_SimFile_Benchmark) {
+  // An annual simulation with 5 minute time steps
+  int npaths = 20;
+  int nsteps = 365*24*12 + 1;
+  {
+    openstudio::filesystem::ofstream lfr(openstudio::toPath("SimFile_Benchmark.lfr"));
+    ASSERT_TRUE(lfr.is_open());
+    lfr << "day\ttime\tpath\tdP\tFlow0\tFlow1\n";
+    int days[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    int month = 1;
+    int day = 1;
+    int minutes = 0;
+    char time[16];
+    for(int i = 0; i < nsteps; i++) {
+      snprintf(time, sizeof(time), "%02d:%02d:00", minutes / 60, minutes % 60);
+      for(int j = 1; j <= npaths; j++) {
+        lfr << month << '/' << day << '\t' << time << '\t' << j << '\t' << 0.01*j << '\t' << 1.0e-3*i << '\t'
+          << -1.0e-4*j << '\n';
+      }
+      minutes += 5;
+      if(minutes == 24*60 && i < nsteps - 2) {
+        minutes = 0;
+        if(++day > days[month - 1]) {
+          day = 1;
+          ++month;
+        }
+      }
+    }
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  openstudio::contam::SimFile sim(openstudio::toPath("SimFile_Benchmark.sim"));
+  auto loaded = std::chrono::steady_clock::now();
+  ASSERT_EQ(npaths, sim.pathNrs().size());
+  ASSERT_EQ(nsteps, sim.fileDateTimes().size());
+
+  for(int j = 1; j <= npaths; j++) {
+    EXPECT_TRUE(sim.pathFlow(j));
+  }
+  auto converted = std::chrono::steady_clock::now();
+
+  std::cout << "Loaded " << npaths << " paths by " << nsteps << " times in "
+    << std::chrono::duration<double, std::milli>(loaded - start).count() << " ms" << std::endl;
+  std::cout << "Converted flows in " << std::chrono::duration<double, std::milli>(converted - loaded).count()
+    << " ms" << std::endl;
+}
@@ -36,16 +36,23 @@
 #include "../../model/Space_Impl.hpp"
 #include "../../model/SpaceType.hpp"
 #include "../../model/Surface.hpp"
+#include "../../model/Surface_Impl.hpp"
 #include "../../model/SubSurface.hpp"
 #include "../../model/ThermalZone.hpp"
 #include "../../model/ThermalZone_Impl.hpp"
+#include "../../model/BuildingStory.hpp"
 #include "../../osversion/VersionTranslator.hpp"
 #include "../../utilities/idf/Handle.hpp"
+#include "../../utilities/geometry/Point3d.hpp"
 
 #include "DemoModel.hpp"
 
 #include <resources.hxx>
 
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
 class SurfaceCounter : public openstudio::airflow::SurfaceNetworkBuilder
 {
 public:
@@ -60,17 +67,23 @@ public:
     interiorSubSurface = 0;
     exteriorSurface = 0;
     exteriorSubSurface = 0;
+    maxGeometryError = 0.0;
   }
 
   int interiorSurface;
   int exteriorSurface;
   int interiorSubSurface;
   int exteriorSubSurface;
+  double maxGeometryError;
 
 protected:
   virtual bool linkExteriorSurface(openstudio::model::ThermalZone zone, openstudio::model::Space space, openstudio::model::Surface surface) override
   {
     exteriorSurface++;
+    openstudio::airflow::SurfaceGeometry geometry = surfaceGeometry(surface);
+    maxGeometryError = std::max(maxGeometryError, std::abs(geometry.grossArea - surface.grossArea()));
+    maxGeometryError = std::max(maxGeometryError, std::abs(geometry.azimuth - surface.azimuth()));
+    maxGeometryError = std::max(maxGeometryError, std::abs(geometry.tilt - surface.tilt()));
     return true;
   }
   virtual bool linkExteriorSubSurface(openstudio::model::ThermalZone zone, openstudio::model::Space space, openstudio::model::Surface surface, openstudio::model::SubSurface subSurface) override
@@ -82,6 +95,8 @@ protected:
     openstudio::model::Surface adjacentSurface, openstudio::model::Space adjacentSpace, openstudio::model::ThermalZone adjacentZone) override
   {
     interiorSurface++;
+    maxGeometryError = std::max(maxGeometryError,
+      std::abs(surfaceGeometry(adjacentSurface).grossArea - adjacentSurface.grossArea()));
     return true;
   }
   virtual bool linkInteriorSubSurface(openstudio::model::ThermalZone zone, openstudio::model::Space space, openstudio::model::Surface surface, openstudio::model::SubSurface subSurface,
@@ -134,4 +149,63 @@ TEST_F(AirflowFixture, SurfaceNetworkBuilder_DemoModel_2014)
   EXPECT_EQ(12, counter.exteriorSurface);
   EXPECT_EQ(3, counter.interiorSubSurface);
   EXPECT_EQ(28, counter.exteriorSubSurface);
-}
\ No newline at end of file
+  EXPECT_GT(1.0e-9, counter.maxGeometryError);
+}
+
+// Build a tower with a 2x2 grid of zones on each story
+static openstudio::model::Model buildTower(int nstories)
+{
+  openstudio::model::Model model;
+  double floorHeight = 3.5;
+  double width = 10.0;
+  std::vector<openstudio::model::Space> spaces;
+  for(int k = 0; k < nstories; k++) {
+    double z = k*floorHeight;
+    openstudio::model::BuildingStory story(model);
+    story.setNominalZCoordinate(z);
+    std::vector<openstudio::model::Space> storySpaces;
+    for(int i = 0; i < 2; i++) {
+      for(int j = 0; j < 2; j++) {
+        std::vector<openstudio::Point3d> points;
+        points.push_back(openstudio::Point3d(i*width, (j+1)*width, z));
+        points.push_back(openstudio::Point3d((i+1)*width, (j+1)*width, z));
+        points.push_back(openstudio::Point3d((i+1)*width, j*width, z));
+        points.push_back(openstudio::Point3d(i*width, j*width, z));
+        boost::optional<openstudio::model::Space> space = openstudio::model::Space::fromFloorPrint(points, floorHeight, model);
+        openstudio::model::ThermalZone zone(model);
+        space->setThermalZone(zone);
+        space->setBuildingStory(story);
+        storySpaces.push_back(*space);
+      }
+    }
+    if(!spaces.empty()) {
+      // Match against the story below
+      storySpaces.insert(storySpaces.end(), spaces.end() - 4, spaces.end());
+    }
+    openstudio::model::matchSurfaces(storySpaces);
+    spaces.insert(spaces.end(), storySpaces.begin(), storySpaces.begin() + 4);
+  }
+  for(openstudio::model::Surface surface : model.getConcreteModelObjects<openstudio::model::Surface>()) {
+    if(surface.outsideBoundaryCondition() == "Outdoors" && surface.surfaceType() == "Wall") {
+      surface.setWindowToWallRatio(0.4);
+    }
+  }
+  return model;
+}
+
+TEST_F(AirflowFixture, DISABLED_SurfaceNetworkBuilder_Benchmark)
+{
+  openstudio::model::Model model = buildTower(50);
+
+  SurfaceCounter counter;
+  auto start = std::chrono::steady_clock::now();
+  counter.build(model);
+  auto end = std::chrono::steady_clock::now();
+
+  // Eight exterior walls on every story and the four roofs of the top story
+  EXPECT_EQ(50*8 + 4, counter.exteriorSurface);
+  EXPECT_GT(1.0e-9, counter.maxGeometryError);
+
+  std::cout << "Surface network for " << model.getConcreteModelObjects<openstudio::model::Surface>().size()
+    << " surfaces: " << std::chrono::duration<double, std::milli>(end - start).count() << " ms" << std::endl;
+}
@@ -175,6 +175,9 @@ void ForwardTranslator::clear()
   m_pathMap = QMap <std::string, int>();
   m_surfaceMap = std::map <Handle, int>();
   m_ahsMap = QMap <Handle, int>();
+  m_zones.clear();
+  m_levels.clear();
+  m_wPmod = 0.0;
   m_leakageDescriptor = boost::optional<std::string>("Average");
   m_returnSupplyRatio = 1.0;
   m_ratioOverride = false;
@@ -203,7 +206,7 @@ int ForwardTranslator::tableLookup(QMap<Handle,int> map, Handle handle, const ch
   return nr;
 }
 
-int ForwardTranslator::tableLookup(std::map<Handle,int> map, Handle handle, const char *name)
+int ForwardTranslator::tableLookup(const std::map<Handle,int> &map, const Handle &handle, const char *name)
 {
   std::map<Handle,int>::const_iterator iter = map.find(handle);
   int nr = 0;
@@ -611,8 +614,14 @@ boost::optional<contam::IndexModel> ForwardTranslator::translateModel(model::Mod
   initProgress(surfaces.size(), "Translating Surfaces");
 
   nr = 0;
-  // Loop over surfaces and generate paths
+  // Loop over surfaces and generate paths. The zones, levels and wind pressure modifier
+  // are fixed while this is done, so look them up once rather than once per surface.
+  m_zones = m_prjModel.zones();
+  m_levels = m_prjModel.levels();
+  m_wPmod = openstudio::wind::pressureModifier(openstudio::wind::Default, m_prjModel.wind_H());
   build(model);
+  m_zones.clear();
+  m_levels.clear();
 
   if(m_translateHVAC) {
     // Generate air handling systems
@@ -988,26 +997,26 @@ bool ForwardTranslator::linkExteriorSurface(openstudio::model::ThermalZone zone,
     // Maybe this needs a warning?
     return false;
   }
-  contam::Zone airflowZone = m_prjModel.zones()[zoneNr - 1];
+  contam::Zone airflowZone = m_zones[zoneNr - 1];
+  airflow::SurfaceGeometry geometry = surfaceGeometry(surface);
+  if (!geometry.valid) {
+    LOG(Error, "Unable to compute the orientation of surface '" << surface.name().get() << "'");
+    return false;
+  }
   // Get the surface area - will need to do more work here later if large openings are present
-  double area = surface.grossArea();
+  double area = geometry.grossArea;
   std::string type = surface.surfaceType();
-  double averageZ = 0;
-  double numVertices = surface.vertices().size();
-  for(const Point3d& point : surface.vertices()) {
-    averageZ += point.z();
-  }
   // Now set the path info
-  path.setRelHt(averageZ / numVertices - m_prjModel.levels()[airflowZone.pl() - 1].refht());
+  path.setRelHt(geometry.averageZ - m_levels[airflowZone.pl() - 1].refht());
   path.setPld(airflowZone.pl());
   path.setMult(area);
   // Make an exterior flow path
   path.setPzn(airflowZone.nr());
   path.setPzm(-1);
   // Set the wind-related stuff here
-  path.setWazm(openstudio::radToDeg(surface.azimuth()));
+  path.setWazm(openstudio::radToDeg(geometry.azimuth));
   path.setWindPressure(true);
-  path.setWPmod(openstudio::wind::pressureModifier(openstudio::wind::Default, m_prjModel.wind_H()));
+  path.setWPmod(m_wPmod);
   path.setPw(4); // Assume standard template
   // Set flow element
   if (type == "RoofCeiling") {
@@ -1032,17 +1041,13 @@ bool ForwardTranslator::linkInteriorSurface(openstudio::model::ThermalZone zone,
     // Maybe this needs a warning?
     return false;
   }
-  contam::Zone airflowZone = m_prjModel.zones()[zoneNr - 1];
+  contam::Zone airflowZone = m_zones[zoneNr - 1];
+  airflow::SurfaceGeometry geometry = surfaceGeometry(surface);
   // Get the surface area - will need to do more work here later if large openings are present
-  double area = 0.5*(surface.grossArea() + adjacentSurface.grossArea());
+  double area = 0.5*(geometry.grossArea + surfaceGeometry(adjacentSurface).grossArea);
   std::string type = surface.surfaceType();
-  double averageZ = 0;
-  double numVertices = surface.vertices().size();
-  for(const Point3d& point : surface.vertices()) {
-    averageZ += point.z();
-  }
   // Now set the path info
-  path.setRelHt(averageZ / numVertices - m_prjModel.levels()[airflowZone.pl() - 1].refht());
+  path.setRelHt(geometry.averageZ - m_levels[airflowZone.pl() - 1].refht());
   path.setPld(airflowZone.pl());
   path.setMult(area);
 
@@ -205,11 +205,15 @@ private:
   // Really need to look at these and determine if they are really needed
   int tableLookup(QMap<std::string,int> map, std::string str, const char *name);
   int tableLookup(QMap<Handle,int> map, Handle handle, const char *name);
-  int tableLookup(std::map<Handle,int> map, Handle handle, const char *name);
+  int tableLookup(const std::map<Handle,int> &map, const Handle &handle, const char *name);
   std::string reverseLookup(QMap<std::string,int> map, int nr, const char *name);
   Handle reverseLookup(QMap<Handle,int> map, int nr, const char *name);
 
   contam::IndexModel m_prjModel;
+  // The zones, levels and wind pressure modifier of m_prjModel, only valid while building the surface network
+  std::vector<contam::Zone> m_zones;
+  std::vector<contam::Level> m_levels;
+  double m_wPmod;
 
   // Maps - will be populated after a call of translateModel
   // All map to the CONTAM index (1,2,...,nElement)
@@ -106,13 +106,13 @@ void PlrOrfImpl::read(Reader &input)
   std::string dataType = input.readString(); // Should really check this
   setName(input.readString());
   setDesc(input.readLine());
-  setLam(input.readNumber<std::string>());
-  setTurb(input.readNumber<std::string>());
-  setExpt(input.readNumber<std::string>());
-  setArea(input.readNumber<std::string>());
-  setDia(input.readNumber<std::string>());
-  setCoef(input.readNumber<std::string>());
-  setRe(input.readNumber<std::string>());
+  setLam(input.readNumber<PRJFLOAT>());
+  setTurb(input.readNumber<PRJFLOAT>());
+  setExpt(input.readNumber<PRJFLOAT>());
+  setArea(input.readNumber<PRJFLOAT>());
+  setDia(input.readNumber<PRJFLOAT>());
+  setCoef(input.readNumber<PRJFLOAT>());
+  setRe(input.readNumber<PRJFLOAT>());
   setU_A(input.read<int>());
   setU_D(input.read<int>());
 }
@@ -130,13 +130,13 @@ std::string PlrOrfImpl::write()
 
 void PlrOrfImpl::readDetails(Reader &input)
 {
-  setLam(input.readNumber<std::string>());
-  setTurb(input.readNumber<std::string>());
-  setExpt(input.readNumber<std::string>());
-  setArea(input.readNumber<std::string>());
-  setDia(input.readNumber<std::string>());
-  setCoef(input.readNumber<std::string>());
-  setRe(input.readNumber<std::string>());
+  setLam(input.readNumber<PRJFLOAT>());
+  setTurb(input.readNumber<PRJFLOAT>());
+  setExpt(input.readNumber<PRJFLOAT>());
+  setArea(input.readNumber<PRJFLOAT>());
+  setDia(input.readNumber<PRJFLOAT>());
+  setCoef(input.readNumber<PRJFLOAT>());
+  setRe(input.readNumber<PRJFLOAT>());
   setU_A(input.read<int>());
   setU_D(input.read<int>());
 }
@@ -188,7 +188,7 @@ double PlrOrfImpl::lam() const
 
 bool PlrOrfImpl::setLam(const double lam)
 {
-  m_lam = QString::number(lam);
+  m_lam = lam;
   return true;
 }
 
@@ -204,6 +204,11 @@ bool PlrOrfImpl::setLam(const std::string &lam)
   return false;
 }
 
+void PlrOrfImpl::setLam(const PRJFLOAT &lam)
+{
+  m_lam = lam;
+}
+
 double PlrOrfImpl::turb() const
 {
   return m_turb.toDouble();
@@ -211,7 +216,7 @@ double PlrOrfImpl::turb() const
 
 bool PlrOrfImpl::setTurb(const double turb)
 {
-  m_turb = QString::number(turb);
+  m_turb = turb;
   return true;
 }
 
@@ -227,6 +232,11 @@ bool PlrOrfImpl::setTurb(const std::string &turb)
   return false;
 }
 
+void PlrOrfImpl::setTurb(const PRJFLOAT &turb)
+{
+  m_turb = turb;
+}
+
 double PlrOrfImpl::expt() const
 {
   return m_expt.toDouble();
@@ -234,7 +244,7 @@ double PlrOrfImpl::expt() const
 
 bool PlrOrfImpl::setExpt(const double expt)
 {
-  m_expt = QString::number(expt);
+  m_expt = expt;
   return true;
 }
 
@@ -250,6 +260,11 @@ bool PlrOrfImpl::setExpt(const std::string &expt)
   return false;
 }
 
+void PlrOrfImpl::setExpt(const PRJFLOAT &expt)
+{
+  m_expt = expt;
+}
+
 double PlrOrfImpl::area() const
 {
   return m_area.toDouble();
@@ -257,7 +272,7 @@ double PlrOrfImpl::area() const
 
 bool PlrOrfImpl::setArea(const double area)
 {
-  m_area = QString::number(area);
+  m_area = area;
   return true;
 }
 
@@ -273,6 +288,11 @@ bool PlrOrfImpl::setArea(const std::string &area)
   return false;
 }
 
+void PlrOrfImpl::setArea(const PRJFLOAT &area)
+{
+  m_area = area;
+}
+
 double PlrOrfImpl::dia() const
 {
   return m_dia.toDouble();
@@ -280,7 +300,7 @@ double PlrOrfImpl::dia() const
 
 bool PlrOrfImpl::setDia(const double dia)
 {
-  m_dia = QString::number(dia);
+  m_dia = dia;
   return true;
 }
 
@@ -296,6 +316,11 @@ bool PlrOrfImpl::setDia(const std::string &dia)
   return false;
 }
 
+void PlrOrfImpl::setDia(const PRJFLOAT &dia)
+{
+  m_dia = dia;
+}
+
 double PlrOrfImpl::coef() const
 {
   return m_coef.toDouble();
@@ -303,7 +328,7 @@ double PlrOrfImpl::coef() const
 
 bool PlrOrfImpl::setCoef(const double coef)
 {
-  m_coef = QString::number(coef);
+  m_coef = coef;
   return true;
 }
 
@@ -319,6 +344,11 @@ bool PlrOrfImpl::setCoef(const std::string &coef)
   return false;
 }
 
+void PlrOrfImpl::setCoef(const PRJFLOAT &coef)
+{
+  m_coef = coef;
+}
+
 double PlrOrfImpl::Re() const
 {
   return m_Re.toDouble();
@@ -326,7 +356,7 @@ double PlrOrfImpl::Re() const
 
 bool PlrOrfImpl::setRe(const double Re)
 {
-  m_Re = QString::number(Re);
+  m_Re = Re;
   return true;
 }
 
@@ -342,6 +372,11 @@ bool PlrOrfImpl::setRe(const std::string &Re)
   return false;
 }
 
+void PlrOrfImpl::setRe(const PRJFLOAT &Re)
+{
+  m_Re = Re;
+}
+
 int PlrOrfImpl::u_A() const
 {
   return m_u_A;
@@ -447,14 +482,14 @@ void PlrLeakImpl::read(Reader &input)
   std::string dataType = input.readString(); // Should really check this
   setName(input.readString());
   setDesc(input.readLine());
-  setLam(input.readNumber<std::string>());
-  setTurb(input.readNumber<std::string>());
-  setExpt(input.readNumber<std::string>());
-  setCoef(input.readNumber<std::string>());
-  setPres(input.readNumber<std::string>());
-  setArea1(input.readNumber<std::string>());
-  setArea2(input.readNumber<std::string>());
-  setArea3(input.readNumber<std::string>());
+  setLam(input.readNumber<PRJFLOAT>());
+  setTurb(input.readNumber<PRJFLOAT>());
+  setExpt(input.readNumber<PRJFLOAT>());
+  setCoef(input.readNumber<PRJFLOAT>());
+  setPres(input.readNumber<PRJFLOAT>());
+  setArea1(input.readNumber<PRJFLOAT>());
+  setArea2(input.readNumber<PRJFLOAT>());
+  setArea3(input.readNumber<PRJFLOAT>());
   setU_A1(input.read<int>());
   setU_A2(input.read<int>());
   setU_A3(input.read<int>());
@@ -475,14 +510,14 @@ std::string PlrLeakImpl::write(std::string datatype)
 
 void PlrLeakImpl::readDetails(Reader &input)
 {
-  setLam(input.readNumber<std::string>());
-  setTurb(input.readNumber<std::string>());
-  setExpt(input.readNumber<std::string>());
-  setCoef(input.readNumber<std::string>());
-  setPres(input.readNumber<std::string>());
-  setArea1(input.readNumber<std::string>());
-  setArea2(input.readNumber<std::string>());
-  setArea3(input.readNumber<std::string>());
+  setLam(input.readNumber<PRJFLOAT>());
+  setTurb(input.readNumber<PRJFLOAT>());
+  setExpt(input.readNumber<PRJFLOAT>());
+  setCoef(input.readNumber<PRJFLOAT>());
+  setPres(input.readNumber<PRJFLOAT>());
+  setArea1(input.readNumber<PRJFLOAT>());
+  setArea2(input.readNumber<PRJFLOAT>());
+  setArea3(input.readNumber<PRJFLOAT>());
   setU_A1(input.read<int>());
   setU_A2(input.read<int>());
   setU_A3(input.read<int>());
@@ -536,7 +571,7 @@ double PlrLeakImpl::lam() const
 
 bool PlrLeakImpl::setLam(const double lam)
 {
-  m_lam = QString::number(lam);
+  m_lam = lam;
   return true;
 }
 
@@ -552,6 +587,11 @@ bool PlrLeakImpl::setLam(const std::string &lam)
   return false;
 }
 
+void PlrLeakImpl::setLam(const PRJFLOAT &lam)
+{
+  m_lam = lam;
+}
+
 double PlrLeakImpl::turb() const
 {
   return m_turb.toDouble();
@@ -559,7 +599,7 @@ double PlrLeakImpl::turb() const
 
 bool PlrLeakImpl::setTurb(const double turb)
 {
-  m_turb = QString::number(turb);
+  m_turb = turb;
   return true;
 }
 
@@ -575,6 +615,11 @@ bool PlrLeakImpl::setTurb(const std::string &turb)
   return false;
 }
 
+void PlrLeakImpl::setTurb(const PRJFLOAT &turb)
+{
+  m_turb = turb;
+}
+
 double PlrLeakImpl::expt() const
 {
   return m_expt.toDouble();
@@ -582,7 +627,7 @@ double PlrLeakImpl::expt() const
 
 bool PlrLeakImpl::setExpt(const double expt)
 {
-  m_expt = QString::number(expt);
+  m_expt = expt;
   return true;
 }
 
@@ -598,6 +643,11 @@ bool PlrLeakImpl::setExpt(const std::string &expt)
   return false;
 }
 
+void PlrLeakImpl::setExpt(const PRJFLOAT &expt)
+{
+  m_expt = expt;
+}
+
 double PlrLeakImpl::coef() const
 {
   return m_coef.toDouble();
@@ -605,7 +655,7 @@ double PlrLeakImpl::coef() const
 
 bool PlrLeakImpl::setCoef(const double coef)
 {
-  m_coef = QString::number(coef);
+  m_coef = coef;
   return true;
 }
 
@@ -621,6 +671,11 @@ bool PlrLeakImpl::setCoef(const std::string &coef)
   return false;
 }
 
+void PlrLeakImpl::setCoef(const PRJFLOAT &coef)
+{
+  m_coef = coef;
+}
+
 double PlrLeakImpl::pres() const
 {
   return m_pres.toDouble();
@@ -628,7 +683,7 @@ double PlrLeakImpl::pres() const
 
 bool PlrLeakImpl::setPres(const double pres)
 {
-  m_pres = QString::number(pres);
+  m_pres = pres;
   return true;
 }
 
@@ -644,6 +699,11 @@ bool PlrLeakImpl::setPres(const std::string &pres)
   return false;
 }
 
+void PlrLeakImpl::setPres(const PRJFLOAT &pres)
+{
+  m_pres = pres;
+}
+
 double PlrLeakImpl::area1() const
 {
   return m_area1.toDouble();
@@ -651,7 +711,7 @@ double PlrLeakImpl::area1() const
 
 bool PlrLeakImpl::setArea1(const double area1)
 {
-  m_area1 = QString::number(area1);
+  m_area1 = area1;
   return true;
 }
 
@@ -667,6 +727,11 @@ bool PlrLeakImpl::setArea1(const std::string &area1)
   return false;
 }
 
+void PlrLeakImpl::setArea1(const PRJFLOAT &area1)
+{
+  m_area1 = area1;
+}
+
 double PlrLeakImpl::area2() const
 {
   return m_area2.toDouble();
@@ -674,7 +739,7 @@ double PlrLeakImpl::area2() const
 
 bool PlrLeakImpl::setArea2(const double area2)
 {
-  m_area2 = QString::number(area2);
+  m_area2 = area2;
   return true;
 }
 
@@ -690,6 +755,11 @@ bool PlrLeakImpl::setArea2(const std::string &area2)
   return false;
 }
 
+void PlrLeakImpl::setArea2(const PRJFLOAT &area2)
+{
+  m_area2 = area2;
+}
+
 double PlrLeakImpl::area3() const
 {
   return m_area3.toDouble();
@@ -697,7 +767,7 @@ double PlrLeakImpl::area3() const
 
 bool PlrLeakImpl::setArea3(const double area3)
 {
-  m_area3 = QString::number(area3);
+  m_area3 = area3;
   return true;
 }
 
@@ -713,6 +783,11 @@ bool PlrLeakImpl::setArea3(const std::string &area3)
   return false;
 }
 
+void PlrLeakImpl::setArea3(const PRJFLOAT &area3)
+{
+  m_area3 = area3;
+}
+
 int PlrLeakImpl::u_A1() const
 {
   return m_u_A1;
@@ -818,11 +893,11 @@ void PlrConnImpl::read(Reader &input)
   std::string dataType = input.readString(); // Should really check this
   setName(input.readString());
   setDesc(input.readLine());
-  setLam(input.readNumber<std::string>());
-  setTurb(input.readNumber<std::string>());
-  setExpt(input.readNumber<std::string>());
-  setArea(input.readNumber<std::string>());
-  setCoef(input.readNumber<std::string>());
+  setLam(input.readNumber<PRJFLOAT>());
+  setTurb(input.readNumber<PRJFLOAT>());
+  setExpt(input.readNumber<PRJFLOAT>());
+  setArea(input.readNumber<PRJFLOAT>());
+  setCoef(input.readNumber<PRJFLOAT>());
   setU_A(input.read<int>());
 }
 
@@ -838,11 +913,11 @@ std::string PlrConnImpl::write()
 
 void PlrConnImpl::readDetails(Reader &input)
 {
-  setLam(input.readNumber<std::string>());
-  setTurb(input.readNumber<std::string>());
-  setExpt(input.readNumber<std::string>());
-  setArea(input.readNumber<std::string>());
-  setCoef(input.readNumber<std::string>());
+  setLam(input.readNumber<PRJFLOAT>());
+  setTurb(input.readNumber<PRJFLOAT>());
+  setExpt(input.readNumber<PRJFLOAT>());
+  setArea(input.readNumber<PRJFLOAT>());
+  setCoef(input.readNumber<PRJFLOAT>());
   setU_A(input.read<int>());
 }
 
@@ -893,7 +968,7 @@ double PlrConnImpl::lam() const
 
 bool PlrConnImpl::setLam(const double lam)
 {
-  m_lam = QString::number(lam);
+  m_lam = lam;
   return true;
 }
 
@@ -909,6 +984,11 @@ bool PlrConnImpl::setLam(const std::string &lam)
   return false;
 }
 
+void PlrConnImpl::setLam(const PRJFLOAT &lam)
+{
+  m_lam = lam;
+}
+
 double PlrConnImpl::turb() const
 {
   return m_turb.toDouble();
@@ -916,7 +996,7 @@ double PlrConnImpl::turb() const
 
 bool PlrConnImpl::setTurb(const double turb)
 {
-  m_turb = QString::number(turb);
+  m_turb = turb;
   return true;
 }
 
@@ -932,6 +1012,11 @@ bool PlrConnImpl::setTurb(const std::string &turb)
   return false;
 }
 
+void PlrConnImpl::setTurb(const PRJFLOAT &turb)
+{
+  m_turb = turb;
+}
+
 double PlrConnImpl::expt() const
 {
   return m_expt.toDouble();
@@ -939,7 +1024,7 @@ double PlrConnImpl::expt() const
 
 bool PlrConnImpl::setExpt(const double expt)
 {
-  m_expt = QString::number(expt);
+  m_expt = expt;
   return true;
 }
 
@@ -955,6 +1040,11 @@ bool PlrConnImpl::setExpt(const std::string &expt)
   return false;
 }
 
+void PlrConnImpl::setExpt(const PRJFLOAT &expt)
+{
+  m_expt = expt;
+}
+
 double PlrConnImpl::area() const
 {
   return m_area.toDouble();
@@ -962,7 +1052,7 @@ double PlrConnImpl::area() const
 
 bool PlrConnImpl::setArea(const double area)
 {
-  m_area = QString::number(area);
+  m_area = area;
   return true;
 }
 
@@ -978,6 +1068,11 @@ bool PlrConnImpl::setArea(const std::string &area)
   return false;
 }
 
+void PlrConnImpl::setArea(const PRJFLOAT &area)
+{
+  m_area = area;
+}
+
 double PlrConnImpl::coef() const
 {
   return m_coef.toDouble();
@@ -985,7 +1080,7 @@ double PlrConnImpl::coef() const
 
 bool PlrConnImpl::setCoef(const double coef)
 {
-  m_coef = QString::number(coef);
+  m_coef = coef;
   return true;
 }
 
@@ -1001,6 +1096,11 @@ bool PlrConnImpl::setCoef(const std::string &coef)
   return false;
 }
 
+void PlrConnImpl::setCoef(const PRJFLOAT &coef)
+{
+  m_coef = coef;
+}
+
 int PlrConnImpl::u_A() const
 {
   return m_u_A;
@@ -1065,9 +1165,9 @@ void PlrGeneralImpl::read(Reader &input)
   std::string dataType = input.readString(); // Should really check this
   setName(input.readString());
   setDesc(input.readLine());
-  setLam(input.readNumber<std::string>());
-  setTurb(input.readNumber<std::string>());
-  setExpt(input.readNumber<std::string>());
+  setLam(input.readNumber<PRJFLOAT>());
+  setTurb(input.readNumber<PRJFLOAT>());
+  setExpt(input.readNumber<PRJFLOAT>());
 }
 
 std::string PlrGeneralImpl::write(std::string dataType)
@@ -1081,9 +1181,9 @@ std::string PlrGeneralImpl::write(std::string dataType)
 
 void PlrGeneralImpl::readDetails(Reader &input)
 {
-  setLam(input.readNumber<std::string>());
-  setTurb(input.readNumber<std::string>());
-  setExpt(input.readNumber<std::string>());
+  setLam(input.readNumber<PRJFLOAT>());
+  setTurb(input.readNumber<PRJFLOAT>());
+  setExpt(input.readNumber<PRJFLOAT>());
 }
 
 int PlrGeneralImpl::nr() const
@@ -1133,7 +1233,7 @@ double PlrGeneralImpl::lam() const
 
 bool PlrGeneralImpl::setLam(const double lam)
 {
-  m_lam = QString::number(lam);
+  m_lam = lam;
   return true;
 }
 
@@ -1149,6 +1249,11 @@ bool PlrGeneralImpl::setLam(const std::string &lam)
   return false;
 }
 
+void PlrGeneralImpl::setLam(const PRJFLOAT &lam)
+{
+  m_lam = lam;
+}
+
 double PlrGeneralImpl::turb() const
 {
   return m_turb.toDouble();
@@ -1156,7 +1261,7 @@ double PlrGeneralImpl::turb() const
 
 bool PlrGeneralImpl::setTurb(const double turb)
 {
-  m_turb = QString::number(turb);
+  m_turb = turb;
   return true;
 }
 
@@ -1172,6 +1277,11 @@ bool PlrGeneralImpl::setTurb(const std::string &turb)
   return false;
 }
 
+void PlrGeneralImpl::setTurb(const PRJFLOAT &turb)
+{
+  m_turb = turb;
+}
+
 double PlrGeneralImpl::expt() const
 {
   return m_expt.toDouble();
@@ -1179,7 +1289,7 @@ double PlrGeneralImpl::expt() const
 
 bool PlrGeneralImpl::setExpt(const double expt)
 {
-  m_expt = QString::number(expt);
+  m_expt = expt;
   return true;
 }
 
@@ -1195,6 +1305,11 @@ bool PlrGeneralImpl::setExpt(const std::string &expt)
   return false;
 }
 
+void PlrGeneralImpl::setExpt(const PRJFLOAT &expt)
+{
+  m_expt = expt;
+}
+
 void PlrTest1Impl::setDefaults()
 {
   m_nr = 0;
@@ -1263,11 +1378,11 @@ void PlrTest1Impl::read(Reader &input)
   std::string dataType = input.readString(); // Should really check this
   setName(input.readString());
   setDesc(input.readLine());
-  setLam(input.readNumber<std::string>());
-  setTurb(input.readNumber<std::string>());
-  setExpt(input.readNumber<std::string>());
-  setDP(input.readNumber<std::string>());
-  setFlow(input.readNumber<std::string>());
+  setLam(input.readNumber<PRJFLOAT>());
+  setTurb(input.readNumber<PRJFLOAT>());
+  setExpt(input.readNumber<PRJFLOAT>());
+  setDP(input.readNumber<PRJFLOAT>());
+  setFlow(input.readNumber<PRJFLOAT>());
   setU_P(input.read<int>());
   setU_F(input.read<int>());
 }
@@ -1285,11 +1400,11 @@ std::string PlrTest1Impl::write()
 
 void PlrTest1Impl::readDetails(Reader &input)
 {
-  setLam(input.readNumber<std::string>());
-  setTurb(input.readNumber<std::string>());
-  setExpt(input.readNumber<std::string>());
-  setDP(input.readNumber<std::string>());
-  setFlow(input.readNumber<std::string>());
+  setLam(input.readNumber<PRJFLOAT>());
+  setTurb(input.readNumber<PRJFLOAT>());
+  setExpt(input.readNumber<PRJFLOAT>());
+  setDP(input.readNumber<PRJFLOAT>());
+  setFlow(input.readNumber<PRJFLOAT>());
   setU_P(input.read<int>());
   setU_F(input.read<int>());
 }
@@ -1341,7 +1456,7 @@ double PlrTest1Impl::lam() const
 
 bool PlrTest1Impl::setLam(const double lam)
 {
-  m_lam = QString::number(lam);
+  m_lam = lam;
   return true;
 }
 
@@ -1357,6 +1472,11 @@ bool PlrTest1Impl::setLam(const std::string &lam)
   return false;
 }
 
+void PlrTest1Impl::setLam(const PRJFLOAT &lam)
+{
+  m_lam = lam;
+}
+
 double PlrTest1Impl::turb() const
 {
   return m_turb.toDouble();
@@ -1364,7 +1484,7 @@ double PlrTest1Impl::turb() const
 
 bool PlrTest1Impl::setTurb(const double turb)
 {
-  m_turb = QString::number(turb);
+  m_turb = turb;
   return true;
 }
 
@@ -1380,6 +1500,11 @@ bool PlrTest1Impl::setTurb(const std::string &turb)
   return false;
 }
 
+void PlrTest1Impl::setTurb(const PRJFLOAT &turb)
+{
+  m_turb = turb;
+}
+
 double PlrTest1Impl::expt() const
 {
   return m_expt.toDouble();
@@ -1387,7 +1512,7 @@ double PlrTest1Impl::expt() const
 
 bool PlrTest1Impl::setExpt(const double expt)
 {
-  m_expt = QString::number(expt);
+  m_expt = expt;
   return true;
 }
 
@@ -1403,6 +1528,11 @@ bool PlrTest1Impl::setExpt(const std::string &expt)
   return false;
 }
 
+void PlrTest1Impl::setExpt(const PRJFLOAT &expt)
+{
+  m_expt = expt;
+}
+
 double PlrTest1Impl::dP() const
 {
   return m_dP.toDouble();
@@ -1410,7 +1540,7 @@ double PlrTest1Impl::dP() const
 
 bool PlrTest1Impl::setDP(const double dP)
 {
-  m_dP = QString::number(dP);
+  m_dP = dP;
   return true;
 }
 
@@ -1426,6 +1556,11 @@ bool PlrTest1Impl::setDP(const std::string &dP)
   return false;
 }
 
+void PlrTest1Impl::setDP(const PRJFLOAT &dP)
+{
+  m_dP = dP;
+}
+
 double PlrTest1Impl::Flow() const
 {
   return m_Flow.toDouble();
@@ -1433,7 +1568,7 @@ double PlrTest1Impl::Flow() const
 
 bool PlrTest1Impl::setFlow(const double Flow)
 {
-  m_Flow = QString::number(Flow);
+  m_Flow = Flow;
   return true;
 }
 
@@ -1449,6 +1584,11 @@ bool PlrTest1Impl::setFlow(const std::string &Flow)
   return false;
 }
 
+void PlrTest1Impl::setFlow(const PRJFLOAT &Flow)
+{
+  m_Flow = Flow;
+}
+
 int PlrTest1Impl::u_P() const
 {
   return m_u_P;
@@ -1549,13 +1689,13 @@ void PlrTest2Impl::read(Reader &input)
   std::string dataType = input.readString(); // Should really check this
   setName(input.readString());
   setDesc(input.readLine());
-  setLam(input.readNumber<std::string>());
-  setTurb(input.readNumber<std::string>());
-  setExpt(input.readNumber<std::string>());
-  setDP1(input.readNumber<std::string>());
-  setF1(input.readNumber<std::string>());
-  setDP2(input.readNumber<std::string>());
-  setF2(input.readNumber<std::string>());
+  setLam(input.readNumber<PRJFLOAT>());
+  setTurb(input.readNumber<PRJFLOAT>());
+  setExpt(input.readNumber<PRJFLOAT>());
+  setDP1(input.readNumber<PRJFLOAT>());
+  setF1(input.readNumber<PRJFLOAT>());
+  setDP2(input.readNumber<PRJFLOAT>());
+  setF2(input.readNumber<PRJFLOAT>());
   setU_P1(input.read<int>());
   setU_F1(input.read<int>());
   setU_P2(input.read<int>());
@@ -1576,13 +1716,13 @@ std::string PlrTest2Impl::write()
 
 void PlrTest2Impl::readDetails(Reader &input)
 {
-  setLam(input.readNumber<std::string>());
-  setTurb(input.readNumber<std::string>());
-  setExpt(input.readNumber<std::string>());
-  setDP1(input.readNumber<std::string>());
-  setF1(input.readNumber<std::string>());
-  setDP2(input.readNumber<std::string>());
-  setF2(input.readNumber<std::string>());
+  setLam(input.readNumber<PRJFLOAT>());
+  setTurb(input.readNumber<PRJFLOAT>());
+  setExpt(input.readNumber<PRJFLOAT>());
+  setDP1(input.readNumber<PRJFLOAT>());
+  setF1(input.readNumber<PRJFLOAT>());
+  setDP2(input.readNumber<PRJFLOAT>());
+  setF2(input.readNumber<PRJFLOAT>());
   setU_P1(input.read<int>());
   setU_F1(input.read<int>());
   setU_P2(input.read<int>());
@@ -1636,7 +1776,7 @@ double PlrTest2Impl::lam() const
 
 bool PlrTest2Impl::setLam(const double lam)
 {
-  m_lam = QString::number(lam);
+  m_lam = lam;
   return true;
 }
 
@@ -1652,6 +1792,11 @@ bool PlrTest2Impl::setLam(const std::string &lam)
   return false;
 }
 
+void PlrTest2Impl::setLam(const PRJFLOAT &lam)
+{
+  m_lam = lam;
+}
+
 double PlrTest2Impl::turb() const
 {
   return m_turb.toDouble();
@@ -1659,7 +1804,7 @@ double PlrTest2Impl::turb() const
 
 bool PlrTest2Impl::setTurb(const double turb)
 {
-  m_turb = QString::number(turb);
+  m_turb = turb;
   return true;
 }
 
@@ -1675,6 +1820,11 @@ bool PlrTest2Impl::setTurb(const std::string &turb)
   return false;
 }
 
+void PlrTest2Impl::setTurb(const PRJFLOAT &turb)
+{
+  m_turb = turb;
+}
+
 double PlrTest2Impl::expt() const
 {
   return m_expt.toDouble();
@@ -1682,7 +1832,7 @@ double PlrTest2Impl::expt() const
 
 bool PlrTest2Impl::setExpt(const double expt)
 {
-  m_expt = QString::number(expt);
+  m_expt = expt;
   return true;
 }
 
@@ -1698,6 +1848,11 @@ bool PlrTest2Impl::setExpt(const std::string &expt)
   return false;
 }
 
+void PlrTest2Impl::setExpt(const PRJFLOAT &expt)
+{
+  m_expt = expt;
+}
+
 double PlrTest2Impl::dP1() const
 {
   return m_dP1.toDouble();
@@ -1705,7 +1860,7 @@ double PlrTest2Impl::dP1() const
 
 bool PlrTest2Impl::setDP1(const double dP1)
 {
-  m_dP1 = QString::number(dP1);
+  m_dP1 = dP1;
   return true;
 }
 
@@ -1721,6 +1876,11 @@ bool PlrTest2Impl::setDP1(const std::string &dP1)
   return false;
 }
 
+void PlrTest2Impl::setDP1(const PRJFLOAT &dP1)
+{
+  m_dP1 = dP1;
+}
+
 double PlrTest2Impl::F1() const
 {
   return m_F1.toDouble();
@@ -1728,7 +1888,7 @@ double PlrTest2Impl::F1() const
 
 bool PlrTest2Impl::setF1(const double F1)
 {
-  m_F1 = QString::number(F1);
+  m_F1 = F1;
   return true;
 }
 
@@ -1744,6 +1904,11 @@ bool PlrTest2Impl::setF1(const std::string &F1)
   return false;
 }
 
+void PlrTest2Impl::setF1(const PRJFLOAT &F1)
+{
+  m_F1 = F1;
+}
+
 double PlrTest2Impl::dP2() const
 {
   return m_dP2.toDouble();
@@ -1751,7 +1916,7 @@ double PlrTest2Impl::dP2() const
 
 bool PlrTest2Impl::setDP2(const double dP2)
 {
-  m_dP2 = QString::number(dP2);
+  m_dP2 = dP2;
   return true;
 }
 
@@ -1767,6 +1932,11 @@ bool PlrTest2Impl::setDP2(const std::string &dP2)
   return false;
 }
 
+void PlrTest2Impl::setDP2(const PRJFLOAT &dP2)
+{
+  m_dP2 = dP2;
+}
+
 double PlrTest2Impl::F2() const
 {
   return m_F2.toDouble();
@@ -1774,7 +1944,7 @@ double PlrTest2Impl::F2() const
 
 bool PlrTest2Impl::setF2(const double F2)
 {
-  m_F2 = QString::number(F2);
+  m_F2 = F2;
   return true;
 }
 
@@ -1790,6 +1960,11 @@ bool PlrTest2Impl::setF2(const std::string &F2)
   return false;
 }
 
+void PlrTest2Impl::setF2(const PRJFLOAT &F2)
+{
+  m_F2 = F2;
+}
+
 int PlrTest2Impl::u_P1() const
 {
   return m_u_P1;
@@ -1898,11 +2073,11 @@ void PlrCrackImpl::read(Reader &input)
   std::string dataType = input.readString(); // Should really check this
   setName(input.readString());
   setDesc(input.readLine());
-  setLam(input.readNumber<std::string>());
-  setTurb(input.readNumber<std::string>());
-  setExpt(input.readNumber<std::string>());
-  setLength(input.readNumber<std::string>());
-  setWidth(input.readNumber<std::string>());
+  setLam(input.readNumber<PRJFLOAT>());
+  setTurb(input.readNumber<PRJFLOAT>());
+  setExpt(input.readNumber<PRJFLOAT>());
+  setLength(input.readNumber<PRJFLOAT>());
+  setWidth(input.readNumber<PRJFLOAT>());
   setU_L(input.read<int>());
   setU_W(input.read<int>());
 }
@@ -1920,11 +2095,11 @@ std::string PlrCrackImpl::write()
 
 void PlrCrackImpl::readDetails(Reader &input)
 {
-  setLam(input.readNumber<std::string>());
-  setTurb(input.readNumber<std::string>());
-  setExpt(input.readNumber<std::string>());
-  setLength(input.readNumber<std::string>());
-  setWidth(input.readNumber<std::string>());
+  setLam(input.readNumber<PRJFLOAT>());
+  setTurb(input.readNumber<PRJFLOAT>());
+  setExpt(input.readNumber<PRJFLOAT>());
+  setLength(input.readNumber<PRJFLOAT>());
+  setWidth(input.readNumber<PRJFLOAT>());
   setU_L(input.read<int>());
   setU_W(input.read<int>());
 }
@@ -1976,7 +2151,7 @@ double PlrCrackImpl::lam() const
 
 bool PlrCrackImpl::setLam(const double lam)
 {
-  m_lam = QString::number(lam);
+  m_lam = lam;
   return true;
 }
 
@@ -1992,6 +2167,11 @@ bool PlrCrackImpl::setLam(const std::string &lam)
   return false;
 }
 
+void PlrCrackImpl::setLam(const PRJFLOAT &lam)
+{
+  m_lam = lam;
+}
+
 double PlrCrackImpl::turb() const
 {
   return m_turb.toDouble();
@@ -1999,7 +2179,7 @@ double PlrCrackImpl::turb() const
 
 bool PlrCrackImpl::setTurb(const double turb)
 {
-  m_turb = QString::number(turb);
+  m_turb = turb;
   return true;
 }
 
@@ -2015,6 +2195,11 @@ bool PlrCrackImpl::setTurb(const std::string &turb)
   return false;
 }
 
+void PlrCrackImpl::setTurb(const PRJFLOAT &turb)
+{
+  m_turb = turb;
+}
+
 double PlrCrackImpl::expt() const
 {
   return m_expt.toDouble();
@@ -2022,7 +2207,7 @@ double PlrCrackImpl::expt() const
 
 bool PlrCrackImpl::setExpt(const double expt)
 {
-  m_expt = QString::number(expt);
+  m_expt = expt;
   return true;
 }
 
@@ -2038,6 +2223,11 @@ bool PlrCrackImpl::setExpt(const std::string &expt)
   return false;
 }
 
+void PlrCrackImpl::setExpt(const PRJFLOAT &expt)
+{
+  m_expt = expt;
+}
+
 double PlrCrackImpl::length() const
 {
   return m_length.toDouble();
@@ -2045,7 +2235,7 @@ double PlrCrackImpl::length() const
 
 bool PlrCrackImpl::setLength(const double length)
 {
-  m_length = QString::number(length);
+  m_length = length;
   return true;
 }
 
@@ -2061,6 +2251,11 @@ bool PlrCrackImpl::setLength(const std::string &length)
   return false;
 }
 
+void PlrCrackImpl::setLength(const PRJFLOAT &length)
+{
+  m_length = length;
+}
+
 double PlrCrackImpl::width() const
 {
   return m_width.toDouble();
@@ -2068,7 +2263,7 @@ double PlrCrackImpl::width() const
 
 bool PlrCrackImpl::setWidth(const double width)
 {
-  m_width = QString::number(width);
+  m_width = width;
   return true;
 }
 
@@ -2084,6 +2279,11 @@ bool PlrCrackImpl::setWidth(const std::string &width)
   return false;
 }
 
+void PlrCrackImpl::setWidth(const PRJFLOAT &width)
+{
+  m_width = width;
+}
+
 int PlrCrackImpl::u_L() const
 {
   return m_u_L;
@@ -2181,12 +2381,12 @@ void PlrStairImpl::read(Reader &input)
   std::string dataType = input.readString(); // Should really check this
   setName(input.readString());
   setDesc(input.readLine());
-  setLam(input.readNumber<std::string>());
-  setTurb(input.readNumber<std::string>());
-  setExpt(input.readNumber<std::string>());
-  setHt(input.readNumber<std::string>());
-  setArea(input.readNumber<std::string>());
-  setPeople(input.readNumber<std::string>());
+  setLam(input.readNumber<PRJFLOAT>());
+  setTurb(input.readNumber<PRJFLOAT>());
+  setExpt(input.readNumber<PRJFLOAT>());
+  setHt(input.readNumber<PRJFLOAT>());
+  setArea(input.readNumber<PRJFLOAT>());
+  setPeople(input.readNumber<PRJFLOAT>());
   setTread(input.read<int>());
   setU_A(input.read<int>());
   setU_D(input.read<int>());
@@ -2205,12 +2405,12 @@ std::string PlrStairImpl::write()
 
 void PlrStairImpl::readDetails(Reader &input)
 {
-  setLam(input.readNumber<std::string>());
-  setTurb(input.readNumber<std::string>());
-  setExpt(input.readNumber<std::string>());
-  setHt(input.readNumber<std::string>());
-  setArea(input.readNumber<std::string>());
-  setPeople(input.readNumber<std::string>());
+  setLam(input.readNumber<PRJFLOAT>());
+  setTurb(input.readNumber<PRJFLOAT>());
+  setExpt(input.readNumber<PRJFLOAT>());
+  setHt(input.readNumber<PRJFLOAT>());
+  setArea(input.readNumber<PRJFLOAT>());
+  setPeople(input.readNumber<PRJFLOAT>());
   setTread(input.read<int>());
   setU_A(input.read<int>());
   setU_D(input.read<int>());
@@ -2263,7 +2463,7 @@ double PlrStairImpl::lam() const
 
 bool PlrStairImpl::setLam(const double lam)
 {
-  m_lam = QString::number(lam);
+  m_lam = lam;
   return true;
 }
 
@@ -2279,6 +2479,11 @@ bool PlrStairImpl::setLam(const std::string &lam)
   return false;
 }
 
+void PlrStairImpl::setLam(const PRJFLOAT &lam)
+{
+  m_lam = lam;
+}
+
 double PlrStairImpl::turb() const
 {
   return m_turb.toDouble();
@@ -2286,7 +2491,7 @@ double PlrStairImpl::turb() const
 
 bool PlrStairImpl::setTurb(const double turb)
 {
-  m_turb = QString::number(turb);
+  m_turb = turb;
   return true;
 }
 
@@ -2302,6 +2507,11 @@ bool PlrStairImpl::setTurb(const std::string &turb)
   return false;
 }
 
+void PlrStairImpl::setTurb(const PRJFLOAT &turb)
+{
+  m_turb = turb;
+}
+
 double PlrStairImpl::expt() const
 {
   return m_expt.toDouble();
@@ -2309,7 +2519,7 @@ double PlrStairImpl::expt() const
 
 bool PlrStairImpl::setExpt(const double expt)
 {
-  m_expt = QString::number(expt);
+  m_expt = expt;
   return true;
 }
 
@@ -2325,6 +2535,11 @@ bool PlrStairImpl::setExpt(const std::string &expt)
   return false;
 }
 
+void PlrStairImpl::setExpt(const PRJFLOAT &expt)
+{
+  m_expt = expt;
+}
+
 double PlrStairImpl::Ht() const
 {
   return m_Ht.toDouble();
@@ -2332,7 +2547,7 @@ double PlrStairImpl::Ht() const
 
 bool PlrStairImpl::setHt(const double Ht)
 {
-  m_Ht = QString::number(Ht);
+  m_Ht = Ht;
   return true;
 }
 
@@ -2348,6 +2563,11 @@ bool PlrStairImpl::setHt(const std::string &Ht)
   return false;
 }
 
+void PlrStairImpl::setHt(const PRJFLOAT &Ht)
+{
+  m_Ht = Ht;
+}
+
 double PlrStairImpl::area() const
 {
   return m_Area.toDouble();
@@ -2355,7 +2575,7 @@ double PlrStairImpl::area() const
 
 bool PlrStairImpl::setArea(const double Area)
 {
-  m_Area = QString::number(Area);
+  m_Area = Area;
   return true;
 }
 
@@ -2371,6 +2591,11 @@ bool PlrStairImpl::setArea(const std::string &Area)
   return false;
 }
 
+void PlrStairImpl::setArea(const PRJFLOAT &Area)
+{
+  m_Area = Area;
+}
+
 double PlrStairImpl::people() const
 {
   return m_peo.toDouble();
@@ -2378,7 +2603,7 @@ double PlrStairImpl::people() const
 
 bool PlrStairImpl::setPeople(const double peo)
 {
-  m_peo = QString::number(peo);
+  m_peo = peo;
   return true;
 }
 
@@ -2394,6 +2619,11 @@ bool PlrStairImpl::setPeople(const std::string &peo)
   return false;
 }
 
+void PlrStairImpl::setPeople(const PRJFLOAT &peo)
+{
+  m_peo = peo;
+}
+
 int PlrStairImpl::tread() const
 {
   return m_tread;
@@ -2504,13 +2734,13 @@ void PlrShaftImpl::read(Reader &input)
   std::string dataType = input.readString(); // Should really check this
   setName(input.readString());
   setDesc(input.readLine());
-  setLam(input.readNumber<std::string>());
-  setTurb(input.readNumber<std::string>());
-  setExpt(input.readNumber<std::string>());
-  setHt(input.readNumber<std::string>());
-  setArea(input.readNumber<std::string>());
-  setPerim(input.readNumber<std::string>());
-  setRough(input.readNumber<std::string>());
+  setLam(input.readNumber<PRJFLOAT>());
+  setTurb(input.readNumber<PRJFLOAT>());
+  setExpt(input.readNumber<PRJFLOAT>());
+  setHt(input.readNumber<PRJFLOAT>());
+  setArea(input.readNumber<PRJFLOAT>());
+  setPerim(input.readNumber<PRJFLOAT>());
+  setRough(input.readNumber<PRJFLOAT>());
   setU_A(input.read<int>());
   setU_D(input.read<int>());
   setU_P(input.read<int>());
@@ -2531,13 +2761,13 @@ std::string PlrShaftImpl::write()
 
 void PlrShaftImpl::readDetails(Reader &input)
 {
-  setLam(input.readNumber<std::string>());
-  setTurb(input.readNumber<std::string>());
-  setExpt(input.readNumber<std::string>());
-  setHt(input.readNumber<std::string>());
-  setArea(input.readNumber<std::string>());
-  setPerim(input.readNumber<std::string>());
-  setRough(input.readNumber<std::string>());
+  setLam(input.readNumber<PRJFLOAT>());
+  setTurb(input.readNumber<PRJFLOAT>());
+  setExpt(input.readNumber<PRJFLOAT>());
+  setHt(input.readNumber<PRJFLOAT>());
+  setArea(input.readNumber<PRJFLOAT>());
+  setPerim(input.readNumber<PRJFLOAT>());
+  setRough(input.readNumber<PRJFLOAT>());
   setU_A(input.read<int>());
   setU_D(input.read<int>());
   setU_P(input.read<int>());
@@ -2591,7 +2821,7 @@ double PlrShaftImpl::lam() const
 
 bool PlrShaftImpl::setLam(const double lam)
 {
-  m_lam = QString::number(lam);
+  m_lam = lam;
   return true;
 }
 
@@ -2607,6 +2837,11 @@ bool PlrShaftImpl::setLam(const std::string &lam)
   return false;
 }
 
+void PlrShaftImpl::setLam(const PRJFLOAT &lam)
+{
+  m_lam = lam;
+}
+
 double PlrShaftImpl::turb() const
 {
   return m_turb.toDouble();
@@ -2614,7 +2849,7 @@ double PlrShaftImpl::turb() const
 
 bool PlrShaftImpl::setTurb(const double turb)
 {
-  m_turb = QString::number(turb);
+  m_turb = turb;
   return true;
 }
 
@@ -2630,6 +2865,11 @@ bool PlrShaftImpl::setTurb(const std::string &turb)
   return false;
 }
 
+void PlrShaftImpl::setTurb(const PRJFLOAT &turb)
+{
+  m_turb = turb;
+}
+
 double PlrShaftImpl::expt() const
 {
   return m_expt.toDouble();
@@ -2637,7 +2877,7 @@ double PlrShaftImpl::expt() const
 
 bool PlrShaftImpl::setExpt(const double expt)
 {
-  m_expt = QString::number(expt);
+  m_expt = expt;
   return true;
 }
 
@@ -2653,6 +2893,11 @@ bool PlrShaftImpl::setExpt(const std::string &expt)
   return false;
 }
 
+void PlrShaftImpl::setExpt(const PRJFLOAT &expt)
+{
+  m_expt = expt;
+}
+
 double PlrShaftImpl::Ht() const
 {
   return m_Ht.toDouble();
@@ -2660,7 +2905,7 @@ double PlrShaftImpl::Ht() const
 
 bool PlrShaftImpl::setHt(const double Ht)
 {
-  m_Ht = QString::number(Ht);
+  m_Ht = Ht;
   return true;
 }
 
@@ -2676,6 +2921,11 @@ bool PlrShaftImpl::setHt(const std::string &Ht)
   return false;
 }
 
+void PlrShaftImpl::setHt(const PRJFLOAT &Ht)
+{
+  m_Ht = Ht;
+}
+
 double PlrShaftImpl::area() const
 {
   return m_area.toDouble();
@@ -2683,7 +2933,7 @@ double PlrShaftImpl::area() const
 
 bool PlrShaftImpl::setArea(const double area)
 {
-  m_area = QString::number(area);
+  m_area = area;
   return true;
 }
 
@@ -2699,6 +2949,11 @@ bool PlrShaftImpl::setArea(const std::string &area)
   return false;
 }
 
+void PlrShaftImpl::setArea(const PRJFLOAT &area)
+{
+  m_area = area;
+}
+
 double PlrShaftImpl::perim() const
 {
   return m_perim.toDouble();
@@ -2706,7 +2961,7 @@ double PlrShaftImpl::perim() const
 
 bool PlrShaftImpl::setPerim(const double perim)
 {
-  m_perim = QString::number(perim);
+  m_perim = perim;
   return true;
 }
 
@@ -2722,6 +2977,11 @@ bool PlrShaftImpl::setPerim(const std::string &perim)
   return false;
 }
 
+void PlrShaftImpl::setPerim(const PRJFLOAT &perim)
+{
+  m_perim = perim;
+}
+
 double PlrShaftImpl::rough() const
 {
   return m_rough.toDouble();
@@ -2729,7 +2989,7 @@ double PlrShaftImpl::rough() const
 
 bool PlrShaftImpl::setRough(const double rough)
 {
-  m_rough = QString::number(rough);
+  m_rough = rough;
   return true;
 }
 
@@ -2745,6 +3005,11 @@ bool PlrShaftImpl::setRough(const std::string &rough)
   return false;
 }
 
+void PlrShaftImpl::setRough(const PRJFLOAT &rough)
+{
+  m_rough = rough;
+}
+
 int PlrShaftImpl::u_A() const
 {
   return m_u_A;
@@ -2847,11 +3112,11 @@ void PlrBackDamperImpl::read(Reader &input)
   std::string dataType = input.readString(); // Should really check this
   setName(input.readString());
   setDesc(input.readLine());
-  setLam(input.readNumber<std::string>());
-  setCp(input.readNumber<std::string>());
-  setXp(input.readNumber<std::string>());
-  setCn(input.readNumber<std::string>());
-  setXn(input.readNumber<std::string>());
+  setLam(input.readNumber<PRJFLOAT>());
+  setCp(input.readNumber<PRJFLOAT>());
+  setXp(input.readNumber<PRJFLOAT>());
+  setCn(input.readNumber<PRJFLOAT>());
+  setXn(input.readNumber<PRJFLOAT>());
 }
 
 std::string PlrBackDamperImpl::write(std::string dataType)
@@ -2866,11 +3131,11 @@ std::string PlrBackDamperImpl::write(std::string dataType)
 
 void PlrBackDamperImpl::readDetails(Reader &input)
 {
-  setLam(input.readNumber<std::string>());
-  setCp(input.readNumber<std::string>());
-  setXp(input.readNumber<std::string>());
-  setCn(input.readNumber<std::string>());
-  setXn(input.readNumber<std::string>());
+  setLam(input.readNumber<PRJFLOAT>());
+  setCp(input.readNumber<PRJFLOAT>());
+  setXp(input.readNumber<PRJFLOAT>());
+  setCn(input.readNumber<PRJFLOAT>());
+  setXn(input.readNumber<PRJFLOAT>());
 }
 
 int PlrBackDamperImpl::nr() const
@@ -2920,7 +3185,7 @@ double PlrBackDamperImpl::lam() const
 
 bool PlrBackDamperImpl::setLam(const double lam)
 {
-  m_lam = QString::number(lam);
+  m_lam = lam;
   return true;
 }
 
@@ -2936,6 +3201,11 @@ bool PlrBackDamperImpl::setLam(const std::string &lam)
   return false;
 }
 
+void PlrBackDamperImpl::setLam(const PRJFLOAT &lam)
+{
+  m_lam = lam;
+}
+
 double PlrBackDamperImpl::Cp() const
 {
   return m_Cp.toDouble();
@@ -2943,7 +3213,7 @@ double PlrBackDamperImpl::Cp() const
 
 bool PlrBackDamperImpl::setCp(const double Cp)
 {
-  m_Cp = QString::number(Cp);
+  m_Cp = Cp;
   return true;
 }
 
@@ -2959,6 +3229,11 @@ bool PlrBackDamperImpl::setCp(const std::string &Cp)
   return false;
 }
 
+void PlrBackDamperImpl::setCp(const PRJFLOAT &Cp)
+{
+  m_Cp = Cp;
+}
+
 double PlrBackDamperImpl::xp() const
 {
   return m_xp.toDouble();
@@ -2966,7 +3241,7 @@ double PlrBackDamperImpl::xp() const
 
 bool PlrBackDamperImpl::setXp(const double xp)
 {
-  m_xp = QString::number(xp);
+  m_xp = xp;
   return true;
 }
 
@@ -2982,6 +3257,11 @@ bool PlrBackDamperImpl::setXp(const std::string &xp)
   return false;
 }
 
+void PlrBackDamperImpl::setXp(const PRJFLOAT &xp)
+{
+  m_xp = xp;
+}
+
 double PlrBackDamperImpl::Cn() const
 {
   return m_Cn.toDouble();
@@ -2989,7 +3269,7 @@ double PlrBackDamperImpl::Cn() const
 
 bool PlrBackDamperImpl::setCn(const double Cn)
 {
-  m_Cn = QString::number(Cn);
+  m_Cn = Cn;
   return true;
 }
 
@@ -3005,6 +3285,11 @@ bool PlrBackDamperImpl::setCn(const std::string &Cn)
   return false;
 }
 
+void PlrBackDamperImpl::setCn(const PRJFLOAT &Cn)
+{
+  m_Cn = Cn;
+}
+
 double PlrBackDamperImpl::xn() const
 {
   return m_xn.toDouble();
@@ -3012,7 +3297,7 @@ double PlrBackDamperImpl::xn() const
 
 bool PlrBackDamperImpl::setXn(const double xn)
 {
-  m_xn = QString::number(xn);
+  m_xn = xn;
   return true;
 }
 
@@ -3028,6 +3313,11 @@ bool PlrBackDamperImpl::setXn(const std::string &xn)
   return false;
 }
 
+void PlrBackDamperImpl::setXn(const PRJFLOAT &xn)
+{
+  m_xn = xn;
+}
+
 void QfrQuadraticImpl::setDefaults()
 {
   m_nr = 0;
@@ -3079,8 +3369,8 @@ void QfrQuadraticImpl::read(Reader &input)
   std::string dataType = input.readString(); // Should really check this
   setName(input.readString());
   setDesc(input.readLine());
-  setA(input.readNumber<std::string>());
-  setB(input.readNumber<std::string>());
+  setA(input.readNumber<PRJFLOAT>());
+  setB(input.readNumber<PRJFLOAT>());
 }
 
 std::string QfrQuadraticImpl::write(std::string dataType)
@@ -3094,8 +3384,8 @@ std::string QfrQuadraticImpl::write(std::string dataType)
 
 void QfrQuadraticImpl::readDetails(Reader &input)
 {
-  setA(input.readNumber<std::string>());
-  setB(input.readNumber<std::string>());
+  setA(input.readNumber<PRJFLOAT>());
+  setB(input.readNumber<PRJFLOAT>());
 }
 
 int QfrQuadraticImpl::nr() const
@@ -3145,7 +3435,7 @@ double QfrQuadraticImpl::a() const
 
 bool QfrQuadraticImpl::setA(const double a)
 {
-  m_a = QString::number(a);
+  m_a = a;
   return true;
 }
 
@@ -3161,6 +3451,11 @@ bool QfrQuadraticImpl::setA(const std::string &a)
   return false;
 }
 
+void QfrQuadraticImpl::setA(const PRJFLOAT &a)
+{
+  m_a = a;
+}
+
 double QfrQuadraticImpl::b() const
 {
   return m_b.toDouble();
@@ -3168,7 +3463,7 @@ double QfrQuadraticImpl::b() const
 
 bool QfrQuadraticImpl::setB(const double b)
 {
-  m_b = QString::number(b);
+  m_b = b;
   return true;
 }
 
@@ -3184,6 +3479,11 @@ bool QfrQuadraticImpl::setB(const std::string &b)
   return false;
 }
 
+void QfrQuadraticImpl::setB(const PRJFLOAT &b)
+{
+  m_b = b;
+}
+
 void QfrCrackImpl::setDefaults()
 {
   m_nr = 0;
@@ -3258,11 +3558,11 @@ void QfrCrackImpl::read(Reader &input)
   std::string dataType = input.readString(); // Should really check this
   setName(input.readString());
   setDesc(input.readLine());
-  setA(input.readNumber<std::string>());
-  setB(input.readNumber<std::string>());
-  setLength(input.readNumber<std::string>());
-  setWidth(input.readNumber<std::string>());
-  setDepth(input.readNumber<std::string>());
+  setA(input.readNumber<PRJFLOAT>());
+  setB(input.readNumber<PRJFLOAT>());
+  setLength(input.readNumber<PRJFLOAT>());
+  setWidth(input.readNumber<PRJFLOAT>());
+  setDepth(input.readNumber<PRJFLOAT>());
   setNB(input.read<int>());
   setU_L(input.read<int>());
   setU_W(input.read<int>());
@@ -3282,11 +3582,11 @@ std::string QfrCrackImpl::write()
 
 void QfrCrackImpl::readDetails(Reader &input)
 {
-  setA(input.readNumber<std::string>());
-  setB(input.readNumber<std::string>());
-  setLength(input.readNumber<std::string>());
-  setWidth(input.readNumber<std::string>());
-  setDepth(input.readNumber<std::string>());
+  setA(input.readNumber<PRJFLOAT>());
+  setB(input.readNumber<PRJFLOAT>());
+  setLength(input.readNumber<PRJFLOAT>());
+  setWidth(input.readNumber<PRJFLOAT>());
+  setDepth(input.readNumber<PRJFLOAT>());
   setNB(input.read<int>());
   setU_L(input.read<int>());
   setU_W(input.read<int>());
@@ -3340,7 +3640,7 @@ double QfrCrackImpl::a() const
 
 bool QfrCrackImpl::setA(const double a)
 {
-  m_a = QString::number(a);
+  m_a = a;
   return true;
 }
 
@@ -3356,6 +3656,11 @@ bool QfrCrackImpl::setA(const std::string &a)
   return false;
 }
 
+void QfrCrackImpl::setA(const PRJFLOAT &a)
+{
+  m_a = a;
+}
+
 double QfrCrackImpl::b() const
 {
   return m_b.toDouble();
@@ -3363,7 +3668,7 @@ double QfrCrackImpl::b() const
 
 bool QfrCrackImpl::setB(const double b)
 {
-  m_b = QString::number(b);
+  m_b = b;
   return true;
 }
 
@@ -3379,6 +3684,11 @@ bool QfrCrackImpl::setB(const std::string &b)
   return false;
 }
 
+void QfrCrackImpl::setB(const PRJFLOAT &b)
+{
+  m_b = b;
+}
+
 double QfrCrackImpl::length() const
 {
   return m_length.toDouble();
@@ -3386,7 +3696,7 @@ double QfrCrackImpl::length() const
 
 bool QfrCrackImpl::setLength(const double length)
 {
-  m_length = QString::number(length);
+  m_length = length;
   return true;
 }
 
@@ -3402,6 +3712,11 @@ bool QfrCrackImpl::setLength(const std::string &length)
   return false;
 }
 
+void QfrCrackImpl::setLength(const PRJFLOAT &length)
+{
+  m_length = length;
+}
+
 double QfrCrackImpl::width() const
 {
   return m_width.toDouble();
@@ -3409,7 +3724,7 @@ double QfrCrackImpl::width() const
 
 bool QfrCrackImpl::setWidth(const double width)
 {
-  m_width = QString::number(width);
+  m_width = width;
   return true;
 }
 
@@ -3425,6 +3740,11 @@ bool QfrCrackImpl::setWidth(const std::string &width)
   return false;
 }
 
+void QfrCrackImpl::setWidth(const PRJFLOAT &width)
+{
+  m_width = width;
+}
+
 double QfrCrackImpl::depth() const
 {
   return m_depth.toDouble();
@@ -3432,7 +3752,7 @@ double QfrCrackImpl::depth() const
 
 bool QfrCrackImpl::setDepth(const double depth)
 {
-  m_depth = QString::number(depth);
+  m_depth = depth;
   return true;
 }
 
@@ -3448,6 +3768,11 @@ bool QfrCrackImpl::setDepth(const std::string &depth)
   return false;
 }
 
+void QfrCrackImpl::setDepth(const PRJFLOAT &depth)
+{
+  m_depth = depth;
+}
+
 int QfrCrackImpl::nB() const
 {
   return m_nB;
@@ -3565,12 +3890,12 @@ void QfrTest2Impl::read(Reader &input)
   std::string dataType = input.readString(); // Should really check this
   setName(input.readString());
   setDesc(input.readLine());
-  setA(input.readNumber<std::string>());
-  setB(input.readNumber<std::string>());
-  setDP1(input.readNumber<std::string>());
-  setF1(input.readNumber<std::string>());
-  setDP2(input.readNumber<std::string>());
-  setF2(input.readNumber<std::string>());
+  setA(input.readNumber<PRJFLOAT>());
+  setB(input.readNumber<PRJFLOAT>());
+  setDP1(input.readNumber<PRJFLOAT>());
+  setF1(input.readNumber<PRJFLOAT>());
+  setDP2(input.readNumber<PRJFLOAT>());
+  setF2(input.readNumber<PRJFLOAT>());
   setU_P1(input.read<int>());
   setU_F1(input.read<int>());
   setU_P2(input.read<int>());
@@ -3590,12 +3915,12 @@ std::string QfrTest2Impl::write()
 
 void QfrTest2Impl::readDetails(Reader &input)
 {
-  setA(input.readNumber<std::string>());
-  setB(input.readNumber<std::string>());
-  setDP1(input.readNumber<std::string>());
-  setF1(input.readNumber<std::string>());
-  setDP2(input.readNumber<std::string>());
-  setF2(input.readNumber<std::string>());
+  setA(input.readNumber<PRJFLOAT>());
+  setB(input.readNumber<PRJFLOAT>());
+  setDP1(input.readNumber<PRJFLOAT>());
+  setF1(input.readNumber<PRJFLOAT>());
+  setDP2(input.readNumber<PRJFLOAT>());
+  setF2(input.readNumber<PRJFLOAT>());
   setU_P1(input.read<int>());
   setU_F1(input.read<int>());
   setU_P2(input.read<int>());
@@ -3649,7 +3974,7 @@ double QfrTest2Impl::a() const
 
 bool QfrTest2Impl::setA(const double a)
 {
-  m_a = QString::number(a);
+  m_a = a;
   return true;
 }
 
@@ -3665,6 +3990,11 @@ bool QfrTest2Impl::setA(const std::string &a)
   return false;
 }
 
+void QfrTest2Impl::setA(const PRJFLOAT &a)
+{
+  m_a = a;
+}
+
 double QfrTest2Impl::b() const
 {
   return m_b.toDouble();
@@ -3672,7 +4002,7 @@ double QfrTest2Impl::b() const
 
 bool QfrTest2Impl::setB(const double b)
 {
-  m_b = QString::number(b);
+  m_b = b;
   return true;
 }
 
@@ -3688,6 +4018,11 @@ bool QfrTest2Impl::setB(const std::string &b)
   return false;
 }
 
+void QfrTest2Impl::setB(const PRJFLOAT &b)
+{
+  m_b = b;
+}
+
 double QfrTest2Impl::dP1() const
 {
   return m_dP1.toDouble();
@@ -3695,7 +4030,7 @@ double QfrTest2Impl::dP1() const
 
 bool QfrTest2Impl::setDP1(const double dP1)
 {
-  m_dP1 = QString::number(dP1);
+  m_dP1 = dP1;
   return true;
 }
 
@@ -3711,6 +4046,11 @@ bool QfrTest2Impl::setDP1(const std::string &dP1)
   return false;
 }
 
+void QfrTest2Impl::setDP1(const PRJFLOAT &dP1)
+{
+  m_dP1 = dP1;
+}
+
 double QfrTest2Impl::F1() const
 {
   return m_F1.toDouble();
@@ -3718,7 +4058,7 @@ double QfrTest2Impl::F1() const
 
 bool QfrTest2Impl::setF1(const double F1)
 {
-  m_F1 = QString::number(F1);
+  m_F1 = F1;
   return true;
 }
 
@@ -3734,6 +4074,11 @@ bool QfrTest2Impl::setF1(const std::string &F1)
   return false;
 }
 
+void QfrTest2Impl::setF1(const PRJFLOAT &F1)
+{
+  m_F1 = F1;
+}
+
 double QfrTest2Impl::dP2() const
 {
   return m_dP2.toDouble();
@@ -3741,7 +4086,7 @@ double QfrTest2Impl::dP2() const
 
 bool QfrTest2Impl::setDP2(const double dP2)
 {
-  m_dP2 = QString::number(dP2);
+  m_dP2 = dP2;
   return true;
 }
 
@@ -3757,6 +4102,11 @@ bool QfrTest2Impl::setDP2(const std::string &dP2)
   return false;
 }
 
+void QfrTest2Impl::setDP2(const PRJFLOAT &dP2)
+{
+  m_dP2 = dP2;
+}
+
 double QfrTest2Impl::F2() const
 {
   return m_F2.toDouble();
@@ -3764,7 +4114,7 @@ double QfrTest2Impl::F2() const
 
 bool QfrTest2Impl::setF2(const double F2)
 {
-  m_F2 = QString::number(F2);
+  m_F2 = F2;
   return true;
 }
 
@@ -3780,6 +4130,11 @@ bool QfrTest2Impl::setF2(const std::string &F2)
   return false;
 }
 
+void QfrTest2Impl::setF2(const PRJFLOAT &F2)
+{
+  m_F2 = F2;
+}
+
 int QfrTest2Impl::u_P1() const
 {
   return m_u_P1;
@@ -3897,13 +4252,13 @@ void AfeDorImpl::read(Reader &input)
   std::string dataType = input.readString(); // Should really check this
   setName(input.readString());
   setDesc(input.readLine());
-  setLam(input.readNumber<std::string>());
-  setTurb(input.readNumber<std::string>());
-  setExpt(input.readNumber<std::string>());
-  setDTmin(input.readNumber<std::string>());
-  setHeight(input.readNumber<std::string>());
-  setWidth(input.readNumber<std::string>());
-  setCd(input.readNumber<std::string>());
+  setLam(input.readNumber<PRJFLOAT>());
+  setTurb(input.readNumber<PRJFLOAT>());
+  setExpt(input.readNumber<PRJFLOAT>());
+  setDTmin(input.readNumber<PRJFLOAT>());
+  setHeight(input.readNumber<PRJFLOAT>());
+  setWidth(input.readNumber<PRJFLOAT>());
+  setCd(input.readNumber<PRJFLOAT>());
   setU_T(input.read<int>());
   setU_H(input.read<int>());
   setU_W(input.read<int>());
@@ -3923,13 +4278,13 @@ std::string AfeDorImpl::write()
 
 void AfeDorImpl::readDetails(Reader &input)
 {
-  setLam(input.readNumber<std::string>());
-  setTurb(input.readNumber<std::string>());
-  setExpt(input.readNumber<std::string>());
-  setDTmin(input.readNumber<std::string>());
-  setHeight(input.readNumber<std::string>());
-  setWidth(input.readNumber<std::string>());
-  setCd(input.readNumber<std::string>());
+  setLam(input.readNumber<PRJFLOAT>());
+  setTurb(input.readNumber<PRJFLOAT>());
+  setExpt(input.readNumber<PRJFLOAT>());
+  setDTmin(input.readNumber<PRJFLOAT>());
+  setHeight(input.readNumber<PRJFLOAT>());
+  setWidth(input.readNumber<PRJFLOAT>());
+  setCd(input.readNumber<PRJFLOAT>());
   setU_T(input.read<int>());
   setU_H(input.read<int>());
   setU_W(input.read<int>());
@@ -3982,7 +4337,7 @@ double AfeDorImpl::lam() const
 
 bool AfeDorImpl::setLam(const double lam)
 {
-  m_lam = QString::number(lam);
+  m_lam = lam;
   return true;
 }
 
@@ -3998,6 +4353,11 @@ bool AfeDorImpl::setLam(const std::string &lam)
   return false;
 }
 
+void AfeDorImpl::setLam(const PRJFLOAT &lam)
+{
+  m_lam = lam;
+}
+
 double AfeDorImpl::turb() const
 {
   return m_turb.toDouble();
@@ -4005,7 +4365,7 @@ double AfeDorImpl::turb() const
 
 bool AfeDorImpl::setTurb(const double turb)
 {
-  m_turb = QString::number(turb);
+  m_turb = turb;
   return true;
 }
 
@@ -4021,6 +4381,11 @@ bool AfeDorImpl::setTurb(const std::string &turb)
   return false;
 }
 
+void AfeDorImpl::setTurb(const PRJFLOAT &turb)
+{
+  m_turb = turb;
+}
+
 double AfeDorImpl::expt() const
 {
   return m_expt.toDouble();
@@ -4028,7 +4393,7 @@ double AfeDorImpl::expt() const
 
 bool AfeDorImpl::setExpt(const double expt)
 {
-  m_expt = QString::number(expt);
+  m_expt = expt;
   return true;
 }
 
@@ -4044,6 +4409,11 @@ bool AfeDorImpl::setExpt(const std::string &expt)
   return false;
 }
 
+void AfeDorImpl::setExpt(const PRJFLOAT &expt)
+{
+  m_expt = expt;
+}
+
 double AfeDorImpl::dTmin() const
 {
   return m_dTmin.toDouble();
@@ -4051,7 +4421,7 @@ double AfeDorImpl::dTmin() const
 
 bool AfeDorImpl::setDTmin(const double dTmin)
 {
-  m_dTmin = QString::number(dTmin);
+  m_dTmin = dTmin;
   return true;
 }
 
@@ -4067,6 +4437,11 @@ bool AfeDorImpl::setDTmin(const std::string &dTmin)
   return false;
 }
 
+void AfeDorImpl::setDTmin(const PRJFLOAT &dTmin)
+{
+  m_dTmin = dTmin;
+}
+
 double AfeDorImpl::height() const
 {
   return m_ht.toDouble();
@@ -4074,7 +4449,7 @@ double AfeDorImpl::height() const
 
 bool AfeDorImpl::setHeight(const double ht)
 {
-  m_ht = QString::number(ht);
+  m_ht = ht;
   return true;
 }
 
@@ -4090,6 +4465,11 @@ bool AfeDorImpl::setHeight(const std::string &ht)
   return false;
 }
 
+void AfeDorImpl::setHeight(const PRJFLOAT &ht)
+{
+  m_ht = ht;
+}
+
 double AfeDorImpl::width() const
 {
   return m_wd.toDouble();
@@ -4097,7 +4477,7 @@ double AfeDorImpl::width() const
 
 bool AfeDorImpl::setWidth(const double wd)
 {
-  m_wd = QString::number(wd);
+  m_wd = wd;
   return true;
 }
 
@@ -4113,6 +4493,11 @@ bool AfeDorImpl::setWidth(const std::string &wd)
   return false;
 }
 
+void AfeDorImpl::setWidth(const PRJFLOAT &wd)
+{
+  m_wd = wd;
+}
+
 double AfeDorImpl::cd() const
 {
   return m_cd.toDouble();
@@ -4120,7 +4505,7 @@ double AfeDorImpl::cd() const
 
 bool AfeDorImpl::setCd(const double cd)
 {
-  m_cd = QString::number(cd);
+  m_cd = cd;
   return true;
 }
 
@@ -4136,6 +4521,11 @@ bool AfeDorImpl::setCd(const std::string &cd)
   return false;
 }
 
+void AfeDorImpl::setCd(const PRJFLOAT &cd)
+{
+  m_cd = cd;
+}
+
 int AfeDorImpl::u_T() const
 {
   return m_u_T;
@@ -4240,13 +4630,13 @@ void DrPl2Impl::read(Reader &input)
   std::string dataType = input.readString(); // Should really check this
   setName(input.readString());
   setDesc(input.readLine());
-  setLam(input.readNumber<std::string>());
-  setTurb(input.readNumber<std::string>());
-  setExpt(input.readNumber<std::string>());
-  setDH(input.readNumber<std::string>());
-  setHeight(input.readNumber<std::string>());
-  setWidth(input.readNumber<std::string>());
-  setCd(input.readNumber<std::string>());
+  setLam(input.readNumber<PRJFLOAT>());
+  setTurb(input.readNumber<PRJFLOAT>());
+  setExpt(input.readNumber<PRJFLOAT>());
+  setDH(input.readNumber<PRJFLOAT>());
+  setHeight(input.readNumber<PRJFLOAT>());
+  setWidth(input.readNumber<PRJFLOAT>());
+  setCd(input.readNumber<PRJFLOAT>());
   setU_H(input.read<int>());
   setU_W(input.read<int>());
 }
@@ -4264,13 +4654,13 @@ std::string DrPl2Impl::write()
 
 void DrPl2Impl::readDetails(Reader &input)
 {
-  setLam(input.readNumber<std::string>());
-  setTurb(input.readNumber<std::string>());
-  setExpt(input.readNumber<std::string>());
-  setDH(input.readNumber<std::string>());
-  setHeight(input.readNumber<std::string>());
-  setWidth(input.readNumber<std::string>());
-  setCd(input.readNumber<std::string>());
+  setLam(input.readNumber<PRJFLOAT>());
+  setTurb(input.readNumber<PRJFLOAT>());
+  setExpt(input.readNumber<PRJFLOAT>());
+  setDH(input.readNumber<PRJFLOAT>());
+  setHeight(input.readNumber<PRJFLOAT>());
+  setWidth(input.readNumber<PRJFLOAT>());
+  setCd(input.readNumber<PRJFLOAT>());
   setU_H(input.read<int>());
   setU_W(input.read<int>());
 }
@@ -4322,7 +4712,7 @@ double DrPl2Impl::lam() const
 
 bool DrPl2Impl::setLam(const double lam)
 {
-  m_lam = QString::number(lam);
+  m_lam = lam;
   return true;
 }
 
@@ -4338,6 +4728,11 @@ bool DrPl2Impl::setLam(const std::string &lam)
   return false;
 }
 
+void DrPl2Impl::setLam(const PRJFLOAT &lam)
+{
+  m_lam = lam;
+}
+
 double DrPl2Impl::turb() const
 {
   return m_turb.toDouble();
@@ -4345,7 +4740,7 @@ double DrPl2Impl::turb() const
 
 bool DrPl2Impl::setTurb(const double turb)
 {
-  m_turb = QString::number(turb);
+  m_turb = turb;
   return true;
 }
 
@@ -4361,6 +4756,11 @@ bool DrPl2Impl::setTurb(const std::string &turb)
   return false;
 }
 
+void DrPl2Impl::setTurb(const PRJFLOAT &turb)
+{
+  m_turb = turb;
+}
+
 double DrPl2Impl::expt() const
 {
   return m_expt.toDouble();
@@ -4368,7 +4768,7 @@ double DrPl2Impl::expt() const
 
 bool DrPl2Impl::setExpt(const double expt)
 {
-  m_expt = QString::number(expt);
+  m_expt = expt;
   return true;
 }
 
@@ -4384,6 +4784,11 @@ bool DrPl2Impl::setExpt(const std::string &expt)
   return false;
 }
 
+void DrPl2Impl::setExpt(const PRJFLOAT &expt)
+{
+  m_expt = expt;
+}
+
 double DrPl2Impl::dH() const
 {
   return m_dH.toDouble();
@@ -4391,7 +4796,7 @@ double DrPl2Impl::dH() const
 
 bool DrPl2Impl::setDH(const double dH)
 {
-  m_dH = QString::number(dH);
+  m_dH = dH;
   return true;
 }
 
@@ -4407,6 +4812,11 @@ bool DrPl2Impl::setDH(const std::string &dH)
   return false;
 }
 
+void DrPl2Impl::setDH(const PRJFLOAT &dH)
+{
+  m_dH = dH;
+}
+
 double DrPl2Impl::height() const
 {
   return m_ht.toDouble();
@@ -4414,7 +4824,7 @@ double DrPl2Impl::height() const
 
 bool DrPl2Impl::setHeight(const double ht)
 {
-  m_ht = QString::number(ht);
+  m_ht = ht;
   return true;
 }
 
@@ -4430,6 +4840,11 @@ bool DrPl2Impl::setHeight(const std::string &ht)
   return false;
 }
 
+void DrPl2Impl::setHeight(const PRJFLOAT &ht)
+{
+  m_ht = ht;
+}
+
 double DrPl2Impl::width() const
 {
   return m_wd.toDouble();
@@ -4437,7 +4852,7 @@ double DrPl2Impl::width() const
 
 bool DrPl2Impl::setWidth(const double wd)
 {
-  m_wd = QString::number(wd);
+  m_wd = wd;
   return true;
 }
 
@@ -4453,6 +4868,11 @@ bool DrPl2Impl::setWidth(const std::string &wd)
   return false;
 }
 
+void DrPl2Impl::setWidth(const PRJFLOAT &wd)
+{
+  m_wd = wd;
+}
+
 double DrPl2Impl::cd() const
 {
   return m_cd.toDouble();
@@ -4460,7 +4880,7 @@ double DrPl2Impl::cd() const
 
 bool DrPl2Impl::setCd(const double cd)
 {
-  m_cd = QString::number(cd);
+  m_cd = cd;
   return true;
 }
 
@@ -4476,6 +4896,11 @@ bool DrPl2Impl::setCd(const std::string &cd)
   return false;
 }
 
+void DrPl2Impl::setCd(const PRJFLOAT &cd)
+{
+  m_cd = cd;
+}
+
 int DrPl2Impl::u_H() const
 {
   return m_u_H;
@@ -4547,7 +4972,7 @@ void AfeFlowImpl::read(Reader &input)
   std::string dataType = input.readString(); // Should really check this
   setName(input.readString());
   setDesc(input.readLine());
-  setFlow(input.readNumber<std::string>());
+  setFlow(input.readNumber<PRJFLOAT>());
   setU_F(input.read<int>());
 }
 
@@ -4562,7 +4987,7 @@ std::string AfeFlowImpl::write(std::string dataType)
 
 void AfeFlowImpl::readDetails(Reader &input)
 {
-  setFlow(input.readNumber<std::string>());
+  setFlow(input.readNumber<PRJFLOAT>());
   setU_F(input.read<int>());
 }
 
@@ -4613,7 +5038,7 @@ double AfeFlowImpl::Flow() const
 
 bool AfeFlowImpl::setFlow(const double Flow)
 {
-  m_Flow = QString::number(Flow);
+  m_Flow = Flow;
   return true;
 }
 
@@ -4629,6 +5054,11 @@ bool AfeFlowImpl::setFlow(const std::string &Flow)
   return false;
 }
 
+void AfeFlowImpl::setFlow(const PRJFLOAT &Flow)
+{
+  m_Flow = Flow;
+}
+
 int AfeFlowImpl::u_F() const
 {
   return m_u_F;
@@ -4719,21 +5149,21 @@ void AfeFanImpl::read(Reader &input)
   std::string dataType = input.readString(); // Should really check this
   setName(input.readString());
   setDesc(input.readLine());
-  setLam(input.readNumber<std::string>());
-  setTurb(input.readNumber<std::string>());
-  setExpt(input.readNumber<std::string>());
-  setRdens(input.readNumber<std::string>());
-  setFdf(input.readNumber<std::string>());
-  setSop(input.readNumber<std::string>());
-  setOff(input.readNumber<std::string>());
-  std::vector<std::string> fpc;
+  setLam(input.readNumber<PRJFLOAT>());
+  setTurb(input.readNumber<PRJFLOAT>());
+  setExpt(input.readNumber<PRJFLOAT>());
+  setRdens(input.readNumber<PRJFLOAT>());
+  setFdf(input.readNumber<PRJFLOAT>());
+  setSop(input.readNumber<PRJFLOAT>());
+  setOff(input.readNumber<PRJFLOAT>());
+  std::vector<PRJFLOAT> fpc;
   for(int i=0;i<4;i++)
   {
-    fpc.push_back(input.read<std::string>());
+    fpc.push_back(input.readNumber<PRJFLOAT>());
   }
   setFpc(fpc);
   int npts = input.read<int>();
-  setSarea(input.readNumber<std::string>());
+  setSarea(input.readNumber<PRJFLOAT>());
   setU_Sa(input.read<int>());
   std::vector<FanDataPoint> data;
   for(int i=0;i<npts;i++)
@@ -4765,21 +5195,21 @@ std::string AfeFanImpl::write()
 
 void AfeFanImpl::readDetails(Reader &input)
 {
-  setLam(input.readNumber<std::string>());
-  setTurb(input.readNumber<std::string>());
-  setExpt(input.readNumber<std::string>());
-  setRdens(input.readNumber<std::string>());
-  setFdf(input.readNumber<std::string>());
-  setSop(input.readNumber<std::string>());
-  setOff(input.readNumber<std::string>());
-  std::vector<std::string> fpc;
+  setLam(input.readNumber<PRJFLOAT>());
+  setTurb(input.readNumber<PRJFLOAT>());
+  setExpt(input.readNumber<PRJFLOAT>());
+  setRdens(input.readNumber<PRJFLOAT>());
+  setFdf(input.readNumber<PRJFLOAT>());
+  setSop(input.readNumber<PRJFLOAT>());
+  setOff(input.readNumber<PRJFLOAT>());
+  std::vector<PRJFLOAT> fpc;
   for(int i=0;i<4;i++)
   {
-    fpc.push_back(input.read<std::string>());
+    fpc.push_back(input.readNumber<PRJFLOAT>());
   }
   setFpc(fpc);
   int npts = input.read<int>();
-  setSarea(input.readNumber<std::string>());
+  setSarea(input.readNumber<PRJFLOAT>());
   setU_Sa(input.read<int>());
   std::vector<FanDataPoint> data;
   for(int i=0;i<npts;i++)
@@ -4838,7 +5268,7 @@ double AfeFanImpl::lam() const
 
 bool AfeFanImpl::setLam(const double lam)
 {
-  m_lam = QString::number(lam);
+  m_lam = lam;
   return true;
 }
 
@@ -4854,6 +5284,11 @@ bool AfeFanImpl::setLam(const std::string &lam)
   return false;
 }
 
+void AfeFanImpl::setLam(const PRJFLOAT &lam)
+{
+  m_lam = lam;
+}
+
 double AfeFanImpl::turb() const
 {
   return m_turb.toDouble();
@@ -4861,7 +5296,7 @@ double AfeFanImpl::turb() const
 
 bool AfeFanImpl::setTurb(const double turb)
 {
-  m_turb = QString::number(turb);
+  m_turb = turb;
   return true;
 }
 
@@ -4877,6 +5312,11 @@ bool AfeFanImpl::setTurb(const std::string &turb)
   return false;
 }
 
+void AfeFanImpl::setTurb(const PRJFLOAT &turb)
+{
+  m_turb = turb;
+}
+
 double AfeFanImpl::expt() const
 {
   return m_expt.toDouble();
@@ -4884,7 +5324,7 @@ double AfeFanImpl::expt() const
 
 bool AfeFanImpl::setExpt(const double expt)
 {
-  m_expt = QString::number(expt);
+  m_expt = expt;
   return true;
 }
 
@@ -4900,6 +5340,11 @@ bool AfeFanImpl::setExpt(const std::string &expt)
   return false;
 }
 
+void AfeFanImpl::setExpt(const PRJFLOAT &expt)
+{
+  m_expt = expt;
+}
+
 double AfeFanImpl::rdens() const
 {
   return m_rdens.toDouble();
@@ -4907,7 +5352,7 @@ double AfeFanImpl::rdens() const
 
 bool AfeFanImpl::setRdens(const double rdens)
 {
-  m_rdens = QString::number(rdens);
+  m_rdens = rdens;
   return true;
 }
 
@@ -4923,6 +5368,11 @@ bool AfeFanImpl::setRdens(const std::string &rdens)
   return false;
 }
 
+void AfeFanImpl::setRdens(const PRJFLOAT &rdens)
+{
+  m_rdens = rdens;
+}
+
 double AfeFanImpl::fdf() const
 {
   return m_fdf.toDouble();
@@ -4930,7 +5380,7 @@ double AfeFanImpl::fdf() const
 
 bool AfeFanImpl::setFdf(const double fdf)
 {
-  m_fdf = QString::number(fdf);
+  m_fdf = fdf;
   return true;
 }
 
@@ -4946,6 +5396,11 @@ bool AfeFanImpl::setFdf(const std::string &fdf)
   return false;
 }
 
+void AfeFanImpl::setFdf(const PRJFLOAT &fdf)
+{
+  m_fdf = fdf;
+}
+
 double AfeFanImpl::sop() const
 {
   return m_sop.toDouble();
@@ -4953,7 +5408,7 @@ double AfeFanImpl::sop() const
 
 bool AfeFanImpl::setSop(const double sop)
 {
-  m_sop = QString::number(sop);
+  m_sop = sop;
   return true;
 }
 
@@ -4969,6 +5424,11 @@ bool AfeFanImpl::setSop(const std::string &sop)
   return false;
 }
 
+void AfeFanImpl::setSop(const PRJFLOAT &sop)
+{
+  m_sop = sop;
+}
+
 double AfeFanImpl::off() const
 {
   return m_off.toDouble();
@@ -4976,7 +5436,7 @@ double AfeFanImpl::off() const
 
 bool AfeFanImpl::setOff(const double off)
 {
-  m_off = QString::number(off);
+  m_off = off;
   return true;
 }
 
@@ -4992,6 +5452,11 @@ bool AfeFanImpl::setOff(const std::string &off)
   return false;
 }
 
+void AfeFanImpl::setOff(const PRJFLOAT &off)
+{
+  m_off = off;
+}
+
 std::vector<double> AfeFanImpl::fpc() const
 {
   std::vector<double> out;
@@ -5006,7 +5471,7 @@ bool AfeFanImpl::setFpc(const std::vector<double> &fpc)
 {
   for(int i=0;i<4;i++)
   {
-    m_fpc.push_back(QString::number(fpc[i]));
+    m_fpc.push_back(fpc[i]);
   }
   return true;
 }
@@ -5028,6 +5493,11 @@ bool AfeFanImpl::setFpc(const std::vector<std::string> &fpc)
   return true;
 }
 
+void AfeFanImpl::setFpc(const std::vector<PRJFLOAT> &fpc)
+{
+  m_fpc = fpc;
+}
+
 double AfeFanImpl::Sarea() const
 {
   return m_Sarea.toDouble();
@@ -5035,7 +5505,7 @@ double AfeFanImpl::Sarea() const
 
 bool AfeFanImpl::setSarea(const double Sarea)
 {
-  m_Sarea = QString::number(Sarea);
+  m_Sarea = Sarea;
   return true;
 }
 
@@ -5051,6 +5521,11 @@ bool AfeFanImpl::setSarea(const std::string &Sarea)
   return false;
 }
 
+void AfeFanImpl::setSarea(const PRJFLOAT &Sarea)
+{
+  m_Sarea = Sarea;
+}
+
 int AfeFanImpl::u_Sa() const
 {
   return m_u_Sa;
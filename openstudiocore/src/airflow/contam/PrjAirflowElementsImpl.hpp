@@ -74,42 +74,56 @@ public:
   bool setLam(const double lam);
   /** Sets the laminar flow coefficient. */
   bool setLam(const std::string &lam);
+  /** Sets the laminar flow coefficient. */
+  void setLam(const PRJFLOAT &lam);
   /** Returns the turbulent flow coefficient. */
   double turb() const;
   /** Sets the turbulent flow coefficient. */
   bool setTurb(const double turb);
   /** Sets the turbulent flow coefficient. */
   bool setTurb(const std::string &turb);
+  /** Sets the turbulent flow coefficient. */
+  void setTurb(const PRJFLOAT &turb);
   /** Returns the pressure exponent. */
   double expt() const;
   /** Sets the pressure exponent. */
   bool setExpt(const double expt);
   /** Sets the pressure exponent. */
   bool setExpt(const std::string &expt);
+  /** Sets the pressure exponent. */
+  void setExpt(const PRJFLOAT &expt);
   /** Returns the actual area [m^2]. */
   double area() const;
   /** Sets the actual area [m^2]. */
   bool setArea(const double area);
   /** Sets the actual area [m^2]. */
   bool setArea(const std::string &area);
+  /** Sets the actual area [m^2]. */
+  void setArea(const PRJFLOAT &area);
   /** Returns the hydraulic diameter [m]. */
   double dia() const;
   /** Sets the hydraulic diameter [m]. */
   bool setDia(const double dia);
   /** Sets the hydraulic diameter [m]. */
   bool setDia(const std::string &dia);
+  /** Sets the hydraulic diameter [m]. */
+  void setDia(const PRJFLOAT &dia);
   /** Returns the flow coefficient. */
   double coef() const;
   /** Sets the flow coefficient. */
   bool setCoef(const double coef);
   /** Sets the flow coefficient. */
   bool setCoef(const std::string &coef);
+  /** Sets the flow coefficient. */
+  void setCoef(const PRJFLOAT &coef);
   /** Returns the laminar/turbulet transition Reynolds number. */
   double Re() const;
   /** Sets the laminar/turbulet transition Reynolds number. */
   bool setRe(const double Re);
   /** Sets the laminar/turbulet transition Reynolds number. */
   bool setRe(const std::string &Re);
+  /** Sets the laminar/turbulet transition Reynolds number. */
+  void setRe(const PRJFLOAT &Re);
   /** Returns the display units for area. */
   int u_A() const;
   /** Sets the display units for area. */
@@ -172,48 +186,64 @@ public:
   bool setLam(const double lam);
   /** Sets the laminar flow coefficient. */
   bool setLam(const std::string &lam);
+  /** Sets the laminar flow coefficient. */
+  void setLam(const PRJFLOAT &lam);
   /** Returns the turbulent flow coefficient. */
   double turb() const;
   /** Sets the turbulent flow coefficient. */
   bool setTurb(const double turb);
   /** Sets the turbulent flow coefficient. */
   bool setTurb(const std::string &turb);
+  /** Sets the turbulent flow coefficient. */
+  void setTurb(const PRJFLOAT &turb);
   /** Returns the pressure exponent. */
   double expt() const;
   /** Sets the pressure exponent. */
   bool setExpt(const double expt);
   /** Sets the pressure exponent. */
   bool setExpt(const std::string &expt);
+  /** Sets the pressure exponent. */
+  void setExpt(const PRJFLOAT &expt);
   /** Returns the flow coefficient. */
   double coef() const;
   /** Sets the flow coefficient. */
   bool setCoef(const double coef);
   /** Sets the flow coefficient. */
   bool setCoef(const std::string &coef);
+  /** Sets the flow coefficient. */
+  void setCoef(const PRJFLOAT &coef);
   /** Returns the reference pressure drop [Pa]. */
   double pres() const;
   /** Sets the reference pressure drop [Pa]. */
   bool setPres(const double pres);
   /** Sets the reference pressure drop [Pa]. */
   bool setPres(const std::string &pres);
+  /** Sets the reference pressure drop [Pa]. */
+  void setPres(const PRJFLOAT &pres);
   /** Returns the leakage area per item [m^2]. */
   double area1() const;
   /** Sets the leakage area per item [m^2]. */
   bool setArea1(const double area1);
   /** Sets the leakage area per item [m^2]. */
   bool setArea1(const std::string &area1);
+  /** Sets the leakage area per item [m^2]. */
+  void setArea1(const PRJFLOAT &area1);
   /** Returns the leakage area per unit length [m^2/m]. */
   double area2() const;
   /** Sets the leakage area per unit length [m^2/m]. */
   bool setArea2(const double area2);
   /** Sets the leakage area per unit length [m^2/m]. */
   bool setArea2(const std::string &area2);
+  /** Sets the leakage area per unit length [m^2/m]. */
+  void setArea2(const PRJFLOAT &area2);
   /** Returns the leakage area per unit area [m^2/m^2]. */
   double area3() const;
   /** Sets the leakage area per unit area [m^2/m^2]. */
   bool setArea3(const double area3);
   /** Sets the leakage area per unit area [m^2/m^2]. */
   bool setArea3(const std::string &area3);
+  /** Sets the leakage area per unit area [m^2/m^2]. */
+  void setArea3(const PRJFLOAT &area3);
   /** Returns the display units of area 1. */
   int u_A1() const;
   /** Sets the display units of area 1. */
@@ -289,30 +319,40 @@ public:
   bool setLam(const double lam);
   /** Sets the laminar flow coefficient. */
   bool setLam(const std::string &lam);
+  /** Sets the laminar flow coefficient. */
+  void setLam(const PRJFLOAT &lam);
   /** Returns the turbulent flow coefficient. */
   double turb() const;
   /** Sets the turbulent flow coefficient. */
   bool setTurb(const double turb);
   /** Sets the turbulent flow coefficient. */
   bool setTurb(const std::string &turb);
+  /** Sets the turbulent flow coefficient. */
+  void setTurb(const PRJFLOAT &turb);
   /** Returns the pressure exponent. */
   double expt() const;
   /** Sets the pressure exponent. */
   bool setExpt(const double expt);
   /** Sets the pressure exponent. */
   bool setExpt(const std::string &expt);
+  /** Sets the pressure exponent. */
+  void setExpt(const PRJFLOAT &expt);
   /** Returns the actual area [m^2]. */
   double area() const;
   /** Sets the actual area [m^2]. */
   bool setArea(const double area1);
   /** Sets the actual area [m^2]. */
   bool setArea(const std::string &area1);
+  /** Sets the actual area [m^2]. */
+  void setArea(const PRJFLOAT &area1);
   /** Returns the flow coefficient. */
   double coef() const;
   /** Sets the flow coefficient. */
   bool setCoef(const double coef);
   /** Sets the flow coefficient. */
   bool setCoef(const std::string &coef);
+  /** Sets the flow coefficient. */
+  void setCoef(const PRJFLOAT &coef);
   /** Returns the display units of area. */
   int u_A() const;
   /** Sets the display units of area. */
@@ -366,18 +406,24 @@ public:
   bool setLam(const double lam);
   /** Sets the laminar flow coefficient. */
   bool setLam(const std::string &lam);
+  /** Sets the laminar flow coefficient. */
+  void setLam(const PRJFLOAT &lam);
   /** Returns the turbulent flow coefficient. */
   double turb() const;
   /** Sets the turbulent flow coefficient. */
   bool setTurb(const double turb);
   /** Sets the turbulent flow coefficient. */
   bool setTurb(const std::string &turb);
+  /** Sets the turbulent flow coefficient. */
+  void setTurb(const PRJFLOAT &turb);
   /** Returns the pressure exponent. */
   double expt() const;
   /** Sets the pressure exponent. */
   bool setExpt(const double expt);
   /** Sets the pressure exponent. */
   bool setExpt(const std::string &expt);
+  /** Sets the pressure exponent. */
+  void setExpt(const PRJFLOAT &expt);
 
 private:
   void setDefaults();
@@ -426,30 +472,40 @@ public:
   bool setLam(const double lam);
   /** Sets the laminar flow coefficient. */
   bool setLam(const std::string &lam);
+  /** Sets the laminar flow coefficient. */
+  void setLam(const PRJFLOAT &lam);
   /** Returns the turbulent flow coefficient. */
   double turb() const;
   /** Sets the turbulent flow coefficient. */
   bool setTurb(const double turb);
   /** Sets the turbulent flow coefficient. */
   bool setTurb(const std::string &turb);
+  /** Sets the turbulent flow coefficient. */
+  void setTurb(const PRJFLOAT &turb);
   /** Returns the pressure exponent. */
   double expt() const;
   /** Sets the pressure exponent. */
   bool setExpt(const double expt);
   /** Sets the pressure exponent. */
   bool setExpt(const std::string &expt);
+  /** Sets the pressure exponent. */
+  void setExpt(const PRJFLOAT &expt);
   /** Returns the pressure drop [Pa]. */
   double dP() const;
   /** Sets the pressure drop [Pa]. */
   bool setDP(const double dP);
   /** Sets the pressure drop [Pa]. */
   bool setDP(const std::string &dP);
+  /** Sets the pressure drop [Pa]. */
+  void setDP(const PRJFLOAT &dP);
   /** Returns the flow rate [kg/s].*/
   double Flow() const;
   /** Sets the flow rate [kg/s].*/
   bool setFlow(const double Flow);
   /** Sets the flow rate [kg/s].*/
   bool setFlow(const std::string &Flow);
+  /** Sets the flow rate [kg/s].*/
+  void setFlow(const PRJFLOAT &Flow);
   /** Returns the display units of pressure drop. */
   int u_P() const;
   /** Sets the display units of pressure drop. */
@@ -512,42 +568,56 @@ public:
   bool setLam(const double lam);
   /** Sets the laminar flow coefficient. */
   bool setLam(const std::string &lam);
+  /** Sets the laminar flow coefficient. */
+  void setLam(const PRJFLOAT &lam);
   /** Returns the turbulent flow coefficient. */
   double turb() const;
   /** Sets the turbulent flow coefficient. */
   bool setTurb(const double turb);
   /** Sets the turbulent flow coefficient. */
   bool setTurb(const std::string &turb);
+  /** Sets the turbulent flow coefficient. */
+  void setTurb(const PRJFLOAT &turb);
   /** Returns the pressure exponent. */
   double expt() const;
   /** Sets the pressure exponent. */
   bool setExpt(const double expt);
   /** Sets the pressure exponent. */
   bool setExpt(const std::string &expt);
+  /** Sets the pressure exponent. */
+  void setExpt(const PRJFLOAT &expt);
   /** Returns the point 1 pressure drop [Pa]. */
   double dP1() const;
   /** Sets the point 1 pressure drop [Pa]. */
   bool setDP1(const double dP);
   /** Sets the point 1 pressure drop [Pa]. */
   bool setDP1(const std::string &dP);
+  /** Sets the point 1 pressure drop [Pa]. */
+  void setDP1(const PRJFLOAT &dP);
   /** Returns the point 1 flow rate [kg/s].*/
   double F1() const;
   /** Sets the point 1 flow rate [kg/s].*/
   bool setF1(const double Flow);
   /** Sets the point 1 flow rate [kg/s].*/
   bool setF1(const std::string &Flow);
+  /** Sets the point 1 flow rate [kg/s].*/
+  void setF1(const PRJFLOAT &Flow);
   /** Returns the point 2 pressure drop [Pa]. */
   double dP2() const;
   /** Sets the point 2 pressure drop [Pa]. */
   bool setDP2(const double dP);
   /** Sets the point 2 pressure drop [Pa]. */
   bool setDP2(const std::string &dP);
+  /** Sets the point 2 pressure drop [Pa]. */
+  void setDP2(const PRJFLOAT &dP);
   /** Returns the point 2 flow rate [kg/s].*/
   double F2() const;
   /** Sets the point 2 flow rate [kg/s].*/
   bool setF2(const double Flow);
   /** Sets the point 2 flow rate [kg/s].*/
   bool setF2(const std::string &Flow);
+  /** Sets the point 2 flow rate [kg/s].*/
+  void setF2(const PRJFLOAT &Flow);
   /** Returns the display units of point 1 pressure drop. */
   int u_P1() const;
   /** Sets the display units of point 1 pressure drop. */
@@ -620,30 +690,40 @@ public:
   bool setLam(const double lam);
   /** Sets the laminar flow coefficient. */
   bool setLam(const std::string &lam);
+  /** Sets the laminar flow coefficient. */
+  void setLam(const PRJFLOAT &lam);
   /** Returns the turbulent flow coefficient. */
   double turb() const;
   /** Sets the turbulent flow coefficient. */
   bool setTurb(const double turb);
   /** Sets the turbulent flow coefficient. */
   bool setTurb(const std::string &turb);
+  /** Sets the turbulent flow coefficient. */
+  void setTurb(const PRJFLOAT &turb);
   /** Returns the pressure exponent. */
   double expt() const;
   /** Sets the pressure exponent. */
   bool setExpt(const double expt);
   /** Sets the pressure exponent. */
   bool setExpt(const std::string &expt);
+  /** Sets the pressure exponent. */
+  void setExpt(const PRJFLOAT &expt);
   /** Returns the crack length [m]. */
   double length() const;
   /** Sets the crack length [m]. */
   bool setLength(const double length);
   /** Sets the crack length [m]. */
   bool setLength(const std::string &length);
+  /** Sets the crack length [m]. */
+  void setLength(const PRJFLOAT &length);
   /** Returns the crack width [m].*/
   double width() const;
   /** Sets the crack width [m].*/
   bool setWidth(const double width);
   /** Sets the crack width [m].*/
   bool setWidth(const std::string &width);
+  /** Sets the crack width [m].*/
+  void setWidth(const PRJFLOAT &width);
   /** Returns the display units of length. */
   int u_L() const;
   /** Sets the display units of length. */
@@ -704,36 +784,48 @@ public:
   bool setLam(const double lam);
   /** Sets the laminar flow coefficient. */
   bool setLam(const std::string &lam);
+  /** Sets the laminar flow coefficient. */
+  void setLam(const PRJFLOAT &lam);
   /** Returns the turbulent flow coefficient. */
   double turb() const;
   /** Sets the turbulent flow coefficient. */
   bool setTurb(const double turb);
   /** Sets the turbulent flow coefficient. */
   bool setTurb(const std::string &turb);
+  /** Sets the turbulent flow coefficient. */
+  void setTurb(const PRJFLOAT &turb);
   /** Returns the pressure exponent. */
   double expt() const;
   /** Sets the pressure exponent. */
   bool setExpt(const double expt);
   /** Sets the pressure exponent. */
   bool setExpt(const std::string &expt);
+  /** Sets the pressure exponent. */
+  void setExpt(const PRJFLOAT &expt);
   /** Returns the distance between levels [m]. */
   double Ht() const;
   /** Sets the distance between levels [m]. */
   bool setHt(const double Ht);
   /** Sets the distance between levels [m]. */
   bool setHt(const std::string &Ht);
+  /** Sets the distance between levels [m]. */
+  void setHt(const PRJFLOAT &Ht);
   /** Returns the cross-sectional area [m^2]. */
   double area() const;
   /** Sets the cross-sectional area [m^2]. */
   bool setArea(const double Area);
   /** Sets the cross-sectional area [m^2]. */
   bool setArea(const std::string &Area);
+  /** Sets the cross-sectional area [m^2]. */
+  void setArea(const PRJFLOAT &Area);
   /** Returns the density of people [pers/m^2]. */
   double people() const;
   /** Sets the density of people [pers/m^2]. */
   bool setPeople(const double peo);
   /** Sets the density of people [pers/m^2]. */
   bool setPeople(const std::string &peo);
+  /** Sets the density of people [pers/m^2]. */
+  void setPeople(const PRJFLOAT &peo);
   /** Returns the tread type: 1 = open tread 0 = closed. */
   int tread() const;
   /** Sets the tread type: 1 = open tread 0 = closed. */
@@ -803,42 +895,56 @@ public:
   bool setLam(const double lam);
   /** Sets the laminar flow coefficient. */
   bool setLam(const std::string &lam);
+  /** Sets the laminar flow coefficient. */
+  void setLam(const PRJFLOAT &lam);
   /** Returns the turbulent flow coefficient. */
   double turb() const;
   /** Sets the turbulent flow coefficient. */
   bool setTurb(const double turb);
   /** Sets the turbulent flow coefficient. */
   bool setTurb(const std::string &turb);
+  /** Sets the turbulent flow coefficient. */
+  void setTurb(const PRJFLOAT &turb);
   /** Returns the pressure exponent. */
   double expt() const;
   /** Sets the pressure exponent. */
   bool setExpt(const double expt);
   /** Sets the pressure exponent. */
   bool setExpt(const std::string &expt);
+  /** Sets the pressure exponent. */
+  void setExpt(const PRJFLOAT &expt);
   /** Returns the distance between levels [m]. */
   double Ht() const;
   /** Sets the distance between levels [m]. */
   bool setHt(const double Ht);
   /** Sets the distance between levels [m]. */
   bool setHt(const std::string &Ht);
+  /** Sets the distance between levels [m]. */
+  void setHt(const PRJFLOAT &Ht);
   /** Returns the cross-sectional area [m^2]. */
   double area() const;
   /** Sets the cross-sectional area [m^2]. */
   bool setArea(const double Area);
   /** Sets the cross-sectional area [m^2]. */
   bool setArea(const std::string &Area);
+  /** Sets the cross-sectional area [m^2]. */
+  void setArea(const PRJFLOAT &Area);
   /** Returns the perimeter [m]. */
   double perim() const;
   /** Sets the perimeter [m]. */
   bool setPerim(const double perim);
   /** Sets the perimeter [m]. */
   bool setPerim(const std::string &perim);
+  /** Sets the perimeter [m]. */
+  void setPerim(const PRJFLOAT &perim);
   /** Returns the roughness [m]. */
   double rough() const;
   /** Sets the roughness [m]. */
   bool setRough(const double rough);
   /** Sets the roughness [m]. */
   bool setRough(const std::string &rough);
+  /** Sets the roughness [m]. */
+  void setRough(const PRJFLOAT &rough);
   /** Returns the display units of area. */
   int u_A() const;
   /** Sets the display units of area. */
@@ -909,30 +1015,40 @@ public:
   bool setLam(const double lam);
   /** Sets the laminar flow coefficient. */
   bool setLam(const std::string &lam);
+  /** Sets the laminar flow coefficient. */
+  void setLam(const PRJFLOAT &lam);
   /** Returns the turbulent flow coefficient (dP > 0). */
   double Cp() const;
   /** Sets the turbulent flow coefficient (dP > 0). */
   bool setCp(const double Cp);
   /** Sets the turbulent flow coefficient (dP > 0). */
   bool setCp(const std::string &Cp);
+  /** Sets the turbulent flow coefficient (dP > 0). */
+  void setCp(const PRJFLOAT &Cp);
   /** Returns the pressure exponent (dP > 0). */
   double xp() const;
   /** Sets the pressure exponent (dP > 0). */
   bool setXp(const double xp);
   /** Sets the pressure exponent (dP > 0). */
   bool setXp(const std::string &xp);
+  /** Sets the pressure exponent (dP > 0). */
+  void setXp(const PRJFLOAT &xp);
   /** Returns the turbulent flow coefficient (dP < 0). */
   double Cn() const;
   /** Sets the turbulent flow coefficient (dP < 0). */
   bool setCn(const double Cn);
   /** Sets the turbulent flow coefficient (dP < 0). */
   bool setCn(const std::string &Cn);
+  /** Sets the turbulent flow coefficient (dP < 0). */
+  void setCn(const PRJFLOAT &Cn);
   /** Returns the pressure exponent (dP < 0). */
   double xn() const;
   /** Sets the pressure exponent (dP < 0). */
   bool setXn(const double xn);
   /** Sets the pressure exponent (dP < 0). */
   bool setXn(const std::string &xn);
+  /** Sets the pressure exponent (dP < 0). */
+  void setXn(const PRJFLOAT &xn);
 
 private:
   void setDefaults();
@@ -981,12 +1097,16 @@ public:
   bool setA(const double a);
   /** Sets the flow rate coefficient. */
   bool setA(const std::string &a);
+  /** Sets the flow rate coefficient. */
+  void setA(const PRJFLOAT &a);
   /** Returns the flow rate^2 coefficient. */
   double b() const;
   /** Sets the flow rate^2 coefficient. */
   bool setB(const double b);
   /** Sets the flow rate^2 coefficient. */
   bool setB(const std::string &b);
+  /** Sets the flow rate^2 coefficient. */
+  void setB(const PRJFLOAT &b);
 
 private:
   void setDefaults();
@@ -1039,30 +1159,40 @@ public:
   bool setA(const double a);
   /** Sets the flow rate coefficient. */
   bool setA(const std::string &a);
+  /** Sets the flow rate coefficient. */
+  void setA(const PRJFLOAT &a);
   /** Returns the flow rate^2 coefficient. */
   double b() const;
   /** Sets the flow rate^2 coefficient. */
   bool setB(const double b);
   /** Sets the flow rate^2 coefficient. */
   bool setB(const std::string &b);
+  /** Sets the flow rate^2 coefficient. */
+  void setB(const PRJFLOAT &b);
   /** Returns the crack length [m]. */
   double length() const;
   /** Sets the crack length [m]. */
   bool setLength(const double length);
   /** Sets the crack length [m]. */
   bool setLength(const std::string &length);
+  /** Sets the crack length [m]. */
+  void setLength(const PRJFLOAT &length);
   /** Returns the crack width [m].*/
   double width() const;
   /** Sets the crack width [m].*/
   bool setWidth(const double width);
   /** Sets the crack width [m].*/
   bool setWidth(const std::string &width);
+  /** Sets the crack width [m].*/
+  void setWidth(const PRJFLOAT &width);
   /** Sets the crack depth [m].*/
   double depth() const;
   /** Sets the crack depth [m].*/
   bool setDepth(const double depth);
   /** Sets the crack depth [m].*/
   bool setDepth(const std::string &depth);
+  /** Sets the crack depth [m].*/
+  void setDepth(const PRJFLOAT &depth);
   /** Returns the number of bends. */
   int nB() const;
   /** Sets the number of bends. */
@@ -1133,36 +1263,48 @@ public:
   bool setA(const double a);
   /** Sets the flow rate coefficient. */
   bool setA(const std::string &a);
+  /** Sets the flow rate coefficient. */
+  void setA(const PRJFLOAT &a);
   /** Returns the flow rate^2 coefficient. */
   double b() const;
   /** Sets the flow rate^2 coefficient. */
   bool setB(const double b);
   /** Sets the flow rate^2 coefficient. */
   bool setB(const std::string &b);
+  /** Sets the flow rate^2 coefficient. */
+  void setB(const PRJFLOAT &b);
   /** Returns the point 1 pressure drop [Pa]. */
   double dP1() const;
   /** Sets the point 1 pressure drop [Pa]. */
   bool setDP1(const double dP);
   /** Sets the point 1 pressure drop [Pa]. */
   bool setDP1(const std::string &dP);
+  /** Sets the point 1 pressure drop [Pa]. */
+  void setDP1(const PRJFLOAT &dP);
   /** Returns the point 1 flow rate [kg/s].*/
   double F1() const;
   /** Sets the point 1 flow rate [kg/s].*/
   bool setF1(const double Flow);
   /** Sets the point 1 flow rate [kg/s].*/
   bool setF1(const std::string &Flow);
+  /** Sets the point 1 flow rate [kg/s].*/
+  void setF1(const PRJFLOAT &Flow);
   /** Returns the point 2 pressure drop [Pa]. */
   double dP2() const;
   /** Sets the point 2 pressure drop [Pa]. */
   bool setDP2(const double dP);
   /** Sets the point 2 pressure drop [Pa]. */
   bool setDP2(const std::string &dP);
+  /** Sets the point 2 pressure drop [Pa]. */
+  void setDP2(const PRJFLOAT &dP);
   /** Returns the point 2 flow rate [kg/s].*/
   double F2() const;
   /** Sets the point 2 flow rate [kg/s].*/
   bool setF2(const double Flow);
   /** Sets the point 2 flow rate [kg/s].*/
   bool setF2(const std::string &Flow);
+  /** Sets the point 2 flow rate [kg/s].*/
+  void setF2(const PRJFLOAT &Flow);
   /** Returns the display units of point 1 pressure drop. */
   int u_P1() const;
   /** Sets the display units of point 1 pressure drop. */
@@ -1237,42 +1379,56 @@ public:
   bool setLam(const double lam);
   /** Sets the laminar flow coefficient. */
   bool setLam(const std::string &lam);
+  /** Sets the laminar flow coefficient. */
+  void setLam(const PRJFLOAT &lam);
   /** Returns the turbulent flow coefficient. */
   double turb() const;
   /** Sets the turbulent flow coefficient. */
   bool setTurb(const double turb);
   /** Sets the turbulent flow coefficient. */
   bool setTurb(const std::string &turb);
+  /** Sets the turbulent flow coefficient. */
+  void setTurb(const PRJFLOAT &turb);
   /** Returns the pressure exponent. */
   double expt() const;
   /** Sets the pressure exponent. */
   bool setExpt(const double expt);
   /** Sets the pressure exponent. */
   bool setExpt(const std::string &expt);
+  /** Sets the pressure exponent. */
+  void setExpt(const PRJFLOAT &expt);
   /** Returns the minimum temperature difference for two-way flow [C]. */
   double dTmin() const;
   /** Sets the minimum temperature difference for two-way flow [C]. */
   bool setDTmin(const double dTmin);
   /** Sets the minimum temperature difference for two-way flow [C]. */
   bool setDTmin(const std::string &dTmin);
+  /** Sets the minimum temperature difference for two-way flow [C]. */
+  void setDTmin(const PRJFLOAT &dTmin);
   /** Returns the height of doorway [m]. */
   double height() const;
   /** Sets the height of doorway [m]. */
   bool setHeight(const double ht);
   /** Sets the height of doorway [m]. */
   bool setHeight(const std::string &ht);
+  /** Sets the height of doorway [m]. */
+  void setHeight(const PRJFLOAT &ht);
   /** Sets the width of doorway [m]. */
   double width() const;
   /** Sets the width of doorway [m]. */
   bool setWidth(const double wd);
   /** Sets the width of doorway [m]. */
   bool setWidth(const std::string &wd);
+  /** Sets the width of doorway [m]. */
+  void setWidth(const PRJFLOAT &wd);
   /** Returns the discharge coefficient. */
   double cd() const;
   /** Sets the discharge coefficient. */
   bool setCd(const double cd);
   /** Sets the discharge coefficient. */
   bool setCd(const std::string &cd);
+  /** Sets the discharge coefficient. */
+  void setCd(const PRJFLOAT &cd);
   /** Returns the display units of temperature. */
   int u_T() const;
   /** Sets the display units of temperature. */
@@ -1343,42 +1499,56 @@ public:
   bool setLam(const double lam);
   /** Sets the laminar flow coefficient. */
   bool setLam(const std::string &lam);
+  /** Sets the laminar flow coefficient. */
+  void setLam(const PRJFLOAT &lam);
   /** Returns the turbulent flow coefficient. */
   double turb() const;
   /** Sets the turbulent flow coefficient. */
   bool setTurb(const double turb);
   /** Sets the turbulent flow coefficient. */
   bool setTurb(const std::string &turb);
+  /** Sets the turbulent flow coefficient. */
+  void setTurb(const PRJFLOAT &turb);
   /** Returns the pressure exponent. */
   double expt() const;
   /** Sets the pressure exponent. */
   bool setExpt(const double expt);
   /** Sets the pressure exponent. */
   bool setExpt(const std::string &expt);
+  /** Sets the pressure exponent. */
+  void setExpt(const PRJFLOAT &expt);
   /** Returns the distance above/below midpoint [m]. */
   double dH() const;
   /** Sets the distance above/below midpoint [m]. */
   bool setDH(const double dH);
   /** Sets the distance above/below midpoint [m]. */
   bool setDH(const std::string &dH);
+  /** Sets the distance above/below midpoint [m]. */
+  void setDH(const PRJFLOAT &dH);
   /** Returns the height of doorway [m]. */
   double height() const;
   /** Sets the height of doorway [m]. */
   bool setHeight(const double ht);
   /** Sets the height of doorway [m]. */
   bool setHeight(const std::string &ht);
+  /** Sets the height of doorway [m]. */
+  void setHeight(const PRJFLOAT &ht);
   /** Sets the width of doorway [m]. */
   double width() const;
   /** Sets the width of doorway [m]. */
   bool setWidth(const double wd);
   /** Sets the width of doorway [m]. */
   bool setWidth(const std::string &wd);
+  /** Sets the width of doorway [m]. */
+  void setWidth(const PRJFLOAT &wd);
   /** Returns the discharge coefficient. */
   double cd() const;
   /** Sets the discharge coefficient. */
   bool setCd(const double cd);
   /** Sets the discharge coefficient. */
   bool setCd(const std::string &cd);
+  /** Sets the discharge coefficient. */
+  void setCd(const PRJFLOAT &cd);
   /** Returns the display units of height. */
   int u_H() const;
   /** Sets the display units of height. */
@@ -1439,6 +1609,8 @@ public:
   bool setFlow(const double Flow);
   /** Sets the design flow rate [kg/s or m^3/s]. */
   bool setFlow(const std::string &Flow);
+  /** Sets the design flow rate [kg/s or m^3/s]. */
+  void setFlow(const PRJFLOAT &Flow);
   /** Returns the display units of design flow rate. */
   int u_F() const;
   /** Sets the display units of design flow rate. */
@@ -1494,54 +1666,72 @@ public:
   bool setLam(const double lam);
   /** Sets the laminar flow coefficient. */
   bool setLam(const std::string &lam);
+  /** Sets the laminar flow coefficient. */
+  void setLam(const PRJFLOAT &lam);
   /** Returns the turbulent flow coefficient. */
   double turb() const;
   /** Sets the turbulent flow coefficient. */
   bool setTurb(const double turb);
   /** Sets the turbulent flow coefficient. */
   bool setTurb(const std::string &turb);
+  /** Sets the turbulent flow coefficient. */
+  void setTurb(const PRJFLOAT &turb);
   /** Returns the pressure exponent. */
   double expt() const;
   /** Sets the pressure exponent. */
   bool setExpt(const double expt);
   /** Sets the pressure exponent. */
   bool setExpt(const std::string &expt);
+  /** Sets the pressure exponent. */
+  void setExpt(const PRJFLOAT &expt);
   /** Returns the reference fluid density [kg/m^3]. */
   double rdens() const;
   /** Sets the reference fluid density [kg/m^3]. */
   bool setRdens(const double rdens);
   /** Sets the reference fluid density [kg/m^3]. */
   bool setRdens(const std::string &rdens);
+  /** Sets the reference fluid density [kg/m^3]. */
+  void setRdens(const PRJFLOAT &rdens);
   /** Returns the free delivery flow (prise = 0) [kg/s]. */
   double fdf() const;
   /** Returns the free delivery flow (prise = 0) [kg/s]. */
   bool setFdf(const double fdf);
   /** Returns the free delivery flow (prise = 0) [kg/s]. */
   bool setFdf(const std::string &fdf);
+  /** Returns the free delivery flow (prise = 0) [kg/s]. */
+  void setFdf(const PRJFLOAT &fdf);
   /** Returns the shut-off pressure (flow = 0) [Pa]. */
   double sop() const;
   /** Sets the shut-off pressure (flow = 0) [Pa]. */
   bool setSop(const double sop);
   /** Sets the shut-off pressure (flow = 0) [Pa]. */
   bool setSop(const std::string &sop);
+  /** Sets the shut-off pressure (flow = 0) [Pa]. */
+  void setSop(const PRJFLOAT &sop);
   /** Returns the minimum RPM fraction: fan is off if (RPM/rated RPM) < off. */
   double off() const;
   /** Returns the minimum RPM fraction: fan is off if (RPM/rated RPM) < off. */
   bool setOff(const double off);
   /** Returns the minimum RPM fraction: fan is off if (RPM/rated RPM) < off. */
   bool setOff(const std::string &off);
+  /** Returns the minimum RPM fraction: fan is off if (RPM/rated RPM) < off. */
+  void setOff(const PRJFLOAT &off);
   /** Returns the fan performance polynomial coefficients. */
   std::vector<double> fpc() const;
   /** Sets the fan performance polynomial coefficients. */
   bool setFpc(const std::vector<double> &fpc);
   /** Sets the fan performance polynomial coefficients. */
   bool setFpc(const std::vector<std::string> &fpc);
+  /** Sets the fan performance polynomial coefficients. */
+  void setFpc(const std::vector<PRJFLOAT> &fpc);
   /** Returns the shut-off orifice area [m^2]. */
   double Sarea() const;
   /** Returns the shut-off orifice area [m^2]. */
   bool setSarea(const double Sarea);
   /** Returns the shut-off orifice area [m^2]. */
   bool setSarea(const std::string &Sarea);
+  /** Returns the shut-off orifice area [m^2]. */
+  void setSarea(const PRJFLOAT &Sarea);
   /** Returns the display units of shut-off orifice area. */
   int u_Sa() const;
   /** Sets the display units of shut-off orifice area. */
@@ -29,9 +29,11 @@
 #ifndef AIRFLOW_CONTAM_PRJDEFINES_HPP
 #define AIRFLOW_CONTAM_PRJDEFINES_HPP
 
-#define PRJFLOAT QString
-#define STR_TO_FLOAT(a) QString::fromStdString(a)
-#define FLOAT_CHECK(a,b) QString::fromStdString(a).toDouble(b)
+#include "PrjFloat.hpp"
+
+#define PRJFLOAT openstudio::contam::PrjFloat
+#define STR_TO_FLOAT(a) openstudio::contam::PrjFloat(a)
+#define FLOAT_CHECK(a,b) openstudio::contam::PrjFloat::check(a,b)
 #define ANY_TO_STR openstudio::toString
 
 // CONTAM icon definitions
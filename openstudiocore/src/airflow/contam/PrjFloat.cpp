@@ -0,0 +1,113 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2017, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+
+#include "PrjFloat.hpp"
+
+#include <boost/lexical_cast.hpp>
+
+#include <locale>
+#include <sstream>
+
+namespace openstudio {
+namespace contam {
+
+PrjFloat::PrjFloat() : m_value(0.0)
+{
+}
+
+PrjFloat::PrjFloat(double value) : m_value(value)
+{
+}
+
+PrjFloat::PrjFloat(const std::string &text) : m_value(0.0), m_text(text)
+{
+  bool ok;
+  double value = check(text, &ok);
+  if(ok) {
+    m_value = value;
+  }
+}
+
+PrjFloat::PrjFloat(const char *text) : m_value(0.0), m_text(text)
+{
+  bool ok;
+  double value = check(m_text, &ok);
+  if(ok) {
+    m_value = value;
+  }
+}
+
+PrjFloat::PrjFloat(const char *text, std::size_t size) : m_value(0.0), m_text(text, size)
+{
+  bool ok;
+  double value = check(text, size, &ok);
+  if(ok) {
+    m_value = value;
+  }
+}
+
+PrjFloat::PrjFloat(double value, const char *text, std::size_t size) : m_value(value), m_text(text, size)
+{
+}
+
+std::string PrjFloat::toString() const
+{
+  if(!m_text.empty()) {
+    return m_text;
+  }
+  // Match the default QString::number format (%g with 6 significant digits)
+  // independent of the current locale
+  std::ostringstream stream;
+  stream.imbue(std::locale::classic());
+  stream << m_value;
+  return stream.str();
+}
+
+double PrjFloat::check(const std::string &text, bool *ok)
+{
+  return check(text.data(), text.size(), ok);
+}
+
+double PrjFloat::check(const char *text, std::size_t size, bool *ok)
+{
+  double value = 0.0;
+  bool result = size != 0 && boost::conversion::try_lexical_convert(text, size, value);
+  if(ok) {
+    *ok = result;
+  }
+  return result ? value : 0.0;
+}
+
+} // contam
+
+std::string toString(const contam::PrjFloat &value)
+{
+  return value.toString();
+}
+
+} // openstudio
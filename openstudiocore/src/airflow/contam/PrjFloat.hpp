@@ -0,0 +1,93 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2017, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+
+#ifndef AIRFLOW_CONTAM_PRJFLOAT_HPP
+#define AIRFLOW_CONTAM_PRJFLOAT_HPP
+
+#include "../AirflowAPI.hpp"
+
+#include <cstddef>
+#include <string>
+
+namespace openstudio {
+namespace contam {
+
+/** PrjFloat stores a CONTAM real-valued field. The value is kept as a double so
+ *  that getters do not have to reparse text. When the value comes from text (a
+ *  PRJ file or a string setter), the original token is preserved as well and is
+ *  what gets written back out, so reading and writing a PRJ file reproduces the
+ *  numbers exactly as they appeared in the input. Values set from a double are
+ *  written in the same format that QString::number produces.
+ */
+class AIRFLOW_API PrjFloat
+{
+public:
+  /** Create a zero-valued float. */
+  PrjFloat();
+  /** Create a float from a double. No text is preserved. */
+  PrjFloat(double value);
+  /** Create a float from text, preserving the text. Invalid text gives a value of zero. */
+  explicit PrjFloat(const std::string &text);
+  /** Create a float from text, preserving the text. Invalid text gives a value of zero. */
+  explicit PrjFloat(const char *text);
+  /** Create a float from the first size characters of text, preserving them. */
+  PrjFloat(const char *text, std::size_t size);
+  /** Create a float from a value already converted from the first size characters of text, preserving them. */
+  PrjFloat(double value, const char *text, std::size_t size);
+
+  /** Returns the value. */
+  double toDouble() const
+  {
+    return m_value;
+  }
+  /** Returns the text representation, which is the original token if there is one. */
+  std::string toString() const;
+  /** Returns true if the float holds the text it was created from. */
+  bool hasText() const
+  {
+    return !m_text.empty();
+  }
+
+  /** Returns the value of text, with ok set to indicate whether the entire string is a valid number. */
+  static double check(const std::string &text, bool *ok);
+  /** Returns the value of the first size characters of text, with ok set to indicate whether they form a valid number. */
+  static double check(const char *text, std::size_t size, bool *ok);
+
+private:
+  double m_value;
+  std::string m_text;
+};
+
+} // contam
+
+/** PrjFloat to std::string, preserving any original text. */
+AIRFLOW_API std::string toString(const contam::PrjFloat &value);
+
+} // openstudio
+
+#endif // AIRFLOW_CONTAM_PRJFLOAT_HPP
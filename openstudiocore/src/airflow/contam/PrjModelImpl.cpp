@@ -130,14 +130,14 @@ bool IndexModelImpl::read(Reader &input)
   setSkwidth(input.read<int>());
   setDef_units(input.read<int>());
   setDef_flows(input.read<int>());
-  setDef_T(input.readNumber<std::string>());
+  setDef_T(input.readNumber<PRJFLOAT>());
   setUdefT(input.read<int>());
-  setRel_N(input.readNumber<std::string>());
-  setWind_H(input.readNumber<std::string>());
+  setRel_N(input.readNumber<PRJFLOAT>());
+  setWind_H(input.readNumber<PRJFLOAT>());
   setUwH(input.read<int>());
-  setWind_Ao(input.readNumber<std::string>());
-  setWind_a(input.readNumber<std::string>());
-  setScale(input.readNumber<std::string>());
+  setWind_Ao(input.readNumber<PRJFLOAT>());
+  setWind_a(input.readNumber<PRJFLOAT>());
+  setScale(input.readNumber<PRJFLOAT>());
   setUScale(input.read<int>());
   setOrgRow(input.read<int>());
   setOrgCol(input.read<int>());
@@ -152,24 +152,24 @@ bool IndexModelImpl::read(Reader &input)
   m_WPCfile = input.readLine();
   m_EWCfile = input.readLine();
   m_WPCdesc = input.readLine();
-  setX0(input.readNumber<std::string>());
-  setY0(input.readNumber<std::string>());
-  setZ0(input.readNumber<std::string>());
-  setAngle(input.readNumber<std::string>());
+  setX0(input.readNumber<PRJFLOAT>());
+  setY0(input.readNumber<PRJFLOAT>());
+  setZ0(input.readNumber<PRJFLOAT>());
+  setAngle(input.readNumber<PRJFLOAT>());
   setU_XYZ(input.read<int>());
-  setEpsPath(input.readNumber<std::string>());
-  setEpsSpcs(input.readNumber<std::string>());
+  setEpsPath(input.readNumber<PRJFLOAT>());
+  setEpsSpcs(input.readNumber<PRJFLOAT>());
   setTShift(input.readString());
   setDStart(input.readString());
   setDEnd(input.readString());
   setUseWPCwp(input.read<int>());
   setUseWPCmf(input.read<int>());
   setWpctrig(input.read<int>());
-  setLatd(input.readNumber<std::string>());
-  setLgtd(input.readNumber<std::string>());
-  setTznr(input.readNumber<std::string>());
-  setAltd(input.readNumber<std::string>());
-  setTgrnd(input.readNumber<std::string>());
+  setLatd(input.readNumber<PRJFLOAT>());
+  setLgtd(input.readNumber<PRJFLOAT>());
+  setTznr(input.readNumber<PRJFLOAT>());
+  setAltd(input.readNumber<PRJFLOAT>());
+  setTgrnd(input.readNumber<PRJFLOAT>());
   setUtg(input.read<int>());
   setU_a(input.read<int>());
   m_rc.read(input); // Read the run control section
@@ -421,7 +421,7 @@ double IndexModelImpl::def_T() const
 
 bool IndexModelImpl::setDef_T(const double def_T)
 {
-  m_def_T = QString::number(def_T);
+  m_def_T = def_T;
   return true;
 }
 
@@ -437,6 +437,11 @@ bool IndexModelImpl::setDef_T(const std::string &def_T)
   return false;
 }
 
+void IndexModelImpl::setDef_T(const PRJFLOAT &def_T)
+{
+  m_def_T = def_T;
+}
+
 int IndexModelImpl::udefT() const
 {
   return m_udefT;
@@ -454,7 +459,7 @@ double IndexModelImpl::rel_N() const
 
 bool IndexModelImpl::setRel_N(const double rel_N)
 {
-  m_rel_N = QString::number(rel_N);
+  m_rel_N = rel_N;
   return true;
 }
 
@@ -470,6 +475,11 @@ bool IndexModelImpl::setRel_N(const std::string &rel_N)
   return false;
 }
 
+void IndexModelImpl::setRel_N(const PRJFLOAT &rel_N)
+{
+  m_rel_N = rel_N;
+}
+
 double IndexModelImpl::wind_H() const
 {
   return m_wind_H.toDouble();
@@ -477,7 +487,7 @@ double IndexModelImpl::wind_H() const
 
 bool IndexModelImpl::setWind_H(const double wind_H)
 {
-  m_wind_H = QString::number(wind_H);
+  m_wind_H = wind_H;
   return true;
 }
 
@@ -493,6 +503,11 @@ bool IndexModelImpl::setWind_H(const std::string &wind_H)
   return false;
 }
 
+void IndexModelImpl::setWind_H(const PRJFLOAT &wind_H)
+{
+  m_wind_H = wind_H;
+}
+
 int IndexModelImpl::uwH() const
 {
   return m_uwH;
@@ -510,7 +525,7 @@ double IndexModelImpl::wind_Ao() const
 
 bool IndexModelImpl::setWind_Ao(const double wind_Ao)
 {
-  m_wind_Ao = QString::number(wind_Ao);
+  m_wind_Ao = wind_Ao;
   return true;
 }
 
@@ -526,6 +541,11 @@ bool IndexModelImpl::setWind_Ao(const std::string &wind_Ao)
   return false;
 }
 
+void IndexModelImpl::setWind_Ao(const PRJFLOAT &wind_Ao)
+{
+  m_wind_Ao = wind_Ao;
+}
+
 double IndexModelImpl::wind_a() const
 {
   return m_wind_a.toDouble();
@@ -533,7 +553,7 @@ double IndexModelImpl::wind_a() const
 
 bool IndexModelImpl::setWind_a(const double wind_a)
 {
-  m_wind_a = QString::number(wind_a);
+  m_wind_a = wind_a;
   return true;
 }
 
@@ -549,6 +569,11 @@ bool IndexModelImpl::setWind_a(const std::string &wind_a)
   return false;
 }
 
+void IndexModelImpl::setWind_a(const PRJFLOAT &wind_a)
+{
+  m_wind_a = wind_a;
+}
+
 double IndexModelImpl::scale() const
 {
   return m_scale.toDouble();
@@ -556,7 +581,7 @@ double IndexModelImpl::scale() const
 
 bool IndexModelImpl::setScale(const double scale)
 {
-  m_scale = QString::number(scale);
+  m_scale = scale;
   return true;
 }
 
@@ -572,6 +597,11 @@ bool IndexModelImpl::setScale(const std::string &scale)
   return false;
 }
 
+void IndexModelImpl::setScale(const PRJFLOAT &scale)
+{
+  m_scale = scale;
+}
+
 int IndexModelImpl::uScale() const
 {
   return m_uScale;
@@ -719,7 +749,7 @@ double IndexModelImpl::X0() const
 
 bool IndexModelImpl::setX0(const double X0)
 {
-  m_X0 = QString::number(X0);
+  m_X0 = X0;
   return true;
 }
 
@@ -735,6 +765,11 @@ bool IndexModelImpl::setX0(const std::string &X0)
   return false;
 }
 
+void IndexModelImpl::setX0(const PRJFLOAT &X0)
+{
+  m_X0 = X0;
+}
+
 double IndexModelImpl::Y0() const
 {
   return m_Y0.toDouble();
@@ -742,7 +777,7 @@ double IndexModelImpl::Y0() const
 
 bool IndexModelImpl::setY0(const double Y0)
 {
-  m_Y0 = QString::number(Y0);
+  m_Y0 = Y0;
   return true;
 }
 
@@ -758,6 +793,11 @@ bool IndexModelImpl::setY0(const std::string &Y0)
   return false;
 }
 
+void IndexModelImpl::setY0(const PRJFLOAT &Y0)
+{
+  m_Y0 = Y0;
+}
+
 double IndexModelImpl::Z0() const
 {
   return m_Z0.toDouble();
@@ -765,7 +805,7 @@ double IndexModelImpl::Z0() const
 
 bool IndexModelImpl::setZ0(const double Z0)
 {
-  m_Z0 = QString::number(Z0);
+  m_Z0 = Z0;
   return true;
 }
 
@@ -781,6 +821,11 @@ bool IndexModelImpl::setZ0(const std::string &Z0)
   return false;
 }
 
+void IndexModelImpl::setZ0(const PRJFLOAT &Z0)
+{
+  m_Z0 = Z0;
+}
+
 double IndexModelImpl::angle() const
 {
   return m_angle.toDouble();
@@ -788,7 +833,7 @@ double IndexModelImpl::angle() const
 
 bool IndexModelImpl::setAngle(const double angle)
 {
-  m_angle = QString::number(angle);
+  m_angle = angle;
   return true;
 }
 
@@ -804,6 +849,11 @@ bool IndexModelImpl::setAngle(const std::string &angle)
   return false;
 }
 
+void IndexModelImpl::setAngle(const PRJFLOAT &angle)
+{
+  m_angle = angle;
+}
+
 int IndexModelImpl::u_XYZ() const
 {
   return m_u_XYZ;
@@ -821,7 +871,7 @@ double IndexModelImpl::epsPath() const
 
 bool IndexModelImpl::setEpsPath(const double epsPath)
 {
-  m_epsPath = QString::number(epsPath);
+  m_epsPath = epsPath;
   return true;
 }
 
@@ -837,6 +887,11 @@ bool IndexModelImpl::setEpsPath(const std::string &epsPath)
   return false;
 }
 
+void IndexModelImpl::setEpsPath(const PRJFLOAT &epsPath)
+{
+  m_epsPath = epsPath;
+}
+
 double IndexModelImpl::epsSpcs() const
 {
   return m_epsSpcs.toDouble();
@@ -844,7 +899,7 @@ double IndexModelImpl::epsSpcs() const
 
 bool IndexModelImpl::setEpsSpcs(const double epsSpcs)
 {
-  m_epsSpcs = QString::number(epsSpcs);
+  m_epsSpcs = epsSpcs;
   return true;
 }
 
@@ -860,6 +915,11 @@ bool IndexModelImpl::setEpsSpcs(const std::string &epsSpcs)
   return false;
 }
 
+void IndexModelImpl::setEpsSpcs(const PRJFLOAT &epsSpcs)
+{
+  m_epsSpcs = epsSpcs;
+}
+
 std::string IndexModelImpl::tShift() const
 {
   return m_tShift;
@@ -927,7 +987,7 @@ double IndexModelImpl::latd() const
 
 bool IndexModelImpl::setLatd(const double latd)
 {
-  m_latd = QString::number(latd);
+  m_latd = latd;
   return true;
 }
 
@@ -943,6 +1003,11 @@ bool IndexModelImpl::setLatd(const std::string &latd)
   return false;
 }
 
+void IndexModelImpl::setLatd(const PRJFLOAT &latd)
+{
+  m_latd = latd;
+}
+
 double IndexModelImpl::lgtd() const
 {
   return m_lgtd.toDouble();
@@ -950,7 +1015,7 @@ double IndexModelImpl::lgtd() const
 
 bool IndexModelImpl::setLgtd(const double lgtd)
 {
-  m_lgtd = QString::number(lgtd);
+  m_lgtd = lgtd;
   return true;
 }
 
@@ -966,6 +1031,11 @@ bool IndexModelImpl::setLgtd(const std::string &lgtd)
   return false;
 }
 
+void IndexModelImpl::setLgtd(const PRJFLOAT &lgtd)
+{
+  m_lgtd = lgtd;
+}
+
 double IndexModelImpl::Tznr() const
 {
   return m_Tznr.toDouble();
@@ -973,7 +1043,7 @@ double IndexModelImpl::Tznr() const
 
 bool IndexModelImpl::setTznr(const double Tznr)
 {
-  m_Tznr = QString::number(Tznr);
+  m_Tznr = Tznr;
   return true;
 }
 
@@ -989,6 +1059,11 @@ bool IndexModelImpl::setTznr(const std::string &Tznr)
   return false;
 }
 
+void IndexModelImpl::setTznr(const PRJFLOAT &Tznr)
+{
+  m_Tznr = Tznr;
+}
+
 double IndexModelImpl::altd() const
 {
   return m_altd.toDouble();
@@ -996,7 +1071,7 @@ double IndexModelImpl::altd() const
 
 bool IndexModelImpl::setAltd(const double altd)
 {
-  m_altd = QString::number(altd);
+  m_altd = altd;
   return true;
 }
 
@@ -1012,6 +1087,11 @@ bool IndexModelImpl::setAltd(const std::string &altd)
   return false;
 }
 
+void IndexModelImpl::setAltd(const PRJFLOAT &altd)
+{
+  m_altd = altd;
+}
+
 double IndexModelImpl::Tgrnd() const
 {
   return m_Tgrnd.toDouble();
@@ -1019,7 +1099,7 @@ double IndexModelImpl::Tgrnd() const
 
 bool IndexModelImpl::setTgrnd(const double Tgrnd)
 {
-  m_Tgrnd = QString::number(Tgrnd);
+  m_Tgrnd = Tgrnd;
   return true;
 }
 
@@ -1035,6 +1115,11 @@ bool IndexModelImpl::setTgrnd(const std::string &Tgrnd)
   return false;
 }
 
+void IndexModelImpl::setTgrnd(const PRJFLOAT &Tgrnd)
+{
+  m_Tgrnd = Tgrnd;
+}
+
 int IndexModelImpl::utg() const
 {
   return m_utg;
@@ -1230,10 +1315,10 @@ void IndexModelImpl::readZoneIc(Reader &input)
           .arg(input.lineNumber());
         LOG_FREE_AND_THROW("openstudio.contam.ForwardTranslator",mesg.toStdString());
       }
-      std::vector<std::string> ic;
+      std::vector<PRJFLOAT> ic;
       for(unsigned int j=0;j<nctm;j++)
       {
-        ic.push_back(input.readNumber<std::string>());
+        ic.push_back(input.readNumber<PRJFLOAT>());
       }
       m_zones[i].setIc(ic);
     }
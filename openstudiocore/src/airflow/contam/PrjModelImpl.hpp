@@ -96,6 +96,8 @@ public:
   bool setDef_T(const double def_T);
   /** Sets the default temperature for zones [K]. */
   bool setDef_T(const std::string &def_T);
+  /** Sets the default temperature for zones [K]. */
+  void setDef_T(const PRJFLOAT &def_T);
   /** Returns the display units for temperature. */
   int udefT() const;
   /** Sets the display units for temperature. */
@@ -106,12 +108,16 @@ public:
   bool setRel_N(const double rel_N);
   /** Sets the angle to true north [degrees]. */
   bool setRel_N(const std::string &rel_N);
+  /** Sets the angle to true north [degrees]. */
+  void setRel_N(const PRJFLOAT &rel_N);
   /** Returns the elevation for reference wind speed [m]. */
   double wind_H() const;
   /** Sets the elevation for reference wind speed [m]. */
   bool setWind_H(const double wind_H);
   /** Sets the elevation for reference wind speed [m]. */
   bool setWind_H(const std::string &wind_H);
+  /** Sets the elevation for reference wind speed [m]. */
+  void setWind_H(const PRJFLOAT &wind_H);
   /** Returns the display units for elevation for reference wind speed. */
   int uwH() const;
   /** Sets the display units for elevation for reference wind speed. */
@@ -122,17 +128,23 @@ public:
   bool setWind_Ao(const double wind_Ao);
   /** Sets the local terrain constant for wind. */
   bool setWind_Ao(const std::string &wind_Ao);
+  /** Sets the local terrain constant for wind. */
+  void setWind_Ao(const PRJFLOAT &wind_Ao);
   /** Returns the velocity profile exponent for wind. */
   double wind_a() const;
   /** Sets the velocity profile exponent for wind. */
   bool setWind_a(const double wind_a);
   /** Sets the velocity profile exponent for wind. */
   bool setWind_a(const std::string &wind_a);/** Returns the cell scaling factor. */
+  /** Sets the velocity profile exponent for wind. */
+  void setWind_a(const PRJFLOAT &wind_a);
   double scale() const;
   /** Sets the cell scaling factor. */
   bool setScale(const double scale);
   /** Sets the cell scaling factor. */
   bool setScale(const std::string &scale);
+  /** Sets the cell scaling factor. */
+  void setScale(const PRJFLOAT &scale);
   /** Returns the units of scaling factor: 0 = m, 1 = ft. */
   int uScale() const;
   /** Sets the units of scaling factor: 0 = m, 1 = ft. */
@@ -195,24 +207,32 @@ public:
   bool setX0(const double X0);
   /** Sets the X-value of ContamW origin in EWC coordinates [m]. */
   bool setX0(const std::string &X0);
+  /** Sets the X-value of ContamW origin in EWC coordinates [m]. */
+  void setX0(const PRJFLOAT &X0);
   /** Returns the Y-value of ContamW origin in EWC coordinates [m]. */
   double Y0() const;
   /** Sets the Y-value of ContamW origin in EWC coordinates [m]. */
   bool setY0(const double Y0);
   /** Sets the Y-value of ContamW origin in EWC coordinates [m]. */
   bool setY0(const std::string &Y0);
+  /** Sets the Y-value of ContamW origin in EWC coordinates [m]. */
+  void setY0(const PRJFLOAT &Y0);
   /** Returns the Z-value of ContamW origin in EWC coordinates [m]. */
   double Z0() const;
   /** Sets the Z-value of ContamW origin in EWC coordinates [m]. */
   bool setZ0(const double Z0);
   /** Sets the Z-value of ContamW origin in EWC coordinates [m]. */
   bool setZ0(const std::string &Z0);
+  /** Sets the Z-value of ContamW origin in EWC coordinates [m]. */
+  void setZ0(const PRJFLOAT &Z0);
   /** Returns the rotation of ContamW relative to EWC coordinates. */
   double angle() const;
   /** Sets the rotation of ContamW relative to EWC coordinates. */
   bool setAngle(const double angle);
   /** Sets the rotation of ContamW relative to EWC coordinates. */
   bool setAngle(const std::string &angle);
+  /** Sets the rotation of ContamW relative to EWC coordinates. */
+  void setAngle(const PRJFLOAT &angle);
   /** Returns the units of coordinates. */
   int u_XYZ() const;
   /** Sets the units of coordinates. */
@@ -223,12 +243,16 @@ public:
   bool setEpsPath(const double epsPath);
   /** Sets the tolerance for matching path locations. */
   bool setEpsPath(const std::string &epsPath);
+  /** Sets the tolerance for matching path locations. */
+  void setEpsPath(const PRJFLOAT &epsPath);
   /** Returns the tolerance for matching species. */
   double epsSpcs() const;
   /** Sets the tolerance for matching species. */
   bool setEpsSpcs(const double epsSpcs);
   /** Sets the tolerance for matching species. */
   bool setEpsSpcs(const std::string &epsSpcs);
+  /** Sets the tolerance for matching species. */
+  void setEpsSpcs(const PRJFLOAT &epsSpcs);
   /** Returns the time shift of EWC data [hh:mm:ss]. */
   std::string tShift() const;
   /** Sets the time shift of EWC data [hh:mm:ss]. */
@@ -259,30 +283,40 @@ public:
   bool setLatd(const double latd);
   /** Sets the latitude (degrees: north +, south -). */
   bool setLatd(const std::string &latd);
+  /** Sets the latitude (degrees: north +, south -). */
+  void setLatd(const PRJFLOAT &latd);
   /** Returns the longitude (degrees: east +, west -). */
   double lgtd() const;
   /** Sets the longitude (degrees: east +, west -). */
   bool setLgtd(const double lgtd);
   /** Sets the longitude (degrees: east +, west -). */
   bool setLgtd(const std::string &lgtd);
+  /** Sets the longitude (degrees: east +, west -). */
+  void setLgtd(const PRJFLOAT &lgtd);
   /** Returns the time zone (Greenwich = 0, Eastern = -5, etc.). */
   double Tznr() const;
   /** Sets the time zone (Greenwich = 0, Eastern = -5, etc.). */
   bool setTznr(const double Tznr);
   /** Sets the time zone (Greenwich = 0, Eastern = -5, etc.). */
   bool setTznr(const std::string &Tznr);
+  /** Sets the time zone (Greenwich = 0, Eastern = -5, etc.). */
+  void setTznr(const PRJFLOAT &Tznr);
   /** Returns the elevation above sea level [m]. */
   double altd() const;
   /** Sets the elevation above sea level [m]. */
   bool setAltd(const double altd);
   /** Sets the elevation above sea level [m]. */
   bool setAltd(const std::string &altd);
+  /** Sets the elevation above sea level [m]. */
+  void setAltd(const PRJFLOAT &altd);
   /** Returns the ground temperature [K]. */
   double Tgrnd() const;
   /** Sets the ground temperature [K]. */
   bool setTgrnd(const double Tgrnd);
   /** Sets the ground temperature [K]. */
   bool setTgrnd(const std::string &Tgrnd);
+  /** Sets the ground temperature [K]. */
+  void setTgrnd(const PRJFLOAT &Tgrnd);
   /** Returns the display units for ground temperatures. */
   int utg() const;
   /** Sets the display units for ground temperatures. */
@@ -511,6 +511,11 @@ bool Zone::setIc(std::vector<std::string> &ic)
   return m_impl->setIc(ic);
 }
 
+void Zone::setIc(const std::vector<PRJFLOAT> &ic)
+{
+  m_impl->setIc(ic);
+}
+
 Species::Species() :
   m_impl(std::shared_ptr<detail::SpeciesImpl>(new detail::SpeciesImpl))
 {}
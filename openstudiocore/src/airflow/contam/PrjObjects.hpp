@@ -263,6 +263,8 @@ public:
   bool setIc(std::vector<double> &ic);
   /** Sets the contaminant initial condition vector. */
   bool setIc(std::vector<std::string> &ic);
+  /** Sets the contaminant initial condition vector. */
+  void setIc(const std::vector<PRJFLOAT> &ic);
   //@}
 
 private:
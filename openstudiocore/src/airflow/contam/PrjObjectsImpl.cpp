@@ -150,10 +150,10 @@ void ZoneImpl::read(Reader &input)
   setPc(input.readInt());
   setPk(input.readInt());
   setPl(input.readInt());
-  setRelHt(input.readNumber<std::string>());
-  setVol(input.readNumber<std::string>());
-  setT0(input.readNumber<std::string>());
-  setP0(input.readNumber<std::string>());
+  setRelHt(input.readNumber<PRJFLOAT>());
+  setVol(input.readNumber<PRJFLOAT>());
+  setT0(input.readNumber<PRJFLOAT>());
+  setP0(input.readNumber<PRJFLOAT>());
   setName(input.readString());
   setColor(input.readInt());
   setU_Ht(input.readInt());
@@ -169,14 +169,14 @@ void ZoneImpl::read(Reader &input)
   else if(cdaxis())
   {
     input.readString();  // Read "1D:"
-    setX1(input.readNumber<std::string>());
-    setY1(input.readNumber<std::string>());
-    setH1(input.readNumber<std::string>());
-    setX2(input.readNumber<std::string>());
-    setY2(input.readNumber<std::string>());
-    setH2(input.readNumber<std::string>());
-    setCelldx(input.readNumber<std::string>());
-    setAxialD(input.readNumber<std::string>());
+    setX1(input.readNumber<PRJFLOAT>());
+    setY1(input.readNumber<PRJFLOAT>());
+    setH1(input.readNumber<PRJFLOAT>());
+    setX2(input.readNumber<PRJFLOAT>());
+    setY2(input.readNumber<PRJFLOAT>());
+    setH2(input.readNumber<PRJFLOAT>());
+    setCelldx(input.readNumber<PRJFLOAT>());
+    setAxialD(input.readNumber<PRJFLOAT>());
     setU_aD(input.readInt());
     setU_L(input.readInt());
   }
@@ -267,7 +267,7 @@ double ZoneImpl::relHt() const
 
 bool ZoneImpl::setRelHt(const double relHt)
 {
-  m_relHt = QString::number(relHt);
+  m_relHt = relHt;
   return true;
 }
 
@@ -283,6 +283,11 @@ bool ZoneImpl::setRelHt(const std::string &relHt)
   return false;
 }
 
+void ZoneImpl::setRelHt(const PRJFLOAT &relHt)
+{
+  m_relHt = relHt;
+}
+
 double ZoneImpl::Vol() const
 {
   return m_Vol.toDouble();
@@ -290,7 +295,7 @@ double ZoneImpl::Vol() const
 
 bool ZoneImpl::setVol(const double Vol)
 {
-  m_Vol = QString::number(Vol);
+  m_Vol = Vol;
   return true;
 }
 
@@ -306,6 +311,11 @@ bool ZoneImpl::setVol(const std::string &Vol)
   return false;
 }
 
+void ZoneImpl::setVol(const PRJFLOAT &Vol)
+{
+  m_Vol = Vol;
+}
+
 double ZoneImpl::T0() const
 {
   return m_T0.toDouble();
@@ -313,7 +323,7 @@ double ZoneImpl::T0() const
 
 bool ZoneImpl::setT0(const double T0)
 {
-  m_T0 = QString::number(T0);
+  m_T0 = T0;
   return true;
 }
 
@@ -329,6 +339,11 @@ bool ZoneImpl::setT0(const std::string &T0)
   return false;
 }
 
+void ZoneImpl::setT0(const PRJFLOAT &T0)
+{
+  m_T0 = T0;
+}
+
 double ZoneImpl::P0() const
 {
   return m_P0.toDouble();
@@ -336,7 +351,7 @@ double ZoneImpl::P0() const
 
 bool ZoneImpl::setP0(const double P0)
 {
-  m_P0 = QString::number(P0);
+  m_P0 = P0;
   return true;
 }
 
@@ -352,6 +367,11 @@ bool ZoneImpl::setP0(const std::string &P0)
   return false;
 }
 
+void ZoneImpl::setP0(const PRJFLOAT &P0)
+{
+  m_P0 = P0;
+}
+
 std::string ZoneImpl::name() const
 {
   return m_name;
@@ -449,7 +469,7 @@ double ZoneImpl::X1() const
 
 bool ZoneImpl::setX1(const double X1)
 {
-  m_X1 = QString::number(X1);
+  m_X1 = X1;
   return true;
 }
 
@@ -465,6 +485,11 @@ bool ZoneImpl::setX1(const std::string &X1)
   return false;
 }
 
+void ZoneImpl::setX1(const PRJFLOAT &X1)
+{
+  m_X1 = X1;
+}
+
 double ZoneImpl::Y1() const
 {
   return m_Y1.toDouble();
@@ -472,7 +497,7 @@ double ZoneImpl::Y1() const
 
 bool ZoneImpl::setY1(const double Y1)
 {
-  m_Y1 = QString::number(Y1);
+  m_Y1 = Y1;
   return true;
 }
 
@@ -488,6 +513,11 @@ bool ZoneImpl::setY1(const std::string &Y1)
   return false;
 }
 
+void ZoneImpl::setY1(const PRJFLOAT &Y1)
+{
+  m_Y1 = Y1;
+}
+
 double ZoneImpl::H1() const
 {
   return m_H1.toDouble();
@@ -495,7 +525,7 @@ double ZoneImpl::H1() const
 
 bool ZoneImpl::setH1(const double H1)
 {
-  m_H1 = QString::number(H1);
+  m_H1 = H1;
   return true;
 }
 
@@ -511,6 +541,11 @@ bool ZoneImpl::setH1(const std::string &H1)
   return false;
 }
 
+void ZoneImpl::setH1(const PRJFLOAT &H1)
+{
+  m_H1 = H1;
+}
+
 double ZoneImpl::X2() const
 {
   return m_X2.toDouble();
@@ -518,7 +553,7 @@ double ZoneImpl::X2() const
 
 bool ZoneImpl::setX2(const double X2)
 {
-  m_X2 = QString::number(X2);
+  m_X2 = X2;
   return true;
 }
 
@@ -534,6 +569,11 @@ bool ZoneImpl::setX2(const std::string &X2)
   return false;
 }
 
+void ZoneImpl::setX2(const PRJFLOAT &X2)
+{
+  m_X2 = X2;
+}
+
 double ZoneImpl::Y2() const
 {
   return m_Y2.toDouble();
@@ -541,7 +581,7 @@ double ZoneImpl::Y2() const
 
 bool ZoneImpl::setY2(const double Y2)
 {
-  m_Y2 = QString::number(Y2);
+  m_Y2 = Y2;
   return true;
 }
 
@@ -557,6 +597,11 @@ bool ZoneImpl::setY2(const std::string &Y2)
   return false;
 }
 
+void ZoneImpl::setY2(const PRJFLOAT &Y2)
+{
+  m_Y2 = Y2;
+}
+
 double ZoneImpl::H2() const
 {
   return m_H2.toDouble();
@@ -564,7 +609,7 @@ double ZoneImpl::H2() const
 
 bool ZoneImpl::setH2(const double H2)
 {
-  m_H2 = QString::number(H2);
+  m_H2 = H2;
   return true;
 }
 
@@ -580,6 +625,11 @@ bool ZoneImpl::setH2(const std::string &H2)
   return false;
 }
 
+void ZoneImpl::setH2(const PRJFLOAT &H2)
+{
+  m_H2 = H2;
+}
+
 double ZoneImpl::celldx() const
 {
   return m_celldx.toDouble();
@@ -587,7 +637,7 @@ double ZoneImpl::celldx() const
 
 bool ZoneImpl::setCelldx(const double celldx)
 {
-  m_celldx = QString::number(celldx);
+  m_celldx = celldx;
   return true;
 }
 
@@ -603,6 +653,11 @@ bool ZoneImpl::setCelldx(const std::string &celldx)
   return false;
 }
 
+void ZoneImpl::setCelldx(const PRJFLOAT &celldx)
+{
+  m_celldx = celldx;
+}
+
 double ZoneImpl::axialD() const
 {
   return m_axialD.toDouble();
@@ -610,7 +665,7 @@ double ZoneImpl::axialD() const
 
 bool ZoneImpl::setAxialD(const double axialD)
 {
-  m_axialD = QString::number(axialD);
+  m_axialD = axialD;
   return true;
 }
 
@@ -626,6 +681,11 @@ bool ZoneImpl::setAxialD(const std::string &axialD)
   return false;
 }
 
+void ZoneImpl::setAxialD(const PRJFLOAT &axialD)
+{
+  m_axialD = axialD;
+}
+
 int ZoneImpl::u_aD() const
 {
   return m_u_aD;
@@ -702,7 +762,7 @@ std::vector<double> ZoneImpl::ic() const
 
 bool ZoneImpl::setIc(const int i, const double value)
 {
-  m_ic[i] = QString::number(value);
+  m_ic[i] = value;
   return true;
 }
 
@@ -720,10 +780,10 @@ bool ZoneImpl::setIc(const int i, const std::string &value)
 
 bool ZoneImpl::setIc(std::vector<double> &ic)
 {
-  QVector<QString> in;
+  QVector<PRJFLOAT> in;
   for(unsigned i=0;i<ic.size();i++)
   {
-    in << QString::number(ic[i]);
+    in << PRJFLOAT(ic[i]);
   }
   m_ic = in;
   return true;
@@ -731,7 +791,7 @@ bool ZoneImpl::setIc(std::vector<double> &ic)
 
 bool ZoneImpl::setIc(std::vector<std::string> &ic)
 {
-  QVector<QString> in;
+  QVector<PRJFLOAT> in;
   for(unsigned i=0;i<ic.size();i++)
   {
     bool ok;
@@ -746,6 +806,16 @@ bool ZoneImpl::setIc(std::vector<std::string> &ic)
   return true;
 }
 
+void ZoneImpl::setIc(const std::vector<PRJFLOAT> &ic)
+{
+  QVector<PRJFLOAT> in;
+  for(unsigned i=0;i<ic.size();i++)
+  {
+    in << ic[i];
+  }
+  m_ic = in;
+}
+
 void SpeciesImpl::setDefaults()
 {
   m_nr = 0;
@@ -823,13 +893,13 @@ void SpeciesImpl::read(Reader &input)
   setNr(input.read<int>());
   setSflag(input.read<int>());
   setNtflag(input.read<int>());
-  setMolwt(input.read<std::string>());
-  setMdiam(input.read<std::string>());
-  setEdens(input.read<std::string>());
-  setDecay(input.read<std::string>());
-  setDm(input.read<std::string>());
-  setCcdef(input.read<std::string>());
-  setCp(input.read<std::string>());
+  setMolwt(input.readNumber<PRJFLOAT>());
+  setMdiam(input.readNumber<PRJFLOAT>());
+  setEdens(input.readNumber<PRJFLOAT>());
+  setDecay(input.readNumber<PRJFLOAT>());
+  setDm(input.readNumber<PRJFLOAT>());
+  setCcdef(input.readNumber<PRJFLOAT>());
+  setCp(input.readNumber<PRJFLOAT>());
   setUcc(input.read<int>());
   setUmd(input.read<int>());
   setUed(input.read<int>());
@@ -884,7 +954,7 @@ double SpeciesImpl::molwt() const
 
 bool SpeciesImpl::setMolwt(const double molwt)
 {
-  m_molwt = QString::number(molwt);
+  m_molwt = molwt;
   return true;
 }
 
@@ -900,6 +970,11 @@ bool SpeciesImpl::setMolwt(const std::string &molwt)
   return false;
 }
 
+void SpeciesImpl::setMolwt(const PRJFLOAT &molwt)
+{
+  m_molwt = molwt;
+}
+
 double SpeciesImpl::mdiam() const
 {
   return m_mdiam.toDouble();
@@ -907,7 +982,7 @@ double SpeciesImpl::mdiam() const
 
 bool SpeciesImpl::setMdiam(const double mdiam)
 {
-  m_mdiam = QString::number(mdiam);
+  m_mdiam = mdiam;
   return true;
 }
 
@@ -923,6 +998,11 @@ bool SpeciesImpl::setMdiam(const std::string &mdiam)
   return false;
 }
 
+void SpeciesImpl::setMdiam(const PRJFLOAT &mdiam)
+{
+  m_mdiam = mdiam;
+}
+
 double SpeciesImpl::edens() const
 {
   return m_edens.toDouble();
@@ -930,7 +1010,7 @@ double SpeciesImpl::edens() const
 
 bool SpeciesImpl::setEdens(const double edens)
 {
-  m_edens = QString::number(edens);
+  m_edens = edens;
   return true;
 }
 
@@ -946,6 +1026,11 @@ bool SpeciesImpl::setEdens(const std::string &edens)
   return false;
 }
 
+void SpeciesImpl::setEdens(const PRJFLOAT &edens)
+{
+  m_edens = edens;
+}
+
 double SpeciesImpl::decay() const
 {
   return m_decay.toDouble();
@@ -969,6 +1054,11 @@ bool SpeciesImpl::setDecay(const std::string &decay)
   return false;
 }
 
+void SpeciesImpl::setDecay(const PRJFLOAT &decay)
+{
+  m_decay = decay;
+}
+
 double SpeciesImpl::Dm() const
 {
   return m_Dm.toDouble();
@@ -976,7 +1066,7 @@ double SpeciesImpl::Dm() const
 
 bool SpeciesImpl::setDm(const double Dm)
 {
-  m_Dm = QString::number(Dm);
+  m_Dm = Dm;
   return true;
 }
 
@@ -992,6 +1082,11 @@ bool SpeciesImpl::setDm(const std::string &Dm)
   return false;
 }
 
+void SpeciesImpl::setDm(const PRJFLOAT &Dm)
+{
+  m_Dm = Dm;
+}
+
 double SpeciesImpl::ccdef() const
 {
   return m_ccdef.toDouble();
@@ -999,7 +1094,7 @@ double SpeciesImpl::ccdef() const
 
 bool SpeciesImpl::setCcdef(const double ccdef)
 {
-  m_ccdef = QString::number(ccdef);
+  m_ccdef = ccdef;
   return true;
 }
 
@@ -1015,6 +1110,11 @@ bool SpeciesImpl::setCcdef(const std::string &ccdef)
   return false;
 }
 
+void SpeciesImpl::setCcdef(const PRJFLOAT &ccdef)
+{
+  m_ccdef = ccdef;
+}
+
 double SpeciesImpl::Cp() const
 {
   return m_Cp.toDouble();
@@ -1038,6 +1138,11 @@ bool SpeciesImpl::setCp(const std::string &Cp)
   return false;
 }
 
+void SpeciesImpl::setCp(const PRJFLOAT &Cp)
+{
+  m_Cp = Cp;
+}
+
 int SpeciesImpl::ucc() const
 {
   return m_ucc;
@@ -1370,16 +1475,16 @@ void AirflowPathImpl::read(Reader &input)
   setPs(input.read<int>());
   setPc(input.read<int>());
   setPld(input.read<int>());
-  setX(input.readNumber<std::string>());
-  setY(input.readNumber<std::string>());
-  setRelHt(input.readNumber<std::string>());
-  setMult(input.readNumber<std::string>());
-  setWPset(input.readNumber<std::string>());
-  setWPmod(input.readNumber<std::string>());
-  setWazm(input.readNumber<std::string>());
-  setFahs(input.readNumber<std::string>());
-  setXmax(input.readNumber<std::string>());
-  setXmin(input.readNumber<std::string>());
+  setX(input.readNumber<PRJFLOAT>());
+  setY(input.readNumber<PRJFLOAT>());
+  setRelHt(input.readNumber<PRJFLOAT>());
+  setMult(input.readNumber<PRJFLOAT>());
+  setWPset(input.readNumber<PRJFLOAT>());
+  setWPmod(input.readNumber<PRJFLOAT>());
+  setWazm(input.readNumber<PRJFLOAT>());
+  setFahs(input.readNumber<PRJFLOAT>());
+  setXmax(input.readNumber<PRJFLOAT>());
+  setXmin(input.readNumber<PRJFLOAT>());
   setIcon(input.read<unsigned int>());
   setDir(input.read<unsigned int>());
   setU_Ht(input.read<int>());
@@ -1531,7 +1636,7 @@ double AirflowPathImpl::X() const
 
 bool AirflowPathImpl::setX(const double X)
 {
-  m_X = QString::number(X);
+  m_X = X;
   return true;
 }
 
@@ -1547,6 +1652,11 @@ bool AirflowPathImpl::setX(const std::string &X)
   return false;
 }
 
+void AirflowPathImpl::setX(const PRJFLOAT &X)
+{
+  m_X = X;
+}
+
 double AirflowPathImpl::Y() const
 {
   return m_Y.toDouble();
@@ -1554,7 +1664,7 @@ double AirflowPathImpl::Y() const
 
 bool AirflowPathImpl::setY(const double Y)
 {
-  m_Y = QString::number(Y);
+  m_Y = Y;
   return true;
 }
 
@@ -1570,6 +1680,11 @@ bool AirflowPathImpl::setY(const std::string &Y)
   return false;
 }
 
+void AirflowPathImpl::setY(const PRJFLOAT &Y)
+{
+  m_Y = Y;
+}
+
 double AirflowPathImpl::relHt() const
 {
   return m_relHt.toDouble();
@@ -1577,7 +1692,7 @@ double AirflowPathImpl::relHt() const
 
 bool AirflowPathImpl::setRelHt(const double relHt)
 {
-  m_relHt = QString::number(relHt);
+  m_relHt = relHt;
   return true;
 }
 
@@ -1593,6 +1708,11 @@ bool AirflowPathImpl::setRelHt(const std::string &relHt)
   return false;
 }
 
+void AirflowPathImpl::setRelHt(const PRJFLOAT &relHt)
+{
+  m_relHt = relHt;
+}
+
 double AirflowPathImpl::mult() const
 {
   return m_mult.toDouble();
@@ -1600,7 +1720,7 @@ double AirflowPathImpl::mult() const
 
 bool AirflowPathImpl::setMult(const double mult)
 {
-  m_mult = QString::number(mult);
+  m_mult = mult;
   return true;
 }
 
@@ -1616,6 +1736,11 @@ bool AirflowPathImpl::setMult(const std::string &mult)
   return false;
 }
 
+void AirflowPathImpl::setMult(const PRJFLOAT &mult)
+{
+  m_mult = mult;
+}
+
 double AirflowPathImpl::wPset() const
 {
   return m_wPset.toDouble();
@@ -1623,7 +1748,7 @@ double AirflowPathImpl::wPset() const
 
 bool AirflowPathImpl::setWPset(const double wPset)
 {
-  m_wPset = QString::number(wPset);
+  m_wPset = wPset;
   return true;
 }
 
@@ -1639,6 +1764,11 @@ bool AirflowPathImpl::setWPset(const std::string &wPset)
   return false;
 }
 
+void AirflowPathImpl::setWPset(const PRJFLOAT &wPset)
+{
+  m_wPset = wPset;
+}
+
 double AirflowPathImpl::wPmod() const
 {
   return m_wPmod.toDouble();
@@ -1646,7 +1776,7 @@ double AirflowPathImpl::wPmod() const
 
 bool AirflowPathImpl::setWPmod(const double wPmod)
 {
-  m_wPmod = QString::number(wPmod);
+  m_wPmod = wPmod;
   return true;
 }
 
@@ -1662,6 +1792,11 @@ bool AirflowPathImpl::setWPmod(const std::string &wPmod)
   return false;
 }
 
+void AirflowPathImpl::setWPmod(const PRJFLOAT &wPmod)
+{
+  m_wPmod = wPmod;
+}
+
 double AirflowPathImpl::wazm() const
 {
   return m_wazm.toDouble();
@@ -1669,7 +1804,7 @@ double AirflowPathImpl::wazm() const
 
 bool AirflowPathImpl::setWazm(const double wazm)
 {
-  m_wazm = QString::number(wazm);
+  m_wazm = wazm;
   return true;
 }
 
@@ -1685,6 +1820,11 @@ bool AirflowPathImpl::setWazm(const std::string &wazm)
   return false;
 }
 
+void AirflowPathImpl::setWazm(const PRJFLOAT &wazm)
+{
+  m_wazm = wazm;
+}
+
 double AirflowPathImpl::Fahs() const
 {
   return m_Fahs.toDouble();
@@ -1692,7 +1832,7 @@ double AirflowPathImpl::Fahs() const
 
 bool AirflowPathImpl::setFahs(const double Fahs)
 {
-  m_Fahs = QString::number(Fahs);
+  m_Fahs = Fahs;
   return true;
 }
 
@@ -1708,6 +1848,11 @@ bool AirflowPathImpl::setFahs(const std::string &Fahs)
   return false;
 }
 
+void AirflowPathImpl::setFahs(const PRJFLOAT &Fahs)
+{
+  m_Fahs = Fahs;
+}
+
 double AirflowPathImpl::Xmax() const
 {
   return m_Xmax.toDouble();
@@ -1715,7 +1860,7 @@ double AirflowPathImpl::Xmax() const
 
 bool AirflowPathImpl::setXmax(const double Xmax)
 {
-  m_Xmax = QString::number(Xmax);
+  m_Xmax = Xmax;
   return true;
 }
 
@@ -1731,6 +1876,11 @@ bool AirflowPathImpl::setXmax(const std::string &Xmax)
   return false;
 }
 
+void AirflowPathImpl::setXmax(const PRJFLOAT &Xmax)
+{
+  m_Xmax = Xmax;
+}
+
 double AirflowPathImpl::Xmin() const
 {
   return m_Xmin.toDouble();
@@ -1738,7 +1888,7 @@ double AirflowPathImpl::Xmin() const
 
 bool AirflowPathImpl::setXmin(const double Xmin)
 {
-  m_Xmin = QString::number(Xmin);
+  m_Xmin = Xmin;
   return true;
 }
 
@@ -1754,6 +1904,11 @@ bool AirflowPathImpl::setXmin(const std::string &Xmin)
   return false;
 }
 
+void AirflowPathImpl::setXmin(const PRJFLOAT &Xmin)
+{
+  m_Xmin = Xmin;
+}
+
 unsigned int AirflowPathImpl::icon() const
 {
   return m_icon;
@@ -2289,59 +2444,59 @@ void RunControlImpl::read(Reader &input)
   setSim_af(input.read<int>());
   setAfcalc(input.read<int>());
   setAfmaxi(input.read<int>());
-  setAfrcnvg(input.readNumber<std::string>());
-  setAfacnvg(input.readNumber<std::string>());
-  setAfrelax(input.readNumber<std::string>());
+  setAfrcnvg(input.readNumber<PRJFLOAT>());
+  setAfacnvg(input.readNumber<PRJFLOAT>());
+  setAfrelax(input.readNumber<PRJFLOAT>());
   setUac2(input.read<int>());
-  setPres(input.readNumber<std::string>());
+  setPres(input.readNumber<PRJFLOAT>());
   setUPres(input.read<int>());
   setAfslae(input.read<int>());
   setAfrseq(input.read<int>());
   setAflmaxi(input.read<int>());
-  setAflcnvg(input.readNumber<std::string>());
+  setAflcnvg(input.readNumber<PRJFLOAT>());
   setAflinit(input.read<int>());
   setTadj(input.read<int>());
   setSim_mf(input.read<int>());
   setCcmaxi(input.read<int>());
-  setCcrcnvg(input.readNumber<std::string>());
-  setCcacnvg(input.readNumber<std::string>());
-  setCcrelax(input.readNumber<std::string>());
+  setCcrcnvg(input.readNumber<PRJFLOAT>());
+  setCcacnvg(input.readNumber<PRJFLOAT>());
+  setCcrelax(input.readNumber<PRJFLOAT>());
   setUccc(input.read<int>());
   setMfnmthd(input.read<int>());
   setMfnrseq(input.read<int>());
   setMfnmaxi(input.read<int>());
-  setMfnrcnvg(input.readNumber<std::string>());
-  setMfnacnvg(input.readNumber<std::string>());
-  setMfnrelax(input.readNumber<std::string>());
-  setMfngamma(input.readNumber<std::string>());
+  setMfnrcnvg(input.readNumber<PRJFLOAT>());
+  setMfnacnvg(input.readNumber<PRJFLOAT>());
+  setMfnrelax(input.readNumber<PRJFLOAT>());
+  setMfngamma(input.readNumber<PRJFLOAT>());
   setUccn(input.read<int>());
   setMftmthd(input.read<int>());
   setMftrseq(input.read<int>());
   setMftmaxi(input.read<int>());
-  setMftrcnvg(input.readNumber<std::string>());
-  setMftacnvg(input.readNumber<std::string>());
-  setMftrelax(input.readNumber<std::string>());
-  setMftgamma(input.readNumber<std::string>());
+  setMftrcnvg(input.readNumber<PRJFLOAT>());
+  setMftacnvg(input.readNumber<PRJFLOAT>());
+  setMftrelax(input.readNumber<PRJFLOAT>());
+  setMftgamma(input.readNumber<PRJFLOAT>());
   setUcct(input.read<int>());
   setMfvmthd(input.read<int>());
   setMfvrseq(input.read<int>());
   setMfvmaxi(input.read<int>());
-  setMfvrcnvg(input.readNumber<std::string>());
-  setMfvacnvg(input.readNumber<std::string>());
-  setMfvrelax(input.readNumber<std::string>());
+  setMfvrcnvg(input.readNumber<PRJFLOAT>());
+  setMfvacnvg(input.readNumber<PRJFLOAT>());
+  setMfvrelax(input.readNumber<PRJFLOAT>());
   setUccv(input.read<int>());
   setMf_solver(input.read<int>());
   setSim_1dz(input.read<int>());
   setSim_1dd(input.read<int>());
-  setCelldx(input.readNumber<std::string>());
+  setCelldx(input.readNumber<PRJFLOAT>());
   setSim_vjt(input.read<int>());
   setUdx(input.read<int>());
   setCvode_mth(input.read<int>());
-  setCvode_rcnvg(input.readNumber<std::string>());
-  setCvode_acnvg(input.readNumber<std::string>());
-  setCvode_dtmax(input.readNumber<std::string>());
+  setCvode_rcnvg(input.readNumber<PRJFLOAT>());
+  setCvode_acnvg(input.readNumber<PRJFLOAT>());
+  setCvode_dtmax(input.readNumber<PRJFLOAT>());
   setTsdens(input.read<int>());
-  setTsrelax(input.readNumber<std::string>());
+  setTsrelax(input.readNumber<PRJFLOAT>());
   setTsmaxi(input.read<int>());
   setCnvgSS(input.read<int>());
   setDensZP(input.read<int>());
@@ -2385,17 +2540,17 @@ void RunControlImpl::read(Reader &input)
   }
   setSave(save);
   int nrvals = input.read<int>();
-  std::vector<std::string> rvals;
+  std::vector<PRJFLOAT> rvals;
   for(int i=0;i<nrvals;i++)
   {
-    rvals.push_back(input.read<std::string>());
+    rvals.push_back(input.readNumber<PRJFLOAT>());
   }
   setRvals(rvals);
   setBldgFlowZ(input.read<int>());
   setBldgFlowD(input.read<int>());
   setBldgFlowC(input.read<int>());
   setCfd_ctype(input.read<int>());
-  setCfd_convcpl(input.readNumber<std::string>());
+  setCfd_convcpl(input.readNumber<PRJFLOAT>());
   setCfd_var(input.read<int>());
   setCfd_zref(input.read<int>());
   setCfd_imax(input.read<int>());
@@ -2488,7 +2643,7 @@ double RunControlImpl::afrcnvg() const
 
 bool RunControlImpl::setAfrcnvg(const double afrcnvg)
 {
-  m_afrcnvg = QString::number(afrcnvg);
+  m_afrcnvg = afrcnvg;
   return true;
 }
 
@@ -2504,6 +2659,11 @@ bool RunControlImpl::setAfrcnvg(const std::string &afrcnvg)
   return false;
 }
 
+void RunControlImpl::setAfrcnvg(const PRJFLOAT &afrcnvg)
+{
+  m_afrcnvg = afrcnvg;
+}
+
 double RunControlImpl::afacnvg() const
 {
   return m_afacnvg.toDouble();
@@ -2511,7 +2671,7 @@ double RunControlImpl::afacnvg() const
 
 bool RunControlImpl::setAfacnvg(const double afacnvg)
 {
-  m_afacnvg = QString::number(afacnvg);
+  m_afacnvg = afacnvg;
   return true;
 }
 
@@ -2527,6 +2687,11 @@ bool RunControlImpl::setAfacnvg(const std::string &afacnvg)
   return false;
 }
 
+void RunControlImpl::setAfacnvg(const PRJFLOAT &afacnvg)
+{
+  m_afacnvg = afacnvg;
+}
+
 double RunControlImpl::afrelax() const
 {
   return m_afrelax.toDouble();
@@ -2534,7 +2699,7 @@ double RunControlImpl::afrelax() const
 
 bool RunControlImpl::setAfrelax(const double afrelax)
 {
-  m_afrelax = QString::number(afrelax);
+  m_afrelax = afrelax;
   return true;
 }
 
@@ -2550,6 +2715,11 @@ bool RunControlImpl::setAfrelax(const std::string &afrelax)
   return false;
 }
 
+void RunControlImpl::setAfrelax(const PRJFLOAT &afrelax)
+{
+  m_afrelax = afrelax;
+}
+
 int RunControlImpl::uac2() const
 {
   return m_uac2;
@@ -2567,7 +2737,7 @@ double RunControlImpl::Pres() const
 
 bool RunControlImpl::setPres(const double Pres)
 {
-  m_Pres = QString::number(Pres);
+  m_Pres = Pres;
   return true;
 }
 
@@ -2583,6 +2753,11 @@ bool RunControlImpl::setPres(const std::string &Pres)
   return false;
 }
 
+void RunControlImpl::setPres(const PRJFLOAT &Pres)
+{
+  m_Pres = Pres;
+}
+
 int RunControlImpl::uPres() const
 {
   return m_uPres;
@@ -2630,7 +2805,7 @@ double RunControlImpl::aflcnvg() const
 
 bool RunControlImpl::setAflcnvg(const double aflcnvg)
 {
-  m_aflcnvg = QString::number(aflcnvg);
+  m_aflcnvg = aflcnvg;
   return true;
 }
 
@@ -2646,6 +2821,11 @@ bool RunControlImpl::setAflcnvg(const std::string &aflcnvg)
   return false;
 }
 
+void RunControlImpl::setAflcnvg(const PRJFLOAT &aflcnvg)
+{
+  m_aflcnvg = aflcnvg;
+}
+
 int RunControlImpl::aflinit() const
 {
   return m_aflinit;
@@ -2693,7 +2873,7 @@ double RunControlImpl::ccrcnvg() const
 
 bool RunControlImpl::setCcrcnvg(const double ccrcnvg)
 {
-  m_ccrcnvg = QString::number(ccrcnvg);
+  m_ccrcnvg = ccrcnvg;
   return true;
 }
 
@@ -2709,6 +2889,11 @@ bool RunControlImpl::setCcrcnvg(const std::string &ccrcnvg)
   return false;
 }
 
+void RunControlImpl::setCcrcnvg(const PRJFLOAT &ccrcnvg)
+{
+  m_ccrcnvg = ccrcnvg;
+}
+
 double RunControlImpl::ccacnvg() const
 {
   return m_ccacnvg.toDouble();
@@ -2716,7 +2901,7 @@ double RunControlImpl::ccacnvg() const
 
 bool RunControlImpl::setCcacnvg(const double ccacnvg)
 {
-  m_ccacnvg = QString::number(ccacnvg);
+  m_ccacnvg = ccacnvg;
   return true;
 }
 
@@ -2732,6 +2917,11 @@ bool RunControlImpl::setCcacnvg(const std::string &ccacnvg)
   return false;
 }
 
+void RunControlImpl::setCcacnvg(const PRJFLOAT &ccacnvg)
+{
+  m_ccacnvg = ccacnvg;
+}
+
 double RunControlImpl::ccrelax() const
 {
   return m_ccrelax.toDouble();
@@ -2739,7 +2929,7 @@ double RunControlImpl::ccrelax() const
 
 bool RunControlImpl::setCcrelax(const double ccrelax)
 {
-  m_ccrelax = QString::number(ccrelax);
+  m_ccrelax = ccrelax;
   return true;
 }
 
@@ -2755,6 +2945,11 @@ bool RunControlImpl::setCcrelax(const std::string &ccrelax)
   return false;
 }
 
+void RunControlImpl::setCcrelax(const PRJFLOAT &ccrelax)
+{
+  m_ccrelax = ccrelax;
+}
+
 int RunControlImpl::uccc() const
 {
   return m_uccc;
@@ -2802,7 +2997,7 @@ double RunControlImpl::mfnrcnvg() const
 
 bool RunControlImpl::setMfnrcnvg(const double mfnrcnvg)
 {
-  m_mfnrcnvg = QString::number(mfnrcnvg);
+  m_mfnrcnvg = mfnrcnvg;
   return true;
 }
 
@@ -2818,6 +3013,11 @@ bool RunControlImpl::setMfnrcnvg(const std::string &mfnrcnvg)
   return false;
 }
 
+void RunControlImpl::setMfnrcnvg(const PRJFLOAT &mfnrcnvg)
+{
+  m_mfnrcnvg = mfnrcnvg;
+}
+
 double RunControlImpl::mfnacnvg() const
 {
   return m_mfnacnvg.toDouble();
@@ -2825,7 +3025,7 @@ double RunControlImpl::mfnacnvg() const
 
 bool RunControlImpl::setMfnacnvg(const double mfnacnvg)
 {
-  m_mfnacnvg = QString::number(mfnacnvg);
+  m_mfnacnvg = mfnacnvg;
   return true;
 }
 
@@ -2841,6 +3041,11 @@ bool RunControlImpl::setMfnacnvg(const std::string &mfnacnvg)
   return false;
 }
 
+void RunControlImpl::setMfnacnvg(const PRJFLOAT &mfnacnvg)
+{
+  m_mfnacnvg = mfnacnvg;
+}
+
 double RunControlImpl::mfnrelax() const
 {
   return m_mfnrelax.toDouble();
@@ -2848,7 +3053,7 @@ double RunControlImpl::mfnrelax() const
 
 bool RunControlImpl::setMfnrelax(const double mfnrelax)
 {
-  m_mfnrelax = QString::number(mfnrelax);
+  m_mfnrelax = mfnrelax;
   return true;
 }
 
@@ -2864,6 +3069,11 @@ bool RunControlImpl::setMfnrelax(const std::string &mfnrelax)
   return false;
 }
 
+void RunControlImpl::setMfnrelax(const PRJFLOAT &mfnrelax)
+{
+  m_mfnrelax = mfnrelax;
+}
+
 double RunControlImpl::mfngamma() const
 {
   return m_mfngamma.toDouble();
@@ -2871,7 +3081,7 @@ double RunControlImpl::mfngamma() const
 
 bool RunControlImpl::setMfngamma(const double mfngamma)
 {
-  m_mfngamma = QString::number(mfngamma);
+  m_mfngamma = mfngamma;
   return true;
 }
 
@@ -2887,6 +3097,11 @@ bool RunControlImpl::setMfngamma(const std::string &mfngamma)
   return false;
 }
 
+void RunControlImpl::setMfngamma(const PRJFLOAT &mfngamma)
+{
+  m_mfngamma = mfngamma;
+}
+
 int RunControlImpl::uccn() const
 {
   return m_uccn;
@@ -2934,7 +3149,7 @@ double RunControlImpl::mftrcnvg() const
 
 bool RunControlImpl::setMftrcnvg(const double mftrcnvg)
 {
-  m_mftrcnvg = QString::number(mftrcnvg);
+  m_mftrcnvg = mftrcnvg;
   return true;
 }
 
@@ -2950,6 +3165,11 @@ bool RunControlImpl::setMftrcnvg(const std::string &mftrcnvg)
   return false;
 }
 
+void RunControlImpl::setMftrcnvg(const PRJFLOAT &mftrcnvg)
+{
+  m_mftrcnvg = mftrcnvg;
+}
+
 double RunControlImpl::mftacnvg() const
 {
   return m_mftacnvg.toDouble();
@@ -2957,7 +3177,7 @@ double RunControlImpl::mftacnvg() const
 
 bool RunControlImpl::setMftacnvg(const double mftacnvg)
 {
-  m_mftacnvg = QString::number(mftacnvg);
+  m_mftacnvg = mftacnvg;
   return true;
 }
 
@@ -2973,6 +3193,11 @@ bool RunControlImpl::setMftacnvg(const std::string &mftacnvg)
   return false;
 }
 
+void RunControlImpl::setMftacnvg(const PRJFLOAT &mftacnvg)
+{
+  m_mftacnvg = mftacnvg;
+}
+
 double RunControlImpl::mftrelax() const
 {
   return m_mftrelax.toDouble();
@@ -2980,7 +3205,7 @@ double RunControlImpl::mftrelax() const
 
 bool RunControlImpl::setMftrelax(const double mftrelax)
 {
-  m_mftrelax = QString::number(mftrelax);
+  m_mftrelax = mftrelax;
   return true;
 }
 
@@ -2996,6 +3221,11 @@ bool RunControlImpl::setMftrelax(const std::string &mftrelax)
   return false;
 }
 
+void RunControlImpl::setMftrelax(const PRJFLOAT &mftrelax)
+{
+  m_mftrelax = mftrelax;
+}
+
 double RunControlImpl::mftgamma() const
 {
   return m_mftgamma.toDouble();
@@ -3003,7 +3233,7 @@ double RunControlImpl::mftgamma() const
 
 bool RunControlImpl::setMftgamma(const double mftgamma)
 {
-  m_mftgamma = QString::number(mftgamma);
+  m_mftgamma = mftgamma;
   return true;
 }
 
@@ -3019,6 +3249,11 @@ bool RunControlImpl::setMftgamma(const std::string &mftgamma)
   return false;
 }
 
+void RunControlImpl::setMftgamma(const PRJFLOAT &mftgamma)
+{
+  m_mftgamma = mftgamma;
+}
+
 int RunControlImpl::ucct() const
 {
   return m_ucct;
@@ -3066,7 +3301,7 @@ double RunControlImpl::mfvrcnvg() const
 
 bool RunControlImpl::setMfvrcnvg(const double mfvrcnvg)
 {
-  m_mfvrcnvg = QString::number(mfvrcnvg);
+  m_mfvrcnvg = mfvrcnvg;
   return true;
 }
 
@@ -3082,6 +3317,11 @@ bool RunControlImpl::setMfvrcnvg(const std::string &mfvrcnvg)
   return false;
 }
 
+void RunControlImpl::setMfvrcnvg(const PRJFLOAT &mfvrcnvg)
+{
+  m_mfvrcnvg = mfvrcnvg;
+}
+
 double RunControlImpl::mfvacnvg() const
 {
   return m_mfvacnvg.toDouble();
@@ -3089,7 +3329,7 @@ double RunControlImpl::mfvacnvg() const
 
 bool RunControlImpl::setMfvacnvg(const double mfvacnvg)
 {
-  m_mfvacnvg = QString::number(mfvacnvg);
+  m_mfvacnvg = mfvacnvg;
   return true;
 }
 
@@ -3105,6 +3345,11 @@ bool RunControlImpl::setMfvacnvg(const std::string &mfvacnvg)
   return false;
 }
 
+void RunControlImpl::setMfvacnvg(const PRJFLOAT &mfvacnvg)
+{
+  m_mfvacnvg = mfvacnvg;
+}
+
 double RunControlImpl::mfvrelax() const
 {
   return m_mfvrelax.toDouble();
@@ -3112,7 +3357,7 @@ double RunControlImpl::mfvrelax() const
 
 bool RunControlImpl::setMfvrelax(const double mfvrelax)
 {
-  m_mfvrelax = QString::number(mfvrelax);
+  m_mfvrelax = mfvrelax;
   return true;
 }
 
@@ -3128,6 +3373,11 @@ bool RunControlImpl::setMfvrelax(const std::string &mfvrelax)
   return false;
 }
 
+void RunControlImpl::setMfvrelax(const PRJFLOAT &mfvrelax)
+{
+  m_mfvrelax = mfvrelax;
+}
+
 int RunControlImpl::uccv() const
 {
   return m_uccv;
@@ -3175,7 +3425,7 @@ double RunControlImpl::celldx() const
 
 bool RunControlImpl::setCelldx(const double celldx)
 {
-  m_celldx = QString::number(celldx);
+  m_celldx = celldx;
   return true;
 }
 
@@ -3191,6 +3441,11 @@ bool RunControlImpl::setCelldx(const std::string &celldx)
   return false;
 }
 
+void RunControlImpl::setCelldx(const PRJFLOAT &celldx)
+{
+  m_celldx = celldx;
+}
+
 int RunControlImpl::sim_vjt() const
 {
   return m_sim_vjt;
@@ -3228,7 +3483,7 @@ double RunControlImpl::cvode_rcnvg() const
 
 bool RunControlImpl::setCvode_rcnvg(const double cvode_rcnvg)
 {
-  m_cvode_rcnvg = QString::number(cvode_rcnvg);
+  m_cvode_rcnvg = cvode_rcnvg;
   return true;
 }
 
@@ -3244,6 +3499,11 @@ bool RunControlImpl::setCvode_rcnvg(const std::string &cvode_rcnvg)
   return false;
 }
 
+void RunControlImpl::setCvode_rcnvg(const PRJFLOAT &cvode_rcnvg)
+{
+  m_cvode_rcnvg = cvode_rcnvg;
+}
+
 double RunControlImpl::cvode_acnvg() const
 {
   return m_cvode_acnvg.toDouble();
@@ -3251,7 +3511,7 @@ double RunControlImpl::cvode_acnvg() const
 
 bool RunControlImpl::setCvode_acnvg(const double cvode_acnvg)
 {
-  m_cvode_acnvg = QString::number(cvode_acnvg);
+  m_cvode_acnvg = cvode_acnvg;
   return true;
 }
 
@@ -3267,6 +3527,11 @@ bool RunControlImpl::setCvode_acnvg(const std::string &cvode_acnvg)
   return false;
 }
 
+void RunControlImpl::setCvode_acnvg(const PRJFLOAT &cvode_acnvg)
+{
+  m_cvode_acnvg = cvode_acnvg;
+}
+
 double RunControlImpl::cvode_dtmax() const
 {
   return m_cvode_dtmax.toDouble();
@@ -3274,7 +3539,7 @@ double RunControlImpl::cvode_dtmax() const
 
 bool RunControlImpl::setCvode_dtmax(const double cvode_dtmax)
 {
-  m_cvode_dtmax = QString::number(cvode_dtmax);
+  m_cvode_dtmax = cvode_dtmax;
   return true;
 }
 
@@ -3290,6 +3555,11 @@ bool RunControlImpl::setCvode_dtmax(const std::string &cvode_dtmax)
   return false;
 }
 
+void RunControlImpl::setCvode_dtmax(const PRJFLOAT &cvode_dtmax)
+{
+  m_cvode_dtmax = cvode_dtmax;
+}
+
 int RunControlImpl::tsdens() const
 {
   return m_tsdens;
@@ -3307,7 +3577,7 @@ double RunControlImpl::tsrelax() const
 
 bool RunControlImpl::setTsrelax(const double tsrelax)
 {
-  m_tsrelax = QString::number(tsrelax);
+  m_tsrelax = tsrelax;
   return true;
 }
 
@@ -3323,6 +3593,11 @@ bool RunControlImpl::setTsrelax(const std::string &tsrelax)
   return false;
 }
 
+void RunControlImpl::setTsrelax(const PRJFLOAT &tsrelax)
+{
+  m_tsrelax = tsrelax;
+}
+
 int RunControlImpl::tsmaxi() const
 {
   return m_tsmaxi;
@@ -3707,7 +3982,7 @@ bool RunControlImpl::setRvals(const std::vector<double> &rvals)
 {
   for(unsigned i=0;i<rvals.size();i++)
   {
-    m_rvals.push_back(QString::number(rvals[i]));
+    m_rvals.push_back(rvals[i]);
   }
   return true;
 }
@@ -3729,6 +4004,11 @@ bool RunControlImpl::setRvals(const std::vector<std::string> &rvals)
   return true;
 }
 
+void RunControlImpl::setRvals(const std::vector<PRJFLOAT> &rvals)
+{
+  m_rvals = rvals;
+}
+
 int RunControlImpl::BldgFlowZ() const
 {
   return m_BldgFlowZ;
@@ -3776,7 +4056,7 @@ double RunControlImpl::cfd_convcpl() const
 
 bool RunControlImpl::setCfd_convcpl(const double cfd_convcpl)
 {
-  m_cfd_convcpl = QString::number(cfd_convcpl);
+  m_cfd_convcpl = cfd_convcpl;
   return true;
 }
 
@@ -3792,6 +4072,11 @@ bool RunControlImpl::setCfd_convcpl(const std::string &cfd_convcpl)
   return false;
 }
 
+void RunControlImpl::setCfd_convcpl(const PRJFLOAT &cfd_convcpl)
+{
+  m_cfd_convcpl = cfd_convcpl;
+}
+
 int RunControlImpl::cfd_var() const
 {
   return m_cfd_var;
@@ -3873,8 +4158,8 @@ LevelImpl::LevelImpl(int nr,std::string refht,std::string delht,int u_rfht,int u
 void LevelImpl::read(Reader &input)
 {
   setNr(input.read<int>());
-  setRefht(input.readNumber<std::string>());
-  setDelht(input.readNumber<std::string>());
+  setRefht(input.readNumber<PRJFLOAT>());
+  setDelht(input.readNumber<PRJFLOAT>());
   int nicon = input.read<int>();
   setU_rfht(input.read<int>());
   setU_dlht(input.read<int>());
@@ -3918,7 +4203,7 @@ double LevelImpl::refht() const
 
 bool LevelImpl::setRefht(const double refht)
 {
-  m_refht = QString::number(refht);
+  m_refht = refht;
   return true;
 }
 
@@ -3934,6 +4219,11 @@ bool LevelImpl::setRefht(const std::string &refht)
   return false;
 }
 
+void LevelImpl::setRefht(const PRJFLOAT &refht)
+{
+  m_refht = refht;
+}
+
 double LevelImpl::delht() const
 {
   return m_delht.toDouble();
@@ -3941,7 +4231,7 @@ double LevelImpl::delht() const
 
 bool LevelImpl::setDelht(const double delht)
 {
-  m_delht = QString::number(delht);
+  m_delht = delht;
   return true;
 }
 
@@ -3957,6 +4247,11 @@ bool LevelImpl::setDelht(const std::string &delht)
   return false;
 }
 
+void LevelImpl::setDelht(const PRJFLOAT &delht)
+{
+  m_delht = delht;
+}
+
 int LevelImpl::u_rfht() const
 {
   return m_u_rfht;
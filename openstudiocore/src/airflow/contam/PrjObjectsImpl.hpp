@@ -81,24 +81,32 @@ public:
   bool setRelHt(const double relHt);
   /** Sets the zone height [m]. */
   bool setRelHt(const std::string &relHt);
+  /** Sets the zone height [m]. */
+  void setRelHt(const PRJFLOAT &relHt);
   /** Returns the zone volume [m^3]. */
   double Vol() const;
   /** Sets the zone volume [m^3]. */
   bool setVol(const double Vol);
   /** Sets the zone volume [m^3]. */
   bool setVol(const std::string &Vol);
+  /** Sets the zone volume [m^3]. */
+  void setVol(const PRJFLOAT &Vol);
   /** Returns the initial zone temperature [K]. */
   double T0() const;
   /** Sets the initial zone temperature [K]. */
   bool setT0(const double T0);
   /** Sets the initial zone temperature [K]. */
   bool setT0(const std::string &T0);
+  /** Sets the initial zone temperature [K]. */
+  void setT0(const PRJFLOAT &T0);
   /** Returns the initial zone pressure [Pa]. */
   double P0() const;
   /** Sets the initial zone pressure [Pa]. */
   bool setP0(const double P0);
   /** Sets the initial zone pressure [Pa]. */
   bool setP0(const std::string &P0);
+  /** Sets the initial zone pressure [Pa]. */
+  void setP0(const PRJFLOAT &P0);
   /** Returns the zone name. */
   std::string name() const;
   /** Sets the zone name. */
@@ -141,48 +149,64 @@ public:
   bool setX1(const double X1);
   /** Sets the X coordinate of one end of the cdaxis. */
   bool setX1(const std::string &X1);
+  /** Sets the X coordinate of one end of the cdaxis. */
+  void setX1(const PRJFLOAT &X1);
   /** Returns the Y coordinate of one end of the cdaxis. */
   double Y1() const;
   /** Sets the Y coordinate of one end of the cdaxis. */
   bool setY1(const double Y1);
   /** Sets the Y coordinate of one end of the cdaxis. */
   bool setY1(const std::string &Y1);
+  /** Sets the Y coordinate of one end of the cdaxis. */
+  void setY1(const PRJFLOAT &Y1);
   /** Returns the relative height of one end of the cdaxis. */
   double H1() const;
   /** Sets the relative height of one end of the cdaxis. */
   bool setH1(const double H1);
   /** Sets the relative height of one end of the cdaxis. */
   bool setH1(const std::string &H1);
+  /** Sets the relative height of one end of the cdaxis. */
+  void setH1(const PRJFLOAT &H1);
   /** Returns the X coordinate of the other end of the cdaxis. */
   double X2() const;
   /** Sets the X coordinate of the other end of the cdaxis. */
   bool setX2(const double X2);
   /** Sets the X coordinate of the other end of the cdaxis. */
   bool setX2(const std::string &X2);
+  /** Sets the X coordinate of the other end of the cdaxis. */
+  void setX2(const PRJFLOAT &X2);
   /** Returns the Y coordinate of the other end of the cdaxis. */
   double Y2() const;
   /** Sets the Y coordinate of the other end of the cdaxis. */
   bool setY2(const double Y2);
   /** Sets the Y coordinate of the other end of the cdaxis. */
   bool setY2(const std::string &Y2);
+  /** Sets the Y coordinate of the other end of the cdaxis. */
+  void setY2(const PRJFLOAT &Y2);
   /** Returns the relative height of the other end of the cdaxis. */
   double H2() const;
   /** Sets the relative height of the other end of the cdaxis. */
   bool setH2(const double H2);
   /** Sets the relative height of the other end of the cdaxis. */
   bool setH2(const std::string &H2);
+  /** Sets the relative height of the other end of the cdaxis. */
+  void setH2(const PRJFLOAT &H2);
   /** Returns the convection/diffusion cell length [m]. */
   double celldx() const;
   /** Returns the convection/diffusion cell length [m]. */
   bool setCelldx(const double celldx);
   /** Returns the convection/diffusion cell length [m]. */
   bool setCelldx(const std::string &celldx);
+  /** Returns the convection/diffusion cell length [m]. */
+  void setCelldx(const PRJFLOAT &celldx);
   /** Returns the axial diffusion coeff [m^2/s]. */
   double axialD() const;
   /** Sets the axial diffusion coeff [m^2/s]. */
   bool setAxialD(const double axialD);
   /** Sets the axial diffusion coeff [m^2/s]. */
   bool setAxialD(const std::string &axialD);
+  /** Sets the axial diffusion coeff [m^2/s]. */
+  void setAxialD(const PRJFLOAT &axialD);
   /** Returns the display units of axial diffusion. */
   int u_aD() const;
   /** Sets the display units of axial diffusion. */
@@ -215,6 +239,8 @@ public:
   bool setIc(std::vector<double> &ic);
   /** Sets the contaminant initial condition vector. */
   bool setIc(std::vector<std::string> &ic);
+  /** Sets the contaminant initial condition vector. */
+  void setIc(const std::vector<PRJFLOAT> &ic);
 
 private:
   void setDefaults();
@@ -296,42 +322,56 @@ public:
   bool setMolwt(const double molwt);
   /** Sets the molar mass [kg/kmol] for gas contaminants. */
   bool setMolwt(const std::string &molwt);
+  /** Sets the molar mass [kg/kmol] for gas contaminants. */
+  void setMolwt(const PRJFLOAT &molwt);
   /** Returns the mean diameter [m] for particle contaminants. */
   double mdiam() const;
   /** Sets the mean diameter [m] for particle contaminants. */
   bool setMdiam(const double mdiam);
   /** Sets the mean diameter [m] for particle contaminants. */
   bool setMdiam(const std::string &mdiam);
+  /** Sets the mean diameter [m] for particle contaminants. */
+  void setMdiam(const PRJFLOAT &mdiam);
   /** Returns the effective density [kg/m^3] for particle contaminants. */
   double edens() const;
   /** Sets the effective density [kg/m^3] for particle contaminants. */
   bool setEdens(const double edens);
   /** Sets the effective density [kg/m^3] for particle contaminants. */
   bool setEdens(const std::string &edens);
+  /** Sets the effective density [kg/m^3] for particle contaminants. */
+  void setEdens(const PRJFLOAT &edens);
   /** Returns the contaminant decay constant [1/s]. */
   double decay() const;
   /** Sets the contaminant decay constant [1/s]. */
   bool setDecay(const double decay);
   /** Sets the contaminant decay constant [1/s]. */
   bool setDecay(const std::string &decay);
+  /** Sets the contaminant decay constant [1/s]. */
+  void setDecay(const PRJFLOAT &decay);
   /** Returns the contaminant molecular diffusion coefficient [m^2/s]. */
   double Dm() const;
   /** Sets the contaminant molecular diffusion coefficient [m^2/s]. */
   bool setDm(const double Dm);
   /** Sets the contaminant molecular diffusion coefficient [m^2/s]. */
   bool setDm(const std::string &Dm);
+  /** Sets the contaminant molecular diffusion coefficient [m^2/s]. */
+  void setDm(const PRJFLOAT &Dm);
   /** Returns the default contaminant concentration [kg/kg air]. */
   double ccdef() const;
   /** Sets the default contaminant concentration [kg/kg air]. */
   bool setCcdef(const double ccdef);
   /** Sets the default contaminant concentration [kg/kg air]. */
   bool setCcdef(const std::string &ccdef);
+  /** Sets the default contaminant concentration [kg/kg air]. */
+  void setCcdef(const PRJFLOAT &ccdef);
   /** Returns the contaminant specific heat at constant pressure [J/kgK]. This is not used by CONTAM. */
   double Cp() const;
   /** Sets the contaminant specific heat at constant pressure [J/kgK]. This is not used by CONTAM. */
   bool setCp(const double Cp);
   /** Sets the contaminant specific heat at constant pressure [J/kgK]. This is not used by CONTAM. */
   bool setCp(const std::string &Cp);
+  /** Sets the contaminant specific heat at constant pressure [J/kgK]. This is not used by CONTAM. */
+  void setCp(const PRJFLOAT &Cp);
   /** Returns the concentration display units. */
   int ucc() const;
   /** Sets the concentration display units. */
@@ -513,60 +553,80 @@ public:
   bool setX(const double X);
   /** Sets the X-coordinate of an envelope path [m]. */
   bool setX(const std::string &X);
+  /** Sets the X-coordinate of an envelope path [m]. */
+  void setX(const PRJFLOAT &X);
   /** Returns the Y-coordinate of an envelope path [m] if set. */
   double Y() const;
   /** Sets the Y-coordinate of an envelope path [m]. */
   bool setY(const double Y);
   /** Sets the Y-coordinate of an envelope path [m]. */
   bool setY(const std::string &Y);
+  /** Sets the Y-coordinate of an envelope path [m]. */
+  void setY(const PRJFLOAT &Y);
   /** Returns the height relative to current level [m]. */
   double relHt() const;
   /** Sets the height relative to current level [m]. */
   bool setRelHt(const double relHt);
   /** Sets the height relative to current level [m]. */
   bool setRelHt(const std::string &relHt);
+  /** Sets the height relative to current level [m]. */
+  void setRelHt(const PRJFLOAT &relHt);
   /** Return the element multiplier. */
   double mult() const;
   /** Sets the element multiplier. */
   bool setMult(const double mult);
   /** Sets the element multiplier. */
   bool setMult(const std::string &mult);
+  /** Sets the element multiplier. */
+  void setMult(const PRJFLOAT &mult);
   /** Returns the constant wind pressure [Pa] (pw==NULL). */
   double wPset() const;
   /** Sets the constant wind pressure [Pa] (pw==NULL). */
   bool setWPset(const double wPset);
   /** Sets the constant wind pressure [Pa] (pw==NULL). */
   bool setWPset(const std::string &wPset);
+  /** Sets the constant wind pressure [Pa] (pw==NULL). */
+  void setWPset(const PRJFLOAT &wPset);
   /** Returns the wind speed modifier (pw!=NULL). */
   double wPmod() const;
   /** Sets the wind speed modifier (pw!=NULL). */
   bool setWPmod(const double wPmod);
   /** Sets the wind speed modifier (pw!=NULL). */
   bool setWPmod(const std::string &wPmod);
+  /** Sets the wind speed modifier (pw!=NULL). */
+  void setWPmod(const PRJFLOAT &wPmod);
   /** Returns the wall azimuth angle in degrees (pw!=NULL). */
   double wazm() const;
   /** Sets the wall azimuth angle in degrees (pw!=NULL). */
   bool setWazm(const double wazm);
   /** Sets the wall azimuth angle in degrees (pw!=NULL). */
   bool setWazm(const std::string &wazm);
+  /** Sets the wall azimuth angle in degrees (pw!=NULL). */
+  void setWazm(const PRJFLOAT &wazm);
   /** Returns the AHS path flow rate [kg/s] (pw==NULL). */
   double Fahs() const;
   /** Sets the AHS path flow rate [kg/s] (pw==NULL). */
   bool setFahs(const double Fahs);
   /** Sets the AHS path flow rate [kg/s] (pw==NULL). */
   bool setFahs(const std::string &Fahs);
+  /** Sets the AHS path flow rate [kg/s] (pw==NULL). */
+  void setFahs(const PRJFLOAT &Fahs);
   /** Returns the flow or pressure maximum. */
   double Xmax() const;
   /** Sets the flow or pressure maximum. */
   bool setXmax(const double Xmax);
   /** Sets the flow or pressure maximum. */
   bool setXmax(const std::string &Xmax);
+  /** Sets the flow or pressure maximum. */
+  void setXmax(const PRJFLOAT &Xmax);
   /** Returns the flow or pressure minimum. */
   double Xmin() const;
   /** Sets the flow or pressure minimum. */
   bool setXmin(const double Xmin);
   /** Sets the flow or pressure minimum. */
   bool setXmin(const std::string &Xmin);
+  /** Sets the flow or pressure minimum. */
+  void setXmin(const PRJFLOAT &Xmin);
   /** Returns the icon used to represent flow path. */
   unsigned int icon() const;
   /** Sets the icon used to represent flow path. */
@@ -706,18 +766,24 @@ public:
   bool setAfrcnvg(const double afrcnvg);
   /** Sets the relative airflow convergence factor. */
   bool setAfrcnvg(const std::string &afrcnvg);
+  /** Sets the relative airflow convergence factor. */
+  void setAfrcnvg(const PRJFLOAT &afrcnvg);
   /** Returns the absolute airflow convergence factor [1/s]. */
   double afacnvg() const;
   /** Sets the absolute airflow convergence factor [1/s]. */
   bool setAfacnvg(const double afacnvg);
   /** Sets the absolute airflow convergence factor [1/s]. */
   bool setAfacnvg(const std::string &afacnvg);
+  /** Sets the absolute airflow convergence factor [1/s]. */
+  void setAfacnvg(const PRJFLOAT &afacnvg);
   /** Returns the flow under-relaxation coefficient (for SUR). */
   double afrelax() const;
   /** Sets the flow under-relaxation coefficient (for SUR). */
   bool setAfrelax(const double afrelax);
   /** Sets the flow under-relaxation coefficient (for SUR). */
   bool setAfrelax(const std::string &afrelax);
+  /** Sets the flow under-relaxation coefficient (for SUR). */
+  void setAfrelax(const PRJFLOAT &afrelax);
   /** Returns the display units for afacnvg. */
   int uac2() const;
   /** Sets the display units for afacnvg. */
@@ -728,6 +794,8 @@ public:
   bool setPres(const double Pres);
   /** Sets the . */
   bool setPres(const std::string &Pres);
+  /** Sets the . */
+  void setPres(const PRJFLOAT &Pres);
   /** Returns the pressure test pressure. */
   int uPres() const;
   /** Sets the pressure test pressure. */
@@ -750,6 +818,8 @@ public:
   bool setAflcnvg(const double aflcnvg);
   /** Sets the relative convergence factor for (PCG). */
   bool setAflcnvg(const std::string &aflcnvg);
+  /** Sets the relative convergence factor for (PCG). */
+  void setAflcnvg(const PRJFLOAT &aflcnvg);
   /** Returns the linear airflow initialization flag: 0 = don't use, 1 = use. */
   int aflinit() const;
   /** Sets the linear airflow initialization flag: 0 = don't use, 1 = use. */
@@ -772,18 +842,24 @@ public:
   bool setCcrcnvg(const double ccrcnvg);
   /** Sets the cyclic relative convergence factor. */
   bool setCcrcnvg(const std::string &ccrcnvg);
+  /** Sets the cyclic relative convergence factor. */
+  void setCcrcnvg(const PRJFLOAT &ccrcnvg);
   /** Returns the cyclic absolute convergence factor [kg/kg]. */
   double ccacnvg() const;
   /** Sets the cyclic absolute convergence factor [kg/kg]. */
   bool setCcacnvg(const double ccacnvg);
   /** Sets the cyclic absolute convergence factor [kg/kg]. */
   bool setCcacnvg(const std::string &ccacnvg);
+  /** Sets the cyclic absolute convergence factor [kg/kg]. */
+  void setCcacnvg(const PRJFLOAT &ccacnvg);
   /** Returns the cyclic (unused) over-relaxation coefficient. */
   double ccrelax() const;
   /** Sets the cyclic (unused) over-relaxation coefficient. */
   bool setCcrelax(const double ccrelax);
   /** Sets the cyclic (unused) over-relaxation coefficient. */
   bool setCcrelax(const std::string &ccrelax);
+  /** Sets the cyclic (unused) over-relaxation coefficient. */
+  void setCcrelax(const PRJFLOAT &ccrelax);
   /** Returns the display units for ccacnvg. */
   int uccc() const;
   /** Sets the display units for ccacnvg. */
@@ -806,24 +882,32 @@ public:
   bool setMfnrcnvg(const double mfnrcnvg);
   /** Sets the non-trace contaminant relative convergence factor. */
   bool setMfnrcnvg(const std::string &mfnrcnvg);
+  /** Sets the non-trace contaminant relative convergence factor. */
+  void setMfnrcnvg(const PRJFLOAT &mfnrcnvg);
   /** Returns the non-trace contaminant absolute convergence factor. */
   double mfnacnvg() const;
   /** Sets the non-trace contaminant absolute convergence factor. */
   bool setMfnacnvg(const double mfnacnvg);
   /** Sets the non-trace contaminant absolute convergence factor. */
   bool setMfnacnvg(const std::string &mfnacnvg);
+  /** Sets the non-trace contaminant absolute convergence factor. */
+  void setMfnacnvg(const PRJFLOAT &mfnacnvg);
   /** Returns the non-trace contaminant relaxation coefficient. */
   double mfnrelax() const;
   /** Sets the non-trace contaminant relaxation coefficient. */
   bool setMfnrelax(const double mfnrelax);
   /** Sets the non-trace contaminant relaxation coefficient. */
   bool setMfnrelax(const std::string &mfnrelax);
+  /** Sets the non-trace contaminant relaxation coefficient. */
+  void setMfnrelax(const PRJFLOAT &mfnrelax);
   /** Returns the non-trace contaminant trapezoidal integration factor. */
   double mfngamma() const;
   /** Sets the non-trace contaminant trapezoidal integration factor. */
   bool setMfngamma(const double mfngamma);
   /** Sets the non-trace contaminant trapezoidal integration factor. */
   bool setMfngamma(const std::string &mfngamma);
+  /** Sets the non-trace contaminant trapezoidal integration factor. */
+  void setMfngamma(const PRJFLOAT &mfngamma);
   /** Returns the display units for mfnacnvg. */
   int uccn() const;
   /** Sets the display units for mfnacnvg. */
@@ -846,24 +930,32 @@ public:
   bool setMftrcnvg(const double mftrcnvg);
   /** Sets the trace contaminant relative convergence factor. */
   bool setMftrcnvg(const std::string &mftrcnvg);
+  /** Sets the trace contaminant relative convergence factor. */
+  void setMftrcnvg(const PRJFLOAT &mftrcnvg);
   /** Returns the trace contaminant absolute convergence factor. */
   double mftacnvg() const;
   /** Sets the trace contaminant absolute convergence factor. */
   bool setMftacnvg(const double mftacnvg);
   /** Sets the trace contaminant absolute convergence factor. */
   bool setMftacnvg(const std::string &mftacnvg);
+  /** Sets the trace contaminant absolute convergence factor. */
+  void setMftacnvg(const PRJFLOAT &mftacnvg);
   /** Returns the trace contaminant relaxation coefficient. */
   double mftrelax() const;
   /** Sets the trace contaminant relaxation coefficient. */
   bool setMftrelax(const double mftrelax);
   /** Sets the trace contaminant relaxation coefficient. */
   bool setMftrelax(const std::string &mftrelax);
+  /** Sets the trace contaminant relaxation coefficient. */
+  void setMftrelax(const PRJFLOAT &mftrelax);
   /** Returns the trace contaminant trapezoidal integration factor. */
   double mftgamma() const;
   /** Sets the trace contaminant trapezoidal integration factor. */
   bool setMftgamma(const double mftgamma);
   /** Sets the trace contaminant trapezoidal integration factor. */
   bool setMftgamma(const std::string &mftgamma);
+  /** Sets the trace contaminant trapezoidal integration factor. */
+  void setMftgamma(const PRJFLOAT &mftgamma);
   /** Returns the display units for mfnacnvg. */
   int ucct() const;
   /** Sets the display units for mfnacnvg. */
@@ -886,18 +978,24 @@ public:
   bool setMfvrcnvg(const double mfvrcnvg);
   /** Sets the CVODE contaminant solver relative convergence factor. */
   bool setMfvrcnvg(const std::string &mfvrcnvg);
+  /** Sets the CVODE contaminant solver relative convergence factor. */
+  void setMfvrcnvg(const PRJFLOAT &mfvrcnvg);
   /** Returns the CVODE contaminant solver absolute convergence factor. */
   double mfvacnvg() const;
   /** Sets the CVODE contaminant solver absolute convergence factor. */
   bool setMfvacnvg(const double mfvacnvg);
   /** Sets the CVODE contaminant solver absolute convergence factor. */
   bool setMfvacnvg(const std::string &mfvacnvg);
+  /** Sets the CVODE contaminant solver absolute convergence factor. */
+  void setMfvacnvg(const PRJFLOAT &mfvacnvg);
   /** Returns the CVODE contaminant solver relaxation coefficient. */
   double mfvrelax() const;
   /** Sets the CVODE contaminant solver relaxation coefficient. */
   bool setMfvrelax(const double mfvrelax);
   /** Sets the CVODE contaminant solver relaxation coefficient. */
   bool setMfvrelax(const std::string &mfvrelax);
+  /** Sets the CVODE contaminant solver relaxation coefficient. */
+  void setMfvrelax(const PRJFLOAT &mfvrelax);
   /** Returns the display units for mfvacnvg. */
   int uccv() const;
   /** Sets the display units for mfvacnvg. */
@@ -920,6 +1018,8 @@ public:
   bool setCelldx(const double celldx);
   /** Sets the default length of duct cells for C-D model [m]. */
   bool setCelldx(const std::string &celldx);
+  /** Sets the default length of duct cells for C-D model [m]. */
+  void setCelldx(const PRJFLOAT &celldx);
   /** Returns the variable junction temperature flag: 0 = don't compute, 1 = compute. */
   int sim_vjt() const;
   /** Sets the variable junction temperature flag: 0 = don't compute, 1 = compute. */
@@ -938,18 +1038,24 @@ public:
   bool setCvode_rcnvg(const double cvode_rcnvg);
   /** Sets the CVODE contaminant solver multi-step relative convergence factor. */
   bool setCvode_rcnvg(const std::string &cvode_rcnvg);
+  /** Sets the CVODE contaminant solver multi-step relative convergence factor. */
+  void setCvode_rcnvg(const PRJFLOAT &cvode_rcnvg);
   /** Returns the CVODE contaminant solver multi-step absolute convergence factor. */
   double cvode_acnvg() const;
   /** Sets the CVODE contaminant solver multi-step absolute convergence factor. */
   bool setCvode_acnvg(const double cvode_acnvg);
   /** Sets the CVODE contaminant solver multi-step absolute convergence factor. */
   bool setCvode_acnvg(const std::string &cvode_acnvg);
+  /** Sets the CVODE contaminant solver multi-step absolute convergence factor. */
+  void setCvode_acnvg(const PRJFLOAT &cvode_acnvg);
   /** Returns the CVODE contaminant solver maximum time step. */
   double cvode_dtmax() const;
   /** Sets the CVODE contaminant solver maximum time step. */
   bool setCvode_dtmax(const double cvode_dtmax);
   /** Sets the CVODE contaminant solver maximum time step. */
   bool setCvode_dtmax(const std::string &cvode_dtmax);
+  /** Sets the CVODE contaminant solver maximum time step. */
+  void setCvode_dtmax(const PRJFLOAT &cvode_dtmax);
   /** Returns the time-varying density flag: 0 = no variation during time step, 1 = vary density during time step. */
   int tsdens() const;
   /** Sets the time-varying density flag: 0 = no variation during time step, 1 = vary density during time step. */
@@ -960,6 +1066,8 @@ public:
   bool setTsrelax(const double tsrelax);
   /** Sets the (inactive) under-relaxation factor for calculating dM/dt. */
   bool setTsrelax(const std::string &tsrelax);
+  /** Sets the (inactive) under-relaxation factor for calculating dM/dt. */
+  void setTsrelax(const PRJFLOAT &tsrelax);
   /** Returns the maximum number of iterations for density changes. */
   int tsmaxi() const;
   /** Sets the maximum number of iterations for density changes. */
@@ -1114,6 +1222,8 @@ public:
   bool setRvals(const std::vector<double> &rvals);
   /** Sets the mysterious rvals vector. */
   bool setRvals(const std::vector<std::string> &rvals);
+  /** Sets the mysterious rvals vector. */
+  void setRvals(const std::vector<PRJFLOAT> &rvals);
   /** Returns the building airflow test (zones) flag: 0 = don't output, 1 = output. */
   int BldgFlowZ() const;
   /** Sets the building airflow test (zones) flag: 0 = don't output, 1 = output. */
@@ -1136,6 +1246,8 @@ public:
   bool setCfd_convcpl(const double cfd_convcpl);
   /** Sets the convergence factor for dynamic coupling. */
   bool setCfd_convcpl(const std::string &cfd_convcpl);
+  /** Sets the convergence factor for dynamic coupling. */
+  void setCfd_convcpl(const PRJFLOAT &cfd_convcpl);
   /** Returns the .var file flag: 0 = don't use, 1 = use. */
   int cfd_var() const;
   /** Sets the .var file flag: 0 = don't use, 1 = use. */
@@ -1280,12 +1392,16 @@ public:
   bool setRefht(const double refht);
   /** Sets the reference elevation of level [m]. */
   bool setRefht(const std::string &refht);
+  /** Sets the reference elevation of level [m]. */
+  void setRefht(const PRJFLOAT &refht);
   /** Returns the delta elevation to next level [m]. */
   double delht() const;
   /** Sets the delta elevation to next level [m]. */
   bool setDelht(const double delht);
   /** Sets the delta elevation to next level [m]. */
   bool setDelht(const std::string &delht);
+  /** Sets the delta elevation to next level [m]. */
+  void setDelht(const PRJFLOAT &delht);
   /** Returns the units of reference elevation. */
   int u_rfht() const;
   /** Returns the units of reference elevation. */
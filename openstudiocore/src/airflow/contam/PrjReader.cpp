@@ -30,34 +30,110 @@
 #include <iostream>
 #include <stdlib.h>
 
+#include <boost/lexical_cast.hpp>
+
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/FilesystemHelpers.hpp"
 
 namespace openstudio {
 namespace contam {
 
-Reader::Reader( openstudio::filesystem::ifstream &file ) 
-  : m_stream(openstudio::filesystem::read_as_QByteArray(file)), m_lineNumber(0)
+Reader::Reader( openstudio::filesystem::ifstream &file )
+  : m_buffer(openstudio::filesystem::read_as_string(file)), m_pos(0), m_cursor(nullptr), m_lineEnd(nullptr),
+  m_lineNumber(0)
+{
+  // Skip a UTF-8 byte order mark, as QTextStream did
+  if(m_buffer.compare(0, 3, "\xEF\xBB\xBF") == 0) {
+    m_pos = 3;
+  }
+}
+
+Reader::Reader(QString *string, int starting) : m_buffer(string->toStdString()), m_pos(0), m_cursor(nullptr),
+  m_lineEnd(nullptr), m_lineNumber(starting)
 {
 }
 
-Reader::Reader(QString *string, int starting) : m_lineNumber(starting)
+Reader::Reader(const std::string &string, int starting) : m_buffer(string), m_pos(0), m_cursor(nullptr),
+  m_lineEnd(nullptr), m_lineNumber(starting)
 {
-  m_stream.setString(string);
 }
 
 Reader::~Reader()
 {
 }
 
+void Reader::throwReadFailure()
+{
+  QString mesg=QString("Failed to read input at line %1").arg(m_lineNumber);
+  LOG_AND_THROW(mesg.toStdString());
+}
+
+bool Reader::nextLine(boost::string_ref &line)
+{
+  if(m_pos >= m_buffer.size()) {
+    return false;
+  }
+  const char *begin = m_buffer.data() + m_pos;
+  std::size_t end = m_buffer.find('\n', m_pos);
+  if(end == std::string::npos) {
+    end = m_buffer.size();
+    m_pos = end;
+  } else {
+    m_pos = end + 1;
+  }
+  const char *last = m_buffer.data() + end;
+  if(last != begin && *(last-1) == '\r') {
+    --last;
+  }
+  line = boost::string_ref(begin, last - begin);
+  return true;
+}
+
+boost::string_ref Reader::readLineRef()
+{
+  /* Dump any other input */
+  m_cursor = m_lineEnd;
+  boost::string_ref line;
+  do {
+    if(!nextLine(line)) {
+      throwReadFailure();
+    }
+    m_lineNumber++;
+  } while(!line.empty() && line[0] == '!');
+  return line;
+}
+
+boost::string_ref Reader::readToken()
+{
+  while(1) {
+    while(m_cursor != m_lineEnd && *m_cursor == ' ') {
+      ++m_cursor;
+    }
+    if(m_cursor == m_lineEnd) {
+      boost::string_ref line = readLineRef();
+      m_cursor = line.data();
+      m_lineEnd = line.data() + line.size();
+      continue;
+    }
+    const char *begin = m_cursor;
+    while(m_cursor != m_lineEnd && *m_cursor != ' ') {
+      ++m_cursor;
+    }
+    if(*begin == '!') {
+      m_cursor = m_lineEnd;
+    } else {
+      return boost::string_ref(begin, m_cursor - begin);
+    }
+  }
+}
+
 float Reader::readFloat()
 {
-  bool ok;
-  QString string = readQString();
-  float value = string.toFloat(&ok);
-  if(!ok) {
+  boost::string_ref string = readToken();
+  float value;
+  if(!boost::conversion::try_lexical_convert(string.data(), string.size(), value)) {
     QString mesg=QString("Floating point (float) conversion error at line %1 for \"%2\"")
-      .arg(m_lineNumber).arg(string);
+      .arg(m_lineNumber).arg(QString::fromStdString(string.to_string()));
     LOG_AND_THROW(mesg.toStdString());
   }
   return value;
@@ -65,12 +141,11 @@ float Reader::readFloat()
 
 double Reader::readDouble()
 {
-  bool ok;
-  QString string = readQString();
-  double value = string.toDouble(&ok);
-  if(!ok) {
+  boost::string_ref string = readToken();
+  double value;
+  if(!boost::conversion::try_lexical_convert(string.data(), string.size(), value)) {
     QString mesg=QString("Floating point (double) conversion error at line %1 for \"%2\"")
-      .arg(m_lineNumber).arg(string);
+      .arg(m_lineNumber).arg(QString::fromStdString(string.to_string()));
     LOG_AND_THROW(mesg.toStdString());
   }
   return value;
@@ -78,53 +153,26 @@ double Reader::readDouble()
 
 QString Reader::readQString()
 {
-  while(1) {
-    while(m_entries.size() == 0) {
-      QString input = m_stream.readLine();
-      LOG(Debug, "Line read: " << input.toStdString());
-      if(input.isNull()) {
-        QString mesg=QString("Failed to read input at line %1").arg(m_lineNumber);
-        LOG_AND_THROW(mesg.toStdString());
-      }
-      m_lineNumber++;
-      while(input[0]=='!') {
-        input = m_stream.readLine();
-        LOG(Debug, "Line read: " << input.toStdString());
-        if(input.isNull()) {
-          QString mesg=QString("Failed to read input at line %1").arg(m_lineNumber);
-          LOG_AND_THROW(mesg.toStdString());
-        }
-        m_lineNumber++;
-      }
-      m_entries = input.split(" ",QString::SkipEmptyParts);
-    }
-    QString out = m_entries.takeFirst();
-    if(out[0] == '!') {
-      m_entries.clear();
-    } else {
-      LOG(Debug, "String return: " << out.toStdString());
-      return out;
-    }
-  }
+  return QString::fromStdString(readToken().to_string());
 }
 
 std::string Reader::readStdString()
 {
-  return readQString().toStdString();
+  return readToken().to_string();
 }
 
 std::string Reader::readString()
 {
-  return readQString().toStdString();
+  return readToken().to_string();
 }
 
 int Reader::readInt()
 {
-  bool ok;
-  QString string = readQString();
-  int value = string.toInt(&ok);
-  if(!ok) {
-    QString mesg=QString("Integer conversion error at line %1 for \"%2\"").arg(m_lineNumber).arg(string);
+  boost::string_ref string = readToken();
+  int value;
+  if(!boost::conversion::try_lexical_convert(string.data(), string.size(), value)) {
+    QString mesg=QString("Integer conversion error at line %1 for \"%2\"").arg(m_lineNumber)
+      .arg(QString::fromStdString(string.to_string()));
     LOG_AND_THROW(mesg.toStdString());
   }
   return value;
@@ -132,11 +180,12 @@ int Reader::readInt()
 
 unsigned int Reader::readUInt()
 {
-  bool ok;
-  QString string = readQString();
-  int value = string.toUInt(&ok);
-  if(!ok) {
-    QString mesg=QString("Unsigned integer conversion error at line %1 for \"%2\"").arg(m_lineNumber).arg(string);
+  boost::string_ref string = readToken();
+  unsigned int value;
+  // lexical_cast accepts negative input for unsigned types, so reject it here
+  if(string[0] == '-' || !boost::conversion::try_lexical_convert(string.data(), string.size(), value)) {
+    QString mesg=QString("Unsigned integer conversion error at line %1 for \"%2\"").arg(m_lineNumber)
+      .arg(QString::fromStdString(string.to_string()));
     LOG_AND_THROW(mesg.toStdString());
   }
   return value;
@@ -144,38 +193,17 @@ unsigned int Reader::readUInt()
 
 std::string Reader::readLine()
 {
-  return readLineQString().toStdString();
+  return readLineRef().to_string();
 }
 
 QString Reader::readLineQString()
 {
-  /* Dump any other input */
-  if(m_entries.size()) {
-    m_entries.clear();
-  }
-  QString input = m_stream.readLine();
-  LOG(Debug, "Line read: " << input.toStdString());
-  if(input.isNull()) {
-    QString mesg=QString("Failed to read input at line %1").arg(m_lineNumber);
-    LOG_AND_THROW(mesg.toStdString());
-  }
-  m_lineNumber++;
-  while(input[0]=='!') {
-    input = m_stream.readLine();
-    LOG(Debug, "Line read: " << input.toStdString());
-    if(input.isNull()) {
-      QString mesg=QString("Failed to read input at line %1").arg(m_lineNumber);
-      LOG_AND_THROW(mesg.toStdString());
-    }
-    m_lineNumber++;
-  }
-  return input;
+  return QString::fromStdString(readLineRef().to_string());
 }
 
 void Reader::read999()
 {
-  QString input = readLineQString();
-  if(!input.startsWith(QString("-999"))) {
+  if(!readLineRef().starts_with("-999")) {
     QString mesg=QString("Failed to read -999 at line %1").arg(m_lineNumber);
     LOG_AND_THROW(mesg.toStdString());
   }
@@ -183,8 +211,7 @@ void Reader::read999()
 
 void Reader::read999(std::string mesg)
 {
-  QString input = readLineQString();
-  if(!input.startsWith(QString("-999"))) {
+  if(!readLineRef().starts_with("-999")) {
     QString errmesg = QString().fromStdString(mesg) + QString(" at line %1").arg(m_lineNumber);
     LOG_AND_THROW(errmesg.toStdString());
   }
@@ -192,8 +219,7 @@ void Reader::read999(std::string mesg)
 
 void Reader::readEnd()
 {
-  QString input = readLineQString();
-  if(!input.startsWith(QString("* end project file."))) {
+  if(!readLineRef().starts_with("* end project file.")) {
     QString mesg = QString("Failed to read file end at line %1").arg(m_lineNumber);
     LOG_AND_THROW(mesg.toStdString());
   }
@@ -201,25 +227,28 @@ void Reader::readEnd()
 
 void Reader::skipSection()
 {
-  readSection();
+  boost::string_ref input;
+  do {
+    if(!nextLine(input)) {
+      throwReadFailure();
+    }
+    m_lineNumber++;
+  } while(!input.starts_with("-999"));
 }
 
 std::string Reader::readSection()
 {
-  QString section;
-  while(1) {
-    QString input = m_stream.readLine();
-    if(input.isNull()) {
-      QString mesg = QString("Failed to read input at line %1").arg(m_lineNumber);
-      LOG_AND_THROW(mesg.toStdString());
+  std::string section;
+  boost::string_ref input;
+  do {
+    if(!nextLine(input)) {
+      throwReadFailure();
     }
     m_lineNumber++;
-    section += input + '\n';
-    if(input.startsWith(QString("-999"))) {
-      break;
-    }
-  }
-  return section.toStdString();
+    section.append(input.data(), input.size());
+    section += '\n';
+  } while(!input.starts_with("-999"));
+  return section;
 }
 
 std::vector<int> Reader::readIntVector(bool terminated)
@@ -267,7 +296,7 @@ template <> std::string Reader::read<std::string>()
 
 template <> double Reader::readNumber<double>()
 {
-  return readInt();
+  return readDouble();
 }
 
 template <> float Reader::readNumber<float>()
@@ -275,28 +304,35 @@ template <> float Reader::readNumber<float>()
   return readFloat();
 }
 
-template <> QString Reader::readNumber<QString>()
+template <> std::string Reader::readNumber<std::string>()
 {
   bool ok;
-  QString string = readQString();
-  string.toDouble(&ok);
+  boost::string_ref string = readToken();
+  PrjFloat::check(string.data(), string.size(), &ok);
   if(!ok) {
-    QString mesg = QString("Invalid number \"%2\" on line %1").arg(m_lineNumber).arg(string);
+    QString mesg = QString("Invalid number \"%2\" on line %1").arg(m_lineNumber)
+      .arg(QString::fromStdString(string.to_string()));
     LOG_AND_THROW(mesg.toStdString());
   }
-  return string;
+  return string.to_string();
 }
 
-template <> std::string Reader::readNumber<std::string>()
+template <> PrjFloat Reader::readNumber<PrjFloat>()
 {
   bool ok;
-  QString string = readQString();
-  string.toDouble(&ok);
+  boost::string_ref string = readToken();
+  double value = PrjFloat::check(string.data(), string.size(), &ok);
   if(!ok) {
-    QString mesg = QString("Invalid number \"%2\" on line %1").arg(m_lineNumber).arg(string);
+    QString mesg = QString("Invalid number \"%2\" on line %1").arg(m_lineNumber)
+      .arg(QString::fromStdString(string.to_string()));
     LOG_AND_THROW(mesg.toStdString());
   }
-  return string.toStdString();
+  return PrjFloat(value, string.data(), string.size());
+}
+
+template <> QString Reader::readNumber<QString>()
+{
+  return QString::fromStdString(readNumber<std::string>());
 }
 
 } // contam
@@ -37,14 +37,21 @@
 
 #include "PrjDefines.hpp"
 
+#include <boost/utility/string_ref.hpp>
+
 namespace openstudio {
 namespace contam {
 
+/** Reader reads PRJ-style input. The entire input is held in a single buffer and
+ *  tokens and lines are located in place, so nothing is copied until a value is
+ *  converted or a string is returned.
+ */
 class Reader
 {
 public:
   explicit Reader(openstudio::filesystem::ifstream &file);
   explicit Reader(QString *string, int starting=0);
+  explicit Reader(const std::string &string, int starting=0);
   ~Reader();
 
   float readFloat();
@@ -82,9 +89,20 @@ private:
   std::string readStdString();
   QString readLineQString();
 
-  QTextStream m_stream;
+  // Returns the next token, skipping comments
+  boost::string_ref readToken();
+  // Returns the next line that is not a comment, discarding any unread tokens
+  boost::string_ref readLineRef();
+  // Returns the next line of input, false at the end of the input
+  bool nextLine(boost::string_ref &line);
+  void throwReadFailure();
+
+  std::string m_buffer;
+  std::size_t m_pos;
+  // Unread part of the current line
+  const char *m_cursor;
+  const char *m_lineEnd;
   int m_lineNumber;
-  QStringList m_entries;
 
   REGISTER_LOGGER("openstudio.contam.Reader");
 };
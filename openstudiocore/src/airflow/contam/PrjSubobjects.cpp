@@ -327,11 +327,11 @@ FanDataPoint::FanDataPoint(std::string mF,int u_mF,std::string dP,int u_dP,std::
 
 void FanDataPoint::read(Reader &input)
 {
-  setMF(input.readNumber<std::string>());
+  setMF(input.readNumber<PRJFLOAT>());
   setU_mF(input.read<int>());
-  setDP(input.readNumber<std::string>());
+  setDP(input.readNumber<PRJFLOAT>());
   setU_dP(input.read<int>());
-  setRP(input.readNumber<std::string>());
+  setRP(input.readNumber<PRJFLOAT>());
   setU_rP(input.read<int>());
 }
 
@@ -349,7 +349,7 @@ double FanDataPoint::mF() const
 
 bool FanDataPoint::setMF(const double mF)
 {
-  m_mF = QString::number(mF);
+  m_mF = mF;
   return true;
 }
 
@@ -365,6 +365,11 @@ bool FanDataPoint::setMF(const std::string &mF)
   return false;
 }
 
+void FanDataPoint::setMF(const PRJFLOAT &mF)
+{
+  m_mF = mF;
+}
+
 int FanDataPoint::u_mF() const
 {
   return m_u_mF;
@@ -382,7 +387,7 @@ double FanDataPoint::dP() const
 
 bool FanDataPoint::setDP(const double dP)
 {
-  m_dP = QString::number(dP);
+  m_dP = dP;
   return true;
 }
 
@@ -398,6 +403,11 @@ bool FanDataPoint::setDP(const std::string &dP)
   return false;
 }
 
+void FanDataPoint::setDP(const PRJFLOAT &dP)
+{
+  m_dP = dP;
+}
+
 int FanDataPoint::u_dP() const
 {
   return m_u_dP;
@@ -415,7 +425,7 @@ double FanDataPoint::rP() const
 
 bool FanDataPoint::setRP(const double rP)
 {
-  m_rP = QString::number(rP);
+  m_rP = rP;
   return true;
 }
 
@@ -431,6 +441,11 @@ bool FanDataPoint::setRP(const std::string &rP)
   return false;
 }
 
+void FanDataPoint::setRP(const PRJFLOAT &rP)
+{
+  m_rP = rP;
+}
+
 int FanDataPoint::u_rP() const
 {
   return m_u_rP;
@@ -468,8 +483,8 @@ XyDataPoint::XyDataPoint(std::string x,std::string y)
 
 void XyDataPoint::read(Reader &input)
 {
-  setX(input.readNumber<std::string>());
-  setY(input.readNumber<std::string>());
+  setX(input.readNumber<PRJFLOAT>());
+  setY(input.readNumber<PRJFLOAT>());
 }
 
 std::string XyDataPoint::write()
@@ -486,7 +501,7 @@ double XyDataPoint::x() const
 
 bool XyDataPoint::setX(const double x)
 {
-  m_x = QString::number(x);
+  m_x = x;
   return true;
 }
 
@@ -502,6 +517,11 @@ bool XyDataPoint::setX(const std::string &x)
   return false;
 }
 
+void XyDataPoint::setX(const PRJFLOAT &x)
+{
+  m_x = x;
+}
+
 double XyDataPoint::y() const
 {
   return m_y.toDouble();
@@ -509,7 +529,7 @@ double XyDataPoint::y() const
 
 bool XyDataPoint::setY(const double y)
 {
-  m_y = QString::number(y);
+  m_y = y;
   return true;
 }
 
@@ -525,6 +545,11 @@ bool XyDataPoint::setY(const std::string &y)
   return false;
 }
 
+void XyDataPoint::setY(const PRJFLOAT &y)
+{
+  m_y = y;
+}
+
 void AirflowSubelementData::setDefaults()
 {
   m_nr = 0;
@@ -556,7 +581,7 @@ AirflowSubelementData::AirflowSubelementData(int nr,std::string relHt,int filt)
 void AirflowSubelementData::read(Reader &input)
 {
   setNr(input.read<int>());
-  setRelHt(input.readNumber<std::string>());
+  setRelHt(input.readNumber<PRJFLOAT>());
   setFilt(input.read<int>());
 }
 
@@ -584,7 +609,7 @@ double AirflowSubelementData::relHt() const
 
 bool AirflowSubelementData::setRelHt(const double relHt)
 {
-  m_relHt = QString::number(relHt);
+  m_relHt = relHt;
   return true;
 }
 
@@ -600,6 +625,11 @@ bool AirflowSubelementData::setRelHt(const std::string &relHt)
   return false;
 }
 
+void AirflowSubelementData::setRelHt(const PRJFLOAT &relHt)
+{
+  m_relHt = relHt;
+}
+
 int AirflowSubelementData::filt() const
 {
   return m_filt;
@@ -637,8 +667,8 @@ PressureCoefficientPoint::PressureCoefficientPoint(std::string azm,std::string c
 
 void PressureCoefficientPoint::read(Reader &input)
 {
-  setAzm(input.readNumber<std::string>());
-  setCoef(input.readNumber<std::string>());
+  setAzm(input.readNumber<PRJFLOAT>());
+  setCoef(input.readNumber<PRJFLOAT>());
 }
 
 std::string PressureCoefficientPoint::write()
@@ -655,7 +685,7 @@ double PressureCoefficientPoint::azm() const
 
 bool PressureCoefficientPoint::setAzm(const double azm)
 {
-  m_azm = QString::number(azm);
+  m_azm = azm;
   return true;
 }
 
@@ -671,6 +701,11 @@ bool PressureCoefficientPoint::setAzm(const std::string &azm)
   return false;
 }
 
+void PressureCoefficientPoint::setAzm(const PRJFLOAT &azm)
+{
+  m_azm = azm;
+}
+
 double PressureCoefficientPoint::coef() const
 {
   return m_coef.toDouble();
@@ -678,7 +713,7 @@ double PressureCoefficientPoint::coef() const
 
 bool PressureCoefficientPoint::setCoef(const double coef)
 {
-  m_coef = QString::number(coef);
+  m_coef = coef;
   return true;
 }
 
@@ -694,6 +729,11 @@ bool PressureCoefficientPoint::setCoef(const std::string &coef)
   return false;
 }
 
+void PressureCoefficientPoint::setCoef(const PRJFLOAT &coef)
+{
+  m_coef = coef;
+}
+
 void SchedulePoint::setDefaults()
 {
   m_time = std::string("00:00:00");
@@ -722,7 +762,7 @@ SchedulePoint::SchedulePoint(std::string time,std::string ctrl)
 void SchedulePoint::read(Reader &input)
 {
   setTime(input.readString());
-  setCtrl(input.readNumber<std::string>());
+  setCtrl(input.readNumber<PRJFLOAT>());
 }
 
 std::string SchedulePoint::write()
@@ -749,7 +789,7 @@ double SchedulePoint::ctrl() const
 
 bool SchedulePoint::setCtrl(const double ctrl)
 {
-  m_ctrl = QString::number(ctrl);
+  m_ctrl = ctrl;
   return true;
 }
 
@@ -765,5 +805,10 @@ bool SchedulePoint::setCtrl(const std::string &ctrl)
   return false;
 }
 
+void SchedulePoint::setCtrl(const PRJFLOAT &ctrl)
+{
+  m_ctrl = ctrl;
+}
+
 } // contam
 } // openstudio
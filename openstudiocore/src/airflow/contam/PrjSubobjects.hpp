@@ -247,6 +247,8 @@ public:
   bool setMF(const double mF);
   /** Sets the measured flow rate [kg/s]. */
   bool setMF(const std::string &mF);
+  /** Sets the measured flow rate [kg/s]. */
+  void setMF(const PRJFLOAT &mF);
   /** Returns the measured flow rate display units. */
   int u_mF() const;
   /** Sets the measured flow rate display units. */
@@ -257,6 +259,8 @@ public:
   bool setDP(const double dP);
   /** Sets the measured pressure rise [Pa]. */
   bool setDP(const std::string &dP);
+  /** Sets the measured pressure rise [Pa]. */
+  void setDP(const PRJFLOAT &dP);
   /** Returns the measured pressure rise display units. */
   int u_dP() const;
   /** Sets the measured pressure rise display units. */
@@ -267,6 +271,8 @@ public:
   bool setRP(const double rP);
   /** Sets the revised pressure rise [Pa]. */
   bool setRP(const std::string &rP);
+  /** Sets the revised pressure rise [Pa]. */
+  void setRP(const PRJFLOAT &rP);
   /** Returns the revised pressure rise display units. */
   int u_rP() const;
   /** Sets the revised pressure rise display units. */
@@ -317,12 +323,16 @@ public:
   bool setX(const double x);
   /** Sets the value of independent variable. */
   bool setX(const std::string &x);
+  /** Sets the value of independent variable. */
+  void setX(const PRJFLOAT &x);
   /** Returns the value of dependent variable. */
   double y() const;
   /** Sets the value of dependent variable. */
   bool setY(const double y);
   /** Sets the value of dependent variable. */
   bool setY(const std::string &y);
+  /** Sets the value of dependent variable. */
+  void setY(const PRJFLOAT &y);
   //@}
 private:
   void setDefaults();
@@ -369,6 +379,8 @@ public:
   bool setRelHt(const double relHt);
   /** Sets the relative height of the sub-element. */
   bool setRelHt(const std::string &relHt);
+  /** Sets the relative height of the sub-element. */
+  void setRelHt(const PRJFLOAT &relHt);
   /** Returns the filtering flag: (1=filtered, 0=not). */
   int filt() const;
   /** Sets the filtering flag (1=filtered, 0=not). */
@@ -417,12 +429,16 @@ public:
   bool setAzm(const double azm);
   /** Sets the wind azimuth value [degrees]. */
   bool setAzm(const std::string &azm);
+  /** Sets the wind azimuth value [degrees]. */
+  void setAzm(const PRJFLOAT &azm);
   /** Returns the normalized wind pressure coefficient. */
   double coef() const;
   /** Sets the normalized wind pressure coefficient. */
   bool setCoef(const double coef);
   /** Sets the normalized wind pressure coefficient. */
   bool setCoef(const std::string &coef);
+  /** Sets the normalized wind pressure coefficient. */
+  void setCoef(const PRJFLOAT &coef);
   //@}
 private:
   void setDefaults();
@@ -469,6 +485,8 @@ public:
   bool setCtrl(const double ctrl);
   /** Sets the control value. */
   bool setCtrl(const std::string &ctrl);
+  /** Sets the control value. */
+  void setCtrl(const PRJFLOAT &ctrl);
   //@}
 private:
   void setDefaults();
@@ -85,11 +85,11 @@ WeatherDataImpl::WeatherDataImpl(double Tambt,double barpres,double windspd,doub
 
 void WeatherDataImpl::read(Reader &input)
 {
-  setTambt(input.readNumber<std::string>());
-  setBarpres(input.readNumber<std::string>());
-  setWindspd(input.readNumber<std::string>());
-  setWinddir(input.readNumber<std::string>());
-  setRelhum(input.readNumber<std::string>());
+  setTambt(input.readNumber<PRJFLOAT>());
+  setBarpres(input.readNumber<PRJFLOAT>());
+  setWindspd(input.readNumber<PRJFLOAT>());
+  setWinddir(input.readNumber<PRJFLOAT>());
+  setRelhum(input.readNumber<PRJFLOAT>());
   setDaytyp(input.read<int>());
   setUTa(input.read<int>());
   setUbP(input.read<int>());
@@ -111,7 +111,7 @@ double WeatherDataImpl::Tambt() const
 
 bool WeatherDataImpl::setTambt(const double Tambt)
 {
-  m_Tambt = QString::number(Tambt);
+  m_Tambt = Tambt;
   return true;
 }
 
@@ -127,6 +127,11 @@ bool WeatherDataImpl::setTambt(const std::string &Tambt)
   return false;
 }
 
+void WeatherDataImpl::setTambt(const PRJFLOAT &Tambt)
+{
+  m_Tambt = Tambt;
+}
+
 double WeatherDataImpl::barpres() const
 {
   return m_barpres.toDouble();
@@ -134,7 +139,7 @@ double WeatherDataImpl::barpres() const
 
 bool WeatherDataImpl::setBarpres(const double barpres)
 {
-  m_barpres = QString::number(barpres);
+  m_barpres = barpres;
   return true;
 }
 
@@ -150,6 +155,11 @@ bool WeatherDataImpl::setBarpres(const std::string &barpres)
   return false;
 }
 
+void WeatherDataImpl::setBarpres(const PRJFLOAT &barpres)
+{
+  m_barpres = barpres;
+}
+
 double WeatherDataImpl::windspd() const
 {
   return m_windspd.toDouble();
@@ -157,7 +167,7 @@ double WeatherDataImpl::windspd() const
 
 bool WeatherDataImpl::setWindspd(const double windspd)
 {
-  m_windspd = QString::number(windspd);
+  m_windspd = windspd;
   return true;
 }
 
@@ -173,6 +183,11 @@ bool WeatherDataImpl::setWindspd(const std::string &windspd)
   return false;
 }
 
+void WeatherDataImpl::setWindspd(const PRJFLOAT &windspd)
+{
+  m_windspd = windspd;
+}
+
 double WeatherDataImpl::winddir() const
 {
   return m_winddir.toDouble();
@@ -180,7 +195,7 @@ double WeatherDataImpl::winddir() const
 
 bool WeatherDataImpl::setWinddir(const double winddir)
 {
-  m_winddir = QString::number(winddir);
+  m_winddir = winddir;
   return true;
 }
 
@@ -196,6 +211,11 @@ bool WeatherDataImpl::setWinddir(const std::string &winddir)
   return false;
 }
 
+void WeatherDataImpl::setWinddir(const PRJFLOAT &winddir)
+{
+  m_winddir = winddir;
+}
+
 double WeatherDataImpl::relhum() const
 {
   return m_relhum.toDouble();
@@ -203,7 +223,7 @@ double WeatherDataImpl::relhum() const
 
 bool WeatherDataImpl::setRelhum(const double relhum)
 {
-  m_relhum = QString::number(relhum);
+  m_relhum = relhum;
   return true;
 }
 
@@ -219,6 +239,11 @@ bool WeatherDataImpl::setRelhum(const std::string &relhum)
   return false;
 }
 
+void WeatherDataImpl::setRelhum(const PRJFLOAT &relhum)
+{
+  m_relhum = relhum;
+}
+
 int WeatherDataImpl::daytyp() const
 {
   return m_daytyp;
@@ -56,30 +56,40 @@ public:
   bool setTambt(const double Tambt);
   /** Sets the ambient temperature [K] */
   bool setTambt(const std::string &Tambt);
+  /** Sets the ambient temperature [K] */
+  void setTambt(const PRJFLOAT &Tambt);
   /** Returns the barometric pressure [Pa] NOT corrected to sea level */
   double barpres() const;
   /** Sets the barometric pressure [Pa] NOT corrected to sea level */
   bool setBarpres(const double barpres);
   /** Sets the barometric pressure [Pa] NOT corrected to sea level */
   bool setBarpres(const std::string &barpres);
+  /** Sets the barometric pressure [Pa] NOT corrected to sea level */
+  void setBarpres(const PRJFLOAT &barpres);
   /** Returns the wind speed [m/s] */
   double windspd() const;
   /** Sets the wind speed [m/s] */
   bool setWindspd(const double windspd);
   /** Sets the wind speed [m/s] */
   bool setWindspd(const std::string &windspd);
+  /** Sets the wind speed [m/s] */
+  void setWindspd(const PRJFLOAT &windspd);
   /** Returns the wind direction: 0 = N, 90 = E, 180 = S, ... */
   double winddir() const;
   /** Sets the wind direction: 0 = N, 90 = E, 180 = S, ... */
   bool setWinddir(const double winddir);
   /** Sets the wind direction: 0 = N, 90 = E, 180 = S, ... */
   bool setWinddir(const std::string &winddir);
+  /** Sets the wind direction: 0 = N, 90 = E, 180 = S, ... */
+  void setWinddir(const PRJFLOAT &winddir);
   /** Returns the relative humidity: 0.0 to 1.0 */
   double relhum() const;
   /** Sets the relative humidity: 0.0 to 1.0 */
   bool setRelhum(const double relhum);
   /** Sets the relative humidity: 0.0 to 1.0 */
   bool setRelhum(const std::string &relhum);
+  /** Sets the relative humidity: 0.0 to 1.0 */
+  void setRelhum(const PRJFLOAT &relhum);
   /** Returns the type of day (1-12) */
   int daytyp() const;
   /** Sets the type of day (1-12) */
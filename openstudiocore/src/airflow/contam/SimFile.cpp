@@ -28,7 +28,10 @@
 
 #include "SimFile.hpp"
 
-#include <QStringList>
+#include <QFile>
+
+#include <boost/lexical_cast.hpp>
+#include <boost/utility/string_ref.hpp>
 
 namespace openstudio {
 namespace contam {
@@ -46,157 +49,271 @@ SimFile::SimFile(openstudio::path path)
   m_hasNfr = readNfr(openstudio::toQString(nfrPath));
 }
 
-bool SimFile::computeDateTimes(QVector<QString> day, QVector<QString> time)
+// Get the next line from [pos,end), without the line ending
+static bool nextLine(const char *&pos, const char *end, boost::string_ref &line)
 {
-  bool ok;
-  QStringList split;
-  int n = qMin(day.size(),time.size());
-  for(int i=0;i<n;i++)
-  {
-    split = day[i].split('/');
-    if(split.size() != 2)
-    {
-      return false;
+  if(pos >= end) {
+    return false;
+  }
+  const char *begin = pos;
+  while(pos != end && *pos != '\n') {
+    ++pos;
+  }
+  const char *last = pos;
+  if(pos != end) {
+    ++pos;
+  }
+  if(last != begin && *(last-1) == '\r') {
+    --last;
+  }
+  line = boost::string_ref(begin, last - begin);
+  return true;
+}
+
+// Split a line on tabs, returning the number of fields and storing up to maxFields of them
+static int splitRow(boost::string_ref line, boost::string_ref *fields, int maxFields)
+{
+  int n = 0;
+  const char *begin = line.data();
+  const char *end = line.data() + line.size();
+  while(true) {
+    const char *tab = begin;
+    while(tab != end && *tab != '\t') {
+      ++tab;
     }
-    unsigned month=split[0].toInt(&ok);
-    if(!ok || month > 12)
-    {
-      return false;
+    if(n < maxFields) {
+      // Trim spaces, which the Qt conversions used to ignore
+      const char *first = begin;
+      const char *last = tab;
+      while(first != last && *first == ' ') {
+        ++first;
+      }
+      while(last != first && *(last-1) == ' ') {
+        --last;
+      }
+      fields[n] = boost::string_ref(first, last - first);
     }
-    unsigned dayOfMonth=split[1].toInt(&ok);
-    if(!ok)
-    {
-      return false;
+    ++n;
+    if(tab == end) {
+      break;
     }
-    m_dateTimes.push_back(DateTime(Date(monthOfYear(month),dayOfMonth),Time(time[i].toStdString())));
+    begin = tab + 1;
   }
-  return true;
+  return n;
 }
 
-void SimFile::clearLfr()
+template <typename T> static bool convert(boost::string_ref field, T &value)
 {
-  m_dP.clear();
-  m_F0.clear();
-  m_F1.clear();
+  return !field.empty() && boost::conversion::try_lexical_convert(field.data(), field.size(), value);
 }
 
-bool SimFile::readLfr(QString fileName)
+// Convert CONTAM's M/D day and HH:MM:SS time to a DateTime
+static bool convertDateTime(boost::string_ref day, boost::string_ref time, DateTime &dateTime)
 {
-  clearLfr();
-  QVector<QString> day;
-  QVector<QString> time;
-  openstudio::filesystem::ifstream file(openstudio::toPath(fileName));
-  if(!file.is_open())
+  std::size_t slash = day.find('/');
+  if(slash == boost::string_ref::npos) {
+    return false;
+  }
+  unsigned month;
+  unsigned dayOfMonth;
+  if(!convert(day.substr(0, slash), month) || !convert(day.substr(slash+1), dayOfMonth) || month > 12) {
+    return false;
+  }
+  try {
+    dateTime = DateTime(Date(monthOfYear(month), dayOfMonth), Time(time.to_string()));
+  } catch(const std::exception &) {
+    return false;
+  }
+  return true;
+}
+
+bool SimFile::readResults(const QString &fileName, const std::string &type, bool extraColumns, const char *names[4],
+  bool zeroInvalidLast, std::vector<int> &nrs, std::vector<std::vector<double> > *columns[3])
+{
+  QFile file(fileName);
+  if(!file.open(QFile::ReadOnly))
   {
-    LOG(Error,"Failed to open LFR file '" << fileName.toStdString() << "'");
+    LOG(Error,"Failed to open " << type << " file '" << fileName.toStdString() << "'");
     return false;
   }
-  QMap<int,int> nrMap;
+  // Map the file if possible, otherwise read the whole thing into memory. Either way, the
+  // file is parsed in place.
+  QByteArray buffer;
+  const char *pos = nullptr;
+  const char *end = nullptr;
+  qint64 size = file.size();
+  if(size > 0)
+  {
+    uchar *data = file.map(0, size);
+    if(data)
+    {
+      pos = reinterpret_cast<const char*>(data);
+      end = pos + size;
+    }
+    else
+    {
+      buffer = file.readAll();
+      pos = buffer.constData();
+      end = pos + buffer.size();
+    }
+  }
   // Read the header
-  std::string headerstr;
-  std::getline(file, headerstr);
-  QString header = openstudio::toQString(headerstr);
-  if(header.isNull() || header.isEmpty())
+  boost::string_ref line;
+  if(!nextLine(pos, end, line) || line.empty())
   {
-    LOG(Error,"No data in LFR file '" << fileName.toStdString() << "'");
+    LOG(Error,"No data in " << type << " file '" << fileName.toStdString() << "'");
     return false;
   }
-  QStringList row = header.split('\t');
-  int ncols = 6;
-  if(row.size() != ncols)
+  const int ncols = 6;
+  boost::string_ref row[ncols+2];
+  int n = splitRow(line, row, ncols+2);
+  if(n != ncols && !(extraColumns && n == ncols+2))
   {
-    LOG(Error,"LFR file has " << row.size() << " columns, not the expected " << ncols);
+    LOG(Error,type << " file has " << n << " columns, not the expected " << ncols);
     return false;
   }
   // Read the data
-  while(file.good())
+  std::map<int,int> nrMap;
+  std::vector<DateTime> dateTimes;
+  boost::string_ref lastDay;
+  boost::string_ref lastTime;
+  const char *dataBegin = pos;
+  std::size_t expectedTimes = 0;
+  while(nextLine(pos, end, line))
   {
-    std::string linestr;
-    std::getline(file, linestr);
-    QString line = openstudio::toQString(linestr);
-    QStringList row = line.split('\t');
-    if(row.size() != ncols)
+    if(line.empty())
+    {
+      continue;
+    }
+    n = splitRow(line, row, ncols+2);
+    if(n != ncols && !(extraColumns && n == ncols+2))
     {
-      clearLfr();
-      LOG(Error,"LFR data line has " << row.size() << " columns, not the expected " << ncols);
+      LOG(Error,type << " data line has " << n << " columns, not the expected " << ncols);
       return false;
     }
-    if(time.size())
+    if(dateTimes.empty() || row[1] != lastTime || row[0] != lastDay)
     {
-      if(time[time.size()-1] != row[1])
+      DateTime dateTime;
+      if(!convertDateTime(row[0], row[1], dateTime))
       {
-        day << row[0];
-        time << row[1];
+        LOG(Error,"Failed to compute date and time objects from " << type << " input");
+        return false;
+      }
+      dateTimes.push_back(dateTime);
+      lastDay = row[0];
+      lastTime = row[1];
+      if(dateTimes.size() == 2)
+      {
+        // The first time step gives a good estimate of the number of time steps in the file
+        expectedTimes = (end - dataBegin) / (line.data() - dataBegin) + 1;
+        for(int j=0;j<3;j++)
+        {
+          for(std::vector<double> &values : *columns[j])
+          {
+            values.reserve(expectedTimes);
+          }
+        }
       }
     }
-    else
-    {
-      day << row[0];
-      time << row[1];
-    }
-    bool convOk;
-    int nr = row[2].toInt(&convOk);
-    if(!convOk)
+    int nr;
+    if(!convert(row[2], nr))
     {
-      clearLfr();
-      LOG(Error,"Invalid link number '" << row[2].toStdString() << "'");
+      LOG(Error,"Invalid " << names[0] << " '" << row[2] << "'");
       return false;
     }
-    if(!nrMap.contains(nr))
+    std::map<int,int>::iterator iter = nrMap.find(nr);
+    if(iter == nrMap.end())
     {
-      int sz = nrMap.size();
-      nrMap[nr] = sz;
-      m_dP.resize(sz+1);
-      m_F0.resize(sz+1);
-      m_F1.resize(sz+1);
-    }
-    double dP = row[3].toDouble(&convOk);
-    if(!convOk)
-    {
-      clearLfr();
-      LOG(Error,"Invalid pressure difference '" << row[3].toStdString() << "'");
-      return false;
+      iter = nrMap.insert(std::make_pair(nr, (int)nrs.size())).first;
+      nrs.push_back(nr);
+      for(int j=0;j<3;j++)
+      {
+        columns[j]->resize(nrs.size());
+        columns[j]->back().reserve(expectedTimes);
+      }
     }
-    double F0 = row[4].toDouble(&convOk);
-    if(!convOk)
+    for(int j=0;j<3;j++)
     {
-      clearLfr();
-      LOG(Error,"Invalid flow 0 '" << row[4].toStdString() << "'");
-      return false;
+      double value;
+      if(!convert(row[j+3], value))
+      {
+        if(zeroInvalidLast && j==2 && nr==0)
+        {
+          value = 0.0;
+        }
+        else
+        {
+          LOG(Error,"Invalid " << names[j+1] << " '" << row[j+3] << "'");
+          return false;
+        }
+      }
+      (*columns[j])[iter->second].push_back(value);
     }
-    double F1 = row[5].toDouble(&convOk);
-    if(!convOk)
+  }
+  // Every column should have one value per time
+  for(int j=0;j<3;j++)
+  {
+    for(const std::vector<double> &values : *columns[j])
     {
-      clearLfr();
-      LOG(Error,"Invalid flow 1 '" << row[5].toStdString() << "'");
-      return false;
+      if(values.size() != dateTimes.size())
+      {
+        LOG(Error,type << " file has " << values.size() << " values for an object, but " << dateTimes.size()
+          << " times");
+        return false;
+      }
     }
-    m_dP[nrMap[nr]].push_back(dP);
-    m_F0[nrMap[nr]].push_back(F0);
-    m_F1[nrMap[nr]].push_back(F1);
-
   }
-  // Unwind the zone number map;
-  QList<int> keys = nrMap.keys();
-  m_pathNr.resize(keys.size());
-  for(int i=0;i<keys.size();i++)
+  // Something should probably be done here to make sure that the times here match up with what we
+  // already have. For now, if nothing is known about the dates, then use these
+  if(m_dateTimes.empty())
   {
-    m_pathNr[nrMap[keys[i]]] = keys[i];
+    setDateTimes(dateTimes);
+  }
+  return true;
+}
+
+void SimFile::setDateTimes(const std::vector<openstudio::DateTime> &dateTimes)
+{
+  m_dateTimes = dateTimes;
+  if(m_dateTimes.size() == 1) {
+    m_reportDateTimes = m_dateTimes;
+  } else if(m_dateTimes.empty()) {
+    m_reportDateTimes.clear();
+  } else {
+    m_reportDateTimes = std::vector<openstudio::DateTime>(m_dateTimes.begin()+1,m_dateTimes.end());
   }
-  file.close();
-  // Compute the required date/time objects - this needs to be moved elsewhere if the NCR and NFR are also read
-  if(!computeDateTimes(day,time))
+}
+
+void SimFile::clearLfr()
+{
+  m_pathNr.clear();
+  m_pathIndex.clear();
+  m_dP.clear();
+  m_F0.clear();
+  m_F1.clear();
+}
+
+bool SimFile::readLfr(QString fileName)
+{
+  clearLfr();
+  const char *names[4] = {"link number", "pressure difference", "flow 0", "flow 1"};
+  std::vector<std::vector<double> > *columns[3] = {&m_dP, &m_F0, &m_F1};
+  if(!readResults(fileName, "LFR", false, names, false, m_pathNr, columns))
   {
     clearLfr();
-    m_dateTimes.clear();
-    LOG(Error,"Failed to compute date and time objects from LFR input");
     return false;
   }
+  for(unsigned i=0;i<m_pathNr.size();i++)
+  {
+    m_pathIndex[m_pathNr[i]] = i;
+  }
   return true;
 }
 
 void SimFile::clearNfr()
 {
+  m_nodeNr.clear();
+  m_nodeIndex.clear();
   m_T.clear();
   m_P.clear();
   m_D.clear();
@@ -205,240 +322,138 @@ void SimFile::clearNfr()
 bool SimFile::readNfr(QString fileName)
 {
   clearNfr();
-  QVector<QString> day;
-  QVector<QString> time;
-  openstudio::filesystem::ifstream file(openstudio::toPath(fileName));
-  if(file.is_open())
-  {
-    LOG(Error,"Failed to open NFR file '" << fileName.toStdString() << "'");
-    return false;
-  }
-
-  QMap<int,int> nrMap;
-  // Read the header
-  std::string headerstr;
-  std::getline(file, headerstr);
-  QString header = openstudio::toQString(headerstr);
-  if(header.isNull() || header.isEmpty())
+  const char *names[4] = {"node number", "temperature", "pressure", "density"};
+  std::vector<std::vector<double> > *columns[3] = {&m_T, &m_P, &m_D};
+  // The ambient node (0) may not have a density
+  if(!readResults(fileName, "NFR", true, names, true, m_nodeNr, columns))
   {
-    LOG(Error,"No data in LFR file '" << fileName.toStdString() << "'");
+    clearNfr();
     return false;
   }
-  QStringList row = header.split('\t');
-  int ncols = 6;
-  if(row.size() != ncols && row.size() != ncols+2)
+  for(unsigned i=0;i<m_nodeNr.size();i++)
   {
-    LOG(Error,"NFR file has " << row.size() << " columns, not the expected " << ncols);
-    return false;
+    m_nodeIndex[m_nodeNr[i]] = i;
   }
-  // Read the data
-  while(file.good())
-  {
-    std::string linestr;
-    std::getline(file, linestr);
-    QString line = openstudio::toQString(linestr);
-
-    QStringList row = line.split('\t');
-    if(row.size() != ncols && row.size() != ncols+2)
-    {
-      clearNfr();
-      LOG(Error,"NFR data line has " << row.size() << " columns, not the expected " << ncols);
-      return false;
-    }
-    if(time.size())
-    {
-      if(time[time.size()-1] != row[1])
-      {
-        day << row[0];
-        time << row[1];
-      }
-    }
-    else
-    {
-      day << row[0];
-      time << row[1];
-    }
-    bool convOk;
-    int nr = row[2].toInt(&convOk);
-    if(!convOk)
-    {
-      clearNfr();
-      LOG(Error,"Invalid node number '" << row[2].toStdString() << "'");
-      return false;
-    }
-    if(!nrMap.contains(nr))
-    {
-      int sz = nrMap.size();
-      nrMap[nr] = sz;
-      m_T.resize(sz+1);
-      m_P.resize(sz+1);
-      m_D.resize(sz+1);
-    }
-    double T = row[3].toDouble(&convOk);
-    if(!convOk)
-    {
-      clearNfr();
-      LOG(Error,"Invalid temperature '" << row[3].toStdString() << "'");
-      return false;
-    }
-    double P = row[4].toDouble(&convOk);
-    if(!convOk)
-    {
-      clearNfr();
-      LOG(Error,"Invalid pressure '" << row[4].toStdString() << "'");
-      return false;
-    }
-    double D = row[5].toDouble(&convOk);
-    if(!convOk)
-    {
-      if(nr==0)
-      {
-        D=0.0;
-      }
-      else
-      {
-        clearNfr();
-        LOG(Error,"Invalid density '" << row[5].toStdString() << "'");
-        return false;
-      }
-    }
-    m_T[nrMap[nr]].push_back(T);
-    m_P[nrMap[nr]].push_back(P);
-    m_D[nrMap[nr]].push_back(D);
+  return true;
+}
 
-  }
-  // Unwind the zone number map;
-  QList<int> keys = nrMap.keys();
-  m_nodeNr.resize(keys.size());
-  for(int i=0;i<keys.size();i++)
+int SimFile::pathIndex(int nr) const
+{
+  std::map<int,int>::const_iterator iter = m_pathIndex.find(nr);
+  if(iter == m_pathIndex.end())
   {
-    m_nodeNr[nrMap[keys[i]]] = keys[i];
+    return -1;
   }
-  file.close();
-  // Something should probably be done here to make sure that the times here match up with what we
-  // already have. For now, if nothing is known about the dates, then try to compute it
-  if(m_dateTimes.size() == 0)
+  return iter->second;
+}
+
+int SimFile::nodeIndex(int nr) const
+{
+  std::map<int,int>::const_iterator iter = m_nodeIndex.find(nr);
+  if(iter == m_nodeIndex.end())
   {
-    if(!computeDateTimes(day,time))
-    {
-      clearLfr();
-      m_dateTimes.clear();
-      LOG(Error,"Failed to compute date and time objects from NFR input");
-      return false;
-    }
+    return -1;
   }
-  return true;
+  return iter->second;
 }
 
-static openstudio::TimeSeries convertData(std::vector<openstudio::DateTime> inputDateTimes,
-                                          std::vector<double> inputValues, std::string units)
+boost::optional<openstudio::TimeSeries> SimFile::convertData(const std::vector<double> &values,
+  const std::string &units) const
 {
-  // Use a per-interval trapezoidal approximation to convert the CONTAM point data into E+ interval data
-  std::vector<openstudio::DateTime> dateTimes;
-  std::vector<double> values;
-  if(inputDateTimes.size()==1) // Account for steady simulation results
+  if(values.size() != m_dateTimes.size())
+  {
+    LOG(Warn,"Result has " << values.size() << " values, but there are " << m_dateTimes.size() << " times");
+    return boost::optional<openstudio::TimeSeries>();
+  }
+  if(m_dateTimes.size()==1) // Account for steady simulation results
   {
-    return openstudio::TimeSeries(inputDateTimes,createVector(inputValues),units);
+    return openstudio::TimeSeries(m_dateTimes,createVector(values),units);
   }
-  for(unsigned i=1;i<inputDateTimes.size();i++)
+  // Use a per-interval trapezoidal approximation to convert the CONTAM point data into E+ interval data
+  Vector intervalValues(m_reportDateTimes.size());
+  for(unsigned i=1;i<m_dateTimes.size();i++)
   {
-    dateTimes.push_back(inputDateTimes[i]);
-    values.push_back(0.5*(inputValues[i-1]+inputValues[i]));
+    intervalValues[i-1] = 0.5*(values[i-1]+values[i]);
   }
-  return openstudio::TimeSeries(dateTimes,createVector(values),units);
+  return openstudio::TimeSeries(m_reportDateTimes,intervalValues,units);
 }
 
-
 boost::optional<openstudio::TimeSeries> SimFile::pathDeltaP(int nr) const
 {
-  int index = m_pathNr.indexOf(nr);
+  int index = pathIndex(nr);
   if(index == -1)
   {
     return boost::optional<openstudio::TimeSeries>();
   }
-  openstudio::TimeSeries series = convertData(m_dateTimes,m_dP[index],"Pa");
-  return boost::optional<openstudio::TimeSeries>(series);
+  return convertData(m_dP[index],"Pa");
 }
 
 boost::optional<openstudio::TimeSeries> SimFile::pathFlow0(int nr) const
 {
-  int index = m_pathNr.indexOf(nr);
+  int index = pathIndex(nr);
   if(index == -1)
   {
     return boost::optional<openstudio::TimeSeries>();
   }
-  openstudio::TimeSeries series = convertData(m_dateTimes,m_F0[index],"kg/s");
-  return boost::optional<openstudio::TimeSeries>(series);
+  return convertData(m_F0[index],"kg/s");
 }
 
 boost::optional<openstudio::TimeSeries> SimFile::pathFlow1(int nr) const
 {
-  int index = m_pathNr.indexOf(nr);
+  int index = pathIndex(nr);
   if(index == -1)
   {
     return boost::optional<openstudio::TimeSeries>();
   }
-  openstudio::TimeSeries series = convertData(m_dateTimes,m_F1[index],"kg/s");
-  return boost::optional<openstudio::TimeSeries>(series);
+  return convertData(m_F1[index],"kg/s");
 }
 
 boost::optional<openstudio::TimeSeries> SimFile::pathFlow(int nr) const
 {
-  int index = m_pathNr.indexOf(nr);
+  int index = pathIndex(nr);
   if(index == -1)
   {
     return boost::optional<openstudio::TimeSeries>();
   }
-  std::vector<double> flow(m_dateTimes.size());
-  for(unsigned i=0;i<m_dateTimes.size();i++)
+  const std::vector<double> &F0 = m_F0[index];
+  const std::vector<double> &F1 = m_F1[index];
+  std::vector<double> flow(F0.size());
+  for(unsigned i=0;i<flow.size();i++)
   {
-    flow[i] = m_F0[index][i] + m_F1[index][i];
+    flow[i] = F0[i] + F1[i];
   }
   // Need to confirm that the total flow is F0+F1, since it also could be F0-F1
-  openstudio::TimeSeries series = convertData(m_dateTimes,flow,"kg/s");
-  return boost::optional<openstudio::TimeSeries>(series);
+  return convertData(flow,"kg/s");
 }
 
 boost::optional<openstudio::TimeSeries> SimFile::nodeTemperature(int nr) const
 {
-  int index = m_nodeNr.indexOf(nr);
+  int index = nodeIndex(nr);
   if(index == -1)
   {
     return boost::optional<openstudio::TimeSeries>();
   }
-  openstudio::TimeSeries series = convertData(m_dateTimes,m_T[index],"K");
-  return boost::optional<openstudio::TimeSeries>(series);
+  return convertData(m_T[index],"K");
 }
 
 boost::optional<openstudio::TimeSeries> SimFile::nodePressure(int nr) const
 {
-  int index = m_nodeNr.indexOf(nr);
+  int index = nodeIndex(nr);
   if(index == -1)
   {
     return boost::optional<openstudio::TimeSeries>();
   }
-  openstudio::TimeSeries series = convertData(m_dateTimes,m_P[index],"Pa");
-  return boost::optional<openstudio::TimeSeries>(series);
+  return convertData(m_P[index],"Pa");
 }
 
 boost::optional<openstudio::TimeSeries> SimFile::nodeDensity(int nr) const
 {
-  int index = m_nodeNr.indexOf(nr);
+  int index = nodeIndex(nr);
   if(index == -1)
   {
     return boost::optional<openstudio::TimeSeries>();
   }
-  openstudio::TimeSeries series = convertData(m_dateTimes,m_D[index],"kg/m^3");
-  return boost::optional<openstudio::TimeSeries>(series);
-}
-
-std::vector<openstudio::DateTime> SimFile::dateTimes() const
-{
-  if(m_dateTimes.size() == 1) {
-    return std::vector<openstudio::DateTime>(m_dateTimes.begin(),m_dateTimes.end());
-  } else {
-    return std::vector<openstudio::DateTime>(m_dateTimes.begin()+1,m_dateTimes.end());
-  }
+  return convertData(m_D[index],"kg/m^3");
 }
 
 /*
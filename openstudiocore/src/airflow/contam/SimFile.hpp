@@ -34,42 +34,60 @@
 #include "../utilities/data/TimeSeries.hpp"
 #include "../utilities/core/Path.hpp"
 
-#include <QVector>
-
 #include "../AirflowAPI.hpp"
 
+#include <QString>
+
+#include <map>
+
 namespace openstudio {
 namespace contam {
 
+/** SimFile loads the text results (.lfr and .nfr) that simread extracts from a
+ *  CONTAM SIM file. The results are stored in columns, with one contiguous array
+ *  of values per path or node and quantity, and the timestamps are parsed once
+ *  into a single index that is shared by all of the columns. The files are memory
+ *  mapped when possible and parsed in place.
+ */
 class AIRFLOW_API SimFile {
 public:
   explicit SimFile(openstudio::path path);
 
   // These are provided for advanced use
-  std::vector<std::vector<double> > dP() const
+  const std::vector<std::vector<double> > &dP() const
   {
     return m_dP;
   }
-  std::vector<std::vector<double> > F0() const
+  const std::vector<std::vector<double> > &F0() const
   {
     return m_F0;
   }
-  std::vector<std::vector<double> > F1() const
+  const std::vector<std::vector<double> > &F1() const
   {
     return m_F1;
   }
-  std::vector<std::vector<double> > T() const
+  const std::vector<std::vector<double> > &T() const
   {
     return m_T;
   }
-  std::vector<std::vector<double> > P() const
+  const std::vector<std::vector<double> > &P() const
   {
     return m_P;
   }
-  std::vector<std::vector<double> > D() const
+  const std::vector<std::vector<double> > &D() const
   {
     return m_D;
   }
+  /** Returns the CONTAM path numbers in the order of the path results. */
+  const std::vector<int> &pathNrs() const
+  {
+    return m_pathNr;
+  }
+  /** Returns the CONTAM node numbers in the order of the node results. */
+  const std::vector<int> &nodeNrs() const
+  {
+    return m_nodeNr;
+  }
 
 
   // Most use should be confined to these
@@ -82,12 +100,15 @@ public:
   boost::optional<openstudio::TimeSeries> nodeDensity(int nr) const;
   /** Returns a vector of DateTime objects that give the EnergyPlus-style
    *  end of interval times. These are not the actual times in the SIM file */
-  std::vector<openstudio::DateTime> dateTimes() const;
+  const std::vector<openstudio::DateTime> &dateTimes() const
+  {
+    return m_reportDateTimes;
+  }
 
   /** Returns a vector of DateTime objects that the SIM file contains data for.
    *  CONTAM always includes a start time result, so a yearly simulation will
    *  result in 8761 times. */
-  std::vector<openstudio::DateTime> fileDateTimes() const
+  const std::vector<openstudio::DateTime> &fileDateTimes() const
   {
     return m_dateTimes;
   }
@@ -97,17 +118,26 @@ private:
   bool readLfr(QString fileName);
   void clearNfr();
   bool readNfr(QString fileName);
-  bool computeDateTimes(QVector<QString> day, QVector<QString> time);
-
-  QVector<int> m_pathNr;  // the CONTAM path index
+  // Reads a tab-separated results file with columns day, time, number, and three values
+  bool readResults(const QString &fileName, const std::string &type, bool extraColumns, const char *names[4],
+    bool zeroInvalidLast, std::vector<int> &nrs, std::vector<std::vector<double> > *columns[3]);
+  void setDateTimes(const std::vector<openstudio::DateTime> &dateTimes);
+  boost::optional<openstudio::TimeSeries> convertData(const std::vector<double> &values, const std::string &units) const;
+  int pathIndex(int nr) const;
+  int nodeIndex(int nr) const;
+
+  std::vector<int> m_pathNr;  // the CONTAM path index
+  std::map<int,int> m_pathIndex;
   std::vector<std::vector<double> > m_dP;
   std::vector<std::vector<double> > m_F0;
   std::vector<std::vector<double> > m_F1;
-  QVector<int> m_nodeNr;  // the CONTAM node index
+  std::vector<int> m_nodeNr;  // the CONTAM node index
+  std::map<int,int> m_nodeIndex;
   std::vector<std::vector<double> > m_T;
   std::vector<std::vector<double> > m_P;
   std::vector<std::vector<double> > m_D;
   std::vector<openstudio::DateTime> m_dateTimes;
+  std::vector<openstudio::DateTime> m_reportDateTimes;
 
   bool m_hasLfr;
   bool m_hasNfr;
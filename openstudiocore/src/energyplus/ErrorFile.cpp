@@ -28,19 +28,186 @@
 
 #include "ErrorFile.hpp"
 
-#include <boost/regex.hpp>
 #include <boost/algorithm/string.hpp>
 
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
 namespace openstudio {
 namespace energyplus {
 
+  namespace {
+
+    inline bool isSpace(char c)
+    {
+      return (c == ' ') || (c == '\t') || (c == '\r') || (c == '\n') || (c == '\f') || (c == '\v');
+    }
+
+    inline bool isDigit(char c)
+    {
+      return (c >= '0') && (c <= '9');
+    }
+
+    inline const char* skipSpace(const char* p, const char* end)
+    {
+      while ((p != end) && isSpace(*p)) { ++p; }
+      return p;
+    }
+
+    inline const char* skipStars(const char* p, const char* end)
+    {
+      while ((p != end) && (*p == '*')) { ++p; }
+      return p;
+    }
+
+    inline bool startsWith(const char* p, const char* end, const char* text)
+    {
+      size_t n = std::strlen(text);
+      return (static_cast<size_t>(end - p) >= n) && (std::memcmp(p, text, n) == 0);
+    }
+
+    // tries to read "** <type> **<rest>" starting at p, equivalent to the tail of the old
+    // "^\s*\**\s+\*\*\s*([^\s\*]+)\s*\*\*(.*)$" regex
+    bool matchMessageMarker(const char* p, const char* end,
+                            const char*& typeBegin, const char*& typeEnd, const char*& rest)
+    {
+      if (!startsWith(p, end, "**")) {
+        return false;
+      }
+      p = skipSpace(p + 2, end);
+      typeBegin = p;
+      while ((p != end) && !isSpace(*p) && (*p != '*')) { ++p; }
+      typeEnd = p;
+      if (typeBegin == typeEnd) {
+        return false;
+      }
+      p = skipSpace(p, end);
+      if (!startsWith(p, end, "**")) {
+        return false;
+      }
+      rest = p + 2;
+      return true;
+    }
+
+    // classifies lines like "   ** Warning ** text" and "   **   ~~~   ** text", leading
+    // whitespace, then optional stars, then whitespace, then the marker
+    bool matchMessage(const char* begin, const char* end,
+                      const char*& typeBegin, const char*& typeEnd, const char*& rest)
+    {
+      const char* a = skipSpace(begin, end);
+      const char* b = skipStars(a, end);
+      const char* c = skipSpace(b, end);
+      if ((c != b) && matchMessageMarker(c, end, typeBegin, typeEnd, rest)) {
+        return true;
+      }
+      if ((a != begin) && matchMessageMarker(a, end, typeBegin, typeEnd, rest)) {
+        return true;
+      }
+      return false;
+    }
+
+    // classifies lines like "   ************* EnergyPlus Completed Successfully", returns the text after "*+ "
+    const char* matchStatus(const char* begin, const char* end)
+    {
+      const char* a = skipSpace(begin, end);
+      const char* b = skipStars(a, end);
+      if ((a == b) || (b == end) || (*b != ' ')) {
+        return nullptr;
+      }
+      return b + 1;
+    }
+
+    bool isCompletedSuccessfully(const char* p, const char* end)
+    {
+      if (startsWith(p, end, "EnergyPlus Completed Successfully")) {
+        return true;
+      }
+      if (startsWith(p, end, "GroundTempCalc")) {
+        p += std::strlen("GroundTempCalc");
+        while ((p != end) && !isSpace(*p)) { ++p; }
+        return startsWith(p, end, " Completed Successfully");
+      }
+      return false;
+    }
+
+    bool isTerminated(const char* p, const char* end)
+    {
+      return startsWith(p, end, "EnergyPlus Terminated");
+    }
+
+    boost::optional<ErrorLevel> errorLevel(const std::string& type)
+    {
+      if (boost::iequals(type, "Warning")) {
+        return ErrorLevel(ErrorLevel::Warning);
+      } else if (boost::iequals(type, "Severe")) {
+        return ErrorLevel(ErrorLevel::Severe);
+      } else if (boost::iequals(type, "Fatal")) {
+        return ErrorLevel(ErrorLevel::Fatal);
+      }
+      return boost::none;
+    }
+
+  }
+
   /// constructor
   ErrorFile::ErrorFile(const openstudio::path& errPath)
-    : m_completed(false), m_completedSuccessfully(false)
+    : m_completed(false), m_completedSuccessfully(false), m_inMessage(false)
   {
-    openstudio::filesystem::ifstream ifs(errPath);
-    parse(ifs);
+    openstudio::filesystem::ifstream ifs(errPath, std::ios_base::binary);
+    std::vector<char> buffer(1 << 16);
+    while (ifs && !m_completed){
+      ifs.read(buffer.data(), buffer.size());
+      std::streamsize n = ifs.gcount();
+      if (n <= 0){
+        break;
+      }
+      append(buffer.data(), static_cast<size_t>(n));
+    }
     ifs.close();
+    finalize();
+  }
+
+  ErrorFile::ErrorFile()
+    : m_completed(false), m_completedSuccessfully(false), m_inMessage(false)
+  {
+  }
+
+  void ErrorFile::append(const std::string& data)
+  {
+    append(data.data(), data.size());
+  }
+
+  void ErrorFile::append(const char* data, size_t size)
+  {
+    const char* p = data;
+    const char* end = data + size;
+    while ((p != end) && !m_completed){
+      const char* eol = static_cast<const char*>(std::memchr(p, '\n', end - p));
+      if (!eol){
+        m_partialLine.append(p, end);
+        break;
+      }
+      if (m_partialLine.empty()){
+        parseLine(p, eol);
+      }else{
+        m_partialLine.append(p, eol);
+        parseLine(m_partialLine.data(), m_partialLine.data() + m_partialLine.size());
+        m_partialLine.clear();
+      }
+      p = eol + 1;
+    }
+  }
+
+  void ErrorFile::finalize()
+  {
+    if (!m_partialLine.empty() && !m_completed){
+      std::string line;
+      line.swap(m_partialLine);
+      parseLine(line.data(), line.data() + line.size());
+    }
+    m_partialLine.clear();
+    closeMessage();
   }
 
   /// get warnings
@@ -61,6 +228,10 @@ namespace energyplus {
     return m_fatalErrors;
   }
 
+  std::map<std::string, unsigned> ErrorFile::warningCounts() const
+  {
+    return m_warningCounts;
+  }
 
   /// did EnergyPlus complete or crash
   bool ErrorFile::completed() const
@@ -74,94 +245,109 @@ namespace energyplus {
     return m_completedSuccessfully;
   }
 
-  void ErrorFile::parse(openstudio::filesystem::ifstream& is)
+  std::string ErrorFile::messageTemplate(const std::string& message)
   {
-    std::string line;
-
-
-    // matches[1], warning/error type
-    // matches[2], rest of line
-    boost::regex warningOrError("^\\s*\\**\\s+\\*\\*\\s*([^\\s\\*]+)\\s*\\*\\*(.*)$");
-
-    // matches[1], rest of line
-    boost::regex warningOrErrorContinue("^\\s*\\**\\s+\\*\\*\\s*~~~\\s*\\*\\*(.*)$");
-
-    // completed successfully
-    boost::regex completedSuccessful("^\\s*\\*+ EnergyPlus Completed Successfully.*");
-
-    // ground temp completed successfully
-    boost::regex groundTempCompletedSuccessful("^\\s*\\*+ GroundTempCalc\\S* Completed Successfully.*");
-
-    // completed unsuccessfully
-    boost::regex completedUnsuccessful("^\\s*\\*+ EnergyPlus Terminated.*");
-
-    // repeat count
-
-
-    // read the file line by line using regexes
-    while(std::getline(is, line)){
-
-      boost::smatch matches;
-
-//      LOG(Debug, "Parsing ErrorFile Line: " << line);
-
-
-      // parse the file
-      if (boost::regex_search(line, matches, warningOrError)){
-        std::string warningOrErrorType = std::string(matches[1].first, matches[1].second); boost::trim(warningOrErrorType);
-        std::string warningOrErrorString = std::string(matches[2].first, matches[2].second); boost::trim(warningOrErrorString);
-
-        // read the rest of the multi line warning or error
-        while(true){
-          std::streampos pos = is.tellg();
-          if (!std::getline(is, line)){
-            break;
-          }
-          if (boost::regex_search(line, matches, warningOrErrorContinue)){
-            std::string temp = std::string(matches[1].first, matches[1].second); boost::trim_right(temp);
-            warningOrErrorString += "\n" + temp;
-          }else{
-            // unget the line
-            is.seekg(pos);
-            break;
-          }
+    std::string result;
+    result.reserve(message.size());
+
+    std::string::const_iterator it = message.begin();
+    std::string::const_iterator end = std::find(message.begin(), message.end(), '\n');
+    while (it != end){
+      char c = *it;
+      if (c == '"' || c == '['){
+        char close = (c == '"') ? '"' : ']';
+        std::string::const_iterator closeIt = std::find(it + 1, end, close);
+        if (closeIt != end){
+          result += c;
+          result += '*';
+          result += close;
+          it = closeIt + 1;
+          continue;
         }
+      }else if (isDigit(c) && (result.empty() || !(std::isalnum(static_cast<unsigned char>(result.back())) || (result.back() == '_')))){
+        while ((it != end) && (isDigit(*it) || (*it == '.'))) { ++it; }
+        result += '#';
+        continue;
+      }
+      result += c;
+      ++it;
+    }
 
-        LOG(Trace, "Error parsed: " << warningOrErrorString);
+    return result;
+  }
 
+  void ErrorFile::parseLine(const char* begin, const char* end)
+  {
+    const char* typeBegin = nullptr;
+    const char* typeEnd = nullptr;
+    const char* rest = nullptr;
+
+    if (matchMessage(begin, end, typeBegin, typeEnd, rest)){
+      const char* restEnd = end;
+      while ((restEnd != rest) && isSpace(*(restEnd - 1))) { --restEnd; }
+
+      if (m_inMessage && ((typeEnd - typeBegin) == 3) && (std::memcmp(typeBegin, "~~~", 3) == 0)){
+        // continuation of the current multi line warning or error
+        m_currentMessage += '\n';
+        m_currentMessage.append(rest, restEnd);
+        return;
+      }
 
-        // correctly sort warnings and errors
-        try{
-          ErrorLevel level(warningOrErrorType);
+      closeMessage();
 
-          switch(level.value()){
-            case ErrorLevel::Warning:
-              m_warnings.push_back(warningOrErrorString);
-              break;
-            case ErrorLevel::Severe:
-              m_severeErrors.push_back(warningOrErrorString);
-              break;
-            case ErrorLevel::Fatal:
-              m_fatalErrors.push_back(warningOrErrorString);
-              break;
-          }
+      std::string type(typeBegin, typeEnd);
+      rest = skipSpace(rest, restEnd);
 
-        }catch(...){
-          LOG(Error, "Unknown warning or error level '" << warningOrErrorType << "'");
-        }
+      m_inMessage = true;
+      m_currentLevel = errorLevel(type);
+      m_currentMessage.assign(rest, restEnd);
+      if (!m_currentLevel){
+        LOG(Error, "Unknown warning or error level '" << type << "'");
+      }
+      return;
+    }
+
+    closeMessage();
 
-      }else if (boost::regex_match(line, completedSuccessful) 
-                || boost::regex_match(line, groundTempCompletedSuccessful)) {
+    const char* status = matchStatus(begin, end);
+    if (status){
+      if (isCompletedSuccessfully(status, end)){
         m_completed = true;
         m_completedSuccessfully = true;
-        break;
-      }else if (boost::regex_match(line, completedUnsuccessful)){
+      }else if (isTerminated(status, end)){
         m_completed = true;
         m_completedSuccessfully = false;
-        break;
+      }
+    }
+  }
+
+  void ErrorFile::closeMessage()
+  {
+    if (!m_inMessage){
+      return;
+    }
+
+    LOG(Trace, "Error parsed: " << m_currentMessage);
+
+    // correctly sort warnings and errors
+    if (m_currentLevel){
+      switch(m_currentLevel->value()){
+        case ErrorLevel::Warning:
+          ++m_warningCounts[messageTemplate(m_currentMessage)];
+          m_warnings.push_back(m_currentMessage);
+          break;
+        case ErrorLevel::Severe:
+          m_severeErrors.push_back(m_currentMessage);
+          break;
+        case ErrorLevel::Fatal:
+          m_fatalErrors.push_back(m_currentMessage);
+          break;
       }
     }
 
+    m_inMessage = false;
+    m_currentLevel.reset();
+    m_currentMessage.clear();
   }
 
 } // energyplus
@@ -35,7 +35,9 @@
 #include "../utilities/core/Enum.hpp"
 #include "../utilities/core/Logger.hpp"
 
+#include <boost/optional.hpp>
 
+#include <map>
 #include <string>
 #include <vector>
 
@@ -52,9 +54,21 @@ namespace energyplus {
   class ENERGYPLUS_API ErrorFile {
    public:
 
-    /// constructor
+    /// constructor, parses the complete err file at errPath
     ErrorFile(const openstudio::path& errPath);
 
+    /// constructor for incremental parsing, feed the err file contents with append as EnergyPlus writes them
+    ErrorFile();
+
+    /// parse bytes appended to the err file, a trailing partial line is buffered until its end of line is seen
+    void append(const std::string& data);
+
+    /// parse bytes appended to the err file, a trailing partial line is buffered until its end of line is seen
+    void append(const char* data, size_t size);
+
+    /// parse any buffered partial line and close the last warning or error, call once the err file is complete
+    void finalize();
+
     /// get warnings
     std::vector<std::string> warnings() const;
 
@@ -64,24 +78,39 @@ namespace energyplus {
     /// get fatal errors
     std::vector<std::string> fatalErrors() const;
 
+    /// get the number of times each warning message template occurs, see messageTemplate
+    std::map<std::string, unsigned> warningCounts() const;
+
     /// did EnergyPlus complete or crash
     bool completed() const;
 
     /// completed successfully
     bool completedSuccessfully() const;
 
+    /// returns the first line of message with quoted names, bracketed values and numbers replaced by placeholders
+    static std::string messageTemplate(const std::string& message);
+
    private:
 
     REGISTER_LOGGER("energyplus.ErrorFile");
 
-    void parse(openstudio::filesystem::ifstream& is);
+    void parseLine(const char* begin, const char* end);
+
+    void closeMessage();
 
     std::vector<std::string> m_warnings;
     std::vector<std::string> m_severeErrors;
     std::vector<std::string> m_fatalErrors;
+    std::map<std::string, unsigned> m_warningCounts;
     bool m_completed;
     bool m_completedSuccessfully;
 
+    // incremental parse state
+    std::string m_partialLine;
+    std::string m_currentMessage;
+    boost::optional<ErrorLevel> m_currentLevel;
+    bool m_inMessage;
+
   };
 
 } // energyplus
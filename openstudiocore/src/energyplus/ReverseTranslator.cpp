@@ -31,6 +31,7 @@
 #include "GeometryTranslator.hpp"
 
 #include "../model/ModelObject.hpp"
+#include "../model/ModelObject_Impl.hpp"
 
 #include "../utilities/idf/IdfFile.hpp"
 #include "../utilities/idf/WorkspaceObject.hpp"
@@ -39,10 +40,13 @@
 #include <utilities/idd/IddEnums.hxx>
 
 #include "../utilities/core/Assert.hpp"
+#include "../utilities/core/Parallel.hpp"
 #include "../utilities/plot/ProgressBar.hpp"
 
 #include <QThread>
 
+#include <thread>
+
 using namespace openstudio::model;
 
 using namespace std;
@@ -52,12 +56,19 @@ namespace openstudio {
 namespace energyplus {
 
 ReverseTranslator::ReverseTranslator()
+  : m_progressBar(nullptr),
+    m_numThreads(std::max(std::thread::hardware_concurrency(), 1u))
 {
   m_logSink.setLogLevel(Warn);
   m_logSink.setChannelRegex(boost::regex("openstudio\\.energyplus\\.ReverseTranslator"));
   m_logSink.setThreadId(QThread::currentThread());
 }
 
+void ReverseTranslator::setNumThreads(unsigned numThreads)
+{
+  m_numThreads = std::max(numThreads, 1u);
+}
+
 boost::optional<model::Model> ReverseTranslator::loadModel(const openstudio::path& path, ProgressBar* progressBar)
 {
   m_model = Model();
@@ -137,6 +148,8 @@ Model ReverseTranslator::translateWorkspace(const Workspace & workspace, Progres
 
   m_untranslatedIdfObjects.clear();
 
+  m_preparedObjects.clear();
+
   m_logSink.resetStringStream();
 
   // if multiple runperiod objects in idf, remove them all
@@ -163,6 +176,9 @@ Model ReverseTranslator::translateWorkspace(const Workspace & workspace, Progres
 
   m_logSink.setChannelRegex(boost::regex("openstudio\\.energyplus\\.ReverseTranslator"));
 
+  // translate independent leaf objects on worker threads, they are added to the model in order below
+  prepareLeafObjects();
+
   // look for site object in workspace and translate if found
   LOG(Trace,"Translating Site:Location object.");
   vector<WorkspaceObject> site = m_workspace.getObjectsByType(IddObjectType::Site_Location);
@@ -198,6 +214,7 @@ Model ReverseTranslator::translateWorkspace(const Workspace & workspace, Progres
   }
 
   LOG(Trace,"Translation nominally complete.");
+  m_preparedObjects.clear();
   m_model.setFastNaming(false);
   return m_model;
 }
@@ -259,13 +276,43 @@ boost::optional<ModelObject> ReverseTranslator::translateAndMapWorkspaceObject(c
 
   LOG(Trace,"Translating " << workspaceObject.briefDescription() << ".");
 
+  bool addToUntranslated = true;
+
+  modelObject = addPreparedObject(workspaceObject);
+  if (!modelObject) {
+    modelObject = translateWorkspaceObject(workspaceObject, addToUntranslated);
+  }
+
+  if( modelObject )
+  {
+    LOG(Trace,"Adding " << modelObject.get().briefDescription() << " to map.");
+    m_workspaceToModelMap.insert(make_pair(workspaceObject.handle(), modelObject.get()));
+  }else{
+    if (addToUntranslated){
+      if (std::find_if(m_untranslatedIdfObjects.begin(), m_untranslatedIdfObjects.end(), IdfObjectEqual(workspaceObject.idfObject())) == m_untranslatedIdfObjects.end()){
+        LOG(Trace,"Ignoring " << workspaceObject.briefDescription() << ".");
+        m_untranslatedIdfObjects.push_back(workspaceObject.idfObject());
+      }
+    }
+  }
+
+  if (m_progressBar){
+    m_progressBar->setValue(m_untranslatedIdfObjects.size() + m_workspaceToModelMap.size());
+  }
+
+  return modelObject;
+}
+
+boost::optional<ModelObject> ReverseTranslator::translateWorkspaceObject(const WorkspaceObject & workspaceObject,
+                                                                         bool& addToUntranslated)
+{
+  boost::optional<ModelObject> modelObject;
+
   // DLM: the scope of this translator is being changed, we now only import objects from idf
   // in the geometry, loads, resources, and general simulation control portions of the model.
   // Users can add idf objects to their model using idf measures.  Only objects viewable in the
   // current GUIs should be imported, I am making an exception for curves.
 
-  bool addToUntranslated = true;
-
   switch(workspaceObject.iddObject().type().value())
   {
   case openstudio::IddObjectType::AirLoopHVAC :
@@ -980,24 +1027,115 @@ boost::optional<ModelObject> ReverseTranslator::translateAndMapWorkspaceObject(c
     }
   }
 
-  if( modelObject )
+  return modelObject;
+}
+
+namespace {
+
+  // Types whose translators only read the object's own fields and create a single ModelObject.
+  // These can be translated into a scratch model on any thread.
+  bool isLeafObjectType(IddObjectType type)
   {
-    LOG(Trace,"Adding " << modelObject.get().briefDescription() << " to map.");
-    m_workspaceToModelMap.insert(make_pair(workspaceObject.handle(), modelObject.get()));
-  }else{
-    if (addToUntranslated){
-      if (std::find_if(m_untranslatedIdfObjects.begin(), m_untranslatedIdfObjects.end(), IdfObjectEqual(workspaceObject.idfObject())) == m_untranslatedIdfObjects.end()){
-        LOG(Trace,"Ignoring " << workspaceObject.briefDescription() << ".");
-        m_untranslatedIdfObjects.push_back(workspaceObject.idfObject());
+    switch(type.value())
+    {
+    case openstudio::IddObjectType::Curve_Bicubic :
+    case openstudio::IddObjectType::Curve_Biquadratic :
+    case openstudio::IddObjectType::Curve_Cubic :
+    case openstudio::IddObjectType::Curve_DoubleExponentialDecay :
+    case openstudio::IddObjectType::Curve_ExponentialSkewNormal :
+    case openstudio::IddObjectType::Curve_FanPressureRise :
+    case openstudio::IddObjectType::Curve_Functional_PressureDrop :
+    case openstudio::IddObjectType::Curve_Linear :
+    case openstudio::IddObjectType::Curve_Quadratic :
+    case openstudio::IddObjectType::Curve_QuadraticLinear :
+    case openstudio::IddObjectType::Curve_Quartic :
+    case openstudio::IddObjectType::Curve_RectangularHyperbola1 :
+    case openstudio::IddObjectType::Curve_RectangularHyperbola2 :
+    case openstudio::IddObjectType::Curve_Sigmoid :
+    case openstudio::IddObjectType::Curve_Triquadratic :
+    case openstudio::IddObjectType::Material :
+    case openstudio::IddObjectType::Material_AirGap :
+    case openstudio::IddObjectType::Material_NoMass :
+    case openstudio::IddObjectType::ScheduleTypeLimits :
+    case openstudio::IddObjectType::WindowMaterial_Gas :
+    case openstudio::IddObjectType::WindowMaterial_Glazing :
+    case openstudio::IddObjectType::WindowMaterial_SimpleGlazingSystem :
+      return true;
+    default:
+      return false;
+    }
+  }
+
+  // not worth starting a thread for fewer objects than this
+  const unsigned minLeafObjectsPerThread = 16;
+
+}
+
+void ReverseTranslator::prepareLeafObjects()
+{
+  std::vector<WorkspaceObject> leafObjects;
+  for (const WorkspaceObject& workspaceObject : m_workspace.objects()) {
+    if (isLeafObjectType(workspaceObject.iddObject().type())) {
+      leafObjects.push_back(workspaceObject);
+    }
+  }
+
+  if (m_numThreads < 2) {
+    return;
+  }
+  std::vector<IndexRange> ranges = threadRanges(leafObjects.size(), m_numThreads, minLeafObjectsPerThread);
+  if (ranges.size() < 2) {
+    return;
+  }
+
+  LOG(Trace,"Translating " << leafObjects.size() << " leaf objects on " << ranges.size() << " threads.");
+
+  // each thread translates a contiguous range of leafObjects into its own scratch model, only
+  // reading m_workspace, which is not modified until all threads are joined
+  std::vector<boost::optional<IdfObject> > prepared(leafObjects.size());
+  runOnThreads(ranges, [&leafObjects, &prepared](std::size_t, std::size_t begin, std::size_t end) {
+    ReverseTranslator scratch; // its log sink only listens to this thread
+    scratch.m_model.setFastNaming(true);
+    for (std::size_t i = begin; i < end; ++i) {
+      try {
+        OptionalModelObject modelObject = scratch.translateAndMapWorkspaceObject(leafObjects[i]);
+        if (modelObject && scratch.m_logSink.logMessages().empty()) {
+          prepared[i] = modelObject->idfObject();
+        }
       }
+      catch (...) {
+        // left for the main translation, which will report the problem
+      }
+      scratch.m_logSink.resetStringStream();
+    }
+  });
+
+  for (unsigned i = 0, n = leafObjects.size(); i < n; ++i) {
+    if (prepared[i]) {
+      m_preparedObjects.insert(std::make_pair(leafObjects[i].handle(), *prepared[i]));
     }
   }
+}
 
-  if (m_progressBar){
-    m_progressBar->setValue(m_untranslatedIdfObjects.size() + m_workspaceToModelMap.size());
+boost::optional<ModelObject> ReverseTranslator::addPreparedObject(const WorkspaceObject & workspaceObject)
+{
+  auto it = m_preparedObjects.find(workspaceObject.handle());
+  if (it == m_preparedObjects.end()) {
+    return boost::none;
   }
+  IdfObject prepared = it->second;
+  m_preparedObjects.erase(it);
 
-  return modelObject;
+  OptionalWorkspaceObject added = m_model.addObject(prepared);
+  if (!added) {
+    return boost::none;
+  }
+  if (added->name() != prepared.name()) {
+    // renamed to avoid a name conflict, the regular translator resolves those differently
+    m_model.removeObject(added->handle());
+    return boost::none;
+  }
+  return added->cast<ModelObject>();
 }
 
 boost::optional<openstudio::model::Model> loadAndTranslateIdf(const openstudio::path& path)
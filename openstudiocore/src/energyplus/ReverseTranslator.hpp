@@ -58,6 +58,13 @@ class ENERGYPLUS_API ReverseTranslator {
   /** Get IdfObjects that were passed over by the last translation. */
   std::vector<IdfObject> untranslatedIdfObjects() const;
 
+  /** Set the number of threads used to translate leaf objects (materials, curves, and
+   *  ScheduleTypeLimits) ahead of the main translation. The main translation, including the
+   *  creation of all objects in the Model, always runs on the calling thread and in the same
+   *  order, so the resulting Model does not depend on numThreads. Set to 1 to translate
+   *  everything on the calling thread. Defaults to the number of hardware threads. */
+  void setNumThreads(unsigned numThreads);
+
  private:
 
   REGISTER_LOGGER("openstudio.energyplus.ReverseTranslator");
@@ -78,6 +85,22 @@ class ENERGYPLUS_API ReverseTranslator {
    */
   boost::optional<model::ModelObject> translateAndMapWorkspaceObject(const WorkspaceObject & workspaceObject);
 
+  /** Dispatches workspaceObject to its type specific translator. Sets addToUntranslated to false
+   *  for types that are deliberately skipped. */
+  boost::optional<model::ModelObject> translateWorkspaceObject(const WorkspaceObject & workspaceObject,
+                                                               bool& addToUntranslated);
+
+  /** Translates the leaf objects of m_workspace into scratch models on worker threads and keeps
+   *  the resulting IdfObjects in m_preparedObjects. Leaf objects are those whose translators only
+   *  read their own fields and create a single ModelObject. An object is not prepared if its
+   *  translation logs a warning or error, so that those messages are reported in order by the
+   *  main translation. */
+  void prepareLeafObjects();
+
+  /** Adds the prepared IdfObject for workspaceObject to m_model, if there is one. Falls back to the
+   *  regular translator (by returning boost::none) if the object would be renamed. */
+  boost::optional<model::ModelObject> addPreparedObject(const WorkspaceObject & workspaceObject);
+
   boost::optional<model::ModelObject> translateAirLoopHVAC(const WorkspaceObject& workspaceObject);
 
   boost::optional<model::ModelObject> translateAirLoopHVACOutdoorAirSystem(const WorkspaceObject& workspaceObject);
@@ -332,9 +355,13 @@ class ENERGYPLUS_API ReverseTranslator {
 
   std::vector<IdfObject> m_untranslatedIdfObjects;
 
+  std::map<openstudio::Handle,IdfObject> m_preparedObjects;
+
   StringStreamLogSink m_logSink;
 
   ProgressBar* m_progressBar;
+
+  unsigned m_numThreads;
 };
 
 
@@ -35,6 +35,11 @@
 
 #include <resources.hxx>
 
+#include <boost/regex.hpp>
+#include <boost/algorithm/string.hpp>
+
+#include <chrono>
+#include <iostream>
 #include <sstream>
 
 using openstudio::energyplus::ErrorFile;
@@ -113,4 +118,167 @@ TEST_F(EnergyPlusFixture,ErrorFile_WarningsAndCrash)
   EXPECT_FALSE(errorFile.completedSuccessfully());
 }
 
+TEST_F(EnergyPlusFixture,ErrorFile_Incremental)
+{
+  std::vector<std::string> names{"NoErrorsNoWarnings.err", "RepeatingWarnings.err", "SevereErrors.err",
+                                 "Warnings.err", "WarningsAndCrash.err", "WarningsAndSevere.err"};
+
+  for (const std::string& name : names){
+    openstudio::path path = resourcesPath() / openstudio::toPath("energyplus/ErrorFiles") / openstudio::toPath(name);
+    ErrorFile errorFile(path);
+
+    openstudio::filesystem::ifstream ifs(path, std::ios_base::binary);
+    std::stringstream ss;
+    ss << ifs.rdbuf();
+    std::string contents = ss.str();
+
+    // feed the file in small chunks as if EnergyPlus were still writing it
+    ErrorFile incremental;
+    for (size_t i = 0; i < contents.size(); i += 7){
+      incremental.append(contents.substr(i, 7));
+    }
+    incremental.finalize();
+
+    EXPECT_EQ(errorFile.warnings(), incremental.warnings()) << name;
+    EXPECT_EQ(errorFile.severeErrors(), incremental.severeErrors()) << name;
+    EXPECT_EQ(errorFile.fatalErrors(), incremental.fatalErrors()) << name;
+    EXPECT_EQ(errorFile.warningCounts(), incremental.warningCounts()) << name;
+    EXPECT_EQ(errorFile.completed(), incremental.completed()) << name;
+    EXPECT_EQ(errorFile.completedSuccessfully(), incremental.completedSuccessfully()) << name;
+  }
+}
+
+TEST_F(EnergyPlusFixture,ErrorFile_IncrementalStatus)
+{
+  ErrorFile errorFile;
+  EXPECT_FALSE(errorFile.completed());
+
+  errorFile.append("Program Version,EnergyPlus, Version 8.7.0\n   ** Warning ** First warning\n");
+  // the last message stays open until a line that does not continue it is seen
+  EXPECT_EQ(0u, errorFile.warnings().size());
+
+  errorFile.append("   **   ~~~   ** continued\n   ************* Beginning Simulation\n   ** Severe  ** Bad ");
+  ASSERT_EQ(1u, errorFile.warnings().size());
+  EXPECT_EQ("First warning\n continued", errorFile.warnings()[0]);
+  EXPECT_EQ(0u, errorFile.severeErrors().size());
+
+  errorFile.append("input\n   ************* EnergyPlus Terminated--Error(s) Detected.\n");
+  ASSERT_EQ(1u, errorFile.severeErrors().size());
+  EXPECT_EQ("Bad input", errorFile.severeErrors()[0]);
+  EXPECT_TRUE(errorFile.completed());
+  EXPECT_FALSE(errorFile.completedSuccessfully());
+
+  // anything after the completion line is ignored
+  errorFile.append("   ** Warning ** Late warning\n");
+  errorFile.finalize();
+  EXPECT_EQ(1u, errorFile.warnings().size());
+}
+
+TEST_F(EnergyPlusFixture,ErrorFile_WarningCounts)
+{
+  openstudio::path path = resourcesPath() / openstudio::toPath("energyplus/ErrorFiles/RepeatingWarnings.err");
+
+  ErrorFile errorFile(path);
+  std::map<std::string, unsigned> counts = errorFile.warningCounts();
+
+  unsigned total = 0;
+  for (const auto& count : counts){
+    total += count.second;
+  }
+  EXPECT_EQ(errorFile.warnings().size(), total);
+  EXPECT_LT(counts.size(), errorFile.warnings().size());
+
+  EXPECT_EQ("CalcDoe2DXCoil: Coil:Cooling:DX:SingleSpeed \"*\" - Air-cooled condenser inlet dry-bulb temperature below # C. Outdoor dry-bulb temperature = -#",
+            ErrorFile::messageTemplate("CalcDoe2DXCoil: Coil:Cooling:DX:SingleSpeed \"COIL COOLING DX SINGLE SPEED 3\" - Air-cooled condenser inlet dry-bulb temperature below 0 C. Outdoor dry-bulb temperature = -3.80\n ... Occurrence info"));
+  EXPECT_EQ("Difference=[*] degrees, #/# #:#",
+            ErrorFile::messageTemplate("Difference=[0.28] degrees, 01/21 21:10"));
+}
+
+namespace {
+
+  // the regex based parser ErrorFile used before the single pass classifier, kept for benchmarking
+  void regexParse(const openstudio::path& errPath, std::vector<std::string>& warnings, bool& completed)
+  {
+    openstudio::filesystem::ifstream is(errPath);
+    std::string line;
+
+    boost::regex warningOrError("^\\s*\\**\\s+\\*\\*\\s*([^\\s\\*]+)\\s*\\*\\*(.*)$");
+    boost::regex warningOrErrorContinue("^\\s*\\**\\s+\\*\\*\\s*~~~\\s*\\*\\*(.*)$");
+    boost::regex completedSuccessful("^\\s*\\*+ EnergyPlus Completed Successfully.*");
+    boost::regex completedUnsuccessful("^\\s*\\*+ EnergyPlus Terminated.*");
+
+    completed = false;
+    while(std::getline(is, line)){
+      boost::smatch matches;
+      if (boost::regex_search(line, matches, warningOrError)){
+        std::string type = std::string(matches[1].first, matches[1].second); boost::trim(type);
+        std::string message = std::string(matches[2].first, matches[2].second); boost::trim(message);
+        while(true){
+          std::streampos pos = is.tellg();
+          if (!std::getline(is, line)){
+            break;
+          }
+          if (boost::regex_search(line, matches, warningOrErrorContinue)){
+            std::string temp = std::string(matches[1].first, matches[1].second); boost::trim_right(temp);
+            message += "\n" + temp;
+          }else{
+            is.seekg(pos);
+            break;
+          }
+        }
+        if (type == "Warning"){
+          warnings.push_back(message);
+        }
+      }else if (boost::regex_match(line, completedSuccessful) || boost::regex_match(line, completedUnsuccessful)){
+        completed = true;
+        break;
+      }
+    }
+  }
+
+}
+
+TEST_F(EnergyPlusFixture,DISABLED_ErrorFile_Benchmark)
+{
+  openstudio::path repeating = resourcesPath() / openstudio::toPath("energyplus/ErrorFiles/RepeatingWarnings.err");
+  openstudio::path path = openstudio::toPath("./ErrorFile_Benchmark.err");
+
+  // build a ~200 MB err file out of the repeating warnings
+  {
+    openstudio::filesystem::ifstream ifs(repeating);
+    std::string line;
+    std::string warnings;
+    while (std::getline(ifs, line)){
+      if (boost::starts_with(boost::trim_left_copy(line), "** ")){
+        warnings += line + "\n";
+      }
+    }
+
+    openstudio::filesystem::ofstream ofs(path);
+    ofs << "Program Version,EnergyPlus, Version 8.7.0\n";
+    std::size_t size = 0;
+    while (size < 200 * 1024 * 1024){
+      ofs << warnings;
+      size += warnings.size();
+    }
+    ofs << "   ************* EnergyPlus Completed Successfully-- 0 Warning; 0 Severe Errors; Elapsed Time=00hr 00min  1.00sec\n";
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  std::vector<std::string> regexWarnings;
+  bool regexCompleted = false;
+  regexParse(path, regexWarnings, regexCompleted);
+  auto regexDone = std::chrono::steady_clock::now();
+  ErrorFile errorFile(path);
+  auto done = std::chrono::steady_clock::now();
+
+  EXPECT_TRUE(regexCompleted);
+  EXPECT_TRUE(errorFile.completed());
+  EXPECT_EQ(regexWarnings, errorFile.warnings());
 
+  std::cout << "regex parser: " << std::chrono::duration<double>(regexDone - start).count() << " s, "
+            << "ErrorFile: " << std::chrono::duration<double>(done - regexDone).count() << " s, "
+            << errorFile.warnings().size() << " warnings in " << errorFile.warningCounts().size() << " templates" << std::endl;
+
+  openstudio::filesystem::remove(path);
+}
@@ -82,7 +82,12 @@
 
 #include <resources.hxx>
 
+#include <boost/algorithm/string/predicate.hpp>
+
+#include <chrono>
+#include <iostream>
 #include <sstream>
+#include <thread>
 
 using namespace openstudio::energyplus;
 using namespace openstudio::model;
@@ -474,3 +479,85 @@ TEST_F(EnergyPlusFixture, ReverseTranslator_OtherEquipment) {
   EXPECT_EQ(otherEquipments[0].name().get(), "Other Eq 1");
   EXPECT_EQ(otherEquipments[0].endUseSubcategory(), "Category A");
 }
+
+namespace {
+
+  // object counts by type, plus the field data of translated leaf objects
+  std::map<std::string, unsigned> objectCounts(const Model& model) {
+    std::map<std::string, unsigned> result;
+    for (const WorkspaceObject& object : model.objects()) {
+      ++result[object.iddObject().name()];
+    }
+    return result;
+  }
+
+  std::vector<std::string> leafObjectData(const Model& model) {
+    std::vector<std::string> result;
+    for (const WorkspaceObject& object : model.objects()) {
+      std::string type = object.iddObject().name();
+      if (boost::starts_with(type, "OS:Material") || boost::starts_with(type, "OS:WindowMaterial") ||
+          boost::starts_with(type, "OS:Curve") || (type == "OS:ScheduleTypeLimits"))
+      {
+        std::stringstream ss;
+        ss << type;
+        // skip the handle
+        for (unsigned i = 1, n = object.numFields(); i < n; ++i) {
+          ss << "," << object.getString(i, false, false).get();
+        }
+        result.push_back(ss.str());
+      }
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+  }
+
+}
+
+TEST_F(EnergyPlusFixture, ReverseTranslator_ParallelLeafObjects) {
+  openstudio::path inputPath = resourcesPath() / openstudio::toPath("energyplus/RefLargeOffice/RefBldgLargeOfficeNew2004_Chicago.idf");
+  Workspace ws = Workspace::load(inputPath).get();
+
+  ReverseTranslator serialTranslator;
+  serialTranslator.setNumThreads(1);
+  Model serialModel = serialTranslator.translateWorkspace(ws);
+
+  ReverseTranslator parallelTranslator;
+  parallelTranslator.setNumThreads(4);
+  Model parallelModel = parallelTranslator.translateWorkspace(ws);
+
+  EXPECT_EQ(objectCounts(serialModel), objectCounts(parallelModel));
+  std::vector<std::string> serialLeafData = leafObjectData(serialModel);
+  EXPECT_FALSE(serialLeafData.empty());
+  EXPECT_EQ(serialLeafData, leafObjectData(parallelModel));
+  EXPECT_EQ(serialTranslator.warnings().size(), parallelTranslator.warnings().size());
+  EXPECT_EQ(serialTranslator.errors().size(), parallelTranslator.errors().size());
+  EXPECT_EQ(serialTranslator.untranslatedIdfObjects().size(), parallelTranslator.untranslatedIdfObjects().size());
+}
+
+TEST_F(EnergyPlusFixture, DISABLED_ReverseTranslator_Benchmark) {
+  // every idf under resources/energyplus
+  std::vector<openstudio::path> paths;
+  for (openstudio::filesystem::recursive_directory_iterator it(resourcesPath() / toPath("energyplus")), end; it != end; ++it) {
+    if (openstudio::filesystem::is_regular_file(it->path()) && (it->path().extension() == toPath(".idf"))) {
+      paths.push_back(it->path());
+    }
+  }
+
+  for (const openstudio::path& p : paths) {
+    OptionalWorkspace ws = Workspace::load(p);
+    if (!ws) {
+      continue;
+    }
+    double ms[2];
+    for (unsigned j = 0; j < 2; ++j) {
+      ReverseTranslator rt;
+      rt.setNumThreads(j == 0 ? 1 : std::thread::hardware_concurrency());
+      auto start = std::chrono::steady_clock::now();
+      Model model = rt.translateWorkspace(*ws);
+      auto end = std::chrono::steady_clock::now();
+      ms[j] = std::chrono::duration<double, std::milli>(end - start).count();
+    }
+    std::cout << toString(p.filename()) << ": " << ws->numObjects() << " objects, serial " << ms[0]
+              << " ms, parallel " << ms[1] << " ms" << std::endl;
+  }
+}
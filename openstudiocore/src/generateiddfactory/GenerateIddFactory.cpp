@@ -751,13 +751,16 @@ void completeOutFiles(const IddFileFactoryDataVector& iddFiles,
     << "    return result; " << std::endl
     << "  }" << std::endl
     << std::endl
-    << "  // Add the IddObjects." << std::endl
+    << "  // Add the IddObjects. They are only created when first requested from the IddFile." << std::endl
     << "  for(IddObjectCallbackMap::const_iterator it = m_callbackMap.begin()," << std::endl
     << "      itend = m_callbackMap.end(); it != itend; ++it) {" << std::endl
     << "    if (isInFile(it->first,fileType)) {" << std::endl
-    << "      // This lock is necessary to protect construction of the statics used in the callbacks " << std::endl
-    << "      QMutexLocker l(&m_callbackmutex);" << std::endl
-    << "      result.addObject(it->second());" << std::endl
+    << "      CreateIddObjectCallback callback = it->second;" << std::endl
+    << "      result.addObject(it->first,[this,callback]() {" << std::endl
+    << "        // This lock is necessary to protect construction of the statics used in the callbacks " << std::endl
+    << "        QMutexLocker l(&m_callbackmutex);" << std::endl
+    << "        return callback();" << std::endl
+    << "      });" << std::endl
     << "    }" << std::endl
     << "  }" << std::endl
     << std::endl
@@ -28,6 +28,9 @@
 
 #include "EpwData.hpp"
 #include "SolarRadiation.hpp"
+#include "../utilities/filetypes/EpwCache.hpp"
+
+#include <algorithm>
 
 namespace openstudio {
 namespace isomodel {
@@ -38,71 +41,6 @@ EpwData::EpwData(const openstudio::path &t_path)
   loadData(t_path);
 }
 
-void EpwData::parseHeader(const std::string &line)
-{
-  std::stringstream linestream(line);
-
-  //cout << "Weather Location Header: "<<endl;
-  for(int i = 0;i<10;i++)
-  {
-    std::string s;
-    std::getline(linestream, s, ',');
-    switch(i)
-    {
-      case 1:
-        m_location = s;
-        //cout << "\tLocation: " << s <<endl;
-        break;
-      case 5:
-        m_stationid = s;
-        //cout << "\tStation ID: " << s <<endl;
-        break;
-      case 6:
-        m_latitude = atof(s.c_str());
-        //cout << "\tLatitude: " << s <<endl;
-        break;
-      case 7:
-        m_longitude = atof(s.c_str());
-        //cout << "\tLongitude: " << s <<endl;
-        break;
-      case 8:
-        m_timezone = atoi(s.c_str());
-        //cout << "\tTimezone: " << s <<endl;
-        break;
-      default:
-        break;
-    }
-  }
-}
-
-void EpwData::parseData(const std::string &line, size_t row)
-{
-  std::stringstream linestream(line);
-  size_t col = 0;
-
-  for(size_t i = 0;i<22;i++)
-  {
-    std::string s;
-    std::getline(linestream, s, ',');
-    switch(i)
-    {
-      case 6:
-      case 7:
-      case 8:
-      case 13:
-      case 14:
-      case 15:
-      case 21:
-        assert(col < m_data.size());
-        assert(row < m_data[col].size());
-        m_data[col++][row] = ::atof(s.c_str());
-        break;
-      default:
-        break;
-    }
-  }
-}
-
 void EpwData::toISOData(Matrix &_msolar, Matrix &_mhdbt, Matrix &_mhEgh, Vector &_mEgh, Vector &_mdbt, Vector &_mwind) const
 {
   struct MakeMatrix {
@@ -192,29 +130,29 @@ std::string EpwData::toISOData() const {
 void EpwData::loadData(const openstudio::path &fn)
 {
   // Array was fully initialized in constructor
-  std::ifstream myfile(openstudio::toString(fn).c_str());
-  if (myfile.is_open())
-  {
-    size_t i = 0;
-    size_t row = 0;
-    while ( myfile.good() && row < 8760)
-    {
-      i++;
-      std::string line;
-      getline(myfile,line);
-      if(i==1)
-      {
-        parseHeader(line);
-      }
-      else if(i > 8)
-      {
-        parseData(line,row++);
-      }      
-    }
-    myfile.close();
-  } else {
+  std::shared_ptr<const EpwWeatherData> weatherData;
+  if (openstudio::filesystem::exists(fn)) {
+    weatherData = EpwCache::get(fn);
+  }
+  if (!weatherData) {
     throw std::runtime_error("Unable to open weather file: " + openstudio::toString(fn));
   }
+
+  const EpwFile &header = weatherData->header();
+  m_location = header.city();
+  m_stationid = header.wmoNumber();
+  m_latitude = header.latitude();
+  m_longitude = header.longitude();
+  m_timezone = static_cast<int>(header.timeZone());
+
+  const EpwDataField fields[] = {EpwDataField::DryBulbTemperature, EpwDataField::DewPointTemperature,
+    EpwDataField::RelativeHumidity, EpwDataField::GlobalHorizontalRadiation, EpwDataField::DirectNormalRadiation,
+    EpwDataField::DiffuseHorizontalRadiation, EpwDataField::WindSpeed};
+  size_t rows = std::min(weatherData->column(fields[0]).size(), m_data[0].size());
+  for (size_t col = 0; col < m_data.size(); ++col) {
+    const std::vector<double> &column = weatherData->column(fields[col]);
+    std::copy(column.begin(), column.begin() + rows, m_data[col].begin());
+  }
 }
 }
 }
@@ -68,8 +68,6 @@ class EpwData
 
   protected:
     void loadData(const openstudio::path &t_path);
-    void parseHeader(const std::string &line);
-    void parseData(const std::string &line, size_t row);
     std::string m_location,m_stationid;
     int m_timezone;
     double m_latitude,m_longitude;
@@ -28,6 +28,8 @@
 
 #include "SimModel.hpp"
 
+#include "../utilities/core/Parallel.hpp"
+
 #if _DEBUG || (__GNUC__ && !NDEBUG)
 #define DEBUG_ISO_MODEL_SIMULATION
 #endif
@@ -55,6 +57,20 @@ namespace isomodel {
   }
 
 
+  std::vector<ISOResults> simulateBatch(const std::vector<SimModel>& simModels, unsigned numThreads)
+  {
+    std::vector<ISOResults> results(simModels.size());
+
+    // each thread simulates a contiguous block of models and writes only its own results
+    runOnThreads(threadRanges(simModels.size(), numThreads), [&simModels, &results](std::size_t, std::size_t begin, std::size_t end) {
+      for (std::size_t i = begin; i < end; ++i) {
+        results[i] = simModels[i].simulate();
+      }
+    });
+
+    return results;
+  }
+
   void SimModel::printVector(const char* vecName, const Vector &vec){
 #ifdef DEBUG_ISO_MODEL_SIMULATION
     std::stringstream ss;
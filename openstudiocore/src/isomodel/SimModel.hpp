@@ -248,6 +248,13 @@ namespace isomodel {
     static void printVector(const char* vecName, const Vector &vec);
     static void printMatrix(const char* matName, const Matrix &mat);
   };
+
+  /*
+   *  Runs simulate() for each of simModels, for instance the design variants of a parametric study,
+   *  spreading the models over numThreads threads (0 uses one thread per core).
+   *  Results are in the order of simModels and identical to calling simulate() on each model in turn.
+   */
+  ISOMODEL_API std::vector<ISOResults> simulateBatch(const std::vector<SimModel>& simModels, unsigned numThreads = 0);
 } // isomodel
 } // openstudio
 
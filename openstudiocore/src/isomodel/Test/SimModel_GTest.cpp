@@ -31,6 +31,8 @@
 #include "../SimModel.hpp"
 #include "../UserModel.hpp"
 #include <resources.hxx>
+#include <chrono>
+#include <iostream>
 #include <sstream>
 
 using namespace openstudio::isomodel;
@@ -330,3 +332,67 @@ TEST_F(ISOModelFixture, SimModel)
   EXPECT_DOUBLE_EQ(0, results.monthlyResults[10].getEndUse(EndUseFuelType::Gas, EndUseCategoryType::WaterSystems) );
   EXPECT_DOUBLE_EQ(0, results.monthlyResults[11].getEndUse(EndUseFuelType::Gas, EndUseCategoryType::WaterSystems) );
 }
+
+namespace {
+
+  std::vector<UserModel> makeVariants(const UserModel& base, unsigned numVariants)
+  {
+    std::vector<UserModel> variants(numVariants, base);
+    for (unsigned i = 0; i < numVariants; ++i) {
+      double scale = 0.5 + static_cast<double>(i) / numVariants;
+      variants[i].setFloorArea(base.floorArea() * scale);
+      variants[i].setCoolingSystemCOP(base.coolingSystemCOP() * scale);
+      variants[i].setWindowAreaS(base.windowAreaS() * scale);
+      variants[i].setWallUvalueN(base.wallUvalueN() / scale);
+    }
+    return variants;
+  }
+
+}
+
+TEST_F(ISOModelFixture, SimModel_Batch)
+{
+  UserModel userModel;
+  userModel.load(resourcesPath() / openstudio::toPath("isomodel/exampleModel.ISO"));
+  ASSERT_TRUE(userModel.valid());
+  std::shared_ptr<WeatherData> weather = userModel.loadWeather();
+  ASSERT_TRUE(weather);
+
+  std::vector<UserModel> variants = makeVariants(userModel, 23);
+  std::vector<ISOResults> batchResults = simulateBatch(variants, weather, 4);
+  ASSERT_EQ(variants.size(), batchResults.size());
+
+  for (unsigned i = 0; i < variants.size(); ++i) {
+    ISOResults results = variants[i].toSimModel().simulate();
+    ASSERT_EQ(results.monthlyResults.size(), batchResults[i].monthlyResults.size());
+    for (unsigned month = 0; month < results.monthlyResults.size(); ++month) {
+      for (const auto & fuelType : EndUses::fuelTypes()) {
+        for (const auto & category : EndUses::categories()) {
+          // exact match, not just close
+          EXPECT_EQ(results.monthlyResults[month].getEndUse(fuelType, category),
+                    batchResults[i].monthlyResults[month].getEndUse(fuelType, category));
+        }
+      }
+    }
+  }
+
+  EXPECT_TRUE(simulateBatch(std::vector<SimModel>(), 4).empty());
+}
+
+TEST_F(ISOModelFixture, DISABLED_SimModel_Batch_Benchmark)
+{
+  UserModel userModel;
+  userModel.load(resourcesPath() / openstudio::toPath("isomodel/exampleModel.ISO"));
+  ASSERT_TRUE(userModel.valid());
+  std::shared_ptr<WeatherData> weather = userModel.loadWeather();
+
+  std::vector<UserModel> variants = makeVariants(userModel, 10000);
+  for (unsigned numThreads : {1u, 0u}) {
+    auto start = std::chrono::steady_clock::now();
+    std::vector<ISOResults> results = simulateBatch(variants, weather, numThreads);
+    auto end = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(end - start).count();
+    std::cout << (numThreads == 1 ? "1 thread: " : "all cores: ") << results.size() / seconds
+              << " variants per second" << std::endl;
+  }
+}
@@ -46,6 +46,15 @@ namespace isomodel {
       throw std::runtime_error("UserModel is not valid, cannot create SimModel");
     }
 
+    return toSimModel(_weather);
+  }
+
+  SimModel UserModel::toSimModel(std::shared_ptr<WeatherData> weather) const
+  {
+    if(!weather){
+      throw std::runtime_error("No weather data, cannot create SimModel");
+    }
+
     SimModel sim;
 
     std::shared_ptr<Population> pop(new Population);
@@ -61,7 +70,7 @@ namespace isomodel {
 
     std::shared_ptr<Location> loc(new Location);
     loc->setTerrain(_terrainClass);
-    loc->setWeatherData(_weather);
+    loc->setWeatherData(weather);
     sim.setLocation(loc);
 
     std::shared_ptr<Building> building(new Building);
@@ -222,6 +231,19 @@ namespace isomodel {
     sim.setVentilation(ventilation);
     return sim;
   }
+
+  std::vector<ISOResults> simulateBatch(const std::vector<UserModel>& userModels,
+                                        std::shared_ptr<WeatherData> weather,
+                                        unsigned numThreads)
+  {
+    std::vector<SimModel> simModels;
+    simModels.reserve(userModels.size());
+    for (const auto & userModel : userModels) {
+      simModels.push_back(userModel.toSimModel(weather));
+    }
+    return simulateBatch(simModels, numThreads);
+  }
+
   //http://stackoverflow.com/questions/10051679/c-tokenize-string
   std::vector<std::string> inline stringSplit(const std::string &source, char delimiter = ' ', bool keepEmpty = false)
   {
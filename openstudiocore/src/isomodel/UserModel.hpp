@@ -69,6 +69,13 @@ namespace isomodel {
      */  
     SimModel toSimModel();
 
+    /**
+     * Generates a SimModel from the specified parameters of the
+     * UserModel, using weather rather than this model's weather file.
+     * Lets many variants share one copy of the weather data.
+     */
+    SimModel toSimModel(std::shared_ptr<WeatherData> weather) const;
+
     /**
      * Indicates whether or not the user model loaded in correctly
      * If either the ISO file or the Weather File cannot be found
@@ -512,6 +519,15 @@ namespace isomodel {
 
   };
 
+  /**
+   * Simulates each of userModels with the same weather data, for instance the
+   * design variants of a parametric study. Equivalent to calling
+   * toSimModel(weather).simulate() on each model; see simulateBatch.
+   */
+  ISOMODEL_API std::vector<ISOResults> simulateBatch(const std::vector<UserModel>& userModels,
+                                                     std::shared_ptr<WeatherData> weather,
+                                                     unsigned numThreads = 0);
+
 } // isomodel
 } // openstudio
 
@@ -595,22 +595,16 @@ namespace detail {
 
   double Building_Impl::exteriorSurfaceArea() const {
     double result(0.0);
-    for (const Surface& surface : model().getConcreteModelObjects<Surface>()) {
-      OptionalSpace space = surface.space();
-      std::string outsideBoundaryCondition = surface.outsideBoundaryCondition();
-      if (space && openstudio::istringEqual(outsideBoundaryCondition, "Outdoors")) {
-        result += surface.grossArea() * space->multiplier();
-      }
+    for (const Space& space : spaces()) {
+      result += space.exteriorArea() * space.multiplier();
     }
     return result;
   }
 
   double Building_Impl::exteriorWallArea() const {
     double result(0.0);
-    for (const Surface& exteriorWall : exteriorWalls()) {
-      if (OptionalSpace space = exteriorWall.space()) {
-        result += exteriorWall.grossArea() * space->multiplier();
-      }
+    for (const Space& space : spaces()) {
+      result += space.exteriorWallArea() * space.multiplier();
     }
     return result;
   }
@@ -49,6 +49,7 @@
 #include "ConnectorSplitter.hpp"
 #include "ConnectorSplitter_Impl.hpp"
 #include "Model.hpp"
+#include "Model_Impl.hpp"
 
 #include <utilities/idd/IddEnums.hxx>
 
@@ -60,12 +61,14 @@ namespace model {
 
 namespace detail {
   Loop_Impl::Loop_Impl(IddObjectType type, Model_Impl* model)
-    : ParentObject_Impl(type,model)
+    : ParentObject_Impl(type,model),
+      m_topologyChangeCount(0)
   {
   }
 
   Loop_Impl::Loop_Impl(const IdfObject& idfObject, Model_Impl* model, bool keepHandle)
-    : ParentObject_Impl(idfObject, model, keepHandle)
+    : ParentObject_Impl(idfObject, model, keepHandle),
+      m_topologyChangeCount(0)
   { 
   }
 
@@ -73,14 +76,16 @@ namespace detail {
       const openstudio::detail::WorkspaceObject_Impl& other, 
       Model_Impl* model, 
       bool keepHandle)
-    : ParentObject_Impl(other,model,keepHandle)
+    : ParentObject_Impl(other,model,keepHandle),
+      m_topologyChangeCount(0)
   {
   }
 
   Loop_Impl::Loop_Impl(const Loop_Impl& other, 
       Model_Impl* model, 
       bool keepHandles)
-    : ParentObject_Impl(other,model,keepHandles)
+    : ParentObject_Impl(other,model,keepHandles),
+      m_topologyChangeCount(0)
   {
   }
 
@@ -115,39 +120,6 @@ namespace detail {
     return ParentObject_Impl::remove();
   }
 
-  // Recursive depth first search
-  // start algorithm with one source node in the visited vector
-  // searches all paths of nodes between the source and sink until a handle match is found
-  boost::optional<ModelObject> findModelObject(const openstudio::Handle & handle, const HVACComponent & sink, std::vector<HVACComponent> & visited, bool isDemandComponents)
-  {
-    HVACComponent hvacComponent = visited.back();
-    if( handle == hvacComponent.handle() ) { 
-      return hvacComponent;
-    }
-
-    boost::optional<HVACComponent> prev;
-    if( visited.size() >= 2u ) prev = visited.rbegin()[1];
-
-    std::vector<HVACComponent> nodes = hvacComponent.getImpl<HVACComponent_Impl>()->edges(prev);
-
-    for(auto it = nodes.begin();
-        it != nodes.end();
-        it++)
-    {
-      // if it node has already been visited or node is sink then continue
-      if( std::find(visited.begin(), visited.end(), *it) != visited.end() ||
-          *it == sink )
-      {
-        continue; 
-      }
-      visited.push_back(*it);
-      boost::optional<ModelObject> foundHandle = findModelObject(handle, sink, visited, isDemandComponents);
-      if( foundHandle ) { return *foundHandle; }
-      visited.pop_back();
-    }
-    return boost::none;
-  }
-
   OptionalModelObject Loop_Impl::component(openstudio::Handle handle)
   {
     boost::optional<ModelObject> supplyComp = this->supplyComponent(handle);
@@ -164,9 +136,9 @@ namespace detail {
 
     for( auto const & inletComp : inletComps ) {
       if( handle == inletComp.handle() ) { return inletComp; }
-      std::vector<HVACComponent> visited { inletComp };
-      if( auto mo = findModelObject(handle, outletComp, visited, true) ) {
-        return mo;
+      const LoopPath & path = loopPath(inletComp, outletComp);
+      if( path.reachable.find(handle) != path.reachable.end() ) {
+        return model().getModelObject<ModelObject>(handle);
       }
     }
 
@@ -183,9 +155,9 @@ namespace detail {
 
     for( auto const & outletComp : outletComps ) {
       if( handle == outletComp.handle() ) { return outletComp; }
-      std::vector<HVACComponent> visited { inletComp };
-      if( auto mo = findModelObject(handle, outletComp, visited, false) ) {
-        return mo;
+      const LoopPath & path = loopPath(inletComp, outletComp);
+      if( path.reachable.find(handle) != path.reachable.end() ) {
+        return model().getModelObject<ModelObject>(handle);
       }
     }
 
@@ -239,90 +211,155 @@ namespace detail {
     return result;
   }
 
-  // Recursive depth first search
-  // start algorithm with one source node in the visited vector
-  // when complete, paths will be populated with all nodes between the source node and sink
-  void findModelObjects(const HVACComponent & sink, std::vector<HVACComponent> & visited, std::vector<HVACComponent> & paths, bool isDemandComponents)
+  void Loop_Impl::checkLoopTopology() const
+  {
+    unsigned long long changeCount = model().getImpl<Model_Impl>()->changeCount();
+    if( changeCount != m_topologyChangeCount ) {
+      m_loopEdges.clear();
+      m_loopPaths.clear();
+      m_topologyChangeCount = changeCount;
+    }
+  }
+
+  const std::vector<HVACComponent>& Loop_Impl::loopEdges(const HVACComponent & component,
+                                                         const boost::optional<HVACComponent> & previous) const
+  {
+    std::pair<Handle,Handle> key(component.handle(), previous ? previous->handle() : Handle());
+    auto it = m_loopEdges.find(key);
+    if( it == m_loopEdges.end() ) {
+      it = m_loopEdges.insert(std::make_pair(key, component.getImpl<HVACComponent_Impl>()->edges(previous))).first;
+    }
+    return it->second;
+  }
+
+  // Depth first search from the back of visited to outletComp.
+  // Components are added to path.components in the order the paths between inlet and outlet are found,
+  // the same order as an exhaustive search of all paths would give. Since the loop halves are acyclic
+  // apart from the loop closure itself, whether a component entered from a given neighbor leads to the
+  // outlet does not depend on how it was reached. Each (component, previous) state is therefore
+  // searched once, which makes the search linear in the size of the loop.
+  bool Loop_Impl::traverseLoop(const HVACComponent & outletComp,
+                               std::vector<HVACComponent> & visited,
+                               std::set<Handle> & visitedHandles,
+                               std::map<std::pair<Handle,Handle>,bool> & explored,
+                               LoopPath & path,
+                               std::set<Handle> & pathHandles) const
   {
+    auto addPath = [&](const HVACComponent & last) {
+      for( const auto & comp : visited ) {
+        if( pathHandles.insert(comp.handle()).second ) {
+          path.components.push_back(comp.handle());
+        }
+      }
+      if( pathHandles.insert(last.handle()).second ) {
+        path.components.push_back(last.handle());
+      }
+    };
+
+    HVACComponent component = visited.back();
     boost::optional<HVACComponent> prev;
     if( visited.size() >= 2u ) prev = visited.rbegin()[1];
 
-    std::vector<HVACComponent> nodes = visited.back().getImpl<HVACComponent_Impl>()->edges(prev);
+    const std::vector<HVACComponent> & nodes = loopEdges(component, prev);
+
+    bool result = false;
 
-    for(const auto & node : nodes)
+    for( const auto & node : nodes )
     {
-      // if it node has already been visited then continue
-      if( std::find(visited.begin(),visited.end(),node) != visited.end() )
+      if( node == outletComp && visitedHandles.find(node.handle()) == visitedHandles.end() )
       {
-        continue; 
-      }
-      if( node == sink )
-      {
-        visited.push_back(node);
-        // Avoid pushing duplicate nodes into paths
-        if( paths.empty() )
-        {
-          paths.insert(paths.end(), visited.begin(), visited.end());
-        }
-        else
-        {
-          for( const auto & visitedit : visited )
-          {
-            if( std::find(paths.begin(),paths.end(),visitedit) == paths.end() )
-            {
-              paths.push_back(visitedit);
-            }
-          }
-        }
-        visited.pop_back();
+        addPath(node);
+        result = true;
       }
     }
 
-    for(const auto & node : nodes)
+    for( const auto & node : nodes )
     {
+      Handle nodeHandle = node.handle();
       // if it node has already been visited or node is sink then continue
-      if( std::find(visited.begin(),visited.end(),node) != visited.end() ||
-          node == sink )
+      if( node == outletComp || visitedHandles.find(nodeHandle) != visitedHandles.end() )
       {
         continue;
       }
+      path.reachable.insert(nodeHandle);
+
+      std::pair<Handle,Handle> state(nodeHandle, component.handle());
+      auto it = explored.find(state);
+      if( it != explored.end() ) {
+        // everything downstream of this state is already in path
+        if( it->second ) {
+          addPath(node);
+          result = true;
+        }
+        continue;
+      }
+
       visited.push_back(node);
-      findModelObjects(sink, visited, paths, isDemandComponents);
+      visitedHandles.insert(nodeHandle);
+      bool found = traverseLoop(outletComp, visited, visitedHandles, explored, path, pathHandles);
+      visitedHandles.erase(nodeHandle);
       visited.pop_back();
+
+      explored[state] = found;
+      result = result || found;
     }
+
+    return result;
   }
 
-  std::vector<ModelObject> Loop_Impl::demandComponents( HVACComponent inletComp,
-                                                        HVACComponent outletComp,
-                                                        openstudio::IddObjectType type ) const
+  const Loop_Impl::LoopPath& Loop_Impl::loopPath(const HVACComponent & inletComp, const HVACComponent & outletComp) const
   {
-    std::vector<HVACComponent> visited;
-    visited.push_back(inletComp);
-    std::vector<HVACComponent> allPaths;
+    checkLoopTopology();
 
-    if( inletComp == outletComp ) {
-      allPaths.push_back(inletComp);
-    }
-    else {
-      findModelObjects(outletComp, visited, allPaths, true);
+    std::pair<Handle,Handle> key(inletComp.handle(), outletComp.handle());
+    auto it = m_loopPaths.find(key);
+    if( it != m_loopPaths.end() ) {
+      return it->second;
     }
-    std::vector<ModelObject> _demandComponents = std::vector<ModelObject>(allPaths.begin(), allPaths.end());
 
-    // Filter modelObjects for type
-    if( type == IddObjectType::Catchall ) {
-      return _demandComponents;
+    LoopPath & path = m_loopPaths[key];
+
+    std::vector<HVACComponent> visited { inletComp };
+    std::set<Handle> visitedHandles { inletComp.handle() };
+    std::map<std::pair<Handle,Handle>,bool> explored;
+    std::set<Handle> pathHandles;
+    traverseLoop(outletComp, visited, visitedHandles, explored, path, pathHandles);
+
+    if( inletComp == outletComp ) {
+      path.components.clear();
+      path.components.push_back(inletComp.handle());
     }
-    std::vector<ModelObject> reducedModelObjects;
-    
-    for(const auto & demandComponent : _demandComponents)
-    {
-      if( type == demandComponent.iddObject().type() )
-      {
-        reducedModelObjects.push_back(demandComponent);
+
+    return path;
+  }
+
+  std::vector<ModelObject> Loop_Impl::loopComponents(const HVACComponent & inletComp,
+                                                     const HVACComponent & outletComp,
+                                                     const openstudio::IddObjectType & type) const
+  {
+    const LoopPath & path = loopPath(inletComp, outletComp);
+
+    std::vector<ModelObject> result;
+    result.reserve(path.components.size());
+
+    Model t_model = model();
+    for( const auto & handle : path.components ) {
+      if( boost::optional<ModelObject> modelObject = t_model.getModelObject<ModelObject>(handle) ) {
+        // Filter modelObjects for type
+        if( type == IddObjectType::Catchall || type == modelObject->iddObject().type() ) {
+          result.push_back(*modelObject);
+        }
       }
     }
 
-    return reducedModelObjects;
+    return result;
+  }
+
+  std::vector<ModelObject> Loop_Impl::demandComponents( HVACComponent inletComp,
+                                                        HVACComponent outletComp,
+                                                        openstudio::IddObjectType type ) const
+  {
+    return loopComponents(inletComp, outletComp, type);
   }
 
   template <typename T>
@@ -398,33 +435,7 @@ namespace detail {
                                                         HVACComponent outletComp,
                                                         openstudio::IddObjectType type) const
   {
-    std::vector<HVACComponent> visited;
-    visited.push_back(inletComp);
-    std::vector<HVACComponent> allPaths;
-
-    if( inletComp == outletComp ) {
-      allPaths.push_back(inletComp);
-    }
-    else {
-      findModelObjects(outletComp, visited, allPaths, false);
-    }
-    std::vector<ModelObject> _supplyComponents = std::vector<ModelObject>(allPaths.begin(), allPaths.end());
-
-    // Filter modelObjects for type
-    if( type == IddObjectType::Catchall ) {
-      return _supplyComponents;
-    }
-    std::vector<ModelObject> reducedModelObjects;
-    
-    for(const auto & supplyComponent : _supplyComponents)
-    {
-      if( type == supplyComponent.iddObject().type() )
-      {
-        reducedModelObjects.push_back(supplyComponent);
-      }
-    }
-
-    return reducedModelObjects;
+    return loopComponents(inletComp, outletComp, type);
   }
 
   std::vector<ModelObject> Loop_Impl::components(HVACComponent inletComp,
@@ -31,6 +31,9 @@
 
 #include "ParentObject_Impl.hpp"
 
+#include <map>
+#include <set>
+
 namespace openstudio {
 
 namespace model {
@@ -134,6 +137,42 @@ namespace detail {
     boost::optional<ModelObject> demandInletNodeAsModelObject();
     boost::optional<ModelObject> demandOutletNodeAsModelObject();
 
+    // Components found between an inlet and an outlet (sink) component.
+    struct LoopPath {
+      // components on any path from inlet to outlet, in depth first order
+      std::vector<Handle> components;
+      // every component reachable from inlet without passing through outlet
+      std::set<Handle> reachable;
+    };
+
+    // Returns the cached path between inletComp and outletComp, traversing the loop if needed.
+    const LoopPath& loopPath(const HVACComponent& inletComp, const HVACComponent& outletComp) const;
+
+    // Returns the cached downstream edges of component when entered from previous.
+    const std::vector<HVACComponent>& loopEdges(const HVACComponent& component,
+                                                const boost::optional<HVACComponent>& previous) const;
+
+    // Depth first traversal behind loopPath. Returns true if outlet is reachable from the back of visited.
+    bool traverseLoop(const HVACComponent& outletComp,
+                      std::vector<HVACComponent>& visited,
+                      std::set<Handle>& visitedHandles,
+                      std::map<std::pair<Handle,Handle>,bool>& explored,
+                      LoopPath& path,
+                      std::set<Handle>& pathHandles) const;
+
+    // Clears the cached topology if the model changed since it was built.
+    void checkLoopTopology() const;
+
+    std::vector<ModelObject> loopComponents(const HVACComponent& inletComp,
+                                            const HVACComponent& outletComp,
+                                            const openstudio::IddObjectType& type) const;
+
+    // Topology cache, discarded whenever the model changes. Edges are keyed by (component, previous)
+    // since edges depend on the side a component is entered from, paths by (inlet, outlet).
+    mutable unsigned long long m_topologyChangeCount;
+    mutable std::map<std::pair<Handle,Handle>, std::vector<HVACComponent> > m_loopEdges;
+    mutable std::map<std::pair<Handle,Handle>, LoopPath> m_loopPaths;
+
   };
 
 } // detail
@@ -36,6 +36,7 @@
 #include "ModelObject_Impl.hpp"
 #include "ResourceObject.hpp"
 #include "ResourceObject_Impl.hpp"
+#include "ParentObject_Impl.hpp"
 
 // central list of all concrete ModelObject header files (_Impl and non-_Impl)
 // needed here for ::createObject
@@ -63,6 +64,8 @@
 
 #include <boost/regex.hpp>
 
+#include <unordered_set>
+
 using openstudio::IddObjectType;
 using openstudio::detail::WorkspaceObject_Impl;
 
@@ -1524,6 +1527,8 @@ if (_className::iddObjectType() == typeToCreate) { \
         return candidate;
       }
     }
+    // one change notification for the whole component
+    WorkspaceBatchEdit batch(model());
     WorkspaceObjectVector resultingObjects = model().addObjects(component.objects());
     if (resultingObjects.empty()) { return boost::none; }
     OS_ASSERT(resultingObjects.size() == component.numObjects());
@@ -1539,33 +1544,96 @@ if (_className::iddObjectType() == typeToCreate) { \
     return boost::none;
   }
 
-  std::vector<openstudio::IdfObject> Model_Impl::purgeUnusedResourceObjects() {
-    ResourceObjectVector resources = model().getModelObjects<ResourceObject>();
-    IdfObjectVector removedObjects;
-    for (ResourceObject& resource : resources) {
-      // test for initialized first in case earlier .remove() got this one already
-      if ((resource.initialized()) && (resource.nonResourceObjectUseCount(true) == 0)) {
-        IdfObjectVector thisCallRemoved = resource.remove();
-        removedObjects.insert(removedObjects.end(),thisCallRemoved.begin(),thisCallRemoved.end());
+  namespace {
+
+    // ResourceObject::directUseCount(true), not counting uses by objects in removed
+    unsigned directUseCount(const ResourceObject& resource, const std::unordered_set<Handle>& removed) {
+      std::vector<Handle> children = getHandles<ModelObject>(resource.children());
+      unsigned result = 0;
+      for (const WorkspaceObject& source : resource.sources()) {
+        if ((removed.find(source.handle()) == removed.end()) &&
+            (std::find(children.begin(), children.end(), source.handle()) == children.end()))
+        {
+          ++result;
+        }
+      }
+      return result;
+    }
+
+    // ResourceObject::nonResourceObjectUseCount(true), not counting uses by objects in removed
+    unsigned nonResourceObjectUseCount(const ResourceObject& resource, const std::unordered_set<Handle>& removed) {
+      std::vector<Handle> children = getHandles<ModelObject>(resource.children());
+      unsigned result = 0;
+      for (const WorkspaceObject& source : resource.sources()) {
+        if (removed.find(source.handle()) != removed.end()) {
+          continue;
+        }
+        if (OptionalResourceObject oro = source.optionalCast<ResourceObject>()) {
+          result += nonResourceObjectUseCount(*oro, removed);
+        }
+        else if (std::find(children.begin(), children.end(), source.handle()) == children.end()) {
+          ++result;
+        }
+      }
+      return result;
+    }
+
+    // Removes the resources that are unused once the resources before them are gone, with the objects
+    // ResourceObject::remove would take along, in a single Workspace::removeObjects call. This gives the
+    // same result as calling remove on each unused resource in turn.
+    std::vector<openstudio::IdfObject> removeUnusedResources(Model& model,
+                                                             const std::vector<ResourceObject>& resources,
+                                                             bool nonResourceUsesOnly)
+    {
+      IdfObjectVector removedObjects;
+      std::vector<Handle> removedHandles;
+      std::unordered_set<Handle> removed;
+      for (const ResourceObject& resource : resources) {
+        // skip resources taken along with an earlier one
+        if (removed.find(resource.handle()) != removed.end()) {
+          continue;
+        }
+        unsigned useCount = nonResourceUsesOnly ? nonResourceObjectUseCount(resource, removed) : directUseCount(resource, removed);
+        if (useCount != 0) {
+          continue;
+        }
+        // ScheduleDay::remove refuses to remove a day schedule that its rule or rule set still needs
+        if (resource.iddObjectType() == ScheduleDay::iddObjectType()) {
+          OptionalParentObject parent = resource.parent();
+          if (parent && (removed.find(parent->handle()) == removed.end())) {
+            continue;
+          }
+        }
+        for (const ModelObject& object : resource.getImpl<ParentObject_Impl>()->removalSubTree()) {
+          if (removed.insert(object.handle()).second) {
+            removedObjects.push_back(object.idfObject());
+            removedHandles.push_back(object.handle());
+          }
+        }
+      }
+
+      if (!model.removeObjects(removedHandles)) {
+        removedObjects.clear();
       }
+      return removedObjects;
     }
-    return removedObjects;
+
+  }
+
+  std::vector<openstudio::IdfObject> Model_Impl::purgeUnusedResourceObjects() {
+    Model m = model();
+    return removeUnusedResources(m, m.getModelObjects<ResourceObject>(), true);
   }
 
   std::vector<openstudio::IdfObject> Model_Impl::purgeUnusedResourceObjects(IddObjectType iddObjectType) {
-    IdfObjectVector removedObjects;
+    std::vector<ResourceObject> resources;
     for (const WorkspaceObject& workspaceObject : getObjectsByType(iddObjectType)) {
-      boost::optional<ResourceObject> resource = workspaceObject.optionalCast<ResourceObject>();
-      if (resource){
-        // test for initialized first in case earlier .remove() got this one already
-        if ((resource->initialized()) && (resource->directUseCount(true) == 0)) {
-          IdfObjectVector thisCallRemoved = resource->remove();
-          removedObjects.insert(removedObjects.end(),thisCallRemoved.begin(),thisCallRemoved.end());
-        }
+      if (boost::optional<ResourceObject> resource = workspaceObject.optionalCast<ResourceObject>()) {
+        resources.push_back(*resource);
       }
-
     }
-    return removedObjects;
+    Model m = model();
+    return removeUnusedResources(m, resources, false);
   }
 
   void Model_Impl::connect(const Model& m,
@@ -1811,8 +1879,14 @@ boost::optional<Model> Model::load(const path& p) {
   OptionalModel result;
   OptionalIdfFile oIdfFile = IdfFile::load(p,IddFileType::OpenStudio);
   if (oIdfFile) {
+    // apply changes journaled since the last save
+    path journalPath = Workspace::journalPath(p);
+    if (exists(journalPath)) {
+      openstudio::detail::Workspace_Impl::replayJournal(*oIdfFile,journalPath);
+    }
     try {
       result = Model(*oIdfFile);
+      result->getImpl<detail::Model_Impl>()->markAsSaved();
     }
     catch (...) {}
   }
@@ -839,6 +839,9 @@ namespace detail {
     // Can have resources and costs.
     WorkspaceObjectVector toAdd(1u,getObject<WorkspaceObject>());
 
+    // one change notification for the object and its resources
+    WorkspaceBatchEdit batch(model);
+
     // add costs
     std::vector<LifeCycleCost> lifeCycleCosts = this->lifeCycleCosts();
     toAdd.insert(toAdd.end(), lifeCycleCosts.begin(), lifeCycleCosts.end());
@@ -873,10 +876,18 @@ namespace detail {
   /// return std::vector<IdfObject> containing any removed object(s)
   std::vector<IdfObject> ModelObject_Impl::remove()
   {
+    // the object and its costs are removed together
     std::vector<IdfObject> result;
-    std::vector<IdfObject> removedCosts = this->removeLifeCycleCosts();
-    result = WorkspaceObject_Impl::remove();
-    result.insert(result.end(), removedCosts.begin(), removedCosts.end());
+    std::vector<Handle> handles;
+    result.push_back(this->idfObject());
+    handles.push_back(this->handle());
+    for (const LifeCycleCost& lifeCycleCost : this->lifeCycleCosts()){
+      result.push_back(lifeCycleCost.idfObject());
+      handles.push_back(lifeCycleCost.handle());
+    }
+
+    bool ok = this->model().removeObjects(handles);
+    OS_ASSERT(ok);
 
     return result;
   }
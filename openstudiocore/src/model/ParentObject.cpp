@@ -74,6 +74,19 @@ namespace detail {
   {
     std::vector<IdfObject> result;
 
+    std::vector<ModelObject> noCurvesSubTree = removalSubTree();
+    for (const ModelObject& object : noCurvesSubTree) {
+      result.push_back(object.idfObject());
+    }
+      
+    bool ok = model().removeObjects(getHandles<ModelObject>(noCurvesSubTree));
+    if (!ok) { result.clear(); }
+
+    return result;
+  }
+
+  std::vector<ModelObject> ParentObject_Impl::removalSubTree() const
+  {
     // DLM: the following code does not work because subTree includes this object
     // and we don't want to call remove on the same object recursively
     //
@@ -93,16 +106,7 @@ namespace detail {
       return modelObject.optionalCast<Curve>();
     };
     auto end = std::remove_if(subTree.begin(), subTree.end(), isCurve); 
-    std::vector<ModelObject> noCurvesSubTree(subTree.begin(),end);
-
-    for (const ModelObject& object : noCurvesSubTree) {
-      result.push_back(object.idfObject());
-    }
-      
-    bool ok = model().removeObjects(getHandles<ModelObject>(noCurvesSubTree));
-    if (!ok) { result.clear(); }
-
-    return result;
+    return std::vector<ModelObject>(subTree.begin(),end);
   }
 
   /// get a vector of allowable children types
@@ -65,6 +65,10 @@ namespace detail {
     /// return a new workspace containing any removed object(s)
     virtual std::vector<openstudio::IdfObject> remove() override;
 
+    /// return the objects removed by ParentObject_Impl::remove, this object and its recursive
+    /// children (other than curves) with their life cycle costs
+    std::vector<ModelObject> removalSubTree() const;
+
     /// get a vector of allowable children types
     virtual std::vector<IddObjectType> allowableChildTypes() const;
 
@@ -29,6 +29,7 @@
 #include "PlanarSurface.hpp"
 #include "PlanarSurface_Impl.hpp"
 #include "Model.hpp"
+#include "Model_Impl.hpp"
 
 #include "PlanarSurfaceGroup.hpp"
 #include "Space.hpp"
@@ -78,7 +79,7 @@ namespace model {
     // constructor
     PlanarSurface_Impl::PlanarSurface_Impl(IddObjectType type,
                                            Model_Impl* model)
-      : ParentObject_Impl(type, model)
+      : ParentObject_Impl(type, model), m_childCacheChangeCount(0)
     {
       // connect signals
       this->PlanarSurface_Impl::onChange.connect<PlanarSurface_Impl, &PlanarSurface_Impl::clearCachedVariables>(this);
@@ -88,7 +89,7 @@ namespace model {
     PlanarSurface_Impl::PlanarSurface_Impl(const IdfObject& idfObject,
                                            Model_Impl* model,
                                            bool keepHandle)
-      : ParentObject_Impl(idfObject, model, keepHandle)
+      : ParentObject_Impl(idfObject, model, keepHandle), m_childCacheChangeCount(0)
     {
       // connect signals
       this->PlanarSurface_Impl::onChange.connect<PlanarSurface_Impl, &PlanarSurface_Impl::clearCachedVariables>(this);
@@ -97,7 +98,7 @@ namespace model {
     PlanarSurface_Impl::PlanarSurface_Impl(const openstudio::detail::WorkspaceObject_Impl& other,
                                            Model_Impl* model,
                                            bool keepHandle)
-      : ParentObject_Impl(other,model,keepHandle)
+      : ParentObject_Impl(other,model,keepHandle), m_childCacheChangeCount(0)
     {
       // connect signals
       this->PlanarSurface_Impl::onChange.connect<PlanarSurface_Impl, &PlanarSurface_Impl::clearCachedVariables>(this);
@@ -106,7 +107,7 @@ namespace model {
     PlanarSurface_Impl::PlanarSurface_Impl(const PlanarSurface_Impl& other,
                                            Model_Impl* model,
                                            bool keepHandle)
-      : ParentObject_Impl(other,model,keepHandle)
+      : ParentObject_Impl(other,model,keepHandle), m_childCacheChangeCount(0)
     {
       // connect signals
       this->PlanarSurface_Impl::onChange.connect<PlanarSurface_Impl, &PlanarSurface_Impl::clearCachedVariables>(this);
@@ -251,17 +252,25 @@ namespace model {
     // compute gross area (m^2)
     double PlanarSurface_Impl::grossArea() const
     {
-      double result = 0.0;
-      OptionalDouble area = getArea(vertices());
-      if (area){
-        result = *area;
+      if (!m_cachedGrossArea){
+        double result = 0.0;
+        OptionalDouble area = getArea(vertices());
+        if (area){
+          result = *area;
+        }
+        m_cachedGrossArea = result;
       }
-      return result;
+      return m_cachedGrossArea.get();
     }
 
     // compute net area (m^2)
     double PlanarSurface_Impl::netArea() const
     {
+      checkChildCachedVariables();
+      if (m_cachedNetArea){
+        return m_cachedNetArea.get();
+      }
+
       double result = this->grossArea();
 
       // subtract net area of child planar surfaces
@@ -279,6 +288,7 @@ namespace model {
         }
       }
 
+      m_cachedNetArea = result;
       return result;
     }
 
@@ -301,25 +311,33 @@ namespace model {
     }
 
     double PlanarSurface_Impl::tilt() const {
-      OptionalVector3d on = outwardNormal();
-      if (!on) {
-        LOG_AND_THROW("Cannot calculate PlanarSurface tilt because there is no outwardNormal.");
+      if (!m_cachedTilt){
+        OptionalVector3d on = outwardNormal();
+        if (!on) {
+          LOG_AND_THROW("Cannot calculate PlanarSurface tilt because there is no outwardNormal.");
+        }
+        Vector3d n = *on;
+        Vector3d up(0.0,0.0,1.0);
+        m_cachedTilt = getAngle(n,up);
       }
-      Vector3d n = *on;
-      Vector3d up(0.0,0.0,1.0);
-      return getAngle(n,up);
+      return m_cachedTilt.get();
     }
 
     double PlanarSurface_Impl::azimuth() const {
-      OptionalVector3d on = outwardNormal();
-      if (!on) {
-        LOG_AND_THROW("Cannot calculate PlanarSurface azimuth because there is no outwardNormal.");
+      if (!m_cachedAzimuth){
+        OptionalVector3d on = outwardNormal();
+        if (!on) {
+          LOG_AND_THROW("Cannot calculate PlanarSurface azimuth because there is no outwardNormal.");
+        }
+        Vector3d n = *on;
+        Vector3d north(0.0,1.0,0.0);
+        double rawAngle = getAngle(n,north);
+        if (on->x() < 0.0) {
+          rawAngle = -rawAngle + 2.0*boost::math::constants::pi<double>();
+        }
+        m_cachedAzimuth = rawAngle;
       }
-      Vector3d n = *on;
-      Vector3d north(0.0,1.0,0.0);
-      double rawAngle = getAngle(n,north);
-      if (on->x() < 0.0) { return -rawAngle + 2.0*boost::math::constants::pi<double>(); }
-      return rawAngle;
+      return m_cachedAzimuth.get();
     }
 
     boost::optional<double> PlanarSurface_Impl::uFactor() const {
@@ -520,6 +538,7 @@ namespace model {
 
     std::vector<std::vector<Point3d> > PlanarSurface_Impl::triangulation() const
     {
+      checkChildCachedVariables();
       if (m_cachedTriangulation.empty()){
         Transformation faceTransformation = Transformation::alignFace(this->vertices());
         Transformation faceTransformationInverse = faceTransformation.inverse();
@@ -551,9 +570,21 @@ namespace model {
 
     Point3d PlanarSurface_Impl::centroid() const
     {
-      boost::optional<Point3d> result = getCentroid(this->vertices());
-      OS_ASSERT(result);
-      return *result;
+      if (!m_cachedCentroid){
+        m_cachedCentroid = getCentroid(this->vertices());
+        OS_ASSERT(m_cachedCentroid);
+      }
+      return m_cachedCentroid.get();
+    }
+
+    BoundingBox PlanarSurface_Impl::boundingBox() const
+    {
+      if (!m_cachedBoundingBox){
+        BoundingBox result;
+        result.addPoints(this->vertices());
+        m_cachedBoundingBox = result;
+      }
+      return m_cachedBoundingBox.get();
     }
 
     std::vector<ModelObject> PlanarSurface_Impl::solarCollectors() const
@@ -612,9 +643,26 @@ namespace model {
       m_cachedVertices.reset();
       m_cachedPlane.reset();
       m_cachedOutwardNormal.reset();
+      m_cachedGrossArea.reset();
+      m_cachedCentroid.reset();
+      m_cachedBoundingBox.reset();
+      m_cachedTilt.reset();
+      m_cachedAzimuth.reset();
+      m_cachedNetArea.reset();
       m_cachedTriangulation.clear();
     }
 
+    void PlanarSurface_Impl::checkChildCachedVariables() const
+    {
+      // sub surfaces do not signal their parent when they change, so key these on the model's change count
+      unsigned long long changeCount = model().getImpl<Model_Impl>()->changeCount();
+      if (changeCount != m_childCacheChangeCount){
+        m_cachedNetArea.reset();
+        m_cachedTriangulation.clear();
+        m_childCacheChangeCount = changeCount;
+      }
+    }
+
     bool PlanarSurface_Impl::setConstructionAsModelObject(boost::optional<ModelObject> modelObject)
     {
       bool result = false;
@@ -810,6 +858,11 @@ Point3d PlanarSurface::centroid() const
   return getImpl<detail::PlanarSurface_Impl>()->centroid();
 }
 
+BoundingBox PlanarSurface::boundingBox() const
+{
+  return getImpl<detail::PlanarSurface_Impl>()->boundingBox();
+}
+
 std::vector<ModelObject> PlanarSurface::solarCollectors() const
 {
   return getImpl<detail::PlanarSurface_Impl>()->solarCollectors();
@@ -34,6 +34,7 @@
 
 namespace openstudio {
 
+class BoundingBox;
 class Plane;
 class Point3d;
 class Vector3d;
@@ -226,6 +227,9 @@ class MODEL_API PlanarSurface : public ParentObject {
   /// Return the centroid of this planar surface's vertices
   Point3d centroid() const;
 
+  /// Return the bounding box of this planar surface's vertices in local coordinates
+  BoundingBox boundingBox() const;
+
   /// Returns any solar hot water collectors associated with this surface.
   std::vector<ModelObject> solarCollectors() const;
 
@@ -31,6 +31,7 @@
 
 #include "ParentObject_Impl.hpp"
 
+#include "../utilities/geometry/BoundingBox.hpp"
 #include "../utilities/geometry/Plane.hpp"
 #include "../utilities/geometry/Point3d.hpp"
 #include "../utilities/geometry/Vector3d.hpp"
@@ -172,6 +173,8 @@ namespace detail {
 
     Point3d centroid() const;
 
+    BoundingBox boundingBox() const;
+
     std::vector<ModelObject> solarCollectors() const;
 
     std::vector<GeneratorPhotovoltaic> generatorPhotovoltaics() const;
@@ -196,10 +199,23 @@ namespace detail {
 
     bool setConstructionAsModelObject(boost::optional<ModelObject> modelObject);
 
+    // clears the cached values that depend on child surfaces if the model has changed since they were computed
+    void checkChildCachedVariables() const;
+
+    // derived from this surface's vertices, cleared by clearCachedVariables
     mutable boost::optional<std::vector<Point3d> > m_cachedVertices;
     mutable boost::optional<Plane> m_cachedPlane;
     mutable boost::optional<Vector3d> m_cachedOutwardNormal;
+    mutable boost::optional<double> m_cachedGrossArea;
+    mutable boost::optional<Point3d> m_cachedCentroid;
+    mutable boost::optional<BoundingBox> m_cachedBoundingBox;
+    mutable boost::optional<double> m_cachedTilt;
+    mutable boost::optional<double> m_cachedAzimuth;
+
+    // also derived from child surfaces, cleared by checkChildCachedVariables
+    mutable boost::optional<double> m_cachedNetArea;
     mutable std::vector<std::vector<Point3d> > m_cachedTriangulation;
+    mutable unsigned long long m_childCacheChangeCount;
 
   };
 
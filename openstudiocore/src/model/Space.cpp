@@ -139,7 +139,7 @@ namespace model {
 namespace detail {
 
   Space_Impl::Space_Impl(const IdfObject& idfObject, Model_Impl* model, bool keepHandle)
-    : PlanarSurfaceGroup_Impl(idfObject,model,keepHandle)
+    : PlanarSurfaceGroup_Impl(idfObject,model,keepHandle), m_geometryChangeCount(0)
   {
     OS_ASSERT(idfObject.iddObject().type() == Space::iddObjectType());
   }
@@ -147,7 +147,7 @@ namespace detail {
   Space_Impl::Space_Impl(const openstudio::detail::WorkspaceObject_Impl& other,
                          Model_Impl* model,
                          bool keepHandle)
-    : PlanarSurfaceGroup_Impl(other,model,keepHandle)
+    : PlanarSurfaceGroup_Impl(other,model,keepHandle), m_geometryChangeCount(0)
   {
     OS_ASSERT(other.iddObject().type() == Space::iddObjectType());
   }
@@ -155,7 +155,7 @@ namespace detail {
   Space_Impl::Space_Impl(const Space_Impl& other,
                          Model_Impl* model,
                          bool keepHandle)
-    : PlanarSurfaceGroup_Impl(other,model,keepHandle)
+    : PlanarSurfaceGroup_Impl(other,model,keepHandle), m_geometryChangeCount(0)
   {}
 
  boost::optional<ParentObject> Space_Impl::parent() const
@@ -349,10 +349,15 @@ namespace detail {
 
   BoundingBox Space_Impl::boundingBox() const
   {
+    checkCachedGeometry();
+    if (m_cachedBoundingBox){
+      return m_cachedBoundingBox.get();
+    }
+
     BoundingBox result;
 
-    for (Surface surface : this->surfaces()){
-      result.addPoints(surface.vertices());
+    for (const Surface& surface : this->surfaces()){
+      result.add(surface.boundingBox());
     }
 
     for (ShadingSurfaceGroup shadingSurfaceGroup : this->shadingSurfaceGroups()){
@@ -378,8 +383,8 @@ namespace detail {
     for (GlareSensor glareSensor : this->glareSensors()){
       result.addPoint(glareSensor.position());
     }
-  
-    
+
+    m_cachedBoundingBox = result;
     return result;
   }
 
@@ -896,73 +901,23 @@ namespace detail {
 
   double Space_Impl::floorArea() const
   {
-    double result = 0;
-    for (const Surface& surface : this->surfaces()) {
-      if (istringEqual(surface.surfaceType(), "Floor"))
-      {
-        if (surface.isAirWall()){
-          continue;
-        }
-        result += surface.grossArea();
-      }
-    }
-    return result;
+    cacheSurfaceAreas();
+    return m_cachedFloorArea.get();
   }
 
   double Space_Impl::exteriorArea() const {
-    double result = 0;
-    for (const Surface& surface : this->surfaces()) {
-      if (istringEqual(surface.outsideBoundaryCondition(), "Outdoors"))
-      {
-        result += surface.grossArea();
-      }
-    }
-    return result;
+    cacheSurfaceAreas();
+    return m_cachedExteriorArea.get();
   }
 
   double Space_Impl::exteriorWallArea() const {
-    double result = 0;
-    for (const Surface& surface : this->surfaces()) {
-      if (istringEqual(surface.outsideBoundaryCondition(), "Outdoors"))
-      {
-        if (istringEqual(surface.surfaceType(), "Wall"))
-        {
-          result += surface.grossArea();
-        }
-      }
-    }
-    return result;
+    cacheSurfaceAreas();
+    return m_cachedExteriorWallArea.get();
   }
 
   double Space_Impl::volume() const {
-    double result = 0;
-
-    // TODO: need a better method
-    double roofHeight = 0;
-    int numRoof = 0;
-    double floorHeight = 0;
-    int numFloor = 0;
-    for (const Surface& surface : this->surfaces()) {
-      if (istringEqual(surface.surfaceType(), "Floor")){
-        for (const Point3d& point : surface.vertices()) {
-          floorHeight += point.z();
-          ++numFloor;
-        }
-      }else if (istringEqual(surface.surfaceType(), "RoofCeiling")){
-        for (const Point3d& point : surface.vertices()) {
-          roofHeight += point.z();
-          ++numRoof;
-        }
-      }
-    }
-
-    if ((numRoof > 0) * (numFloor > 0)){
-      roofHeight /= numRoof;
-      floorHeight /= numFloor;
-      result = (roofHeight - floorHeight) * this->floorArea();
-    }
-
-    return result;
+    cacheSurfaceAreas();
+    return m_cachedVolume.get();
   }
 
   double Space_Impl::numberOfPeople() const {
@@ -2894,6 +2849,77 @@ namespace detail {
     return boost::make_tuple(point3d.x(), point3d.y());
   }
 
+  void Space_Impl::checkCachedGeometry() const
+  {
+    // surfaces do not signal their space when they change, so key the cache on the model's change count
+    unsigned long long changeCount = model().getImpl<Model_Impl>()->changeCount();
+    if (changeCount != m_geometryChangeCount){
+      m_cachedFloorArea.reset();
+      m_cachedExteriorArea.reset();
+      m_cachedExteriorWallArea.reset();
+      m_cachedVolume.reset();
+      m_cachedBoundingBox.reset();
+      m_geometryChangeCount = changeCount;
+    }
+  }
+
+  void Space_Impl::cacheSurfaceAreas() const
+  {
+    checkCachedGeometry();
+    if (m_cachedFloorArea){
+      return;
+    }
+
+    double floorArea = 0;
+    double exteriorArea = 0;
+    double exteriorWallArea = 0;
+
+    // TODO: need a better method
+    double roofHeight = 0;
+    int numRoof = 0;
+    double floorHeight = 0;
+    int numFloor = 0;
+
+    for (const Surface& surface : this->surfaces()) {
+      std::string surfaceType = surface.surfaceType();
+      bool isFloor = istringEqual(surfaceType, "Floor");
+
+      if (isFloor){
+        if (!surface.isAirWall()){
+          floorArea += surface.grossArea();
+        }
+        for (const Point3d& point : surface.vertices()) {
+          floorHeight += point.z();
+          ++numFloor;
+        }
+      }else if (istringEqual(surfaceType, "RoofCeiling")){
+        for (const Point3d& point : surface.vertices()) {
+          roofHeight += point.z();
+          ++numRoof;
+        }
+      }
+
+      if (istringEqual(surface.outsideBoundaryCondition(), "Outdoors")){
+        exteriorArea += surface.grossArea();
+        if (istringEqual(surfaceType, "Wall")){
+          exteriorWallArea += surface.grossArea();
+        }
+      }
+    }
+
+    double volume = 0;
+    if ((numRoof > 0) * (numFloor > 0)){
+      roofHeight /= numRoof;
+      floorHeight /= numFloor;
+      volume = (roofHeight - floorHeight) * floorArea;
+    }
+
+    m_cachedFloorArea = floorArea;
+    m_cachedExteriorArea = exteriorArea;
+    m_cachedExteriorWallArea = exteriorWallArea;
+    m_cachedVolume = volume;
+  }
+
 } // detail
 
 Space::Space(const Model& model)
@@ -33,6 +33,7 @@
 #include "PlanarSurfaceGroup_Impl.hpp"
 
 #include "../utilities/units/Quantity.hpp"
+#include "../utilities/geometry/BoundingBox.hpp"
 
 #include <boost/geometry/geometries/point_xy.hpp>
 #include <boost/geometry/geometries/adapted/boost_tuple.hpp>
@@ -595,6 +596,19 @@ namespace detail {
     // helper function to get a boost polygon point from a Point3d
     boost::tuple<double, double> point3dToTuple(const Point3d& point3d, std::vector<Point3d>& allPoints, double tol) const;
 
+    // clears the cached geometry if the model has changed since it was computed
+    void checkCachedGeometry() const;
+
+    // computes the cached areas and volume in one pass over the surfaces
+    void cacheSurfaceAreas() const;
+
+    mutable boost::optional<double> m_cachedFloorArea;
+    mutable boost::optional<double> m_cachedExteriorArea;
+    mutable boost::optional<double> m_cachedExteriorWallArea;
+    mutable boost::optional<double> m_cachedVolume;
+    mutable boost::optional<BoundingBox> m_cachedBoundingBox;
+    mutable unsigned long long m_geometryChangeCount;
+
   };
 
 } // detail
@@ -1091,6 +1091,17 @@ namespace detail {
     // sort by space name
     std::sort(spaces.begin(), spaces.end(), WorkspaceObjectNameLess());
 
+    Model model = this->model();
+
+    // everything below is announced by a single onChange
+    WorkspaceBatchEdit batch(model);
+
+    // spaces being combined, used to find surfaces that will end up inside the new space
+    std::set<Handle> spaceHandles;
+    for (const Space& space : spaces){
+      spaceHandles.insert(space.handle());
+    }
+
     // if these variables are set, then they are not defaulted and are common to all spaces
     boost::optional<BuildingStory> buildingStory = spaces[0].buildingStory();
     boost::optional<SpaceType> spaceType = spaces[0].spaceType();
@@ -1192,16 +1203,10 @@ namespace detail {
           auto adjacentSurface = surface.adjacentSurface();
           if (adjacentSurface){
             auto adjacentSpace = adjacentSurface->space();
-            if (adjacentSpace){
-              auto adjacentThermalZone = adjacentSpace->thermalZone();
-              if (adjacentThermalZone){
-                if (adjacentThermalZone->handle() == this->handle())
-                {
-                  // this surface is completely inside the zone, need to set floor area since this surface will be removed 
-                  needToSetFloorArea = true;
-                  break;
-                }
-              }
+            if (adjacentSpace && (spaceHandles.find(adjacentSpace->handle()) != spaceHandles.end())){
+              // this surface is completely inside the zone, need to set floor area since this surface will be removed 
+              needToSetFloorArea = true;
+              break;
             }
           }
         }
@@ -1295,7 +1300,6 @@ namespace detail {
     }
 
     // make the new space
-    Model model = this->model();
     Space newSpace(model);
     ThermalZone thermalZone = this->getObject<ThermalZone>();
     newSpace.setThermalZone(thermalZone);
@@ -1324,12 +1328,19 @@ namespace detail {
 
     // new space transformation
     Transformation newTransformation = newSpace.transformation();
+    double newDirectionofRelativeNorth = newSpace.directionofRelativeNorth();
+
+    // surfaces moved to the new space, used to find the ones that are now inside it
+    std::set<Handle> newSurfaceHandles;
 
     // set common variables for the new space
     for (Space space : spaces){
 
-      // shift the geometry
-      space.changeTransformation(newTransformation);
+      // shift the geometry, nothing moves if the space is already placed like the new space
+      if ((space.xOrigin() != xOrigin) || (space.yOrigin() != yOrigin) || (space.zOrigin() != zOrigin) ||
+          (space.directionofRelativeNorth() != newDirectionofRelativeNorth)){
+        space.changeTransformation(newTransformation);
+      }
 
       // apply the space type
       if (!spaceType){
@@ -1374,6 +1385,9 @@ namespace detail {
       // now move everything over to the new space
       for (ModelObject child : children){
         child.setParent(newSpace);
+        if (child.iddObjectType() == Surface::iddObjectType()){
+          newSurfaceHandles.insert(child.handle());
+        }
       }
 
       // remove the old space
@@ -1397,8 +1411,7 @@ namespace detail {
 
       boost::optional<Surface> adjacentSurface = surface.adjacentSurface();
       if (adjacentSurface){
-        boost::optional<Space> adjacentSpace = adjacentSurface->space();
-        if (adjacentSpace && (newSpace.handle() == adjacentSpace->handle())){
+        if (newSurfaceHandles.find(adjacentSurface->handle()) != newSurfaceHandles.end()){
 
           // handling both the surface and the adjacentSurface
           mergedSurfaces.insert(surface);
@@ -80,11 +80,16 @@
 #include "../../utilities/idf/Workspace.hpp"
 #include "../../utilities/idf/WorkspaceObject.hpp"
 #include "../../utilities/idf/ValidityReport.hpp"
+#include "../../utilities/geometry/Point3d.hpp"
+#include "../../utilities/core/FilesystemHelpers.hpp"
 
 #include <utilities/idd/IddEnums.hxx>
 
 #include <boost/algorithm/string/case_conv.hpp>
 
+#include <chrono>
+#include <iostream>
+
 using namespace openstudio::model;
 using namespace openstudio;
 /*
@@ -747,3 +752,190 @@ TEST_F(ModelFixture,Model_BadSwaps) {
   EXPECT_ANY_THROW(workspace.swap(model));
   EXPECT_ANY_THROW(model.swap(workspace));
 }
+
+TEST_F(ModelFixture, Model_BatchEdit) {
+  Model model;
+
+  unsigned numAdded = 0;
+  {
+    WorkspaceBatchEdit batch = model.batchEdit();
+    EXPECT_TRUE(model.isBatchEditing());
+
+    Space space(model);
+    std::vector<Point3d> vertices;
+    vertices.push_back(Point3d(0,0,1));
+    vertices.push_back(Point3d(0,0,0));
+    vertices.push_back(Point3d(1,0,0));
+    vertices.push_back(Point3d(1,0,1));
+    for (unsigned i = 0; i < 10; ++i) {
+      Surface surface(vertices, model);
+      EXPECT_TRUE(surface.setSpace(space));
+      ++numAdded;
+    }
+
+    // relationships can be used before the batch edit closes
+    EXPECT_EQ(10u, space.surfaces().size());
+    EXPECT_EQ(10u, model.getModelObjects<Surface>().size());
+  }
+
+  EXPECT_FALSE(model.isBatchEditing());
+  EXPECT_EQ(numAdded, model.getModelObjects<Surface>().size());
+}
+
+TEST_F(ModelFixture, DISABLED_Model_BatchEdit_Benchmark) {
+  const unsigned numSurfaces = 20000;
+  std::vector<Point3d> vertices;
+  vertices.push_back(Point3d(0,0,1));
+  vertices.push_back(Point3d(0,0,0));
+  vertices.push_back(Point3d(1,0,0));
+  vertices.push_back(Point3d(1,0,1));
+
+  for (int batched = 0; batched < 2; ++batched) {
+    Model model;
+    model.setFastNaming(true);
+    Space space(model);
+
+    auto start = std::chrono::steady_clock::now();
+    {
+      std::shared_ptr<WorkspaceBatchEdit> batch;
+      if (batched) {
+        batch = std::make_shared<WorkspaceBatchEdit>(model);
+      }
+      for (unsigned i = 0; i < numSurfaces; ++i) {
+        Surface surface(vertices, model);
+        surface.setSpace(space);
+      }
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    std::cout << (batched ? "batchEdit: " : "per object: ") << numSurfaces << " surfaces in "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+    EXPECT_EQ(numSurfaces, model.getModelObjects<Surface>().size());
+  }
+}
+
+TEST_F(ModelFixture, Model_IncrementalSave)
+{
+  Model model = exampleModel();
+  ScheduleCompact schedule(model);
+
+  openstudio::path path = toPath("./Model_IncrementalSave.osm");
+  openstudio::path fullPath = toPath("./Model_IncrementalSave_Full.osm");
+
+  EXPECT_FALSE(model.handlesAddedSinceSave().empty());
+  EXPECT_TRUE(model.save(path, true));
+  EXPECT_TRUE(model.handlesAddedSinceSave().empty());
+  EXPECT_TRUE(model.handlesModifiedSinceSave().empty());
+  EXPECT_TRUE(model.handlesRemovedSinceSave().empty());
+
+  std::vector<Space> spaces = model.getConcreteModelObjects<Space>();
+  ASSERT_FALSE(spaces.empty());
+  EXPECT_TRUE(spaces[0].setName("Renamed Space"));
+  Space newSpace(model);
+  Handle scheduleHandle = schedule.handle();
+  schedule.remove();
+
+  std::vector<Handle> added = model.handlesAddedSinceSave();
+  std::vector<Handle> modified = model.handlesModifiedSinceSave();
+  std::vector<Handle> removed = model.handlesRemovedSinceSave();
+  EXPECT_NE(added.end(), std::find(added.begin(), added.end(), newSpace.handle()));
+  EXPECT_NE(modified.end(), std::find(modified.begin(), modified.end(), spaces[0].handle()));
+  ASSERT_EQ(1u, removed.size());
+  EXPECT_EQ(scheduleHandle, removed[0]);
+
+  // only the changed objects are printed, the result matches a full save
+  EXPECT_TRUE(model.save(path, true));
+  EXPECT_TRUE(model.toIdfFile().save(fullPath, true));
+  EXPECT_EQ(openstudio::filesystem::read_as_string(fullPath), openstudio::filesystem::read_as_string(path));
+
+  EXPECT_TRUE(model.save(path, true));
+  EXPECT_EQ(openstudio::filesystem::read_as_string(fullPath), openstudio::filesystem::read_as_string(path));
+
+  // objects are printed again if the saved file was changed by others
+  {
+    openstudio::filesystem::ofstream outFile(path);
+    outFile << std::string(openstudio::filesystem::file_size(fullPath), ' ');
+  }
+  EXPECT_TRUE(model.save(path, true));
+  EXPECT_EQ(openstudio::filesystem::read_as_string(fullPath), openstudio::filesystem::read_as_string(path));
+}
+
+TEST_F(ModelFixture, Model_Journal)
+{
+  Model model = exampleModel();
+  ScheduleCompact schedule(model);
+
+  openstudio::path path = toPath("./Model_Journal.osm");
+  openstudio::path journalPath = Workspace::journalPath(path);
+  EXPECT_TRUE(model.save(path, true));
+  EXPECT_FALSE(openstudio::filesystem::exists(journalPath));
+
+  std::vector<Space> spaces = model.getConcreteModelObjects<Space>();
+  ASSERT_FALSE(spaces.empty());
+  EXPECT_TRUE(spaces[0].setName("Journaled Space"));
+  EXPECT_TRUE(model.writeJournal(path));
+  EXPECT_TRUE(openstudio::filesystem::exists(journalPath));
+
+  Space newSpace(model);
+  Handle scheduleHandle = schedule.handle();
+  schedule.remove();
+  EXPECT_TRUE(model.writeJournal(path));
+
+  // an incomplete batch, as left by a crash, is ignored
+  {
+    openstudio::filesystem::ofstream journal(journalPath, std::ios_base::out | std::ios_base::app);
+    journal << "!@ remove " << toString(spaces[0].handle()) << std::endl;
+  }
+
+  boost::optional<Model> model2 = Model::load(path);
+  ASSERT_TRUE(model2);
+  EXPECT_EQ(model.numObjects(), model2->numObjects());
+  boost::optional<WorkspaceObject> space = model2->getObject(spaces[0].handle());
+  ASSERT_TRUE(space);
+  EXPECT_EQ("Journaled Space", space->nameString());
+  EXPECT_TRUE(model2->getObject(newSpace.handle()));
+  EXPECT_FALSE(model2->getObject(scheduleHandle));
+  EXPECT_TRUE(model2->handlesAddedSinceSave().empty());
+
+  // saving folds the journal into the file
+  EXPECT_TRUE(model2->save(path, true));
+  EXPECT_FALSE(openstudio::filesystem::exists(journalPath));
+  model2 = Model::load(path);
+  ASSERT_TRUE(model2);
+  EXPECT_EQ(model.numObjects(), model2->numObjects());
+}
+
+TEST_F(ModelFixture, DISABLED_Model_IncrementalSave_Benchmark) {
+  const unsigned numSurfaces = 20000;
+  std::vector<Point3d> vertices;
+  vertices.push_back(Point3d(0,0,1));
+  vertices.push_back(Point3d(0,0,0));
+  vertices.push_back(Point3d(1,0,0));
+  vertices.push_back(Point3d(1,0,1));
+
+  Model model;
+  model.setFastNaming(true);
+  Space space(model);
+  for (unsigned i = 0; i < numSurfaces; ++i) {
+    Surface surface(vertices, model);
+    surface.setSpace(space);
+  }
+  std::vector<Surface> surfaces = model.getConcreteModelObjects<Surface>();
+  openstudio::path path = toPath("./Model_IncrementalSave_Benchmark.osm");
+
+  for (unsigned i = 0; i < 4; ++i) {
+    if (i > 0) {
+      surfaces[i].setName("Edited Surface " + std::to_string(i));
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_TRUE(model.toIdfFile().save(path, true));
+    auto middle = std::chrono::steady_clock::now();
+    EXPECT_TRUE(model.save(path, true));
+    auto end = std::chrono::steady_clock::now();
+
+    std::cout << "save " << i << ": " << numSurfaces << " surfaces, full save "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(middle - start).count() << " ms, incremental save "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - middle).count() << " ms" << std::endl;
+  }
+}
@@ -31,10 +31,18 @@
 #include "ModelFixture.hpp"
 #include "../PlanarSurface.hpp"
 #include "../PlanarSurface_Impl.hpp"
+#include "../Space.hpp"
+#include "../Surface.hpp"
+#include "../SubSurface.hpp"
+
+#include "../../utilities/geometry/BoundingBox.hpp"
+#include "../../utilities/geometry/Point3d.hpp"
 
 #include "../../utilities/units/QuantityFactory.hpp"
 #include "../../utilities/units/QuantityConverter.hpp"
 
+#include <boost/math/constants/constants.hpp>
+
 using namespace openstudio;
 using namespace openstudio::model;
 
@@ -86,3 +94,76 @@ TEST_F(ModelFixture, PlanarSurface_FilmResistanceConversions)
   EXPECT_NEAR(qc->value(),PlanarSurface::filmResistance(FilmResistanceType::MovingAir_7p5mph),1.0E-8);
 }
 
+
+TEST_F(ModelFixture, PlanarSurface_CachedGeometry)
+{
+  Model model;
+  Space space(model);
+
+  Point3dVector points;
+  points.push_back(Point3d(0, 0, 2));
+  points.push_back(Point3d(0, 0, 0));
+  points.push_back(Point3d(4, 0, 0));
+  points.push_back(Point3d(4, 0, 2));
+  Surface wall(points, model);
+  wall.setSpace(space);
+
+  EXPECT_NEAR(8, wall.grossArea(), 1.0E-8);
+  EXPECT_NEAR(8, wall.netArea(), 1.0E-8);
+  EXPECT_NEAR(boost::math::constants::half_pi<double>(), wall.tilt(), 1.0E-8);
+  EXPECT_NEAR(boost::math::constants::pi<double>(), wall.azimuth(), 1.0E-8);
+  Point3d centroid = wall.centroid();
+  EXPECT_NEAR(2, centroid.x(), 1.0E-8);
+  EXPECT_NEAR(0, centroid.y(), 1.0E-8);
+  EXPECT_NEAR(1, centroid.z(), 1.0E-8);
+  BoundingBox boundingBox = wall.boundingBox();
+  ASSERT_FALSE(boundingBox.isEmpty());
+  EXPECT_DOUBLE_EQ(4, boundingBox.maxX().get());
+  EXPECT_DOUBLE_EQ(2, boundingBox.maxZ().get());
+
+  // cached values are cleared when the vertices change
+  points.clear();
+  points.push_back(Point3d(0, 0, 3));
+  points.push_back(Point3d(0, 0, 0));
+  points.push_back(Point3d(0, 4, 0));
+  points.push_back(Point3d(0, 4, 3));
+  EXPECT_TRUE(wall.setVertices(points));
+
+  EXPECT_NEAR(12, wall.grossArea(), 1.0E-8);
+  EXPECT_NEAR(12, wall.netArea(), 1.0E-8);
+  EXPECT_NEAR(boost::math::constants::half_pi<double>(), wall.tilt(), 1.0E-8);
+  EXPECT_NEAR(boost::math::constants::half_pi<double>(), wall.azimuth(), 1.0E-8);
+  centroid = wall.centroid();
+  EXPECT_NEAR(0, centroid.x(), 1.0E-8);
+  EXPECT_NEAR(2, centroid.y(), 1.0E-8);
+  EXPECT_NEAR(1.5, centroid.z(), 1.0E-8);
+  boundingBox = wall.boundingBox();
+  EXPECT_DOUBLE_EQ(0, boundingBox.maxX().get());
+  EXPECT_DOUBLE_EQ(4, boundingBox.maxY().get());
+  EXPECT_DOUBLE_EQ(3, boundingBox.maxZ().get());
+
+  // net area follows changes to sub surfaces
+  points.clear();
+  points.push_back(Point3d(0, 1, 2));
+  points.push_back(Point3d(0, 1, 1));
+  points.push_back(Point3d(0, 2, 1));
+  points.push_back(Point3d(0, 2, 2));
+  SubSurface window(points, model);
+  EXPECT_TRUE(window.setSurface(wall));
+  EXPECT_NEAR(11, wall.netArea(), 1.0E-8);
+
+  EXPECT_TRUE(window.setMultiplier(2));
+  EXPECT_NEAR(10, wall.netArea(), 1.0E-8);
+
+  points.clear();
+  points.push_back(Point3d(0, 1, 2.5));
+  points.push_back(Point3d(0, 1, 1));
+  points.push_back(Point3d(0, 2, 1));
+  points.push_back(Point3d(0, 2, 2.5));
+  EXPECT_TRUE(window.setVertices(points));
+  EXPECT_NEAR(9, wall.netArea(), 1.0E-8);
+
+  window.remove();
+  EXPECT_NEAR(12, wall.netArea(), 1.0E-8);
+  EXPECT_NEAR(12, wall.grossArea(), 1.0E-8);
+}
@@ -59,6 +59,9 @@
 
 #include <utilities/idd/IddEnums.hxx>
 
+#include <chrono>
+#include <iostream>
+
 using namespace openstudio::model;
 
 TEST_F(ModelFixture,PlantLoop_PlantLoop)
@@ -432,3 +435,73 @@ TEST_F(ModelFixture, PlantLoop_OperationSchemes)
   
 }
 
+TEST_F(ModelFixture, PlantLoop_ComponentsCache)
+{
+  Model m;
+  PlantLoop plantLoop(m);
+  ScheduleCompact s(m);
+  CoilHeatingWater heatingCoil(m,s);
+  CoilHeatingWater heatingCoil2(m,s);
+
+  EXPECT_TRUE(plantLoop.addDemandBranchForComponent(heatingCoil));
+  EXPECT_TRUE(plantLoop.addDemandBranchForComponent(heatingCoil2));
+
+  // repeated queries against an unchanged model give the same answer
+  std::vector<ModelObject> demandComponents = plantLoop.demandComponents();
+  ASSERT_EQ(10u, demandComponents.size());
+  EXPECT_EQ(demandComponents, plantLoop.demandComponents());
+  EXPECT_EQ(plantLoop.demandInletNode(), demandComponents.front());
+  EXPECT_EQ(plantLoop.demandOutletNode(), demandComponents.back());
+  EXPECT_EQ(2u, plantLoop.demandComponents(CoilHeatingWater::iddObjectType()).size());
+  EXPECT_TRUE(plantLoop.demandComponent(heatingCoil2.handle()));
+  EXPECT_FALSE(plantLoop.supplyComponent(heatingCoil2.handle()));
+  EXPECT_EQ(3u, plantLoop.components(plantLoop.demandSplitter(), heatingCoil2).size());
+
+  // changing the topology invalidates the cached answer
+  EXPECT_TRUE(plantLoop.removeDemandBranchWithComponent(heatingCoil2));
+  EXPECT_EQ(7u, plantLoop.demandComponents().size());
+  EXPECT_EQ(1u, plantLoop.demandComponents(CoilHeatingWater::iddObjectType()).size());
+  EXPECT_FALSE(plantLoop.demandComponent(heatingCoil2.handle()));
+
+  // as does a change made during a batch edit
+  {
+    openstudio::WorkspaceBatchEdit batch(m);
+    CoilHeatingWater heatingCoil3(m,s);
+    EXPECT_TRUE(plantLoop.addDemandBranchForComponent(heatingCoil3));
+    EXPECT_EQ(10u, plantLoop.demandComponents().size());
+    EXPECT_TRUE(plantLoop.demandComponent(heatingCoil3.handle()));
+  }
+}
+
+TEST_F(ModelFixture, DISABLED_PlantLoop_Components_Benchmark)
+{
+  for (unsigned numBranches : {10u, 100u, 300u}) {
+    Model m;
+    PlantLoop plantLoop(m);
+    ScheduleCompact s(m);
+    std::vector<CoilHeatingWater> coils;
+    for (unsigned i = 0; i < numBranches; ++i) {
+      CoilHeatingWater coil(m,s);
+      plantLoop.addDemandBranchForComponent(coil);
+      coils.push_back(coil);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<ModelObject> demandComponents = plantLoop.demandComponents();
+    auto firstQuery = std::chrono::steady_clock::now();
+    unsigned numFound = 0;
+    for (const auto & coil : coils) {
+      if (plantLoop.demandComponent(coil.handle())) {
+        ++numFound;
+      }
+      numFound += plantLoop.demandComponents(plantLoop.demandSplitter(), coil, CoilHeatingWater::iddObjectType()).size();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    EXPECT_EQ(2 * numBranches, numFound);
+    std::cout << numBranches << " branches, " << demandComponents.size() << " demand components: first query "
+              << std::chrono::duration<double, std::milli>(firstQuery - start).count() << " ms, "
+              << 2 * numBranches << " cached queries "
+              << std::chrono::duration<double, std::milli>(end - firstQuery).count() << " ms" << std::endl;
+  }
+}
@@ -39,6 +39,8 @@
 #include "../StandardsInformationConstruction_Impl.hpp"
 #include "../StandardOpaqueMaterial.hpp"
 #include "../StandardOpaqueMaterial_Impl.hpp"
+#include "../Space.hpp"
+#include "../SpaceType.hpp"
 
 #include "../../utilities/core/Optional.hpp"
 
@@ -133,3 +135,35 @@ TEST_F(ModelFixture,ResourceObject_Clone) {
   EXPECT_EQ("Material with Changed Data",newConstruction.layers()[0].name().get());
   EXPECT_EQ("Material 1",anotherNewConstruction.layers()[0].name().get());
 }
+
+TEST_F(ModelFixture,ResourceObject_PurgeUnusedResourceObjects) {
+  Model model;
+  // an unused construction with a child, the material is only used by the construction
+  Construction construction(model);
+  StandardsInformationConstruction info = construction.standardsInformation();
+  StandardOpaqueMaterial material(model);
+  EXPECT_TRUE(construction.setLayers(MaterialVector(1u,material)));
+  // a used resource
+  Space space(model);
+  SpaceType spaceType(model);
+  EXPECT_TRUE(space.setSpaceType(spaceType));
+  unsigned numObjects = model.numObjects();
+
+  // everything is removed in one call, each object once
+  IdfObjectVector removedObjects = model.purgeUnusedResourceObjects();
+  EXPECT_EQ(3u,removedObjects.size());
+  std::set<Handle> removedHandles;
+  for (const IdfObject& removedObject : removedObjects) {
+    EXPECT_TRUE(removedHandles.insert(removedObject.handle()).second);
+  }
+  EXPECT_EQ(1u,removedHandles.count(construction.handle()));
+  EXPECT_EQ(1u,removedHandles.count(info.handle()));
+  EXPECT_EQ(1u,removedHandles.count(material.handle()));
+  EXPECT_EQ(numObjects - 3u,model.numObjects());
+  EXPECT_FALSE(model.getObject(construction.handle()));
+  EXPECT_FALSE(model.getObject(material.handle()));
+  EXPECT_TRUE(model.getObject(spaceType.handle()));
+
+  // nothing left to purge
+  EXPECT_TRUE(model.purgeUnusedResourceObjects().empty());
+}
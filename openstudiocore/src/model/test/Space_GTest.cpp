@@ -71,6 +71,7 @@
 #include "../../utilities/idf/WorkspaceObjectWatcher.hpp"
 #include "../../utilities/core/Compare.hpp"
 
+#include <chrono>
 #include <iostream>
 
 using namespace openstudio;
@@ -1510,3 +1511,101 @@ TEST_F(ModelFixture, Space_LifeCycleCost)
   EXPECT_TRUE(lifeCycleCost->handle().isNull());
   EXPECT_EQ(0, model.getConcreteModelObjects<LifeCycleCost>().size());
 }
+
+TEST_F(ModelFixture, Space_CachedGeometry)
+{
+  Model model;
+
+  std::vector<Point3d> floorPrint;
+  floorPrint.push_back(Point3d(0, 10, 0));
+  floorPrint.push_back(Point3d(10, 10, 0));
+  floorPrint.push_back(Point3d(10, 0, 0));
+  floorPrint.push_back(Point3d(0, 0, 0));
+
+  boost::optional<Space> space = Space::fromFloorPrint(floorPrint, 3, model);
+  ASSERT_TRUE(space);
+
+  double exteriorArea = 0;
+  boost::optional<Surface> roof;
+  for (const Surface& surface : space->surfaces()){
+    if (istringEqual(surface.outsideBoundaryCondition(), "Outdoors")){
+      exteriorArea += surface.grossArea();
+    }
+    if (istringEqual(surface.surfaceType(), "RoofCeiling")){
+      roof = surface;
+    }
+  }
+  ASSERT_TRUE(roof);
+
+  EXPECT_NEAR(100, space->floorArea(), 1.0E-8);
+  EXPECT_NEAR(300, space->volume(), 1.0E-8);
+  EXPECT_NEAR(exteriorArea, space->exteriorArea(), 1.0E-8);
+  EXPECT_DOUBLE_EQ(3, space->boundingBox().maxZ().get());
+
+  // repeated queries return the cached values
+  EXPECT_NEAR(300, space->volume(), 1.0E-8);
+  EXPECT_DOUBLE_EQ(3, space->boundingBox().maxZ().get());
+
+  // raising the roof changes the volume and bounding box
+  std::vector<Point3d> roofVertices = roof->vertices();
+  for (Point3d& point : roofVertices){
+    point = Point3d(point.x(), point.y(), 4);
+  }
+  EXPECT_TRUE(roof->setVertices(roofVertices));
+  EXPECT_NEAR(100, space->floorArea(), 1.0E-8);
+  EXPECT_NEAR(400, space->volume(), 1.0E-8);
+  EXPECT_DOUBLE_EQ(4, space->boundingBox().maxZ().get());
+
+  // removing the roof is seen as well
+  double roofArea = istringEqual(roof->outsideBoundaryCondition(), "Outdoors") ? roof->grossArea() : 0.0;
+  roof->remove();
+  EXPECT_NEAR(0, space->volume(), 1.0E-8);
+  EXPECT_NEAR(exteriorArea - roofArea, space->exteriorArea(), 1.0E-8);
+  EXPECT_DOUBLE_EQ(3, space->boundingBox().maxZ().get());
+}
+
+TEST_F(ModelFixture, DISABLED_Space_Geometry_Benchmark)
+{
+  const unsigned numStories = 20;
+  const unsigned numSpacesPerStory = 50;
+  const unsigned numQueries = 10;
+
+  Model model;
+  for (unsigned story = 0; story < numStories; ++story){
+    for (unsigned i = 0; i < numSpacesPerStory; ++i){
+      double x = 10.0 * i;
+      double z = 3.0 * story;
+      std::vector<Point3d> floorPrint;
+      floorPrint.push_back(Point3d(x, 10, z));
+      floorPrint.push_back(Point3d(x + 10, 10, z));
+      floorPrint.push_back(Point3d(x + 10, 0, z));
+      floorPrint.push_back(Point3d(x, 0, z));
+      ASSERT_TRUE(Space::fromFloorPrint(floorPrint, 3, model));
+    }
+  }
+
+  std::vector<Space> spaces = model.getConcreteModelObjects<Space>();
+  Building building = model.getUniqueModelObject<Building>();
+
+  for (unsigned query = 0; query < numQueries; ++query){
+    auto start = std::chrono::steady_clock::now();
+
+    double floorArea = building.floorArea();
+    double exteriorArea = building.exteriorSurfaceArea();
+    double volume = 0;
+    BoundingBox boundingBox;
+    for (const Space& space : spaces){
+      volume += space.volume();
+      boundingBox.add(space.boundingBox());
+    }
+
+    auto end = std::chrono::steady_clock::now();
+
+    std::cout << "query " << query << ": " << spaces.size() << " spaces in "
+              << std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() << " us" << std::endl;
+    EXPECT_NEAR(100.0 * spaces.size(), floorArea, 1.0E-6);
+    EXPECT_NEAR(300.0 * spaces.size(), volume, 1.0E-6);
+    EXPECT_LT(0, exteriorArea);
+    EXPECT_FALSE(boundingBox.isEmpty());
+  }
+}
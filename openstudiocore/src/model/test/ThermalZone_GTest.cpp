@@ -28,6 +28,8 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+
 #include "ModelFixture.hpp"
 
 #include "../AirLoopHVAC.hpp"
@@ -40,6 +42,8 @@
 #include "../ElectricEquipment.hpp"
 #include "../ElectricEquipmentDefinition.hpp"
 #include "../FanConstantVolume.hpp"
+#include "../InteriorPartitionSurface.hpp"
+#include "../InteriorPartitionSurfaceGroup.hpp"
 #include "../LifeCycleCost.hpp"
 #include "../LifeCycleCost_Impl.hpp"
 #include "../Lights.hpp"
@@ -47,6 +51,8 @@
 #include "../Model_Impl.hpp"
 #include "../Node.hpp"
 #include "../Node_Impl.hpp"
+#include "../People.hpp"
+#include "../PeopleDefinition.hpp"
 #include "../PortList.hpp"
 #include "../PortList_Impl.hpp"
 #include "../ScheduleCompact.hpp"
@@ -56,9 +62,11 @@
 #include "../SizingZone.hpp"
 #include "../SizingZone_Impl.hpp"
 #include "../Space.hpp"
+#include "../Space_Impl.hpp"
 #include "../SpaceInfiltrationDesignFlowRate.hpp"
 #include "../SpaceInfiltrationEffectiveLeakageArea.hpp"
 #include "../StraightComponent.hpp"
+#include "../Surface.hpp"
 #include "../ThermalZone.hpp"
 #include "../ThermalZone_Impl.hpp"
 #include "../ThermostatSetpointDualSetpoint.hpp"
@@ -76,7 +84,10 @@
 
 #include "../../utilities/core/Containers.hpp"
 #include "../../utilities/data/Attribute.hpp"
+#include "../../utilities/geometry/BoundingBox.hpp"
 #include "../../utilities/geometry/Point3d.hpp"
+#include "../../utilities/geometry/Transformation.hpp"
+#include "../../utilities/geometry/Vector3d.hpp"
 #include "../../utilities/units/Quantity.hpp"
 #include "../../utilities/units/Unit.hpp"
 
@@ -531,6 +542,104 @@ TEST_F(ModelFixture, ThermalZone_CombineSpaces_Cost3)
   EXPECT_EQ(100, newSpace->electricEquipment()[1].definition().lifeCycleCosts()[0].totalCost());
 }
 
+// makes a grid of 10 x 10 x 3 m spaces with matched surfaces, each with people and lights sized per floor area
+static std::vector<Space> makeSpaceGrid(Model& model, int nx, int ny)
+{
+  PeopleDefinition peopleDefinition(model);
+  peopleDefinition.setPeopleperSpaceFloorArea(0.05);
+  LightsDefinition lightsDefinition(model);
+  lightsDefinition.setWattsperSpaceFloorArea(10.0);
+
+  std::vector<Space> spaces;
+  for (int i = 0; i < nx; ++i){
+    for (int j = 0; j < ny; ++j){
+      Point3dVector floorPrint;
+      floorPrint.push_back(Point3d(10*i, 10*(j+1), 0));
+      floorPrint.push_back(Point3d(10*(i+1), 10*(j+1), 0));
+      floorPrint.push_back(Point3d(10*(i+1), 10*j, 0));
+      floorPrint.push_back(Point3d(10*i, 10*j, 0));
+
+      boost::optional<Space> space = Space::fromFloorPrint(floorPrint, 3, model);
+      EXPECT_TRUE(space);
+
+      People people(peopleDefinition);
+      people.setSpace(*space);
+      Lights lights(lightsDefinition);
+      lights.setSpace(*space);
+
+      spaces.push_back(*space);
+    }
+  }
+  matchSurfaces(spaces);
+  return spaces;
+}
+
+TEST_F(ModelFixture, ThermalZone_CombineSpaces_Grid)
+{
+  Model model;
+  std::vector<Space> spaces = makeSpaceGrid(model, 2, 2);
+
+  // move one space's origin so that its geometry has to be transformed into the new space
+  EXPECT_TRUE(spaces[3].changeTransformation(Transformation::translation(Vector3d(10, 10, 0))));
+
+  ThermalZone thermalZone(model);
+  for (Space& space : spaces){
+    EXPECT_TRUE(space.setThermalZone(thermalZone));
+  }
+  EXPECT_DOUBLE_EQ(400.0, thermalZone.floorArea());
+  EXPECT_DOUBLE_EQ(20.0, thermalZone.numberOfPeople());
+
+  boost::optional<Space> newSpace = thermalZone.combineSpaces();
+  ASSERT_TRUE(newSpace);
+  ASSERT_EQ(1u, thermalZone.spaces().size());
+  EXPECT_EQ(newSpace->handle(), thermalZone.spaces()[0].handle());
+  EXPECT_EQ(1u, model.getConcreteModelObjects<Space>().size());
+
+  // the four shared walls are replaced by interior partitions
+  EXPECT_EQ(16u, newSpace->surfaces().size());
+  ASSERT_EQ(1u, newSpace->interiorPartitionSurfaceGroups().size());
+  EXPECT_EQ(4u, newSpace->interiorPartitionSurfaceGroups()[0].interiorPartitionSurfaces().size());
+
+  EXPECT_DOUBLE_EQ(400.0, newSpace->floorArea());
+  EXPECT_DOUBLE_EQ(1200.0, newSpace->volume());
+  EXPECT_DOUBLE_EQ(20.0, newSpace->numberOfPeople());
+  EXPECT_DOUBLE_EQ(4000.0, newSpace->lightingPower());
+
+  BoundingBox boundingBox = newSpace->transformation() * newSpace->boundingBox();
+  ASSERT_TRUE(boundingBox.minX());
+  EXPECT_NEAR(0.0, boundingBox.minX().get(), 1.0e-8);
+  EXPECT_NEAR(0.0, boundingBox.minY().get(), 1.0e-8);
+  EXPECT_NEAR(0.0, boundingBox.minZ().get(), 1.0e-8);
+  EXPECT_NEAR(20.0, boundingBox.maxX().get(), 1.0e-8);
+  EXPECT_NEAR(20.0, boundingBox.maxY().get(), 1.0e-8);
+  EXPECT_NEAR(3.0, boundingBox.maxZ().get(), 1.0e-8);
+}
+
+TEST_F(ModelFixture, DISABLED_ThermalZone_CombineSpaces_Benchmark)
+{
+  Model model;
+
+  // ten open office zones of 40 spaces each
+  std::vector<ThermalZone> thermalZones;
+  for (int z = 0; z < 10; ++z){
+    std::vector<Space> spaces = makeSpaceGrid(model, 8, 5);
+    ThermalZone thermalZone(model);
+    for (Space& space : spaces){
+      space.setThermalZone(thermalZone);
+    }
+    thermalZones.push_back(thermalZone);
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  for (ThermalZone& thermalZone : thermalZones){
+    EXPECT_TRUE(thermalZone.combineSpaces());
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  std::cout << "Combined 10 zones of 40 spaces in "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+}
+
 TEST_F(ModelFixture, ThermalZone_Clone)
 {
   Model m;
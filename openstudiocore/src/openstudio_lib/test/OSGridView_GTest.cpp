@@ -0,0 +1,132 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2017, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "OpenStudioLibFixture.hpp"
+
+#include "../DesignDayGridView.hpp"
+
+#include "../../shared_gui_components/OSGridView.hpp"
+
+#include "../../model/Model.hpp"
+#include "../../model/DesignDay.hpp"
+
+#include <QApplication>
+#include <QScrollArea>
+#include <QScrollBar>
+
+#include <chrono>
+#include <iostream>
+
+using namespace openstudio;
+
+// These tests show widgets, use QT_QPA_PLATFORM=offscreen on machines without a display
+
+namespace {
+
+  model::Model designDayModel(int numDesignDays)
+  {
+    model::Model model;
+    for (int i = 0; i < numDesignDays; ++i) {
+      model::DesignDay designDay(model);
+    }
+    return model;
+  }
+
+  void processEvents()
+  {
+    // queued refreshes and visibility checks are zero length single shot timers
+    for (int i = 0; i < 5; ++i) {
+      QApplication::processEvents();
+    }
+  }
+
+}
+
+TEST_F(OpenStudioLibFixture, OSGridView_LazyRows)
+{
+  model::Model model = designDayModel(1000);
+
+  QScrollArea scrollArea;
+  scrollArea.setWidgetResizable(true);
+  auto designDayGridView = new DesignDayGridView(false, model);
+  scrollArea.setWidget(designDayGridView);
+  scrollArea.resize(800, 600);
+  scrollArea.show();
+  processEvents();
+
+  auto gridView = designDayGridView->findChild<OSGridView *>();
+  ASSERT_TRUE(gridView);
+
+  // header row plus one row per design day, only the top of the grid has widgets
+  EXPECT_GT(gridView->builtRowCount(), 1);
+  EXPECT_LT(gridView->builtRowCount(), 1001);
+  EXPECT_TRUE(gridView->itemAtPosition(1, 0));
+  EXPECT_FALSE(gridView->itemAtPosition(1000, 0));
+
+  scrollArea.verticalScrollBar()->setValue(scrollArea.verticalScrollBar()->maximum());
+  processEvents();
+
+  EXPECT_TRUE(gridView->itemAtPosition(1000, 0));
+  EXPECT_LT(gridView->builtRowCount(), 1001);
+
+  // rows can be built on demand, as when the selected row is scrolled to
+  gridView->ensureRowBuilt(500);
+  EXPECT_TRUE(gridView->itemAtPosition(500, 0));
+}
+
+TEST_F(OpenStudioLibFixture, DISABLED_OSGridView_Benchmark)
+{
+  model::Model model = designDayModel(10000);
+
+  QScrollArea scrollArea;
+  scrollArea.setWidgetResizable(true);
+  scrollArea.resize(1200, 800);
+
+  auto start = std::chrono::steady_clock::now();
+  auto designDayGridView = new DesignDayGridView(false, model);
+  scrollArea.setWidget(designDayGridView);
+  scrollArea.show();
+  processEvents();
+  auto shown = std::chrono::steady_clock::now();
+
+  auto gridView = designDayGridView->findChild<OSGridView *>();
+  ASSERT_TRUE(gridView);
+
+  auto scrollBar = scrollArea.verticalScrollBar();
+  for (int value = 0; value <= scrollBar->maximum(); value += scrollBar->pageStep()) {
+    scrollBar->setValue(value);
+    processEvents();
+  }
+  auto scrolled = std::chrono::steady_clock::now();
+
+  std::cout << "Show 10000 row grid: " << std::chrono::duration_cast<std::chrono::milliseconds>(shown - start).count() << " ms" << std::endl;
+  std::cout << "Scroll to the end: " << std::chrono::duration_cast<std::chrono::milliseconds>(scrolled - shown).count() << " ms" << std::endl;
+  std::cout << "Rows with widgets: " << gridView->builtRowCount() << std::endl;
+}
@@ -33,6 +33,7 @@
 #include "../utilities/core/System.hpp"
 #include "../utilities/data/Vector.hpp"
 
+#include <qwt/qwt_painter.h>
 #include <qwt/qwt_picker_machine.h>
 #include <qwt/qwt_plot_renderer.h>
 #include <qwt/qwt_symbol.h>
@@ -42,7 +43,9 @@
 #include <QVBoxLayout>
 #include <QHBoxLayout>
 #include <QButtonGroup>
+#include <algorithm>
 #include <cfloat>
+#include <cmath>
 #include <QPrinter>
 #include <QPrintDialog>
 #include <QMessageBox>
@@ -74,9 +77,60 @@ namespace resultsviewer{
       m_xValues[i] = data.sample(i).x();
       m_yUnscaled[i] = data.sample(i).y();
     }
+    resetPyramids();
     setLinePlotStyle(resultsviewer::smoothLinePlot);
   }
 
+  const openstudio::MinMaxPyramid& LinePlotCurve::pyramid() const
+  {
+    std::shared_ptr<openstudio::MinMaxPyramid>& result = m_pyramids[m_yType];
+    if (!result)
+    {
+      const QVector<double>& yValues = (m_yType == resultsviewer::scaledY) ? m_yScaled : m_yUnscaled;
+      result = std::make_shared<openstudio::MinMaxPyramid>(m_xValues.toStdVector(), yValues.toStdVector());
+    }
+    return *result;
+  }
+
+  void LinePlotCurve::resetPyramids()
+  {
+    m_pyramids[unScaledY].reset();
+    m_pyramids[scaledY].reset();
+  }
+
+  void LinePlotCurve::drawLines(QPainter *painter, const QwtScaleMap &xMap, const QwtScaleMap &yMap,
+    const QRectF &canvasRect, int from, int to) const
+  {
+    // a few points per pixel column are cheap to draw as they are, and partial
+    // repaints of a curve are rare enough to leave to Qwt
+    const size_t numSamples = dataSize();
+    const unsigned numColumns = static_cast<unsigned>(std::ceil(canvasRect.width()));
+    if (numColumns == 0 || from != 0 || to != static_cast<int>(numSamples) - 1 || numSamples <= 4 * numColumns)
+    {
+      QwtPlotCurve::drawLines(painter, xMap, yMap, canvasRect, from, to);
+      return;
+    }
+
+    double xMin = xMap.invTransform(canvasRect.left());
+    double xMax = xMap.invTransform(canvasRect.right());
+    if (xMax < xMin)
+    {
+      std::swap(xMin, xMax);
+    }
+
+    std::vector<double> x;
+    std::vector<double> y;
+    pyramid().envelope(xMin, xMax, numColumns, x, y);
+
+    QPolygonF polyline(static_cast<int>(x.size()));
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+      polyline[static_cast<int>(i)] = QPointF(xMap.transform(x[i]), yMap.transform(y[i]));
+    }
+
+    QwtPainter::drawPolyline(painter, polyline);
+  }
+
 
   void LinePlotCurve::setDataMode(YValueType yType)
   {
@@ -68,9 +68,12 @@
 #include <qwt/qwt_color_map.h>
 #include <qwt/qwt_plot_spectrogram.h>
 
+#include "../utilities/data/MinMaxPyramid.hpp"
 #include "../utilities/data/TimeSeries.hpp"
 #include "../utilities/time/Date.hpp"
 
+#include <memory>
+
 namespace resultsviewer{
 
   // int or enum
@@ -100,11 +103,11 @@ namespace resultsviewer{
     QStringList& plotSource() {return m_plotSource;}
 
     double yUnscaled(int i) {return m_yUnscaled[i];}
-    void setYUnscaled(QVector<double>& yUnscaled) {m_yUnscaled = yUnscaled;}
+    void setYUnscaled(QVector<double>& yUnscaled) {m_yUnscaled = yUnscaled; m_pyramids[unScaledY].reset();}
     double yScaled(int i) {return m_yScaled[i];}
-    void setYScaled(QVector<double>& yScaled) {m_yScaled = yScaled;}
+    void setYScaled(QVector<double>& yScaled) {m_yScaled = yScaled; m_pyramids[scaledY].reset();}
     double xValues(int i) {return m_xValues[i];}
-    void setXValues(QVector<double>& xValues) {m_xValues = xValues;}
+    void setXValues(QVector<double>& xValues) {m_xValues = xValues; resetPyramids();}
 
     // assign data and update array members
     void setDataMode(YValueType yType);
@@ -115,7 +118,16 @@ namespace resultsviewer{
 
     void setLinePlotStyle(LinePlotStyleType lineStyle);
 
+  protected:
+    // long series are drawn as the min/max envelope of each pixel column
+    virtual void drawLines(QPainter *painter, const QwtScaleMap &xMap, const QwtScaleMap &yMap,
+      const QRectF &canvasRect, int from, int to) const override;
+
   private:
+    // built on first draw and kept until the data changes
+    const openstudio::MinMaxPyramid& pyramid() const;
+    void resetPyramids();
+
     QStringList m_alias;
     QStringList m_plotSource;
     QString m_legend;
@@ -124,6 +136,7 @@ namespace resultsviewer{
     QVector<double> m_xValues; // mid point
     YValueType m_yType;
     LinePlotStyleType m_linePlotStyle;
+    mutable std::shared_ptr<openstudio::MinMaxPyramid> m_pyramids[2]; // indexed by YValueType
 
   };
 
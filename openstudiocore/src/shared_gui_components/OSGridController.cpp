@@ -80,7 +80,7 @@ namespace openstudio {
   const std::vector<QColor> OSGridController::m_colors = SchedulesView::initializeColors();
 
   WidgetLocation::WidgetLocation(QWidget *t_widget, int t_row, int t_column, boost::optional<int> t_subrow)
-    : widget(t_widget), row(t_row), column(t_column), subrow(std::move(t_subrow))
+    : QObject(t_widget), widget(t_widget), row(t_row), column(t_column), subrow(std::move(t_subrow))
   {
   }
 
@@ -105,26 +105,50 @@ namespace openstudio {
     const boost::optional<int> &t_subrow,
     const bool t_selector)
   {
+    // owned by the holder, so it is deleted with the holder when a block of rows is unloaded
     WidgetLocation * widgetLoc = new WidgetLocation(t_holder, t_row, t_column, t_subrow);
 
     connect(t_holder, &QObject::destroyed, this, &ObjectSelector::widgetDestroyed);
     connect(t_holder, &Holder::inFocus, widgetLoc, &WidgetLocation::onInFocus);
     connect(widgetLoc, &WidgetLocation::inFocus, this, &ObjectSelector::inFocus);
 
-    m_widgetMap.insert(std::make_pair(t_obj, widgetLoc));
+    auto itr = m_widgetMap.insert(std::make_pair(t_obj, widgetLoc));
+    m_widgetIndex.insert(std::make_pair(t_holder, itr));
 
-    if (t_selector && t_obj)
+    if (t_obj)
     {
-      m_selectorObjects.insert(*t_obj);
+      addObject(*t_obj, t_row, t_subrow, t_selector);
     }
   }
 
+  void ObjectSelector::addObject(const model::ModelObject &t_obj,
+    int t_row,
+    const boost::optional<int> &t_subrow,
+    const bool t_selector)
+  {
+    // The first location wins, as it does for lookups in m_widgetMap
+    m_objectLocations.insert(std::make_pair(t_obj, std::make_tuple(t_row, t_subrow)));
+
+    if (t_selector)
+    {
+      m_selectorObjects.insert(t_obj);
+    }
+  }
+
+  void ObjectSelector::clearObjectLocations()
+  {
+    m_objectLocations.clear();
+  }
+
   void ObjectSelector::clear()
   {
-    m_widgetMap.clear(); // TODO delete all QObjects, or set parent
+    // WidgetLocations are deleted with their holders
+    m_widgetMap.clear();
+    m_widgetIndex.clear();
     m_selectedObjects.clear();
     m_selectorObjects.clear();
     m_filteredObjects.clear();
+    m_objectLocations.clear();
     m_objectFilter = getDefaultFilter();
   }
 
@@ -135,7 +159,9 @@ namespace openstudio {
     m_selectedObjects.erase(t_obj);
     m_selectorObjects.erase(t_obj);
     m_filteredObjects.erase(t_obj);
-    m_widgetMap.erase(boost::optional<model::ModelObject>(t_obj));
+    auto range = m_widgetMap.equal_range(boost::optional<model::ModelObject>(t_obj));
+    eraseWidgetLocations(range.first, range.second);
+    m_objectLocations.erase(t_obj);
   }
 
   bool ObjectSelector::containsObject(const openstudio::model::ModelObject &t_obj) const
@@ -148,17 +174,25 @@ namespace openstudio {
 
   void ObjectSelector::widgetDestroyed(QObject *t_obj)
   {
-    auto itr = m_widgetMap.begin();
+    auto range = m_widgetIndex.equal_range(t_obj);
+    for (auto itr = range.first; itr != range.second; ++itr) {
+      m_widgetMap.erase(itr->second);
+    }
+    m_widgetIndex.erase(range.first, range.second);
+  }
 
-    while (itr != m_widgetMap.end())
-    {
-      if (itr->second->widget == t_obj) {
-        itr = m_widgetMap.erase(itr);
-      }
-      else {
-        ++itr;
+  void ObjectSelector::eraseWidgetLocations(WidgetMap::iterator t_begin, WidgetMap::iterator t_end)
+  {
+    for (auto itr = t_begin; itr != t_end; ++itr) {
+      auto range = m_widgetIndex.equal_range(itr->second->widget);
+      for (auto indexItr = range.first; indexItr != range.second; ++indexItr) {
+        if (indexItr->second == itr) {
+          m_widgetIndex.erase(indexItr);
+          break;
+        }
       }
     }
+    m_widgetMap.erase(t_begin, t_end);
   }
 
   bool ObjectSelector::getObjectSelection(const model::ModelObject &t_obj) const
@@ -234,12 +268,13 @@ namespace openstudio {
 
     for (auto obj : m_selectorObjects) {
 
-      auto range = m_widgetMap.equal_range(boost::optional<model::ModelObject>(obj));
-
-      assert(range.first != range.second);
+      // Find the row that contains this object, its widgets may not have been built
+      auto location = m_objectLocations.find(obj);
+      if (location == m_objectLocations.end()) {
+        continue;
+      }
 
-      // Find the row that contains this object
-      auto row = std::make_tuple(range.first->second->row, range.first->second->subrow);
+      auto row = location->second;
 
       auto objectVisible = m_objectFilter(obj);
 
@@ -304,12 +339,13 @@ namespace openstudio {
 
     for (auto obj : m_selectorObjects) {
 
-      auto range = m_widgetMap.equal_range(boost::optional<model::ModelObject>(obj));
-
-      assert(range.first != range.second);
+      // Find the row that contains this object, its widgets may not have been built
+      auto location = m_objectLocations.find(obj);
+      if (location == m_objectLocations.end()) {
+        continue;
+      }
 
-      // Find the row that contains this object
-      auto row = std::make_tuple(range.first->second->row, range.first->second->subrow);
+      auto row = location->second;
 
       auto objectVisible = m_objectFilter(obj);
 
@@ -435,11 +471,28 @@ namespace openstudio {
     }
   }
 
+  void ObjectSelector::updateWidgets(const int t_firstRow, const int t_lastRow)
+  {
+    for (const auto &obj : m_selectorObjects)
+    {
+      auto location = m_objectLocations.find(obj);
+      if (location != m_objectLocations.end()
+        && std::get<0>(location->second) >= t_firstRow
+        && std::get<0>(location->second) <= t_lastRow)
+      {
+        updateWidgets(obj);
+      }
+    }
+  }
+
   void ObjectSelector::updateWidgets(const model::ModelObject &t_obj, const bool t_objectVisible)
   {
     auto range = m_widgetMap.equal_range(boost::optional<model::ModelObject>(t_obj));
 
-    assert(range.first != range.second);
+    // Nothing to update if the row containing this object has not been built
+    if (range.first == range.second) {
+      return;
+    }
 
     // Find the row that contains this object
     auto row = std::make_tuple(range.first->second->row, range.first->second->subrow);
@@ -463,7 +516,10 @@ namespace openstudio {
   {
     auto range = m_widgetMap.equal_range(boost::optional<model::ModelObject>(t_obj));
 
-    assert(range.first != range.second);
+    // Nothing to update if the row containing this object has not been built
+    if (range.first == range.second) {
+      return;
+    }
 
     // Find the row that contains this object
     auto row = std::make_tuple(range.first->second->row, range.first->second->subrow);
@@ -1498,6 +1554,37 @@ namespace openstudio {
     return wrapper;
   }
 
+  void OSGridController::addRowObjects()
+  {
+    m_objectSelector->clearObjectLocations();
+
+    for (int row = m_hasHorizontalHeader ? 1 : 0; row < rowCount(); row++) {
+      model::ModelObject mo = modelObject(row);
+
+      for (const auto &baseConcept : m_baseConcepts) {
+        // Only selector objects need to be known before their widgets exist
+        if (QSharedPointer<DataSourceAdapter> dataSource = baseConcept.dynamicCast<DataSourceAdapter>()) {
+          if (!baseConcept->isSelector() && !dataSource->innerConcept()->isSelector()) {
+            continue;
+          }
+
+          // Sub rows are numbered the same way widgetAt numbers them
+          int subrow = 0;
+          for (auto &item : dataSource->source().items(mo))
+          {
+            if (item) {
+              m_objectSelector->addObject(item->cast<model::ModelObject>(), row, subrow, true);
+            }
+            ++subrow;
+          }
+        }
+        else if (baseConcept->isSelector()) {
+          m_objectSelector->addObject(mo, row, boost::none, true);
+        }
+      }
+    }
+  }
+
   void OSGridController::checkSelectedFields()
   {
     // If there is a header row, investigate which columns were previously checked 
@@ -43,6 +43,8 @@
 
 #include <string>
 #include <functional>
+#include <map>
+#include <tuple>
 #include <vector>
 
 #include <QObject>
@@ -207,6 +209,9 @@ class ObjectSelector : public QObject, public Nano::Observer
 
     void addWidget(const boost::optional<model::ModelObject> &t_obj, Holder *t_holder, int row, int column, 
         const boost::optional<int> &subrow, bool t_selector);
+    // record the row of an object without a widget, rows are built lazily by OSGridView
+    void addObject(const model::ModelObject &t_obj, int row, const boost::optional<int> &subrow, bool t_selector);
+    void clearObjectLocations();
     void setObjectSelection(const model::ModelObject &t_obj, bool t_selected);
     bool getObjectSelection(const model::ModelObject &t_obj) const;
     boost::optional<const model::ModelObject &> getObject(const int t_row, const int t_column, const boost::optional<int> &t_subrow);
@@ -221,6 +226,7 @@ class ObjectSelector : public QObject, public Nano::Observer
     void selectAll();
     void clearSelection();
     void updateWidgets();
+    void updateWidgets(const int t_firstRow, const int t_lastRow);
 
     std::set<model::ModelObject> m_selectedObjects;
     std::set<model::ModelObject> m_selectorObjects;
@@ -238,8 +244,15 @@ class ObjectSelector : public QObject, public Nano::Observer
     void updateWidgets(const int t_row, const boost::optional<int> &t_subrow, bool t_selected, bool t_visible);
     static std::function<bool (const model::ModelObject &)> getDefaultFilter();
 
+    typedef std::multimap<boost::optional<model::ModelObject>, WidgetLocation *> WidgetMap;
+    void eraseWidgetLocations(WidgetMap::iterator t_begin, WidgetMap::iterator t_end);
+
     OSGridController *m_grid;
-    std::multimap<boost::optional<model::ModelObject>, WidgetLocation *> m_widgetMap;
+    WidgetMap m_widgetMap;
+    // entries of m_widgetMap by holder, so the entries of a destroyed holder are found without a scan
+    std::multimap<QObject *, WidgetMap::iterator> m_widgetIndex;
+    // row and subrow of each object, kept when the widgets of a row are destroyed
+    std::map<model::ModelObject, std::tuple<int, boost::optional<int>>> m_objectLocations;
     std::function<bool (const model::ModelObject &)> m_objectFilter;
 };
 
@@ -579,6 +592,10 @@ public:
   // In that case a QWidget with sub rows (inner grid layout) will be returned.
   QWidget * widgetAt(int row, int column);
 
+  // Register the objects of every row with the object selector without creating any widgets,
+  // so that selection and filtering cover rows that OSGridView has not built yet.
+  void addRowObjects();
+
   // Call this function on a model update
   virtual void refreshModelObjects() = 0;
 
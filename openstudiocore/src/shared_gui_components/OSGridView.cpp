@@ -51,9 +51,13 @@
 #include <QLabel>
 #include <QPushButton>
 #include <QScrollArea>
+#include <QScrollBar>
 #include <QShowEvent>
 #include <QStackedWidget>
 
+#include <algorithm>
+#include <cstdlib>
+
 #ifdef Q_OS_MAC
   #define WIDTH  110
   #define HEIGHT 60
@@ -152,6 +156,9 @@ OSGridView::OSGridView(OSGridController * gridController,
   m_timer.setSingleShot(true);
   connect(&m_timer, &QTimer::timeout, this, &OSGridView::doRefresh);
 
+  m_visibleBlocksTimer.setSingleShot(true);
+  connect(&m_visibleBlocksTimer, &QTimer::timeout, this, &OSGridView::updateVisibleBlocks);
+
   if (this->isVisible()) {
     m_gridController->connectToModel();
     refreshAll();
@@ -204,10 +211,33 @@ void OSGridView::requestRemoveRow(int row)
 
 QLayoutItem * OSGridView::itemAtPosition(int row, int column)
 {
-  auto layoutnum = row / ROWS_PER_LAYOUT;
+  unsigned layoutnum = row / ROWS_PER_LAYOUT;
   auto relativerow = row % ROWS_PER_LAYOUT;
 
-  return m_gridLayouts.at(layoutnum)->itemAtPosition(relativerow, column);
+  if (layoutnum >= m_gridLayouts.size()) {
+    return nullptr;
+  }
+
+  // Blocks that have not been built have empty layouts
+  return m_gridLayouts[layoutnum]->itemAtPosition(relativerow, column);
+}
+
+void OSGridView::ensureRowBuilt(int row)
+{
+  if (row < 0) return;
+
+  buildBlock(row / ROWS_PER_LAYOUT);
+}
+
+int OSGridView::builtRowCount() const
+{
+  int result = 0;
+  for (unsigned i = 0; i < m_gridBlocks.size(); i++) {
+    if (m_blocksBuilt[i]) {
+      result += rowsInBlock(i);
+    }
+  }
+  return result;
 }
 
 //void OSGridView::removeWidget(int row, int column)
@@ -268,6 +298,8 @@ void OSGridView::deleteAll()
       delete child;
     }
   }
+
+  std::fill(m_blocksBuilt.begin(), m_blocksBuilt.end(), false);
 }
 
 //void OSGridView::refreshGrid()
@@ -371,15 +403,21 @@ void OSGridView::refreshAll()
   {
     m_gridController->refreshModelObjects();
 
-    for (int i = 0; i < m_gridController->rowCount(); i++)
-    {
-      for (int j = 0; j < m_gridController->columnCount(); j++)
-      {
-        addWidget(i, j);
-      }
-    }
+    // Selection and filtering need every row, the widgets are only built for the visible ones
+    m_gridController->addRowObjects();
+
+    resizeBlocks(m_gridController->rowCount());
+
+    // The first block holds the header and is always built
+    buildBlock(0);
 
-    this->m_gridController->getObjectSelector()->updateWidgets();
+    // Placeholder heights use the row height measured on the first block
+    resizeBlocks(m_gridController->rowCount());
+
+    updateVisibleBlocks();
+
+    // Geometry is not final until the layouts have been activated, check again afterwards
+    requestUpdateVisibleBlocks();
 
     QTimer::singleShot(0, this, SLOT(selectRowDeterminedByModelSubTabView()));
   }
@@ -408,6 +446,7 @@ void OSGridView::doRowSelect()
 {
   // If the index is valid, do some work
   if (m_gridController->m_oldIndex > -1){
+    ensureRowBuilt(m_gridController->m_oldIndex);
     m_gridController->selectRow(m_gridController->m_oldIndex, true);
   }
 }
@@ -427,16 +466,207 @@ void OSGridView::addWidget(QWidget *w, int row, int column)
   auto relativerow = row % ROWS_PER_LAYOUT;
 
   if (layoutindex >= m_gridLayouts.size())
+  {
+    resizeBlocks(row + 1);
+  }
+
+  m_gridLayouts[layoutindex]->addWidget(w, relativerow, column);
+}
+
+int OSGridView::rowsInBlock(unsigned blockIndex) const
+{
+  int rowCount = m_gridController ? m_gridController->rowCount() : 0;
+  int remaining = rowCount - static_cast<int>(blockIndex) * ROWS_PER_LAYOUT;
+
+  if (remaining <= 0) return 0;
+
+  return std::min(remaining, static_cast<int>(ROWS_PER_LAYOUT));
+}
+
+void OSGridView::resizeBlocks(int rowCount)
+{
+  unsigned numBlocks = rowCount > 0 ? (rowCount + ROWS_PER_LAYOUT - 1) / ROWS_PER_LAYOUT : 0;
+
+  while (m_gridBlocks.size() < numBlocks)
   {
     auto grid = makeGridLayout();
     OS_ASSERT(grid);
 
+    auto block = new QWidget();
+    block->setLayout(grid);
+
     m_gridLayouts.push_back(grid);
+    m_gridBlocks.push_back(block);
+    m_blocksBuilt.push_back(false);
     OS_ASSERT(m_contentLayout);
-    m_contentLayout->addLayout(grid);
+    m_contentLayout->addWidget(block);
   }
 
-  m_gridLayouts[layoutindex]->addWidget(w, relativerow, column);
+  while (m_gridBlocks.size() > numBlocks)
+  {
+    // deleting the block deletes its layout and any widgets in it
+    delete m_gridBlocks.back();
+
+    m_gridLayouts.pop_back();
+    m_gridBlocks.pop_back();
+    m_blocksBuilt.pop_back();
+  }
+
+  // Unbuilt blocks reserve their estimated height so the scroll bar covers every row
+  for (unsigned i = 0; i < m_gridBlocks.size(); i++) {
+    if (!m_blocksBuilt[i]) {
+      m_gridBlocks[i]->setMinimumHeight(rowsInBlock(i) * m_rowHeight);
+    }
+  }
+}
+
+void OSGridView::buildBlock(unsigned blockIndex)
+{
+  if (blockIndex >= m_gridBlocks.size() || m_blocksBuilt[blockIndex]) return;
+
+  OS_ASSERT(m_gridController);
+
+  int firstRow = blockIndex * ROWS_PER_LAYOUT;
+  int numRows = rowsInBlock(blockIndex);
+
+  for (int i = firstRow; i < firstRow + numRows; i++)
+  {
+    for (int j = 0; j < m_gridController->columnCount(); j++)
+    {
+      addWidget(i, j);
+    }
+  }
+
+  m_blocksBuilt[blockIndex] = true;
+
+  m_gridBlocks[blockIndex]->setMinimumHeight(0);
+
+  int height = m_gridLayouts[blockIndex]->sizeHint().height();
+  if (numRows > 0 && height > 0) {
+    m_rowHeight = std::max(1, height / numRows);
+  }
+
+  m_gridController->getObjectSelector()->updateWidgets(firstRow, firstRow + numRows - 1);
+}
+
+void OSGridView::unloadBlock(unsigned blockIndex)
+{
+  if (blockIndex >= m_gridBlocks.size() || !m_blocksBuilt[blockIndex]) return;
+
+  // Keep the current height so the content below does not move
+  int height = m_gridBlocks[blockIndex]->height();
+
+  QLayoutItem * child;
+  while ((child = m_gridLayouts[blockIndex]->takeAt(0)) != nullptr)
+  {
+    QWidget * widget = child->widget();
+
+    OS_ASSERT(widget);
+
+    // The object selector forgets the widget when it is destroyed
+    delete widget;
+
+    delete child;
+  }
+
+  m_blocksBuilt[blockIndex] = false;
+  m_gridBlocks[blockIndex]->setMinimumHeight(height);
+}
+
+void OSGridView::findScrollArea()
+{
+  if (m_scrollArea) return;
+
+  for (auto widget = parentWidget(); widget; widget = widget->parentWidget())
+  {
+    auto scrollArea = qobject_cast<QScrollArea *>(widget);
+    if (scrollArea && scrollArea->viewport()->isAncestorOf(this)) {
+      m_scrollArea = scrollArea;
+      break;
+    }
+  }
+
+  if (m_scrollArea) {
+    connect(m_scrollArea->verticalScrollBar(), &QScrollBar::valueChanged, this, &OSGridView::requestUpdateVisibleBlocks);
+    connect(m_scrollArea->verticalScrollBar(), &QScrollBar::rangeChanged, this, &OSGridView::requestUpdateVisibleBlocks);
+  }
+}
+
+void OSGridView::requestUpdateVisibleBlocks()
+{
+  m_visibleBlocksTimer.start();
+}
+
+void OSGridView::updateVisibleBlocks()
+{
+  if (m_gridBlocks.empty() || !m_gridController) return;
+
+  // The visible part of the grid in our coordinates
+  QRect visibleRect;
+  if (m_scrollArea) {
+    auto viewport = m_scrollArea->viewport();
+    visibleRect = QRect(mapFrom(viewport, QPoint(0, 0)), viewport->size());
+  }
+  else {
+    visibleRect = visibleRegion().boundingRect();
+  }
+
+  if (visibleRect.isEmpty()) return;
+
+  // Build one screen ahead in each direction so scrolling does not show empty rows
+  visibleRect.adjust(0, -visibleRect.height(), 0, visibleRect.height());
+
+  std::vector<bool> visible(m_gridBlocks.size(), false);
+  int firstVisible = -1;
+  int lastVisible = -1;
+
+  for (unsigned i = 0; i < m_gridBlocks.size(); i++)
+  {
+    auto block = m_gridBlocks[i];
+    QRect blockRect(block->mapTo(this, QPoint(0, 0)), block->size());
+    if (blockRect.intersects(visibleRect)) {
+      visible[i] = true;
+      if (firstVisible < 0) firstVisible = i;
+      lastVisible = i;
+    }
+  }
+
+  for (unsigned i = 0; i < m_gridBlocks.size(); i++)
+  {
+    if (visible[i]) {
+      buildBlock(i);
+    }
+  }
+
+  // Release the blocks furthest from the visible ones, never the header block or the one with focus
+  if (firstVisible < 0) return;
+
+  auto focusWidget = QApplication::focusWidget();
+  std::vector<unsigned> candidates;
+  unsigned numBuilt = 0;
+  for (unsigned i = 1; i < m_gridBlocks.size(); i++)
+  {
+    if (!m_blocksBuilt[i]) continue;
+
+    ++numBuilt;
+
+    if (!visible[i] && !(focusWidget && m_gridBlocks[i]->isAncestorOf(focusWidget))) {
+      candidates.push_back(i);
+    }
+  }
+
+  int center = (firstVisible + lastVisible) / 2;
+  std::sort(candidates.begin(), candidates.end(), [center](unsigned lhs, unsigned rhs) {
+    return std::abs(static_cast<int>(lhs) - center) > std::abs(static_cast<int>(rhs) - center);
+  });
+
+  for (auto i : candidates)
+  {
+    if (numBuilt <= MAX_BUILT_BLOCKS) break;
+
+    unloadBlock(i);
+    --numBuilt;
+  }
 }
 
 void OSGridView::selectCategory(int index)
@@ -485,6 +715,8 @@ void OSGridView::hideEvent(QHideEvent * event)
 
 void OSGridView::showEvent(QShowEvent * event)
 {
+  findScrollArea();
+
   m_gridController->connectToModel();
   refreshAll();
 
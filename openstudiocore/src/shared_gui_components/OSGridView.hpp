@@ -40,6 +40,7 @@ class QGridLayout;
 class QHideEvent;
 class QVBoxLayout;
 class QLabel;
+class QScrollArea;
 class QShowEvent;
 class QString;
 class QLayoutItem;
@@ -67,8 +68,15 @@ public:
   virtual ~OSGridView() {};
 
   // return the QLayoutItem at a particular partition, accounting for multiple grid layouts
+  // returns nullptr if the block containing row has not been built yet
   QLayoutItem * itemAtPosition(int row, int column);
 
+  // build the widgets for the block containing row if they do not exist yet
+  void ensureRowBuilt(int row);
+
+  // number of rows that currently have widgets
+  int builtRowCount() const;
+
   OSDropZone * m_dropZone;
 
   virtual ModelSubTabView * modelSubTabView();
@@ -115,6 +123,10 @@ private slots:
 
   void selectRowDeterminedByModelSubTabView();
 
+  void requestUpdateVisibleBlocks();
+
+  void updateVisibleBlocks();
+
 private:
 
   enum QueueType
@@ -134,10 +146,36 @@ private:
 
   void setGridController(OSGridController * gridController);
 
+  // Rows are grouped into blocks of ROWS_PER_LAYOUT, each with its own grid layout.
+  // Only blocks near the visible part of the enclosing scroll area have widgets,
+  // the others are empty placeholders with an estimated height.
+  void resizeBlocks(int rowCount);
+
+  void buildBlock(unsigned blockIndex);
+
+  void unloadBlock(unsigned blockIndex);
+
+  int rowsInBlock(unsigned blockIndex) const;
+
+  void findScrollArea();
+
   static const int ROWS_PER_LAYOUT = 100;
 
+  // maximum number of blocks that keep their widgets, not counting the first block
+  static const unsigned MAX_BUILT_BLOCKS = 5;
+
   std::vector<QGridLayout *> m_gridLayouts;
 
+  std::vector<QWidget *> m_gridBlocks;
+
+  std::vector<bool> m_blocksBuilt;
+
+  int m_rowHeight = 40;
+
+  QScrollArea * m_scrollArea = nullptr;
+
+  QTimer m_visibleBlocksTimer;
+
   OSCollapsibleView * m_CollapsibleView;
 
   OSGridController * m_gridController;
@@ -27,76 +27,179 @@
  **********************************************************************************************************************/
 
 #include "Checksum.hpp"
+#include "Filesystem.hpp"
 
-#include <ios>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <iomanip>
+#include <map>
+#include <mutex>
 #include <sstream>
-
-#include <boost/crc.hpp> 
-
+#include <vector>
 
 namespace openstudio {
 
   namespace detail {
 
-    bool checksumIgnore(char c) 
-    { 
-      // ignore all whitespace
-      //bool result = (c == ' ' || c == '\t' || c == '\n' ||  c == '\v' || c == '\f' || c == '\r');
+    // CRC-32 as computed by boost::crc_32_type, table driven eight bytes at a time
+    struct Crc32Tables
+    {
+      Crc32Tables()
+      {
+        for (std::uint32_t i = 0; i < 256; ++i) {
+          std::uint32_t crc = i;
+          for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320u : (crc >> 1);
+          }
+          table[0][i] = crc;
+        }
+        for (std::uint32_t i = 0; i < 256; ++i) {
+          for (int k = 1; k < 8; ++k) {
+            table[k][i] = (table[k-1][i] >> 8) ^ table[0][table[k-1][i] & 0xFF];
+          }
+        }
+      }
+
+      std::uint32_t table[8][256];
+    };
+
+    const Crc32Tables& crc32Tables()
+    {
+      static const Crc32Tables tables;
+      return tables;
+    }
+
+    std::uint32_t crc32Update(std::uint32_t crc, const unsigned char* p, size_t n)
+    {
+      const std::uint32_t (&t)[8][256] = crc32Tables().table;
+      while (n >= 8) {
+        std::uint32_t one = (static_cast<std::uint32_t>(p[0]) | (static_cast<std::uint32_t>(p[1]) << 8)
+          | (static_cast<std::uint32_t>(p[2]) << 16) | (static_cast<std::uint32_t>(p[3]) << 24)) ^ crc;
+        std::uint32_t two = static_cast<std::uint32_t>(p[4]) | (static_cast<std::uint32_t>(p[5]) << 8)
+          | (static_cast<std::uint32_t>(p[6]) << 16) | (static_cast<std::uint32_t>(p[7]) << 24);
+        crc = t[7][one & 0xFF] ^ t[6][(one >> 8) & 0xFF] ^ t[5][(one >> 16) & 0xFF] ^ t[4][one >> 24]
+          ^ t[3][two & 0xFF] ^ t[2][(two >> 8) & 0xFF] ^ t[1][(two >> 16) & 0xFF] ^ t[0][two >> 24];
+        p += 8;
+        n -= 8;
+      }
+      while (n--) {
+        crc = t[0][(crc ^ *p++) & 0xFF] ^ (crc >> 8);
+      }
+      return crc;
+    }
+
+    // Runs the CRC over the buffer, skipping carriage returns so that line endings do not change the checksum
+    std::uint32_t crc32UpdateIgnoringCR(std::uint32_t crc, const char* p, size_t n)
+    {
+      const char* end = p + n;
+      while (p != end) {
+        const char* cr = static_cast<const char*>(std::memchr(p, '\r', end - p));
+        const char* runEnd = cr ? cr : end;
+        crc = crc32Update(crc, reinterpret_cast<const unsigned char*>(p), runEnd - p);
+        p = cr ? cr + 1 : end;
+      }
+      return crc;
+    }
+
+    std::string crc32String(std::uint32_t crc)
+    {
+      std::stringstream ss;
+      ss << std::hex << std::uppercase << std::setw(8) << std::setfill('0') << (crc ^ 0xFFFFFFFFu);
+      return ss.str();
+    }
+
+    struct ChecksumCacheEntry
+    {
+      boost::uintmax_t size;
+      std::time_t lastWriteTime;
+      std::string checksum;
+    };
 
-      // ignore just line feed
-      bool result = (c == '\r');
+    struct ChecksumCache
+    {
+      std::mutex mutex;
+      std::map<std::string, ChecksumCacheEntry> entries;
+    };
 
-      return result;
+    ChecksumCache& checksumCache()
+    {
+      static ChecksumCache cache;
+      return cache;
     }
+
   }
 
   /// return 8 character hex checksum of string
   std::string checksum(const std::string& s)
   {
-    std::stringstream ss(s);
-    return checksum(ss);
+    return detail::crc32String(detail::crc32UpdateIgnoringCR(0xFFFFFFFFu, s.data(), s.size()));
   }
 
   /// return 8 character hex checksum of istream
   std::string checksum(std::istream& is)
   {
-    boost::crc_32_type  crc;
+    std::uint32_t crc = 0xFFFFFFFFu;
+    std::vector<char> buffer(64 * 1024);
     do{
-      const std::streamsize n = 1024;
-      char  buffer[n];
-      is.read(buffer, n);
-      std::streamsize readSize = is.gcount();
-      //crc.process_bytes(buffer, readSize);
-
-      size_t stringSize = static_cast<size_t>(readSize);
-      std::string str(buffer, stringSize);
-      str.erase( std::remove_if( str.begin(), str.end(), openstudio::detail::checksumIgnore ), str.end() );
-      stringSize = str.size();
-      
-      crc.process_bytes(str.c_str(), stringSize);
+      is.read(buffer.data(), buffer.size());
+      crc = detail::crc32UpdateIgnoringCR(crc, buffer.data(), static_cast<size_t>(is.gcount()));
     } while ( is );
-    
-    std::stringstream ss;
-    ss << std::hex << std::uppercase << crc.checksum();
-    std::string result = "00000000";
-    std::string checksum = ss.str();
-    result.replace(8-checksum.size(), checksum.size(), checksum);
 
-    return result;
+    return detail::crc32String(crc);
   }
 
   /// return 8 character hex checksum of file contents
   std::string checksum(const path& p)
   { 
     std::string result = "00000000";
+
+    boost::system::error_code ec;
+    boost::uintmax_t size = openstudio::filesystem::file_size(p, ec);
+    std::time_t lastWriteTime = ec ? 0 : openstudio::filesystem::last_write_time(p, ec);
+    std::string key;
+    if (!ec) {
+      key = toString(openstudio::filesystem::system_complete(p));
+      detail::ChecksumCache& cache = detail::checksumCache();
+      std::lock_guard<std::mutex> lock(cache.mutex);
+      auto it = cache.entries.find(key);
+      if ((it != cache.entries.end()) && (it->second.size == size) && (it->second.lastWriteTime == lastWriteTime)) {
+        return it->second.checksum;
+      }
+    }
+
+    // A file written in the last couple of seconds could be written again without its time changing
+    bool cacheable = !ec && (lastWriteTime + 2 < std::time(nullptr));
+
     try{
       openstudio::filesystem::ifstream  ifs(p, std::ios_base::binary );
       if ( ifs ){
         result = checksum(ifs);
+      } else {
+        cacheable = false;
       }
     }catch(...){
+      cacheable = false;
+    }
+
+    if (cacheable) {
+      detail::ChecksumCacheEntry entry;
+      entry.size = size;
+      entry.lastWriteTime = lastWriteTime;
+      entry.checksum = result;
+      detail::ChecksumCache& cache = detail::checksumCache();
+      std::lock_guard<std::mutex> lock(cache.mutex);
+      cache.entries[key] = entry;
     }
+
     return result;
   }
 
+  void clearChecksumCache()
+  {
+    detail::ChecksumCache& cache = detail::checksumCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.entries.clear();
+  }
+
 } // openstudio
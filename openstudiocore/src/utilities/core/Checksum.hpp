@@ -43,9 +43,13 @@ namespace openstudio {
   /// return 8 character hex checksum of istream
   UTILITIES_API std::string checksum(std::istream& is);
 
-  /// return 8 character hex checksum of file contents
+  /// return 8 character hex checksum of file contents, files that have not changed size or modification time since
+  /// they were last checked are not read again
   UTILITIES_API std::string checksum(const path& p);
 
+  /// forget the checksums remembered for files
+  UTILITIES_API void clearChecksumCache();
+
 } // openstudio
 
 
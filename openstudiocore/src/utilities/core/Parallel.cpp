@@ -0,0 +1,95 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2017, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+
+#include "Parallel.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <thread>
+
+namespace openstudio {
+
+  std::vector<IndexRange> threadRanges(std::size_t n, unsigned numThreads, std::size_t minPerThread)
+  {
+    std::vector<IndexRange> result;
+    if (n == 0) {
+      return result;
+    }
+
+    if (numThreads == 0) {
+      numThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    std::size_t numRanges = std::min<std::size_t>(numThreads, n / std::max<std::size_t>(minPerThread, 1));
+    if (numRanges < 2) {
+      result.push_back(IndexRange(0, n));
+      return result;
+    }
+
+    std::size_t rangeSize = (n + numRanges - 1) / numRanges;
+    for (std::size_t begin = 0; begin < n; begin += rangeSize) {
+      result.push_back(IndexRange(begin, std::min(begin + rangeSize, n)));
+    }
+    return result;
+  }
+
+  void runOnThreads(const std::vector<IndexRange>& ranges,
+                    const std::function<void(std::size_t, std::size_t, std::size_t)>& rangeFunction)
+  {
+    if (ranges.size() < 2) {
+      for (std::size_t k = 0; k < ranges.size(); ++k) {
+        rangeFunction(k, ranges[k].first, ranges[k].second);
+      }
+      return;
+    }
+
+    // an exception may not leave a thread, so each range keeps its own until all threads are joined
+    std::vector<std::exception_ptr> exceptions(ranges.size());
+    std::vector<std::thread> threads;
+    threads.reserve(ranges.size());
+    for (std::size_t k = 0; k < ranges.size(); ++k) {
+      threads.push_back(std::thread([&rangeFunction, &ranges, &exceptions, k]() {
+        try {
+          rangeFunction(k, ranges[k].first, ranges[k].second);
+        }
+        catch (...) {
+          exceptions[k] = std::current_exception();
+        }
+      }));
+    }
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+
+    for (const std::exception_ptr& exception : exceptions) {
+      if (exception) {
+        std::rethrow_exception(exception);
+      }
+    }
+  }
+
+} // openstudio
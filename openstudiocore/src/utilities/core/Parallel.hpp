@@ -0,0 +1,57 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2017, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+
+#ifndef UTILITIES_CORE_PARALLEL_HPP
+#define UTILITIES_CORE_PARALLEL_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace openstudio {
+
+  /// a contiguous range [first, second) of item indices
+  typedef std::pair<std::size_t, std::size_t> IndexRange;
+
+  /// split the items [0, n) into contiguous ranges, one per thread, using at most numThreads threads (0 for one
+  /// per core) and giving each thread at least minPerThread items; returns a single range if that leaves fewer
+  /// than two threads, and no ranges if n is 0
+  UTILITIES_API std::vector<IndexRange> threadRanges(std::size_t n, unsigned numThreads, std::size_t minPerThread = 1);
+
+  /// call rangeFunction(k, ranges[k].first, ranges[k].second) for each range, on its own thread if there is more
+  /// than one range and on the calling thread otherwise; waits for every range to finish, then rethrows the
+  /// exception thrown by the first failing range, if any
+  UTILITIES_API void runOnThreads(const std::vector<IndexRange>& ranges,
+                                  const std::function<void(std::size_t, std::size_t, std::size_t)>& rangeFunction);
+
+} // openstudio
+
+#endif // UTILITIES_CORE_PARALLEL_HPP
@@ -35,14 +35,279 @@
 #include <QFileSystemWatcher>
 #include <QTimer>
 
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
 namespace openstudio {
 
+namespace detail {
+
+  /// Watches the parent directories of PathWatcher files with a single inotify instance.  Events are read by one
+  /// thread shared by all watchers, each watcher named by a batch of events gets one checkFile queued on its own
+  /// thread.  A watcher is not queued again until that check has run, so bursts of writes are coalesced.
+  class PathWatcherDispatcher
+  {
+    public:
+
+      static PathWatcherDispatcher& instance()
+      {
+        static PathWatcherDispatcher dispatcher;
+        return dispatcher;
+      }
+
+      /// start watching the watcher's file, returns false if the file cannot be watched and must be polled
+      bool add(PathWatcher* watcher);
+
+      /// stop watching the watcher's file, the watcher will not be queued once this returns
+      void remove(PathWatcher* watcher);
+
+    private:
+
+      PathWatcherDispatcher();
+
+      ~PathWatcherDispatcher();
+
+      void run();
+
+      // queue checkFile on the watcher's thread unless a check is already queued
+      static void queueCheck(PathWatcher* watcher);
+
+      std::mutex m_mutex;
+
+#ifdef __linux__
+      // watchers by file name in one watched directory
+      typedef std::multimap<std::string, PathWatcher*> WatcherMap;
+
+      int m_fd;
+      int m_wakeFds[2];
+      std::map<int, WatcherMap> m_watches;
+      std::map<PathWatcher*, int> m_watchDescriptors;
+      std::thread m_thread;
+#endif
+  };
+
+#ifdef __linux__
+
+  namespace {
+    const uint32_t watchMask = IN_CLOSE_WRITE | IN_MODIFY | IN_ATTRIB | IN_CREATE | IN_DELETE | IN_MOVED_FROM |
+                               IN_MOVED_TO | IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR;
+  }
+
+  PathWatcherDispatcher::PathWatcherDispatcher()
+    : m_fd(inotify_init1(IN_NONBLOCK | IN_CLOEXEC))
+  {
+    m_wakeFds[0] = -1;
+    m_wakeFds[1] = -1;
+
+    if (m_fd < 0){
+      LOG_FREE(Warn, "openstudio.PathWatcher", "Cannot initialize inotify, files will be polled");
+      return;
+    }
+
+    if (pipe2(m_wakeFds, O_NONBLOCK | O_CLOEXEC) != 0){
+      LOG_FREE(Warn, "openstudio.PathWatcher", "Cannot create inotify wake pipe, files will be polled");
+      close(m_fd);
+      m_fd = -1;
+      return;
+    }
+
+    m_thread = std::thread(&PathWatcherDispatcher::run, this);
+  }
+
+  PathWatcherDispatcher::~PathWatcherDispatcher()
+  {
+    if (m_thread.joinable()){
+      char c = 0;
+      while ((write(m_wakeFds[1], &c, 1) < 0) && (errno == EINTR)){
+      }
+      m_thread.join();
+    }
+
+    if (m_fd >= 0){
+      close(m_wakeFds[0]);
+      close(m_wakeFds[1]);
+      close(m_fd);
+    }
+  }
+
+  bool PathWatcherDispatcher::add(PathWatcher* watcher)
+  {
+    if (m_fd < 0){
+      return false;
+    }
+
+    openstudio::path p = openstudio::filesystem::system_complete(watcher->m_path);
+    std::string directory = toString(p.parent_path());
+    std::string name = toString(p.filename());
+    if (directory.empty() || name.empty()){
+      return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // returns the existing descriptor if the directory is already watched
+    int wd = inotify_add_watch(m_fd, directory.c_str(), watchMask);
+    if (wd < 0){
+      LOG_FREE(Warn, "openstudio.PathWatcher", "Cannot watch directory '" << directory << "' with inotify, '"
+        << name << "' will be polled");
+      return false;
+    }
+
+    m_watches[wd].insert(std::make_pair(name, watcher));
+    m_watchDescriptors[watcher] = wd;
+    return true;
+  }
+
+  void PathWatcherDispatcher::remove(PathWatcher* watcher)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto wdIt = m_watchDescriptors.find(watcher);
+    if (wdIt == m_watchDescriptors.end()){
+      return;
+    }
+
+    auto watchIt = m_watches.find(wdIt->second);
+    if (watchIt != m_watches.end()){
+      WatcherMap& watchers = watchIt->second;
+      for (auto it = watchers.begin(); it != watchers.end(); ++it){
+        if (it->second == watcher){
+          watchers.erase(it);
+          break;
+        }
+      }
+      if (watchers.empty()){
+        inotify_rm_watch(m_fd, watchIt->first);
+        m_watches.erase(watchIt);
+      }
+    }
+
+    m_watchDescriptors.erase(wdIt);
+  }
+
+  void PathWatcherDispatcher::run()
+  {
+    // inotify_event records are aligned for reading in place
+    alignas(struct inotify_event) char buffer[64 * 1024];
+
+    while (true){
+      pollfd fds[2] = {{m_fd, POLLIN, 0}, {m_wakeFds[0], POLLIN, 0}};
+      if (poll(fds, 2, -1) < 0){
+        if (errno == EINTR){
+          continue;
+        }
+        LOG_FREE(Error, "openstudio.PathWatcher", "Polling inotify failed, watched files will not be checked");
+        return;
+      }
+
+      if (fds[1].revents != 0){
+        // stopping
+        return;
+      }
+
+      std::set<PathWatcher*> changed;
+      std::set<PathWatcher*> lost;
+
+      // hold the lock until checks are queued so that no watcher is destroyed in between
+      std::lock_guard<std::mutex> lock(m_mutex);
+
+      ssize_t n;
+      while ((n = read(m_fd, buffer, sizeof(buffer))) > 0){
+        for (char* p = buffer; p < buffer + n; ){
+          const struct inotify_event* event = reinterpret_cast<const struct inotify_event*>(p);
+          p += sizeof(struct inotify_event) + event->len;
+
+          if (event->mask & IN_Q_OVERFLOW){
+            // events were dropped, check everything
+            for (const auto& watchDescriptor : m_watchDescriptors){
+              changed.insert(watchDescriptor.first);
+            }
+            continue;
+          }
+
+          auto watchIt = m_watches.find(event->wd);
+          if (watchIt == m_watches.end()){
+            continue;
+          }
+
+          if (event->mask & (IN_IGNORED | IN_DELETE_SELF | IN_MOVE_SELF | IN_UNMOUNT)){
+            // the directory itself is gone, its watchers fall back to polling
+            for (const auto& named : watchIt->second){
+              lost.insert(named.second);
+              m_watchDescriptors.erase(named.second);
+            }
+            if (!(event->mask & IN_IGNORED)){
+              inotify_rm_watch(m_fd, watchIt->first);
+            }
+            m_watches.erase(watchIt);
+            continue;
+          }
+
+          if (event->len > 0){
+            auto range = watchIt->second.equal_range(std::string(event->name));
+            for (auto it = range.first; it != range.second; ++it){
+              changed.insert(it->second);
+            }
+          }
+        }
+      }
+
+      for (PathWatcher* watcher : lost){
+        changed.erase(watcher);
+        queueCheck(watcher);
+        QMetaObject::invokeMethod(watcher, "startPolling", Qt::QueuedConnection);
+      }
+
+      for (PathWatcher* watcher : changed){
+        queueCheck(watcher);
+      }
+    }
+  }
+
+  void PathWatcherDispatcher::queueCheck(PathWatcher* watcher)
+  {
+    if (!watcher->m_checkQueued.exchange(true)){
+      QMetaObject::invokeMethod(watcher, "checkFile", Qt::QueuedConnection);
+    }
+  }
+
+#else
+
+  PathWatcherDispatcher::PathWatcherDispatcher()
+  {}
+
+  PathWatcherDispatcher::~PathWatcherDispatcher()
+  {}
+
+  bool PathWatcherDispatcher::add(PathWatcher* watcher)
+  {
+    return false;
+  }
+
+  void PathWatcherDispatcher::remove(PathWatcher* watcher)
+  {}
+
+#endif
+
+} // detail
+
   /// constructor
   PathWatcher::PathWatcher(const openstudio::path& p, int msec)
     : m_impl(new QFileSystemWatcher()),
     m_enabled(true), m_isDirectory(openstudio::filesystem::is_directory(p) || toString(p.filename())=="." || toString(p.filename())=="/"), 
     m_exists(openstudio::filesystem::exists(p)), m_dirty(false),
-    m_checksum(openstudio::checksum(p)), m_path(p), m_msec(msec)
+    m_checksum(openstudio::checksum(p)), m_path(p), m_msec(msec),
+    m_watchedByDispatcher(false), m_checkQueued(false)
   {
     // make sure a QApplication exists
     openstudio::Application::instance().application(false);
@@ -58,9 +323,10 @@ namespace openstudio {
       m_impl->addPath(openstudio::toQString(p));
 
     }else{
-      m_timer = std::shared_ptr<QTimer>(new QTimer());
-      connect(m_timer.get(), &QTimer::timeout, this, &PathWatcher::checkFile);
-      m_timer->start(m_msec);
+      m_watchedByDispatcher = detail::PathWatcherDispatcher::instance().add(this);
+      if (!m_watchedByDispatcher){
+        startPolling();
+      }
 
       // DLM: do not use QFileSystemWatcher to watch individual files, was acting glitchy
       //connected = this->connect(m_impl.get(), SIGNAL(fileChanged(const QString&)), SLOT(fileChanged(const QString&)));
@@ -71,7 +337,11 @@ namespace openstudio {
   }
 
   PathWatcher::~PathWatcher()
-  {}
+  {
+    if (m_watchedByDispatcher){
+      detail::PathWatcherDispatcher::instance().remove(this);
+    }
+  }
 
   bool PathWatcher::enabled() const
   {
@@ -82,17 +352,33 @@ namespace openstudio {
   {
     m_enabled = true;
 
-    if (!m_timer->isActive()){
-      m_timer->start(m_msec);
+    if (m_timer){
+      if (!m_timer->isActive()){
+        m_timer->start(m_msec);
+      }
+    }else if (!m_isDirectory && !m_watchedByDispatcher){
+      m_watchedByDispatcher = detail::PathWatcherDispatcher::instance().add(this);
+      if (m_watchedByDispatcher){
+        // pick up any change made while disabled, as the first timer tick would
+        m_checkQueued = true;
+        QMetaObject::invokeMethod(this, "checkFile", Qt::QueuedConnection);
+      }else{
+        startPolling();
+      }
     }
   }
 
   bool PathWatcher::disable()
   {
-    if (m_timer->isActive()){
+    if (m_timer && m_timer->isActive()){
       m_timer->stop();
     }
 
+    if (m_watchedByDispatcher){
+      detail::PathWatcherDispatcher::instance().remove(this);
+      m_watchedByDispatcher = false;
+    }
+
     bool result = m_enabled;
     m_enabled = false;
     return result;
@@ -172,6 +458,9 @@ namespace openstudio {
 
   void PathWatcher::checkFile()
   {
+    m_checkQueued = false;
+
+    // checksum does not read the file again unless its size or modification time has changed
     bool exists = openstudio::filesystem::exists(m_path);
     std::string checksum = openstudio::checksum(m_path);
 
@@ -220,4 +509,21 @@ namespace openstudio {
     }
   }
 
+  void PathWatcher::startPolling()
+  {
+    if (m_watchedByDispatcher){
+      detail::PathWatcherDispatcher::instance().remove(this);
+      m_watchedByDispatcher = false;
+    }
+
+    if (!m_timer){
+      m_timer = std::shared_ptr<QTimer>(new QTimer());
+      connect(m_timer.get(), &QTimer::timeout, this, &PathWatcher::checkFile);
+    }
+
+    if (m_enabled && !m_timer->isActive()){
+      m_timer->start(m_msec);
+    }
+  }
+
 }
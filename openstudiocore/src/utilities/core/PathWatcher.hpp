@@ -35,12 +35,18 @@
 #include <QObject>
 #include <QString>
 
+#include <atomic>
+
 // forward declarations
 class QFileSystemWatcher;
 class QTimer;
 
 namespace openstudio {
 
+  namespace detail {
+    class PathWatcherDispatcher;
+  }
+
   /** Class for watching either a file or directory, QFileSystemWatcher has issues when watching 
    **  many files so it is not recommended to use too many of these objects.
    **/
@@ -54,8 +60,10 @@ namespace openstudio {
 
       /// if path is a directory it must exist at time of construction, no periodic checks are performed for directory
       /// if path is not a directory it is assumed to be a regular file which may or may not exist at construction, 
-      /// a timer is used to periodically check for changes to the file
+      /// on Linux the file's parent directory is watched with inotify by a thread shared by all watchers, 
+      /// otherwise or if that fails a timer is used to periodically check for changes to the file
       /// msec is the timer delay to check for updates to the file, msec does not apply if the path is a directory
+      /// or if the file is watched with inotify
       PathWatcher(const openstudio::path& p, int msec = 1000);
 
       /// virtual destructor
@@ -101,8 +109,15 @@ namespace openstudio {
       /// periodically check for changes
       void checkFile();
 
+    private slots:
+
+      /// fall back to periodically checking the file with a timer
+      void startPolling();
+
     private:
 
+      friend class detail::PathWatcherDispatcher;
+
       /// impl
       std::shared_ptr<QFileSystemWatcher> m_impl;
       std::shared_ptr<QTimer> m_timer;
@@ -115,6 +130,12 @@ namespace openstudio {
       openstudio::path m_path;
       int m_msec;
 
+      // true while the file is watched by the shared inotify thread
+      bool m_watchedByDispatcher;
+
+      // set by the inotify thread when a check has been queued, cleared when the check runs
+      std::atomic<bool> m_checkQueued;
+
   };
 
 } // openstudio
@@ -33,7 +33,6 @@
 
 #include <sstream>
 
-#include <boost/uuid/uuid_io.hpp>
 #include <boost/uuid/uuid_generators.hpp>
 #include <boost/thread/tss.hpp>
 
@@ -117,15 +116,70 @@ UUID UUID::random_generate()
   return UUID((*gen)());
 }
 
-UUID UUID::string_generate(const std::string &t_str)
-{
-  static boost::thread_specific_ptr<boost::uuids::string_generator> gen;
+namespace {
 
-  if (gen.get() == nullptr) {
-    gen.reset(new boost::uuids::string_generator);
+  // value of a hex digit, -1 if c is not one
+  int hexValue(char c)
+  {
+    if ((c >= '0') && (c <= '9')) { return c - '0'; }
+    if ((c >= 'a') && (c <= 'f')) { return c - 'a' + 10; }
+    if ((c >= 'A') && (c <= 'F')) { return c - 'A' + 10; }
+    return -1;
   }
 
-  return UUID((*gen)(t_str));
+  // parses the formats accepted by boost::uuids::string_generator, the 32 hex digits may be
+  // enclosed in braces and, if the ninth character is a dash, must be dashed like 8-4-4-4-12
+  bool parseUUID(const std::string& str, boost::uuids::uuid& result)
+  {
+    const char* it = str.data();
+    const char* end = it + str.size();
+    bool hasBraces = (it != end) && (*it == '{');
+    if (hasBraces) { ++it; }
+    bool hasDashes = false;
+    for (unsigned i = 0; i < 16; ++i) {
+      if ((i == 4) && (it != end) && (*it == '-')) {
+        hasDashes = true;
+      }
+      if (hasDashes && ((i == 4) || (i == 6) || (i == 8) || (i == 10))) {
+        if ((it == end) || (*it != '-')) { return false; }
+        ++it;
+      }
+      if ((end - it) < 2) { return false; }
+      int high = hexValue(it[0]);
+      int low = hexValue(it[1]);
+      if ((high < 0) || (low < 0)) { return false; }
+      result.data[i] = static_cast<boost::uuids::uuid::value_type>((high << 4) | low);
+      it += 2;
+    }
+    if (hasBraces) {
+      if ((it == end) || (*it != '}')) { return false; }
+      ++it;
+    }
+    return (it == end);
+  }
+
+  // writes the 36 character dashed form of uuid to out
+  void formatUUID(const boost::uuids::uuid& uuid, char* out)
+  {
+    static const char digits[] = "0123456789abcdef";
+    for (unsigned i = 0; i < 16; ++i) {
+      if ((i == 4) || (i == 6) || (i == 8) || (i == 10)) {
+        *out++ = '-';
+      }
+      *out++ = digits[uuid.data[i] >> 4];
+      *out++ = digits[uuid.data[i] & 0x0f];
+    }
+  }
+
+}
+
+UUID UUID::string_generate(const std::string &t_str)
+{
+  boost::uuids::uuid result;
+  if (!parseUUID(t_str, result)) {
+    return UUID();
+  }
+  return UUID(result);
 }
 
 
@@ -141,11 +195,7 @@ UUID toUUID(const QString &str)
   
 UUID toUUID(const std::string& str)
 {
-  try {
-    return UUID::string_generate(str);
-  } catch (...) {
-    return UUID();
-  }
+  return UUID::string_generate(str);
 }
 
 // Finds Version 4 uuid in a string including {}
@@ -172,11 +222,11 @@ bool operator> ( const UUID & lhs, const UUID & rhs ) {
 
 std::string toString(const UUID& uuid)
 {
-  std::stringstream ss;
-  ss << '{';
-  boost::uuids::operator<<(ss, uuid);
-  ss << '}';
-  return ss.str();
+  char result[38];
+  result[0] = '{';
+  formatUUID(uuid, result + 1);
+  result[37] = '}';
+  return std::string(result, sizeof(result));
 }
 
 QString toQString(const UUID& uuid)
@@ -195,9 +245,9 @@ std::string createUniqueName(const std::string& prefix) {
 }
 
 std::string removeBraces(const UUID& uuid) {
-  std::stringstream ss;
-  boost::uuids::operator<<(ss, uuid);
-  return ss.str();
+  char result[36];
+  formatUUID(uuid, result);
+  return std::string(result, sizeof(result));
 }
 
 std::ostream& operator<<(std::ostream& os,const UUID& uuid) {
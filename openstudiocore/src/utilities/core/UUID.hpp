@@ -35,6 +35,9 @@
 #include <QMetaType>
 #include <boost/optional.hpp>
 #include <boost/uuid/uuid.hpp>
+#include <cstdint>
+#include <cstring>
+#include <functional>
 #include <vector>
 #include <ostream>
 #include <string>
@@ -119,6 +122,30 @@ namespace openstudio {
 
 } // openstudio
 
+namespace std {
+
+  /// hash of a UUID for use in unordered containers, mixes both halves so that non-random UUIDs spread too
+  template <>
+  struct hash<openstudio::UUID>
+  {
+    std::size_t operator()(const openstudio::UUID& uuid) const {
+      std::uint64_t high;
+      std::uint64_t low;
+      std::memcpy(&high, &*uuid.begin(), sizeof(high));
+      std::memcpy(&low, &*uuid.begin() + sizeof(high), sizeof(low));
+      // MurmurHash3 finalizer
+      std::uint64_t result = high * 0x9e3779b97f4a7c15ULL + low;
+      result ^= (result >> 33);
+      result *= 0xff51afd7ed558ccdULL;
+      result ^= (result >> 33);
+      result *= 0xc4ceb9fe1a85ec53ULL;
+      result ^= (result >> 33);
+      return static_cast<std::size_t>(result);
+    }
+  };
+
+} // std
+
 Q_DECLARE_METATYPE(openstudio::UUID);
 
 
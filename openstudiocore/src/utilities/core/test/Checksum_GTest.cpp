@@ -31,9 +31,13 @@
 #include "../Checksum.hpp"
 #include "../UUID.hpp"
 #include "../Containers.hpp"
+#include "../Filesystem.hpp"
 
 #include <resources.hxx>
 
+#include <chrono>
+#include <ctime>
+
 using openstudio::path;
 using openstudio::toPath;
 using openstudio::checksum;
@@ -124,3 +128,111 @@ TEST(Checksum, UUIDs) {
     EXPECT_TRUE(std::find(itStart,itEnd,*it) == itEnd);
   }
 }
+
+TEST(Checksum, LongStreams)
+{
+  // cross the read buffer boundaries with carriage returns in various places
+  std::string withCR;
+  std::string withoutCR;
+  for (unsigned i = 0; i < 200000; ++i) {
+    std::string line = "Line " + std::to_string(i) + ", some text";
+    withCR += line + "\r\n";
+    withoutCR += line + "\n";
+  }
+  stringstream ss(withCR);
+  EXPECT_EQ(checksum(withoutCR), checksum(withCR));
+  EXPECT_EQ(checksum(withoutCR), checksum(ss));
+}
+
+TEST(Checksum, CachedPaths)
+{
+  path p = toPath("CachedChecksum.txt");
+  {
+    openstudio::filesystem::ofstream file(p, std::ios_base::binary);
+    file << "Hi there";
+  }
+  std::time_t past = std::time(nullptr) - 60;
+  openstudio::filesystem::last_write_time(p, past);
+  EXPECT_EQ("1AD514BA", checksum(p));
+
+  // same size and modification time, the remembered checksum is used
+  {
+    openstudio::filesystem::ofstream file(p, std::ios_base::binary);
+    file << "HI there";
+  }
+  openstudio::filesystem::last_write_time(p, past);
+  EXPECT_EQ("1AD514BA", checksum(p));
+
+  // a new modification time means the file is read again
+  openstudio::filesystem::last_write_time(p, past + 1);
+  EXPECT_EQ("D5682D26", checksum(p));
+
+  // as does a new size
+  {
+    openstudio::filesystem::ofstream file(p, std::ios_base::binary);
+    file << "Hithere";
+  }
+  openstudio::filesystem::last_write_time(p, past + 1);
+  EXPECT_EQ("597EA479", checksum(p));
+
+  // recently written files are not remembered
+  {
+    openstudio::filesystem::ofstream file(p, std::ios_base::binary);
+    file << "Hi there";
+  }
+  EXPECT_EQ("1AD514BA", checksum(p));
+  {
+    openstudio::filesystem::ofstream file(p, std::ios_base::binary);
+    file << "HI there";
+  }
+  EXPECT_EQ("D5682D26", checksum(p));
+
+  openstudio::clearChecksumCache();
+  openstudio::filesystem::remove(p);
+}
+
+TEST(Checksum, DISABLED_Checksum_Benchmark)
+{
+  // a measure library: 2000 measures with a script, a measure.xml and a few resources
+  path dir = toPath("ChecksumBenchmark");
+  openstudio::filesystem::remove_all(dir);
+  std::vector<path> files;
+  std::string script;
+  for (unsigned i = 0; i < 500; ++i) {
+    script += "    runner.registerInfo(\"Line " + std::to_string(i) + " of a typical measure script\")\r\n";
+  }
+  std::time_t past = std::time(nullptr) - 60;
+  for (unsigned i = 0; i < 2000; ++i) {
+    path measureDir = dir / toPath("measure_" + std::to_string(i));
+    openstudio::filesystem::create_directories(measureDir / toPath("resources"));
+    files.push_back(measureDir / toPath("measure.rb"));
+    files.push_back(measureDir / toPath("measure.xml"));
+    for (unsigned j = 0; j < 3; ++j) {
+      files.push_back(measureDir / toPath("resources") / toPath("resource_" + std::to_string(j) + ".rb"));
+    }
+  }
+  for (const path& file : files) {
+    {
+      openstudio::filesystem::ofstream ofs(file, std::ios_base::binary);
+      ofs << script;
+    }
+    openstudio::filesystem::last_write_time(file, past);
+  }
+
+  openstudio::clearChecksumCache();
+  auto start = std::chrono::steady_clock::now();
+  for (const path& file : files) {
+    checksum(file);
+  }
+  auto firstScan = std::chrono::steady_clock::now();
+  for (const path& file : files) {
+    checksum(file);
+  }
+  auto secondScan = std::chrono::steady_clock::now();
+
+  std::cout << "Checksum " << files.size() << " files of " << script.size() << " bytes: " << std::chrono::duration_cast<std::chrono::milliseconds>(firstScan - start).count() << " ms" << endl;
+  std::cout << "Checksum again unchanged: " << std::chrono::duration_cast<std::chrono::milliseconds>(secondScan - firstScan).count() << " ms" << endl;
+
+  openstudio::clearChecksumCache();
+  openstudio::filesystem::remove_all(dir);
+}
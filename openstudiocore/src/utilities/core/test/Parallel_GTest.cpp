@@ -0,0 +1,113 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2017, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "../Parallel.hpp"
+
+#include <stdexcept>
+
+using openstudio::IndexRange;
+using openstudio::threadRanges;
+using openstudio::runOnThreads;
+
+TEST(Parallel, ThreadRanges)
+{
+  EXPECT_TRUE(threadRanges(0, 4).empty());
+
+  // too few items to split
+  std::vector<IndexRange> ranges = threadRanges(10, 4, 8);
+  ASSERT_EQ(1u, ranges.size());
+  EXPECT_EQ(IndexRange(0, 10), ranges[0]);
+
+  ranges = threadRanges(10, 1);
+  ASSERT_EQ(1u, ranges.size());
+  EXPECT_EQ(IndexRange(0, 10), ranges[0]);
+
+  // contiguous ranges covering every item
+  ranges = threadRanges(10, 4);
+  ASSERT_EQ(4u, ranges.size());
+  EXPECT_EQ(IndexRange(0, 3), ranges[0]);
+  EXPECT_EQ(IndexRange(3, 6), ranges[1]);
+  EXPECT_EQ(IndexRange(6, 9), ranges[2]);
+  EXPECT_EQ(IndexRange(9, 10), ranges[3]);
+
+  ranges = threadRanges(100, 8, 30);
+  ASSERT_EQ(3u, ranges.size());
+  EXPECT_EQ(0u, ranges.front().first);
+  EXPECT_EQ(100u, ranges.back().second);
+
+  // one thread per core
+  ranges = threadRanges(1000, 0);
+  ASSERT_FALSE(ranges.empty());
+  EXPECT_EQ(0u, ranges.front().first);
+  EXPECT_EQ(1000u, ranges.back().second);
+}
+
+TEST(Parallel, RunOnThreads)
+{
+  std::vector<unsigned> values(1000, 0);
+  std::vector<IndexRange> ranges = threadRanges(values.size(), 4);
+  runOnThreads(ranges, [&values](std::size_t k, std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+      values[i] = static_cast<unsigned>(k + 1);
+    }
+  });
+  for (std::size_t k = 0; k < ranges.size(); ++k) {
+    for (std::size_t i = ranges[k].first; i < ranges[k].second; ++i) {
+      EXPECT_EQ(k + 1, values[i]);
+    }
+  }
+}
+
+TEST(Parallel, RunOnThreads_Exceptions)
+{
+  // the exception of the first failing range is rethrown after all ranges have run
+  std::vector<unsigned> done(4, 0);
+  std::vector<IndexRange> ranges = threadRanges(4, 4);
+  ASSERT_EQ(4u, ranges.size());
+  try {
+    runOnThreads(ranges, [&done](std::size_t k, std::size_t begin, std::size_t end) {
+      done[k] = 1;
+      if (k == 1) {
+        throw std::runtime_error("first");
+      }
+      if (k == 3) {
+        throw std::logic_error("second");
+      }
+    });
+    FAIL() << "Expected an exception";
+  }
+  catch (const std::runtime_error& e) {
+    EXPECT_EQ(std::string("first"), e.what());
+  }
+  EXPECT_EQ(std::vector<unsigned>(4, 1), done);
+
+  // a single range runs on the calling thread
+  EXPECT_THROW(runOnThreads(threadRanges(4, 1), [](std::size_t, std::size_t, std::size_t) { throw 1; }), int);
+}
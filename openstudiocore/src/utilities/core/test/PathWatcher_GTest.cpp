@@ -41,6 +41,7 @@
 
 #include <QThread>
 
+#include <ctime>
 #include <iostream>
 
 using std::ios_base;
@@ -205,3 +206,95 @@ TEST_F(CoreFixture, PathWatcher_Dir)
 
   EXPECT_TRUE(watcher.changed);
 }
+
+TEST_F(CoreFixture, PathWatcher_ManyFiles)
+{
+  Application::instance().application(false);
+
+  openstudio::path dir = toPath("./PathWatcher_ManyFiles");
+  openstudio::filesystem::remove_all(dir);
+  openstudio::filesystem::create_directories(dir);
+
+  std::vector<std::shared_ptr<TestPathWatcher> > watchers;
+  for (int i = 0; i < 20; ++i){
+    openstudio::path path = dir / toPath("file" + std::to_string(i));
+    TestFileWriter w(path, "test " + std::to_string(i)); w.start();
+    while (!w.isFinished()){
+      // do not call process events
+      QThread::yieldCurrentThread();
+    }
+    watchers.push_back(std::make_shared<TestPathWatcher>(path));
+  }
+
+  // calls processEvents
+  System::msleep(10);
+
+  for (const auto& watcher : watchers){
+    watcher->added = false;
+    watcher->changed = false;
+    watcher->removed = false;
+  }
+
+  // only the watcher for the written file is notified, however many times it is written
+  for (int i = 0; i < 10; ++i){
+    TestFileWriter w(watchers[7]->path(), "changed " + std::to_string(i)); w.start();
+    while (!w.isFinished()){
+      // do not call process events
+      QThread::yieldCurrentThread();
+    }
+  }
+
+  // calls processEvents
+  System::msleep(10);
+
+  for (unsigned i = 0; i < watchers.size(); ++i){
+    EXPECT_FALSE(watchers[i]->added);
+    EXPECT_EQ(i == 7, watchers[i]->changed);
+    EXPECT_FALSE(watchers[i]->removed);
+  }
+
+  // a disabled watcher picks up the change once enabled again
+  watchers[3]->disable();
+  TestFileWriter w(watchers[3]->path(), "changed while disabled"); w.start();
+  while (!w.isFinished()){
+    // do not call process events
+    QThread::yieldCurrentThread();
+  }
+  System::msleep(10);
+  EXPECT_FALSE(watchers[3]->changed);
+  watchers[3]->enable();
+  System::msleep(10);
+  EXPECT_TRUE(watchers[3]->changed);
+
+  watchers.clear();
+  openstudio::filesystem::remove_all(dir);
+}
+
+TEST_F(CoreFixture, DISABLED_PathWatcher_LargeFiles_Benchmark)
+{
+  Application::instance().application(false);
+
+  openstudio::path dir = toPath("./PathWatcher_LargeFiles");
+  openstudio::filesystem::remove_all(dir);
+  openstudio::filesystem::create_directories(dir);
+
+  const std::string contents(1024 * 1024, 'x');
+  std::vector<std::shared_ptr<openstudio::PathWatcher> > watchers;
+  for (int i = 0; i < 1000; ++i){
+    openstudio::path path = dir / toPath("file" + std::to_string(i) + ".osm");
+    openstudio::filesystem::ofstream outFile(path, ios_base::out | ios_base::trunc);
+    outFile << contents;
+    outFile.close();
+    watchers.push_back(std::make_shared<openstudio::PathWatcher>(path, 100));
+  }
+
+  // process cpu time used while the watched files are idle
+  std::clock_t start = std::clock();
+  System::msleep(5000);
+  double cpuMs = 1000.0 * (std::clock() - start) / CLOCKS_PER_SEC;
+
+  std::cout << "Watching 1000 files of 1 MB for 5 s used " << cpuMs << " ms of cpu" << std::endl;
+
+  watchers.clear();
+  openstudio::filesystem::remove_all(dir);
+}
@@ -31,8 +31,11 @@
 #include "../UUID.hpp"
 #include "../String.hpp"
 
+#include <iomanip>
 #include <iostream>
+#include <sstream>
 #include <set>
+#include <unordered_set>
 
 #include <QVariant>
 
@@ -104,3 +107,44 @@ TEST(UUID, UUID_UID) {
   EXPECT_EQ(uuid,toUUID(uuidStr));
   EXPECT_EQ(uuid,toUUID(uidStr)); // no extra conversion process
 }
+
+TEST(UUID, UUID_Formats) {
+  UUID uuid = toUUID(std::string("{01234567-89ab-cdef-0123-456789ABCDEF}"));
+  ASSERT_FALSE(uuid.isNull());
+  EXPECT_EQ("{01234567-89ab-cdef-0123-456789abcdef}", toString(uuid));
+  EXPECT_EQ("01234567-89ab-cdef-0123-456789abcdef", removeBraces(uuid));
+
+  EXPECT_EQ(uuid, toUUID(std::string("01234567-89AB-CDEF-0123-456789abcdef")));
+  EXPECT_EQ(uuid, toUUID(std::string("0123456789abcdef0123456789abcdef")));
+  EXPECT_EQ(uuid, toUUID(std::string("{0123456789abcdef0123456789abcdef}")));
+
+  EXPECT_TRUE(toUUID(std::string("")).isNull());
+  EXPECT_TRUE(toUUID(std::string("{01234567-89ab-cdef-0123-456789abcdef")).isNull());
+  EXPECT_TRUE(toUUID(std::string("01234567-89ab-cdef-0123-456789abcdef}")).isNull());
+  EXPECT_TRUE(toUUID(std::string("01234567-89abcdef-0123-456789abcdef")).isNull());
+  EXPECT_TRUE(toUUID(std::string("0123456789ab-cdef-0123-456789abcdef")).isNull());
+  EXPECT_TRUE(toUUID(std::string("01234567-89ab-cdef-0123-456789abcdeg")).isNull());
+  EXPECT_TRUE(toUUID(std::string("01234567-89ab-cdef-0123-456789abcdef0")).isNull());
+}
+
+TEST(UUID, UUID_Hash) {
+  unsigned numUUIDS = 1000;
+  std::unordered_set<UUID> uuids;
+  for (unsigned i = 0; i < numUUIDS; ++i) {
+    UUID uuid = createUUID();
+    uuids.insert(uuid);
+    EXPECT_EQ(std::hash<UUID>()(uuid), std::hash<UUID>()(toUUID(toString(uuid))));
+  }
+  EXPECT_EQ(numUUIDS, uuids.size());
+
+  // sequential, non-random UUIDs still spread over the buckets
+  std::set<std::size_t> hashes;
+  for (unsigned i = 0; i < numUUIDS; ++i) {
+    std::stringstream ss;
+    ss << "{00000000-0000-0000-0000-" << std::setw(12) << std::setfill('0') << i << "}";
+    UUID uuid = toUUID(ss.str());
+    ASSERT_FALSE(uuid.isNull());
+    hashes.insert(std::hash<UUID>()(uuid) % 1024);
+  }
+  EXPECT_LT(500u, hashes.size());
+}
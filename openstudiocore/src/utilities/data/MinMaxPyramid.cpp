@@ -0,0 +1,167 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2017, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+
+
+#include "MinMaxPyramid.hpp"
+
+#include "../core/Assert.hpp"
+
+#include <algorithm>
+
+namespace openstudio {
+
+MinMaxPyramid::MinMaxPyramid(const std::vector<double>& x, const std::vector<double>& y)
+  : m_x(x), m_y(y)
+{
+  OS_ASSERT(m_x.size() == m_y.size());
+
+  size_t blockSize = 2;
+  while (blockSize <= m_y.size()) {
+    std::vector<Block> level(m_y.size() / blockSize);
+    for (size_t i = 0; i < level.size(); ++i) {
+      Block block;
+      if (m_levels.empty()) {
+        unsigned first = static_cast<unsigned>(2 * i);
+        unsigned second = first + 1;
+        block.minIndex = m_y[second] < m_y[first] ? second : first;
+        block.maxIndex = m_y[second] > m_y[first] ? second : first;
+      } else {
+        const Block& first = m_levels.back()[2 * i];
+        const Block& second = m_levels.back()[2 * i + 1];
+        block.minIndex = m_y[second.minIndex] < m_y[first.minIndex] ? second.minIndex : first.minIndex;
+        block.maxIndex = m_y[second.maxIndex] > m_y[first.maxIndex] ? second.maxIndex : first.maxIndex;
+      }
+      level[i] = block;
+    }
+    m_levels.push_back(level);
+    blockSize *= 2;
+  }
+}
+
+size_t MinMaxPyramid::size() const
+{
+  return m_y.size();
+}
+
+size_t MinMaxPyramid::lowerBound(double x) const
+{
+  return std::lower_bound(m_x.begin(), m_x.end(), x) - m_x.begin();
+}
+
+std::pair<size_t, size_t> MinMaxPyramid::minMaxIndices(size_t begin, size_t end) const
+{
+  OS_ASSERT(begin < end);
+  OS_ASSERT(end <= m_y.size());
+
+  size_t minIndex = begin;
+  size_t maxIndex = begin;
+
+  // take the largest aligned block that starts at begin and fits in the range
+  while (begin < end) {
+    size_t level = 0;
+    while (level < m_levels.size()) {
+      size_t blockSize = size_t(2) << level;
+      if (begin % blockSize != 0 || begin + blockSize > end) {
+        break;
+      }
+      ++level;
+    }
+
+    size_t blockSize = size_t(1) << level;
+    size_t blockMin = begin;
+    size_t blockMax = begin;
+    if (level > 0) {
+      const Block& block = m_levels[level - 1][begin / blockSize];
+      blockMin = block.minIndex;
+      blockMax = block.maxIndex;
+    }
+
+    if (m_y[blockMin] < m_y[minIndex]) {
+      minIndex = blockMin;
+    }
+    if (m_y[blockMax] > m_y[maxIndex]) {
+      maxIndex = blockMax;
+    }
+
+    begin += blockSize;
+  }
+
+  return std::make_pair(minIndex, maxIndex);
+}
+
+void MinMaxPyramid::addPoint(size_t i, std::vector<double>& x, std::vector<double>& y) const
+{
+  x.push_back(m_x[i]);
+  y.push_back(m_y[i]);
+}
+
+void MinMaxPyramid::envelope(double xMin, double xMax, unsigned numColumns, std::vector<double>& x, std::vector<double>& y) const
+{
+  x.clear();
+  y.clear();
+
+  if (m_y.empty() || numColumns == 0 || !(xMin < xMax)) {
+    return;
+  }
+
+  size_t begin = lowerBound(xMin);
+  size_t end = std::upper_bound(m_x.begin(), m_x.end(), xMax) - m_x.begin();
+
+  if (begin > 0) {
+    addPoint(begin - 1, x, y);
+  }
+
+  if (end - begin <= 2 * static_cast<size_t>(numColumns)) {
+    for (size_t i = begin; i < end; ++i) {
+      addPoint(i, x, y);
+    }
+  } else {
+    double columnWidth = (xMax - xMin) / numColumns;
+    size_t columnBegin = begin;
+    for (unsigned column = 0; column < numColumns && columnBegin < end; ++column) {
+      size_t columnEnd = (column + 1 == numColumns) ? end : std::max(columnBegin, lowerBound(xMin + (column + 1) * columnWidth));
+      columnEnd = std::min(columnEnd, end);
+      if (columnEnd > columnBegin) {
+        std::pair<size_t, size_t> indices = minMaxIndices(columnBegin, columnEnd);
+        size_t first = std::min(indices.first, indices.second);
+        size_t second = std::max(indices.first, indices.second);
+        addPoint(first, x, y);
+        if (second != first) {
+          addPoint(second, x, y);
+        }
+      }
+      columnBegin = columnEnd;
+    }
+  }
+
+  if (end < m_y.size()) {
+    addPoint(end, x, y);
+  }
+}
+
+} // openstudio
@@ -0,0 +1,84 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2017, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+
+
+#ifndef UTILITIES_DATA_MINMAXPYRAMID_HPP
+#define UTILITIES_DATA_MINMAXPYRAMID_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace openstudio {
+
+/** MinMaxPyramid reduces a long series of (x, y) points to what can be seen at a given resolution.
+ *  It is built once per series and stores the minimum and maximum of every aligned block of
+ *  2^k samples, so the extremes of any index range are found in O(log n). x values must be
+ *  sorted in ascending order, as they are for a TimeSeries. */
+class UTILITIES_API MinMaxPyramid
+{
+public:
+
+  MinMaxPyramid(const std::vector<double>& x, const std::vector<double>& y);
+
+  /// number of points in the series
+  size_t size() const;
+
+  /// index of the first point with x >= value
+  size_t lowerBound(double x) const;
+
+  /// indices of the minimum and maximum y in [begin, end), end must be greater than begin
+  std::pair<size_t, size_t> minMaxIndices(size_t begin, size_t end) const;
+
+  /** Points to draw [xMin, xMax] split into numColumns equal columns. Each column contributes its
+   *  minimum and maximum point, in series order, so the envelope of every column is preserved.
+   *  The nearest points outside the range are included so lines continue to the edges.
+   *  Returns all points in the range if there are no more than two per column. */
+  void envelope(double xMin, double xMax, unsigned numColumns, std::vector<double>& x, std::vector<double>& y) const;
+
+private:
+
+  struct Block {
+    unsigned minIndex;
+    unsigned maxIndex;
+  };
+
+  void addPoint(size_t i, std::vector<double>& x, std::vector<double>& y) const;
+
+  std::vector<double> m_x;
+  std::vector<double> m_y;
+
+  // m_levels[k] holds the blocks of 2^(k+1) samples, level 0 being the samples themselves
+  std::vector<std::vector<Block> > m_levels;
+};
+
+} // openstudio
+
+#endif // UTILITIES_DATA_MINMAXPYRAMID_HPP
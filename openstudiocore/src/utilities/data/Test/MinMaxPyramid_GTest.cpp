@@ -0,0 +1,158 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2017, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+
+
+#include <gtest/gtest.h>
+#include "DataFixture.hpp"
+
+#include "../MinMaxPyramid.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+
+using namespace openstudio;
+
+namespace {
+
+  // one year of one minute data in fractional days
+  void minuteSeries(std::vector<double>& x, std::vector<double>& y)
+  {
+    std::mt19937 generator(42);
+    std::normal_distribution<double> noise(0.0, 5.0);
+
+    const unsigned n = 525600;
+    x.resize(n);
+    y.resize(n);
+    for (unsigned i = 0; i < n; ++i) {
+      x[i] = 1.0 + i / 1440.0;
+      y[i] = 20.0 + 10.0 * std::sin(x[i] * 2.0 * 3.14159265) + noise(generator);
+    }
+    y[123456] = 1000.0;
+    y[400000] = -1000.0;
+  }
+
+}
+
+TEST_F(DataFixture, MinMaxPyramid_MinMaxIndices)
+{
+  std::vector<double> x, y;
+  minuteSeries(x, y);
+  MinMaxPyramid pyramid(x, y);
+  ASSERT_EQ(x.size(), pyramid.size());
+
+  std::mt19937 generator(7);
+  std::uniform_int_distribution<size_t> index(0, x.size() - 1);
+  for (unsigned test = 0; test < 200; ++test) {
+    size_t begin = index(generator);
+    size_t end = std::min(x.size(), begin + 1 + index(generator) % 5000);
+
+    auto indices = pyramid.minMaxIndices(begin, end);
+    EXPECT_EQ(*std::min_element(y.begin() + begin, y.begin() + end), y[indices.first]);
+    EXPECT_EQ(*std::max_element(y.begin() + begin, y.begin() + end), y[indices.second]);
+  }
+
+  auto indices = pyramid.minMaxIndices(0, x.size());
+  EXPECT_EQ(400000u, indices.first);
+  EXPECT_EQ(123456u, indices.second);
+}
+
+TEST_F(DataFixture, MinMaxPyramid_Envelope)
+{
+  std::vector<double> x, y;
+  minuteSeries(x, y);
+  MinMaxPyramid pyramid(x, y);
+
+  const unsigned numColumns = 800;
+  const double xMin = 10.25;
+  const double xMax = 300.5;
+  std::vector<double> ex, ey;
+  pyramid.envelope(xMin, xMax, numColumns, ex, ey);
+
+  ASSERT_EQ(ex.size(), ey.size());
+  EXPECT_LE(ex.size(), 2u * numColumns + 2u);
+  EXPECT_TRUE(std::is_sorted(ex.begin(), ex.end()));
+
+  // the points falling in each column have the same extremes as the full series in that column
+  const double columnWidth = (xMax - xMin) / numColumns;
+  for (unsigned column = 0; column < numColumns; ++column) {
+    double left = xMin + column * columnWidth;
+    double right = (column + 1 == numColumns) ? xMax : xMin + (column + 1) * columnWidth;
+    auto inColumn = [&](double value) { return value >= left && (column + 1 == numColumns ? value <= right : value < right); };
+
+    double expectedMin = 1e300, expectedMax = -1e300;
+    for (size_t i = pyramid.lowerBound(left); i < x.size() && inColumn(x[i]); ++i) {
+      expectedMin = std::min(expectedMin, y[i]);
+      expectedMax = std::max(expectedMax, y[i]);
+    }
+
+    double min = 1e300, max = -1e300;
+    for (size_t i = 0; i < ex.size(); ++i) {
+      if (inColumn(ex[i])) {
+        min = std::min(min, ey[i]);
+        max = std::max(max, ey[i]);
+      }
+    }
+
+    EXPECT_EQ(expectedMin, min) << "column " << column;
+    EXPECT_EQ(expectedMax, max) << "column " << column;
+  }
+
+  // neighbors outside the range keep the line going to the edges
+  EXPECT_LT(ex.front(), xMin);
+  EXPECT_GT(ex.back(), xMax);
+
+  // zoomed in far enough, every point is returned
+  pyramid.envelope(100.0, 100.1, numColumns, ex, ey);
+  size_t numInRange = std::upper_bound(x.begin(), x.end(), 100.1) - x.begin() - pyramid.lowerBound(100.0);
+  EXPECT_EQ(numInRange + 2, ex.size());
+}
+
+TEST_F(DataFixture, DISABLED_MinMaxPyramid_Benchmark)
+{
+  std::vector<double> x, y;
+  minuteSeries(x, y);
+
+  auto start = std::chrono::steady_clock::now();
+  MinMaxPyramid pyramid(x, y);
+  auto built = std::chrono::steady_clock::now();
+
+  // a full redraw at a typical plot width, then a zoom sweep
+  std::vector<double> ex, ey;
+  const unsigned numRedraws = 100;
+  for (unsigned i = 0; i < numRedraws; ++i) {
+    double span = 365.0 / (1 + i);
+    pyramid.envelope(1.0, 1.0 + span, 1200, ex, ey);
+  }
+  auto drawn = std::chrono::steady_clock::now();
+
+  std::cout << "Build pyramid for " << x.size() << " points: " << std::chrono::duration_cast<std::chrono::microseconds>(built - start).count() << " us" << std::endl;
+  std::cout << "Envelope at 1200 columns: " << std::chrono::duration_cast<std::chrono::microseconds>(drawn - built).count() / numRedraws << " us per redraw" << std::endl;
+}
@@ -0,0 +1,282 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2017, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+
+#include "EpwCache.hpp"
+#include "../core/Checksum.hpp"
+#include "../core/PathHelpers.hpp"
+#include "../core/FilesystemHelpers.hpp"
+
+#include <cstdlib>
+#include <fstream>
+#include <list>
+#include <mutex>
+
+namespace openstudio{
+
+namespace detail {
+
+  struct EpwCacheEntry
+  {
+    std::string path;
+    std::string checksum;
+    std::shared_ptr<const EpwWeatherData> weatherData;
+  };
+
+  struct EpwCacheState
+  {
+    EpwCacheState()
+      : capacity(8), hits(0), misses(0)
+    {}
+
+    std::mutex mutex;
+    // Most recently used first
+    std::list<EpwCacheEntry> entries;
+    unsigned capacity;
+    unsigned hits;
+    unsigned misses;
+  };
+
+  EpwCacheState& epwCacheState()
+  {
+    static EpwCacheState state;
+    return state;
+  }
+
+}
+
+EpwWeatherData::EpwWeatherData(const EpwFile& header, std::vector<EpwDataPoint>&& dataPoints)
+  : m_header(header), m_dataPoints(std::move(dataPoints)),
+    m_columns(EpwDataField::LiquidPrecipitationQuantity + 1, std::vector<double>(m_dataPoints.size(), 0.0))
+{
+  typedef std::pair<EpwDataField::domain, int EpwDataPoint::*> IntField;
+  typedef std::pair<EpwDataField::domain, std::string EpwDataPoint::*> StringField;
+  const IntField intFields[] = {
+    IntField(EpwDataField::Year, &EpwDataPoint::m_year),
+    IntField(EpwDataField::Month, &EpwDataPoint::m_month),
+    IntField(EpwDataField::Day, &EpwDataPoint::m_day),
+    IntField(EpwDataField::Hour, &EpwDataPoint::m_hour),
+    IntField(EpwDataField::Minute, &EpwDataPoint::m_minute),
+    IntField(EpwDataField::TotalSkyCover, &EpwDataPoint::m_totalSkyCover),
+    IntField(EpwDataField::OpaqueSkyCover, &EpwDataPoint::m_opaqueSkyCover),
+    IntField(EpwDataField::PresentWeatherObservation, &EpwDataPoint::m_presentWeatherObservation),
+    IntField(EpwDataField::PresentWeatherCodes, &EpwDataPoint::m_presentWeatherCodes)};
+  const StringField stringFields[] = {
+    StringField(EpwDataField::DryBulbTemperature, &EpwDataPoint::m_dryBulbTemperature),
+    StringField(EpwDataField::DewPointTemperature, &EpwDataPoint::m_dewPointTemperature),
+    StringField(EpwDataField::RelativeHumidity, &EpwDataPoint::m_relativeHumidity),
+    StringField(EpwDataField::AtmosphericStationPressure, &EpwDataPoint::m_atmosphericStationPressure),
+    StringField(EpwDataField::ExtraterrestrialHorizontalRadiation, &EpwDataPoint::m_extraterrestrialHorizontalRadiation),
+    StringField(EpwDataField::ExtraterrestrialDirectNormalRadiation, &EpwDataPoint::m_extraterrestrialDirectNormalRadiation),
+    StringField(EpwDataField::HorizontalInfraredRadiationIntensity, &EpwDataPoint::m_horizontalInfraredRadiationIntensity),
+    StringField(EpwDataField::GlobalHorizontalRadiation, &EpwDataPoint::m_globalHorizontalRadiation),
+    StringField(EpwDataField::DirectNormalRadiation, &EpwDataPoint::m_directNormalRadiation),
+    StringField(EpwDataField::DiffuseHorizontalRadiation, &EpwDataPoint::m_diffuseHorizontalRadiation),
+    StringField(EpwDataField::GlobalHorizontalIlluminance, &EpwDataPoint::m_globalHorizontalIlluminance),
+    StringField(EpwDataField::DirectNormalIlluminance, &EpwDataPoint::m_directNormalIlluminance),
+    StringField(EpwDataField::DiffuseHorizontalIlluminance, &EpwDataPoint::m_diffuseHorizontalIlluminance),
+    StringField(EpwDataField::ZenithLuminance, &EpwDataPoint::m_zenithLuminance),
+    StringField(EpwDataField::WindDirection, &EpwDataPoint::m_windDirection),
+    StringField(EpwDataField::WindSpeed, &EpwDataPoint::m_windSpeed),
+    StringField(EpwDataField::Visibility, &EpwDataPoint::m_visibility),
+    StringField(EpwDataField::CeilingHeight, &EpwDataPoint::m_ceilingHeight),
+    StringField(EpwDataField::PrecipitableWater, &EpwDataPoint::m_precipitableWater),
+    StringField(EpwDataField::AerosolOpticalDepth, &EpwDataPoint::m_aerosolOpticalDepth),
+    StringField(EpwDataField::SnowDepth, &EpwDataPoint::m_snowDepth),
+    StringField(EpwDataField::DaysSinceLastSnowfall, &EpwDataPoint::m_daysSinceLastSnowfall),
+    StringField(EpwDataField::Albedo, &EpwDataPoint::m_albedo),
+    StringField(EpwDataField::LiquidPrecipitationDepth, &EpwDataPoint::m_liquidPrecipitationDepth),
+    StringField(EpwDataField::LiquidPrecipitationQuantity, &EpwDataPoint::m_liquidPrecipitationQuantity)};
+
+  // Fill one column at a time straight from the stored fields, the data source flags stay zero
+  for (const IntField& field : intFields) {
+    std::vector<double>& column = m_columns[field.first];
+    for (unsigned row = 0; row < m_dataPoints.size(); ++row) {
+      column[row] = m_dataPoints[row].*field.second;
+    }
+  }
+  for (const StringField& field : stringFields) {
+    std::vector<double>& column = m_columns[field.first];
+    for (unsigned row = 0; row < m_dataPoints.size(); ++row) {
+      column[row] = std::strtod((m_dataPoints[row].*field.second).c_str(), nullptr);
+    }
+  }
+}
+
+const EpwFile& EpwWeatherData::header() const
+{
+  return m_header;
+}
+
+const std::vector<EpwDataPoint>& EpwWeatherData::dataPoints() const
+{
+  return m_dataPoints;
+}
+
+unsigned EpwWeatherData::numberOfRecords() const
+{
+  return m_dataPoints.size();
+}
+
+const std::vector<double>& EpwWeatherData::column(EpwDataField field) const
+{
+  return m_columns.at(field.value());
+}
+
+std::shared_ptr<const EpwWeatherData> EpwCache::get(const openstudio::path& p)
+{
+  if (!openstudio::filesystem::exists(p) || !openstudio::filesystem::is_regular_file(p)){
+    return std::shared_ptr<const EpwWeatherData>();
+  }
+
+  std::string key = toString(completeAndNormalize(p));
+  std::string checksum = openstudio::checksum(p);
+
+  detail::EpwCacheState& state = detail::epwCacheState();
+  {
+    std::lock_guard<std::mutex> lock(state.mutex);
+    for (auto it = state.entries.begin(); it != state.entries.end(); ++it) {
+      if ((it->path == key) && (it->checksum == checksum)) {
+        ++state.hits;
+        state.entries.splice(state.entries.begin(), state.entries, it);
+        return it->weatherData;
+      }
+    }
+    ++state.misses;
+  }
+
+  // Parse without holding the lock so other files can be served meanwhile
+  EpwFile file;
+  file.m_path = p;
+  file.m_checksum = checksum;
+  std::ifstream ifs(openstudio::toString(p));
+  if (!file.parse(ifs, true)) {
+    return std::shared_ptr<const EpwWeatherData>();
+  }
+  ifs.close();
+  std::vector<EpwDataPoint> dataPoints;
+  dataPoints.swap(file.m_data);
+  std::shared_ptr<const EpwWeatherData> weatherData = std::make_shared<const EpwWeatherData>(file, std::move(dataPoints));
+
+  std::lock_guard<std::mutex> lock(state.mutex);
+  for (auto it = state.entries.begin(); it != state.entries.end();) {
+    if (it->path == key) {
+      if (it->checksum == checksum) {
+        // Another thread got here first, share its copy
+        return it->weatherData;
+      }
+      it = state.entries.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  detail::EpwCacheEntry entry;
+  entry.path = key;
+  entry.checksum = checksum;
+  entry.weatherData = weatherData;
+  state.entries.push_front(entry);
+  while (state.entries.size() > state.capacity) {
+    state.entries.pop_back();
+  }
+  return weatherData;
+}
+
+std::shared_ptr<const EpwWeatherData> EpwCache::find(const openstudio::path& p)
+{
+  if (!openstudio::filesystem::exists(p) || !openstudio::filesystem::is_regular_file(p)){
+    return std::shared_ptr<const EpwWeatherData>();
+  }
+
+  std::string key = toString(completeAndNormalize(p));
+  std::string checksum = openstudio::checksum(p);
+
+  detail::EpwCacheState& state = detail::epwCacheState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  for (auto it = state.entries.begin(); it != state.entries.end(); ++it) {
+    if ((it->path == key) && (it->checksum == checksum)) {
+      ++state.hits;
+      state.entries.splice(state.entries.begin(), state.entries, it);
+      return it->weatherData;
+    }
+  }
+  return std::shared_ptr<const EpwWeatherData>();
+}
+
+unsigned EpwCache::capacity()
+{
+  detail::EpwCacheState& state = detail::epwCacheState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  return state.capacity;
+}
+
+void EpwCache::setCapacity(unsigned capacity)
+{
+  detail::EpwCacheState& state = detail::epwCacheState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.capacity = capacity;
+  while (state.entries.size() > state.capacity) {
+    state.entries.pop_back();
+  }
+}
+
+unsigned EpwCache::size()
+{
+  detail::EpwCacheState& state = detail::epwCacheState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  return state.entries.size();
+}
+
+void EpwCache::clear()
+{
+  detail::EpwCacheState& state = detail::epwCacheState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.entries.clear();
+}
+
+unsigned EpwCache::hits()
+{
+  detail::EpwCacheState& state = detail::epwCacheState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  return state.hits;
+}
+
+unsigned EpwCache::misses()
+{
+  detail::EpwCacheState& state = detail::epwCacheState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  return state.misses;
+}
+
+void EpwCache::resetCounts()
+{
+  detail::EpwCacheState& state = detail::epwCacheState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.hits = 0;
+  state.misses = 0;
+}
+
+} // openstudio
@@ -0,0 +1,112 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2017, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+
+#ifndef UTILITIES_FILETYPES_EPWCACHE_HPP
+#define UTILITIES_FILETYPES_EPWCACHE_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include "EpwFile.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace openstudio{
+
+/** EpwWeatherData is the immutable content of one EPW file as handed out by EpwCache. It holds the header
+ *  as an EpwFile without stored data, the data points, and each data field as a column of doubles. */
+class UTILITIES_API EpwWeatherData {
+public:
+
+  EpwWeatherData(const EpwFile& header, std::vector<EpwDataPoint>&& dataPoints);
+
+  /// get the header, the EpwFile holds no data of its own
+  const EpwFile& header() const;
+
+  /// get the data points in file order
+  const std::vector<EpwDataPoint>& dataPoints() const;
+
+  /// get the number of records
+  unsigned numberOfRecords() const;
+
+  /// get a field for all records, numbers are as written in the file so missing values appear as their
+  /// missing value codes, fields that are not numbers are zero
+  const std::vector<double>& column(EpwDataField field) const;
+
+private:
+
+  EpwFile m_header;
+  std::vector<EpwDataPoint> m_dataPoints;
+  std::vector<std::vector<double> > m_columns;
+};
+
+/** EpwCache is a process wide cache of parsed EPW files, so that the EpwFile, the WeatherFile of a model and the
+ *  ISO model all share one parse of a weather file. Entries are keyed by the complete path and the checksum of the
+ *  file, so a file that changes on disk is parsed again. The least recently used files are dropped once capacity
+ *  is reached; data already handed out stays valid. All functions are thread safe. */
+class UTILITIES_API EpwCache {
+public:
+
+  /// get the weather data for path p, parsing the file if it is not in the cache, returns null without
+  /// logging if the file cannot be read or parsed
+  static std::shared_ptr<const EpwWeatherData> get(const openstudio::path& p);
+
+  /// get the weather data for path p if it is already in the cache, the file is never parsed
+  static std::shared_ptr<const EpwWeatherData> find(const openstudio::path& p);
+
+  /// get the number of files held, default is 8
+  static unsigned capacity();
+
+  /// set the number of files held, dropping files as needed
+  static void setCapacity(unsigned capacity);
+
+  /// get the number of files currently held
+  static unsigned size();
+
+  /// drop all files
+  static void clear();
+
+  /// get the number of calls to get and find that were served from the cache
+  static unsigned hits();
+
+  /// get the number of calls to get that had to parse the file
+  static unsigned misses();
+
+  /// reset the hit and miss counts
+  static void resetCounts();
+
+private:
+
+  EpwCache();
+
+  REGISTER_LOGGER("openstudio.EpwCache");
+};
+
+} // openstudio
+
+#endif //UTILITIES_FILETYPES_EPWCACHE_HPP
@@ -27,6 +27,7 @@
  **********************************************************************************************************************/
 
 #include "EpwFile.hpp"
+#include "EpwCache.hpp"
 #include "../idf/IdfObject.hpp"
 #include "../idd/IddEnums.hpp"
 #include <utilities/idd/IddEnums.hxx>
@@ -766,7 +767,7 @@ std::string EpwDataPoint::getUnits(EpwComputedField field)
   return string;
 }
 
-boost::optional<double> EpwDataPoint::getFieldByName(const std::string &name)
+boost::optional<double> EpwDataPoint::getFieldByName(const std::string &name) const
 {
   EpwDataField id;
   try {
@@ -778,7 +779,7 @@ boost::optional<double> EpwDataPoint::getFieldByName(const std::string &name)
   return getField(id);
 }
 
-boost::optional<double> EpwDataPoint::getField(EpwDataField id)
+boost::optional<double> EpwDataPoint::getField(EpwDataField id) const
 {
   boost::optional<int> ivalue;
   switch(id.value()) {
@@ -2043,6 +2044,17 @@ EpwFile::EpwFile(const openstudio::path& p, bool storeData)
     LOG_AND_THROW("Path '" << m_path << "' is not an EPW file");
   }
 
+  // share the parse with everyone else reading this file, a header only read uses the data if it
+  // has already been parsed but does not parse it
+  std::shared_ptr<const EpwWeatherData> weatherData = storeData ? EpwCache::get(m_path) : EpwCache::find(m_path);
+  if (weatherData) {
+    setWeatherData(weatherData);
+    return;
+  }
+  if (storeData) {
+    LOG_AND_THROW("EpwFile '" << toString(p) << "' cannot be processed");
+  }
+
   // set checksum
   m_checksum = openstudio::checksum(m_path);
 
@@ -2177,46 +2189,43 @@ boost::optional<int> EpwFile::endDateActualYear() const
 
 std::vector<EpwDataPoint> EpwFile::data()
 {
-  if(m_data.size()==0){
+  return dataPoints();
+}
+
+void EpwFile::setWeatherData(const std::shared_ptr<const EpwWeatherData>& weatherData)
+{
+  openstudio::path path = m_path;
+  *this = weatherData->header();
+  m_path = path;
+  m_weatherData = weatherData;
+}
+
+const std::vector<EpwDataPoint>& EpwFile::dataPoints()
+{
+  if (m_weatherData) {
+    return m_weatherData->dataPoints();
+  }
+  if (m_data.empty()) {
     if (!openstudio::filesystem::exists(m_path) || !openstudio::filesystem::is_regular_file(m_path)){
       LOG_AND_THROW("Path '" << m_path << "' is not an EPW file");
     }
 
-    // set checksum
-    m_checksum = openstudio::checksum(m_path);
-
-    // open file
-    std::ifstream ifs(openstudio::toString(m_path));
-
-    if (!parse(ifs, true)){
-      ifs.close();
-      LOG(Error,"EpwFile '" << toString(m_path) << "' cannot be processed");
-    } else{
-      ifs.close();
+    std::shared_ptr<const EpwWeatherData> weatherData = EpwCache::get(m_path);
+    if (weatherData) {
+      m_checksum = weatherData->header().checksum();
+      m_weatherData = weatherData;
+      return m_weatherData->dataPoints();
     }
+    LOG(Error,"EpwFile '" << toString(m_path) << "' cannot be processed");
   }
   return m_data;
 }
 
 boost::optional<TimeSeries> EpwFile::getTimeSeries(const std::string &name)
 {
-  if(m_data.size()==0) {
-    if (!openstudio::filesystem::exists(m_path) || !openstudio::filesystem::is_regular_file(m_path)){
-      LOG_AND_THROW("Path '" << m_path << "' is not an EPW file");
-    }
-
-    // set checksum
-    m_checksum = openstudio::checksum(m_path);
-
-    // open file
-    std::ifstream ifs(openstudio::toString(m_path));
-
-    if (!parse(ifs, true)) {
-      ifs.close();
-      LOG(Error,"EpwFile '" << toString(m_path) << "' cannot be processed");
-      return boost::none;
-    } 
-    ifs.close();
+  const std::vector<EpwDataPoint>& data = dataPoints();
+  if (data.empty()) {
+    return boost::none;
   }
   EpwDataField id;
   try {
@@ -2225,15 +2234,16 @@ boost::optional<TimeSeries> EpwFile::getTimeSeries(const std::string &name)
     LOG(Warn, "Unrecognized EPW data field '" << name << "'");
     return boost::none;
   }
-  if(m_data.size() > 0) {
+  if(data.size() > 0) {
     std::string units = EpwDataPoint::getUnits(id);
     DateTimeVector dates;
+    dates.reserve(data.size() + 1);
     dates.push_back(DateTime()); // Use a placeholder to avoid an insert
     std::vector<double> values;
-    for(unsigned int i=0;i<m_data.size();i++) {
-      DateTime dateTime=m_data[i].dateTime();
-      Time time=m_data[i].time();
-      boost::optional<double> value = m_data[i].getField(id);
+    values.reserve(data.size());
+    for(unsigned int i=0;i<data.size();i++) {
+      DateTime dateTime=data[i].dateTime();
+      boost::optional<double> value = data[i].getField(id);
       if(value) {
         dates.push_back(DateTime(dateTime));
         values.push_back(value.get());
@@ -2250,23 +2260,9 @@ boost::optional<TimeSeries> EpwFile::getTimeSeries(const std::string &name)
 
 boost::optional<TimeSeries> EpwFile::getComputedTimeSeries(const std::string &name)
 {
-  if (m_data.size() == 0) {
-    if (!openstudio::filesystem::exists(m_path) || !openstudio::filesystem::is_regular_file(m_path)){
-      LOG_AND_THROW("Path '" << m_path << "' is not an EPW file");
-    }
-
-    // set checksum
-    m_checksum = openstudio::checksum(m_path);
-
-    // open file
-    std::ifstream ifs(openstudio::toString(m_path));
-
-    if (!parse(ifs, true)) {
-      ifs.close();
-      LOG(Error, "EpwFile '" << toString(m_path) << "' cannot be processed");
-      return boost::none;
-    }
-    ifs.close();
+  const std::vector<EpwDataPoint>& data = dataPoints();
+  if (data.empty()) {
+    return boost::none;
   }
   EpwComputedField id;
   try {
@@ -2302,12 +2298,14 @@ boost::optional<TimeSeries> EpwFile::getComputedTimeSeries(const std::string &na
     return boost::none;
   }
   DateTimeVector dates;
+  dates.reserve(data.size() + 1);
   dates.push_back(DateTime()); // Use a placeholder to avoid an insert
   std::vector<double> values;
-  for (unsigned int i = 0; i<m_data.size(); i++) {
-    Date date = m_data[i].date();
-    Time time = m_data[i].time();
-    boost::optional<double> value = (m_data[i].*compute)();
+  values.reserve(data.size());
+  for (unsigned int i = 0; i<data.size(); i++) {
+    Date date = data[i].date();
+    Time time = data[i].time();
+    boost::optional<double> value = (data[i].*compute)();
     if (value) {
       dates.push_back(DateTime(date, time));
       values.push_back(value.get());
@@ -2323,30 +2321,13 @@ boost::optional<TimeSeries> EpwFile::getComputedTimeSeries(const std::string &na
 
 bool EpwFile::translateToWth(openstudio::path path, std::string description)
 {
-  if(m_data.size()==0) {
-    if (!openstudio::filesystem::exists(m_path) || !openstudio::filesystem::is_regular_file(m_path)){
-      LOG_AND_THROW("Path '" << m_path << "' is not an EPW file");
-    }
-
-    // set checksum
-    m_checksum = openstudio::checksum(m_path);
-
-    // open file
-    std::ifstream ifs(openstudio::toString(m_path));
-
-    if (!parse(ifs, true)) {
-      ifs.close();
-      LOG(Error,"EpwFile '" << toString(m_path) << "' cannot be processed");
-      return false;
-    }
-    ifs.close();
-  }
+  const std::vector<EpwDataPoint>& data = dataPoints();
 
   if(description.empty()) {
     description = "Translated from " + openstudio::toString(this->path());
   }
 
-  if(!data().size()) {
+  if(!data.size()) {
     LOG(Error, "EPW file contains no data to translate");
     return false;
   }
@@ -2376,9 +2357,9 @@ bool EpwFile::translateToWth(openstudio::path path, std::string description)
   }
 
   // Cheat to get data at the start time - this will need to change
-  openstudio::EpwDataPoint lastPt = data()[data().size()-1];
+  const openstudio::EpwDataPoint& lastPt = data[data.size()-1];
   std::vector<std::string> epwstrings = lastPt.toEpwStrings();
-  openstudio::DateTime dateTime = data()[0].dateTime();
+  openstudio::DateTime dateTime = data[0].dateTime();
   openstudio::Time dt = timeStep();
   dateTime -= dt;
   epwstrings[0] = std::to_string(dateTime.date().year());
@@ -2400,8 +2381,8 @@ bool EpwFile::translateToWth(openstudio::path path, std::string description)
     return false;
   }
   fp << output.get() << '\n';
-  for(unsigned int i=0;i<data().size();i++) {
-    output = data()[i].toWthString();
+  for(unsigned int i=0;i<data.size();i++) {
+    output = data[i].toWthString();
     if(!output) {
       LOG(Error, "Translation to WTH has failed on data point " << i);
       fp.close();
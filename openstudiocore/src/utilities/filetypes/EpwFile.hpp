@@ -38,10 +38,13 @@
 #include "../time/DateTime.hpp"
 #include "../data/TimeSeries.hpp"
 
+#include <memory>
+
 namespace openstudio{
 
 // forward declaration
 class IdfObject;
+class EpwWeatherData;
 // Added these next four for SWIG
 class Date;
 class Time;
@@ -175,9 +178,9 @@ public:
   static std::string getUnits(EpwComputedField field);
   // Data retrieval
   /** Returns the double value of the named field if possible */
-  boost::optional<double> getFieldByName(const std::string &name);
+  boost::optional<double> getFieldByName(const std::string &name) const;
   /** Returns the dobule value of the field specified by enumeration value */
-  boost::optional<double> getField(EpwDataField id);
+  boost::optional<double> getField(EpwDataField id) const;
   /** Returns the air state specified by the EPW data. If dry bulb, pressure, and relative humidity are available,
       then those values will be used to compute the air state. Otherwise, unless dry bulb, pressure, and dew point are
       available, then an empty optional will be returned. Note that the air state may not be consistend with the EPW
@@ -292,6 +295,9 @@ public:
   boost::optional<double> wetbulb() const;
 
 private:
+  // Reads the stored fields to build its columns
+  friend class EpwWeatherData;
+
   // One billion setters
   void setDate(Date date);
   void setTime(Time time);
@@ -493,8 +499,14 @@ public:
 
 private:
 
+  friend class EpwCache;
+
   EpwFile();
   bool parse(std::istream& is, bool storeData=false);
+  // Takes the header from shared weather data and reads data points from it from then on
+  void setWeatherData(const std::shared_ptr<const EpwWeatherData>& weatherData);
+  // Returns the stored data points, getting them from the EpwCache if there are none
+  const std::vector<EpwDataPoint>& dataPoints();
   bool parseLocation(const std::string& line);
   bool parseDataPeriod(const std::string& line);
 
@@ -519,6 +531,7 @@ private:
   boost::optional<int> m_startDateActualYear;
   boost::optional<int> m_endDateActualYear;
   std::vector<EpwDataPoint> m_data;
+  std::shared_ptr<const EpwWeatherData> m_weatherData;
 
   bool m_isActual;
 
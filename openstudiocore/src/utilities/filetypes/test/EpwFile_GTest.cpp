@@ -28,9 +28,12 @@
 
 #include <gtest/gtest.h>
 #include "../EpwFile.hpp"
+#include "../EpwCache.hpp"
 #include "../../time/Time.hpp"
 #include "../../time/Date.hpp"
 #include "../../core/Checksum.hpp"
+#include "../../core/Filesystem.hpp"
+#include "../../core/FilesystemHelpers.hpp"
 
 #include <resources.hxx>
 
@@ -384,3 +387,96 @@ TEST(Filetypes, EpwFile_Wrap_AMY)
     ASSERT_TRUE(false);
   }
 }
+
+TEST(Filetypes, EpwCache)
+{
+  path p = resourcesPath() / toPath("utilities/Filetypes/USA_CO_Golden-NREL.724666_TMY3.epw");
+  EpwCache::clear();
+  EpwCache::resetCounts();
+
+  std::shared_ptr<const EpwWeatherData> weatherData = EpwCache::get(p);
+  ASSERT_TRUE(weatherData);
+  EXPECT_EQ(0u, EpwCache::hits());
+  EXPECT_EQ(1u, EpwCache::misses());
+  EXPECT_EQ(1u, EpwCache::size());
+  EXPECT_EQ("BDF687C1", weatherData->header().checksum());
+  EXPECT_EQ("Denver Centennial  Golden   Nr", weatherData->header().city());
+  ASSERT_EQ(8760u, weatherData->numberOfRecords());
+  ASSERT_EQ(8760u, weatherData->column(EpwDataField::DryBulbTemperature).size());
+  EXPECT_EQ(4.0, weatherData->column(EpwDataField::DryBulbTemperature)[8759]);
+  EXPECT_EQ(-1.0, weatherData->column(EpwDataField::DewPointTemperature)[8759]);
+  EXPECT_EQ(81100, weatherData->column(EpwDataField::AtmosphericStationPressure)[8759]);
+
+  // Everything that reads the file shares the one parse
+  EpwFile epwFile(p);
+  EXPECT_EQ(1u, EpwCache::hits());
+  EXPECT_EQ(1u, EpwCache::misses());
+  EXPECT_EQ(p, epwFile.path());
+  EXPECT_EQ("BDF687C1", epwFile.checksum());
+  std::vector<EpwDataPoint> data = epwFile.data();
+  ASSERT_EQ(8760u, data.size());
+  EXPECT_EQ(4.0, data[8759].dryBulbTemperature().get());
+  EXPECT_EQ(weatherData, EpwCache::get(p));
+  EXPECT_EQ(2u, EpwCache::hits());
+
+  // A changed file is parsed again
+  path copy = toPath("EpwCache.epw");
+  std::string text = openstudio::filesystem::read_as_string(p);
+  text.replace(text.find("Denver Centennial"), 17, "Golden Centennial");
+  {
+    openstudio::filesystem::ofstream ofs(copy, std::ios_base::binary);
+    ofs << text;
+  }
+  std::shared_ptr<const EpwWeatherData> copyData = EpwCache::get(copy);
+  ASSERT_TRUE(copyData);
+  EXPECT_EQ(2u, EpwCache::misses());
+  EXPECT_EQ("Golden Centennial  Golden   Nr", copyData->header().city());
+  text.replace(text.find("Golden Centennial"), 17, "Boulder Centennial");
+  {
+    openstudio::filesystem::ofstream ofs(copy, std::ios_base::binary);
+    ofs << text;
+  }
+  std::shared_ptr<const EpwWeatherData> changedData = EpwCache::get(copy);
+  ASSERT_TRUE(changedData);
+  EXPECT_EQ(3u, EpwCache::misses());
+  EXPECT_EQ("Boulder Centennial  Golden   Nr", changedData->header().city());
+  EXPECT_EQ("Golden Centennial  Golden   Nr", copyData->header().city());
+  EXPECT_EQ(2u, EpwCache::size());
+
+  EpwCache::setCapacity(1);
+  EXPECT_EQ(1u, EpwCache::size());
+  EXPECT_EQ(changedData, EpwCache::get(copy));
+  EpwCache::setCapacity(8);
+  EpwCache::clear();
+  EXPECT_EQ(0u, EpwCache::size());
+  openstudio::filesystem::remove(copy);
+
+  // Bad files are not cached
+  EXPECT_FALSE(EpwCache::get(resourcesPath() / toPath("utilities/Filetypes/USA_CO_Golden-NREL.wrap.epw")));
+  EXPECT_EQ(0u, EpwCache::size());
+
+  // A header only read does not parse the data, which is parsed into the cache when first needed
+  EpwCache::resetCounts();
+  EpwFile headerOnly(p);
+  EXPECT_EQ(0u, EpwCache::misses());
+  EXPECT_EQ(0u, EpwCache::size());
+  EXPECT_FALSE(EpwCache::find(p));
+  EXPECT_EQ("Denver Centennial  Golden   Nr", headerOnly.city());
+  ASSERT_EQ(8760u, headerOnly.data().size());
+  EXPECT_EQ(1u, EpwCache::misses());
+  EXPECT_TRUE(EpwCache::find(p));
+  EXPECT_EQ(1u, EpwCache::hits());
+
+  // The columns hold the numbers as written, including missing value codes
+  std::shared_ptr<const EpwWeatherData> cached = EpwCache::get(p);
+  ASSERT_TRUE(cached);
+  const EpwDataPoint& last = cached->dataPoints()[8759];
+  EXPECT_EQ(1996.0, cached->column(EpwDataField::Year)[8759]);
+  EXPECT_EQ(12.0, cached->column(EpwDataField::Month)[8759]);
+  EXPECT_EQ(static_cast<double>(last.totalSkyCover()), cached->column(EpwDataField::TotalSkyCover)[8759]);
+  EXPECT_EQ(last.windSpeed().get(), cached->column(EpwDataField::WindSpeed)[8759]);
+  EXPECT_FALSE(last.liquidPrecipitationDepth());
+  EXPECT_EQ(999.0, cached->column(EpwDataField::LiquidPrecipitationDepth)[8759]);
+  EXPECT_EQ(0.0, cached->column(EpwDataField::DataSourceandUncertaintyFlags)[8759]);
+  EpwCache::clear();
+}
@@ -33,12 +33,14 @@ namespace openstudio{
 
   /// default constructor creates point at 0, 0, 0
   Point3d::Point3d()
-    : m_storage(3, 0.0)
-  {}
+  {
+    m_storage[0] = 0.0;
+    m_storage[1] = 0.0;
+    m_storage[2] = 0.0;
+  }
 
   /// constructor with x, y, z
   Point3d::Point3d(double x, double y, double z)
-    : m_storage(3)
   {
     m_storage[0] = x;
     m_storage[1] = y;
@@ -47,8 +49,11 @@ namespace openstudio{
 
   /// copy constructor
   Point3d::Point3d(const Point3d& other)
-    : m_storage(other.m_storage)
-  {}
+  {
+    m_storage[0] = other.m_storage[0];
+    m_storage[1] = other.m_storage[1];
+    m_storage[2] = other.m_storage[2];
+  }
 
   /// get x
   double Point3d::x() const
@@ -98,7 +103,9 @@ namespace openstudio{
   /// check equality
   bool Point3d::operator==(const Point3d& other) const
   {
-    return (m_storage == other.m_storage);
+    return ((m_storage[0] == other.m_storage[0]) &&
+            (m_storage[1] == other.m_storage[1]) &&
+            (m_storage[2] == other.m_storage[2]));
   }
 
   /// ostream operator
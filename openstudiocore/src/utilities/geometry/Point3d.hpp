@@ -40,6 +40,7 @@ namespace openstudio{
 
   // forward declaration
   class Vector3d;
+  class Transformation;
 
   class UTILITIES_API Point3d{
   public:
@@ -76,8 +77,10 @@ namespace openstudio{
 
   private:
 
+    friend class Transformation;
+
     REGISTER_LOGGER("utilities.Point3d");
-    Vector m_storage;
+    double m_storage[3];
 
   };
 
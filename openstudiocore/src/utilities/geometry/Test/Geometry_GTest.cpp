@@ -33,6 +33,9 @@
 #include "../Point3d.hpp"
 #include "../PointLatLon.hpp"
 #include "../Vector3d.hpp"
+#include "../Transformation.hpp"
+
+#include <chrono>
 
 using namespace std;
 using namespace boost;
@@ -815,4 +818,44 @@ TEST_F(GeometryFixture, PointLatLon_Elevation)
   EXPECT_NEAR(-42.521429845143913, test.x(), 0.001);
   EXPECT_NEAR(0.0, test.y(), 0.001);
   EXPECT_NEAR(30.0, test.z(), 0.001);
-}
\ No newline at end of file
+}
+TEST_F(GeometryFixture, DISABLED_Geometry_Benchmark)
+{
+  // a window sized polygon with a few extra vertices, as is typical of surfaces
+  Point3dVector polygon;
+  for (unsigned i = 0; i < 8; ++i){
+    double angle = degToRad(45.0*i);
+    polygon.push_back(Point3d(2.0*cos(angle), 0.0, 1.5 + 1.5*sin(angle)));
+  }
+  Transformation T = Transformation::rotation(Vector3d(0, 0, 1), degToRad(30))*Transformation::translation(Vector3d(10, 20, 3));
+
+  Point3dVector points;
+  for (unsigned i = 0; i < 1000000; ++i){
+    points.push_back(polygon[i % polygon.size()]);
+  }
+
+  const unsigned n = 100000;
+  double sum = 0;
+
+  auto start = std::chrono::steady_clock::now();
+  T.transform(points);
+  auto transformed = std::chrono::steady_clock::now();
+  for (unsigned i = 0; i < n; ++i){
+    sum += getOutwardNormal(polygon)->z();
+  }
+  auto normals = std::chrono::steady_clock::now();
+  for (unsigned i = 0; i < n; ++i){
+    sum += *getArea(polygon);
+  }
+  auto areas = std::chrono::steady_clock::now();
+  for (unsigned i = 0; i < n; ++i){
+    sum += getCentroid(polygon)->x();
+  }
+  auto centroids = std::chrono::steady_clock::now();
+
+  std::cout << "Transform " << points.size() << " points: " << std::chrono::duration_cast<std::chrono::microseconds>(transformed - start).count() << " us" << std::endl;
+  std::cout << "Outward normal: " << std::chrono::duration_cast<std::chrono::nanoseconds>(normals - transformed).count() / n << " ns" << std::endl;
+  std::cout << "Area: " << std::chrono::duration_cast<std::chrono::nanoseconds>(areas - normals).count() / n << " ns" << std::endl;
+  std::cout << "Centroid: " << std::chrono::duration_cast<std::chrono::nanoseconds>(centroids - areas).count() / n << " ns" << std::endl;
+  EXPECT_NE(0.0, sum + points[0].x());
+}
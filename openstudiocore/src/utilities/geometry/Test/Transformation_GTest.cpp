@@ -594,3 +594,32 @@ TEST_F(GeometryFixture, Transformation_Decompose)
   EXPECT_TRUE(transformation.matrix() == test.matrix()) << transformation.matrix() << std::endl << test.matrix();
 
 }
+
+TEST_F(GeometryFixture, Transformation_Batch)
+{
+  Transformation T = Transformation::translation(Vector3d(1, -2, 3)) *
+                     Transformation::rotation(Point3d(1, 1, 0), Vector3d(1, 2, 3), degToRad(37)) *
+                     Transformation::alignZPrime(Vector3d(0.2, -0.5, 1.0));
+
+  Point3dVector points;
+  for (unsigned i = 0; i < 101; ++i){
+    points.push_back(Point3d(0.5*i, 10.0 - i, 0.25*i*i));
+  }
+
+  // the batch kernel gives exactly the same points as transforming one at a time
+  Point3dVector transformed = points;
+  T.transform(transformed);
+  ASSERT_EQ(points.size(), transformed.size());
+  for (unsigned i = 0; i < points.size(); ++i){
+    EXPECT_EQ(T*points[i], transformed[i]);
+  }
+  EXPECT_EQ(transformed, T*points);
+
+  Point3dVector empty;
+  T.transform(empty);
+  EXPECT_TRUE(empty.empty());
+
+  // round trip through the vector representation
+  Transformation T2(T.vector());
+  EXPECT_TRUE(T.matrix() == T2.matrix());
+}
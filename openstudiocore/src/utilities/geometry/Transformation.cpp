@@ -41,87 +41,88 @@
 
 #include <math.h>
 
-using boost::numeric::ublas::identity_matrix;
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define OPENSTUDIO_TRANSFORMATION_SSE2
+#endif
+
 using std::min;
 
 namespace openstudio{
 
   /// default constructor creates identity transformation
   Transformation::Transformation()
-    : m_storage(identity_matrix<double>(4))
-  {}
+  {
+    for (unsigned i = 0; i < 4; ++i){
+      for (unsigned j = 0; j < 4; ++j){
+        m_storage[i][j] = (i == j) ? 1.0 : 0.0;
+      }
+    }
+  }
 
   /// copy constructor
   Transformation::Transformation(const Transformation& other)
-    : m_storage(other.m_storage)
-  {}
+  {
+    for (unsigned i = 0; i < 4; ++i){
+      for (unsigned j = 0; j < 4; ++j){
+        m_storage[i][j] = other.m_storage[i][j];
+      }
+    }
+  }
 
   /// constructor from storage, asserts matrix is 4x4
   Transformation::Transformation(const Matrix& matrix)
-    : m_storage(matrix)
   {
     OS_ASSERT(matrix.size1() == 4);
     OS_ASSERT(matrix.size2() == 4);
+    for (unsigned i = 0; i < 4; ++i){
+      for (unsigned j = 0; j < 4; ++j){
+        m_storage[i][j] = matrix(i,j);
+      }
+    }
   }
 
   /// constructor from storage, asserts vector is size 16
   Transformation::Transformation(const Vector& vector)
-    : m_storage(Matrix(4,4))
   {
     OS_ASSERT(vector.size() == 16);
-    
-    m_storage(0,0) = vector[0];
-    m_storage(1,0) = vector[1];
-    m_storage(2,0) = vector[2];
-    m_storage(3,0) = vector[3];
-    m_storage(0,1) = vector[4];
-    m_storage(1,1) = vector[5];
-    m_storage(2,1) = vector[6];
-    m_storage(2,1) = vector[7];
-    m_storage(0,2) = vector[8];
-    m_storage(1,2) = vector[9];
-    m_storage(2,2) = vector[10];
-    m_storage(3,2) = vector[11];
-    m_storage(0,3) = vector[12];
-    m_storage(1,3) = vector[13];
-    m_storage(2,3) = vector[14];
-    m_storage(3,3) = vector[15];
+
+    // column major, the inverse of vector()
+    for (unsigned i = 0; i < 4; ++i){
+      for (unsigned j = 0; j < 4; ++j){
+        m_storage[i][j] = vector[4*j + i];
+      }
+    }
   }
 
   /// rotation about origin defined by axis and angle (radians)
   Transformation Transformation::rotation(const Vector3d& axis, double radians)
   {
-    Matrix storage = identity_matrix<double>(4);
+    Transformation result;
 
     Vector3d temp = axis;
     if (!temp.normalize()){
       LOG(Error, "Could not normalize axis");
     }
-    Vector normalVector = temp.vector();
+    double n[3] = {temp.x(), temp.y(), temp.z()};
 
     // Rodrigues' rotation formula / Rotation matrix from Euler axis/angle
     // I*cos(radians) + I*(1-cos(radians))*axis*axis^T + Q*sin(radians)
     // Q = [0, -axis[2], axis[1]; axis[2], 0, -axis[0]; -axis[1], axis[0], 0]
-    Matrix P = outer_prod(normalVector, normalVector);
-    Matrix I = identity_matrix<double>(3);
-    Matrix Q(3, 3, 0.0);
-    Q(0,1) = -normalVector(2);
-    Q(0,2) =  normalVector(1);
-    Q(1,0) =  normalVector(2);
-    Q(1,2) = -normalVector(0);
-    Q(2,0) = -normalVector(1);
-    Q(2,1) =  normalVector(0);
+    double Q[3][3] = {{0.0, -n[2], n[1]},
+                      {n[2], 0.0, -n[0]},
+                      {-n[1], n[0], 0.0}};
+    double c = cos(radians);
+    double s = sin(radians);
 
     // rotation matrix
-    Matrix R = I*cos(radians) + (1-cos(radians))*P + Q*sin(radians);
-
     for (unsigned i = 0; i < 3; ++i){
       for (unsigned j = 0; j < 3; ++j){
-        storage(i,j) = R(i,j);
+        result.m_storage[i][j] = ((i == j) ? c : 0.0) + (1-c)*(n[i]*n[j]) + Q[i][j]*s;
       }
     }
 
-    return Transformation(storage);
+    return result;
   }
 
   /// rotation about point defined by axis and angle (radians)
@@ -145,13 +146,13 @@ namespace openstudio{
   /// translation along vector
   Transformation Transformation::translation(const Vector3d& translation)
   {
-    Matrix storage = identity_matrix<double>(4);
+    Transformation result;
 
-    storage(0,3) = translation.x();
-    storage(1,3) = translation.y();
-    storage(2,3) = translation.z();
+    result.m_storage[0][3] = translation.x();
+    result.m_storage[1][3] = translation.y();
+    result.m_storage[2][3] = translation.z();
 
-    return Transformation(storage);
+    return result;
   }
 
   /// transforms system with z' to regular system
@@ -187,18 +188,18 @@ namespace openstudio{
       yp = zp.cross(xp);
     }
 
-    Matrix storage = identity_matrix<double>(4);
-    storage(0,0) = xp.x();
-    storage(1,0) = xp.y();
-    storage(2,0) = xp.z();
-    storage(0,1) = yp.x();
-    storage(1,1) = yp.y();
-    storage(2,1) = yp.z();
-    storage(0,2) = zp.x();
-    storage(1,2) = zp.y();
-    storage(2,2) = zp.z();
-
-    return Transformation(storage);
+    Transformation result;
+    result.m_storage[0][0] = xp.x();
+    result.m_storage[1][0] = xp.y();
+    result.m_storage[2][0] = xp.z();
+    result.m_storage[0][1] = yp.x();
+    result.m_storage[1][1] = yp.y();
+    result.m_storage[2][1] = yp.z();
+    result.m_storage[0][2] = zp.x();
+    result.m_storage[1][2] = zp.y();
+    result.m_storage[2][2] = zp.z();
+
+    return result;
   }
 
   /// transforms face coordinates to regular system, face normal will be z'
@@ -236,7 +237,7 @@ namespace openstudio{
   Transformation Transformation::inverse() const
   {
     Matrix matrix(4,4);
-    bool test = invert(m_storage, matrix);
+    bool test = invert(this->matrix(), matrix);
     if (!test){
       // this should never happen
       LOG_AND_THROW("Matrix inversion failed");
@@ -247,29 +248,24 @@ namespace openstudio{
   /// get the matrix representation directly
   Matrix Transformation::matrix() const
   {
-    return m_storage;
+    Matrix result(4,4);
+    for (unsigned i = 0; i < 4; ++i){
+      for (unsigned j = 0; j < 4; ++j){
+        result(i,j) = m_storage[i][j];
+      }
+    }
+    return result;
   }
 
   /// get the vector representation directly
   Vector Transformation::vector() const
   {
     openstudio::Vector result(16);
-    result[0] = m_storage(0,0);
-    result[1] = m_storage(1,0);
-    result[2] = m_storage(2,0);
-    result[3] = m_storage(3,0);
-    result[4] = m_storage(0,1);
-    result[5] = m_storage(1,1);
-    result[6] = m_storage(2,1);
-    result[7] = m_storage(3,1);
-    result[8] = m_storage(0,2);
-    result[9] = m_storage(1,2);
-    result[10] = m_storage(2,2);
-    result[11] = m_storage(3,2);
-    result[12] = m_storage(0,3);
-    result[13] = m_storage(1,3);
-    result[14] = m_storage(2,3);
-    result[15] = m_storage(3,3);
+    for (unsigned i = 0; i < 4; ++i){
+      for (unsigned j = 0; j < 4; ++j){
+        result[4*j + i] = m_storage[i][j];
+      }
+    }
     return result;
   }
 
@@ -279,19 +275,19 @@ namespace openstudio{
     double psi;
     double theta;
     double phi;
-    if (m_storage(2,0) == 1.0){
+    if (m_storage[2][0] == 1.0){
       phi = 0;
       theta = -boost::math::constants::pi<double>()/2.0;
-      psi = atan2(-m_storage(0,1), -m_storage(0,2));
-    }else if(m_storage(2,0) == -1.0){
+      psi = atan2(-m_storage[0][1], -m_storage[0][2]);
+    }else if(m_storage[2][0] == -1.0){
       phi = 0;
       theta = boost::math::constants::pi<double>()/2.0;
-      psi = atan2(m_storage(0,1), m_storage(0,2));
+      psi = atan2(m_storage[0][1], m_storage[0][2]);
     }else{
-      theta = -asin(m_storage(2,0));
-      // theta = pi + asin(m_storage(2,0)); // alternate solution
-      psi = atan2(m_storage(2,1)/cos(theta), m_storage(2,2)/cos(theta));
-      phi = atan2(m_storage(1,0)/cos(theta), m_storage(0,0)/cos(theta));
+      theta = -asin(m_storage[2][0]);
+      // theta = pi + asin(m_storage[2][0]); // alternate solution
+      psi = atan2(m_storage[2][1]/cos(theta), m_storage[2][2]/cos(theta));
+      phi = atan2(m_storage[1][0]/cos(theta), m_storage[0][0]/cos(theta));
       
     }
     EulerAngles result(psi, theta, phi);
@@ -304,7 +300,7 @@ namespace openstudio{
     Matrix result(3,3);
     for(unsigned i = 0 ; i < 3; ++i){
       for(unsigned j = 0; j < 3; ++j){
-        result(i,j) = m_storage(i,j);
+        result(i,j) = m_storage[i][j];
       }
     }
     return result;
@@ -313,32 +309,32 @@ namespace openstudio{
   /// get the translation for the transformation, does not include rotation
   Vector3d Transformation::translation() const
   {
-    Vector3d result(m_storage(0, 3), m_storage(1, 3), m_storage(2, 3));
+    Vector3d result(m_storage[0][3], m_storage[1][3], m_storage[2][3]);
     return result;
   }
 
   /// apply the transformation to the point
   Point3d Transformation::operator*(const Point3d& point) const
   {
-    Vector temp(4);
-    temp(0) = point.x();
-    temp(1) = point.y();
-    temp(2) = point.z();
-    temp(3) = 1.0;
-    temp = prod(m_storage, temp);
-    return Point3d(temp[0], temp[1], temp[2]);
+    const double (&m)[4][4] = m_storage;
+    double x = point.x();
+    double y = point.y();
+    double z = point.z();
+    return Point3d(m[0][0]*x + m[0][1]*y + m[0][2]*z + m[0][3],
+                   m[1][0]*x + m[1][1]*y + m[1][2]*z + m[1][3],
+                   m[2][0]*x + m[2][1]*y + m[2][2]*z + m[2][3]);
   }
 
   /// apply the transformation to the vector
   Vector3d Transformation::operator*(const Vector3d& vector) const
   {
-    Vector temp(4);
-    temp(0) = vector.x();
-    temp(1) = vector.y();
-    temp(2) = vector.z();
-    temp(3) = 1.0;
-    temp = prod(m_storage, temp);
-    return Vector3d(temp[0], temp[1], temp[2]);
+    const double (&m)[4][4] = m_storage;
+    double x = vector.x();
+    double y = vector.y();
+    double z = vector.z();
+    return Vector3d(m[0][0]*x + m[0][1]*y + m[0][2]*z + m[0][3],
+                    m[1][0]*x + m[1][1]*y + m[1][2]*z + m[1][3],
+                    m[2][0]*x + m[2][1]*y + m[2][2]*z + m[2][3]);
   }
 
   /// apply the transformation to the BoundingBox
@@ -371,10 +367,8 @@ namespace openstudio{
   /// apply the transformation to a vector of points
   std::vector<Point3d> Transformation::operator*(const std::vector<Point3d>& points) const
   {
-    std::vector<Point3d> result(points.size());
-    for(unsigned i = 0; i < points.size(); ++i){
-      result[i] = (*this)*points[i];
-    }
+    std::vector<Point3d> result(points);
+    transform(result);
     return result;
   }
 
@@ -388,10 +382,50 @@ namespace openstudio{
     return result;
   }
 
+  /// apply the transformation to a vector of points in place
+  void Transformation::transform(std::vector<Point3d>& points) const
+  {
+    const double (&m)[4][4] = m_storage;
+#ifdef OPENSTUDIO_TRANSFORMATION_SSE2
+    // x and y are computed together in one register, z on its own
+    const __m128d c0 = _mm_set_pd(m[1][0], m[0][0]);
+    const __m128d c1 = _mm_set_pd(m[1][1], m[0][1]);
+    const __m128d c2 = _mm_set_pd(m[1][2], m[0][2]);
+    const __m128d c3 = _mm_set_pd(m[1][3], m[0][3]);
+    for (Point3d& point : points){
+      double* p = point.m_storage;
+      double z = p[2];
+      __m128d xy = _mm_add_pd(_mm_add_pd(_mm_add_pd(_mm_mul_pd(c0, _mm_set1_pd(p[0])),
+                                                    _mm_mul_pd(c1, _mm_set1_pd(p[1]))),
+                                         _mm_mul_pd(c2, _mm_set1_pd(z))),
+                              c3);
+      p[2] = m[2][0]*p[0] + m[2][1]*p[1] + m[2][2]*z + m[2][3];
+      _mm_storeu_pd(p, xy);
+    }
+#else
+    for (Point3d& point : points){
+      double* p = point.m_storage;
+      double x = p[0];
+      double y = p[1];
+      double z = p[2];
+      p[0] = m[0][0]*x + m[0][1]*y + m[0][2]*z + m[0][3];
+      p[1] = m[1][0]*x + m[1][1]*y + m[1][2]*z + m[1][3];
+      p[2] = m[2][0]*x + m[2][1]*y + m[2][2]*z + m[2][3];
+    }
+#endif
+  }
+
   /// apply the transformation to the other transformation
   Transformation Transformation::operator*(const Transformation& other) const
   {
-    return Transformation(prod(m_storage, other.m_storage));
+    Transformation result;
+    for (unsigned i = 0; i < 4; ++i){
+      for (unsigned j = 0; j < 4; ++j){
+        result.m_storage[i][j] = m_storage[i][0]*other.m_storage[0][j] + m_storage[i][1]*other.m_storage[1][j] +
+                                 m_storage[i][2]*other.m_storage[2][j] + m_storage[i][3]*other.m_storage[3][j];
+      }
+    }
+    return result;
   }
 
   /// ostream operator
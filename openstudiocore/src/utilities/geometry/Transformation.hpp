@@ -119,13 +119,18 @@ namespace openstudio{
     /// apply the transformation to a vector of vector
     std::vector<Vector3d> operator*(const std::vector<Vector3d>& vectors) const;
 
+    /// apply the transformation to a vector of points in place
+    void transform(std::vector<Point3d>& points) const;
+
     /// apply the transformation to the other transformation
     Transformation operator*(const Transformation& other) const;
 
   private:
 
     REGISTER_LOGGER("utilities.Transformation");
-    Matrix m_storage;
+
+    // row major
+    double m_storage[4][4];
 
   };
 
@@ -28,16 +28,20 @@
 
 #include "Vector3d.hpp"
 
+#include <cmath>
+
 namespace openstudio{
 
   /// default constructor creates vector with 0, 0, 0
   Vector3d::Vector3d()
-    : m_storage(3, 0.0)
-  {}
+  {
+    m_storage[0] = 0.0;
+    m_storage[1] = 0.0;
+    m_storage[2] = 0.0;
+  }
 
   /// constructor with x, y, z
   Vector3d::Vector3d(double x, double y, double z)
-    : m_storage(3)
   {
     m_storage[0] = x;
     m_storage[1] = y;
@@ -46,8 +50,11 @@ namespace openstudio{
 
   /// copy constructor
   Vector3d::Vector3d(const Vector3d& other)
-    : m_storage(other.m_storage)
-  {}
+  {
+    m_storage[0] = other.m_storage[0];
+    m_storage[1] = other.m_storage[1];
+    m_storage[2] = other.m_storage[2];
+  }
 
   /// get x
   double Vector3d::x() const
@@ -106,7 +113,9 @@ namespace openstudio{
   /// check equality
   bool Vector3d::operator==(const Vector3d& other) const
   {
-    return (m_storage == other.m_storage);
+    return ((m_storage[0] == other.m_storage[0]) &&
+            (m_storage[1] == other.m_storage[1]) &&
+            (m_storage[2] == other.m_storage[2]));
   }
 
   /// ostream operator
@@ -157,7 +166,7 @@ namespace openstudio{
   /// get length
   double Vector3d::length() const
   {
-    return norm_2(m_storage);
+    return sqrt(m_storage[0]*m_storage[0] + m_storage[1]*m_storage[1] + m_storage[2]*m_storage[2]);
   }
 
   /// set length
@@ -178,7 +187,7 @@ namespace openstudio{
   /// dot product with another Vector3d
   double Vector3d::dot(const Vector3d& other) const
   {
-    return inner_prod(m_storage, other.m_storage);
+    return m_storage[0]*other.m_storage[0] + m_storage[1]*other.m_storage[1] + m_storage[2]*other.m_storage[2];
   }
 
   /// cross product with another Vector3d
@@ -193,7 +202,11 @@ namespace openstudio{
   /// get the Vector directly
   Vector Vector3d::vector() const
   {
-    return m_storage;
+    Vector result(3);
+    result[0] = m_storage[0];
+    result[1] = m_storage[1];
+    result[2] = m_storage[2];
+    return result;
   }
 
 } // openstudio
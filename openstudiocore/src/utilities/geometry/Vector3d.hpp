@@ -99,7 +99,7 @@ namespace openstudio{
 
     REGISTER_LOGGER("utilities.Vector3d");
 
-    Vector m_storage;
+    double m_storage[3];
 
   };
 
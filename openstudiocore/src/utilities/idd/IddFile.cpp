@@ -48,6 +48,32 @@ namespace openstudio {
 
 namespace detail {
 
+  LazyIddObject::LazyIddObject(const IddObject& object)
+    : m_name(object.name()), m_type(object.type()), m_object(object)
+  {}
+
+  LazyIddObject::LazyIddObject(IddObjectType objectType, const std::function<IddObject ()>& createFunction)
+    : m_name(objectType.valueDescription()), m_type(objectType), m_createFunction(createFunction)
+  {}
+
+  const std::string& LazyIddObject::name() const {
+    return m_name;
+  }
+
+  IddObjectType LazyIddObject::type() const {
+    return m_type;
+  }
+
+  const IddObject& LazyIddObject::get() const {
+    if (m_createFunction) {
+      std::call_once(m_createFlag, [this]() {
+        m_object = m_createFunction();
+        OS_ASSERT(m_object->type() == m_type);
+      });
+    }
+    return *m_object;
+  }
+
   // CONSTRUCTORS
 
   IddFile_Impl::IddFile_Impl()
@@ -68,7 +94,12 @@ namespace detail {
   }
 
   std::vector<IddObject> IddFile_Impl::objects() const {
-    return m_objects;
+    IddObjectVector result;
+    result.reserve(m_objects.size());
+    for (const std::shared_ptr<LazyIddObject>& object : m_objects) {
+      result.push_back(object->get());
+    }
+    return result;
   }
 
   std::vector<std::string> IddFile_Impl::groups() const {
@@ -81,7 +112,7 @@ namespace detail {
 
   std::vector<IddObject> IddFile_Impl::getObjectsInGroup(const std::string& group) const {
     IddObjectVector result;
-    for (const IddObject& object : m_objects){
+    for (const IddObject& object : objects()){
       if(istringEqual(object.group(), group)){
         result.push_back(object);
       }
@@ -92,9 +123,9 @@ namespace detail {
   std::vector<IddObject> IddFile_Impl::getObjects(const boost::regex &objectRegex) const {
     IddObjectVector result;
 
-    for (const IddObject& object : m_objects) {
-      if (boost::regex_match(object.name(),objectRegex)) {
-        result.push_back(object);
+    for (const std::shared_ptr<LazyIddObject>& object : m_objects) {
+      if (boost::regex_match(object->name(),objectRegex)) {
+        result.push_back(object->get());
       }
     }
 
@@ -118,9 +149,9 @@ namespace detail {
   boost::optional<IddObject> IddFile_Impl::getObject(const std::string& objectName) const
   {
     OptionalIddObject result;
-    for (const IddObject& object : m_objects){
-      if(istringEqual(object.name(), objectName)){
-        result = object;
+    for (const std::shared_ptr<LazyIddObject>& object : m_objects){
+      if(istringEqual(object->name(), objectName)){
+        result = object->get();
         break;
       }
     }
@@ -139,9 +170,9 @@ namespace detail {
       return result;
     }
 
-    for (const IddObject& object : m_objects){
-      if (object.type() == objectType) {
-        result = object;
+    for (const std::shared_ptr<LazyIddObject>& object : m_objects){
+      if (object->type() == objectType) {
+        result = object->get();
         break;
       }
     }
@@ -152,7 +183,7 @@ namespace detail {
   std::vector<IddObject> IddFile_Impl::requiredObjects() const
   {
     IddObjectVector result;
-    for (const IddObject& object : m_objects){
+    for (const IddObject& object : objects()){
       if(object.properties().required){
         result.push_back(object);
       }
@@ -163,7 +194,7 @@ namespace detail {
   std::vector<IddObject> IddFile_Impl::uniqueObjects() const
   {
     IddObjectVector result;
-    for (const IddObject& object : m_objects){
+    for (const IddObject& object : objects()){
       if(object.properties().unique){
         result.push_back(object);
       }
@@ -185,7 +216,12 @@ namespace detail {
 
   void IddFile_Impl::addObject(const IddObject& object)
   {
-    m_objects.push_back(object);
+    m_objects.push_back(std::make_shared<LazyIddObject>(object));
+  }
+
+  void IddFile_Impl::addObject(IddObjectType objectType, const std::function<IddObject ()>& createFunction)
+  {
+    m_objects.push_back(std::make_shared<LazyIddObject>(objectType, createFunction));
   }
 
   // SERIALIZATION
@@ -209,7 +245,7 @@ namespace detail {
   {
     os << m_header << std::endl;
     std::string groupName;
-    for (const IddObject& object : m_objects){
+    for (const IddObject& object : objects()){
       if (object.group() != groupName) {
         groupName = object.group();
         os << "\\group " << groupName << std::endl << std::endl;
@@ -245,7 +281,7 @@ namespace detail {
                                                           iddRegex::commentOnlyObjectText(), 
                                                           IddObjectType::CommentOnly);
     OS_ASSERT(commentOnlyObject);
-    m_objects.push_back(*commentOnlyObject);
+    addObject(*commentOnlyObject);
 
     // temp string to read file
     std::string line;
@@ -367,7 +403,7 @@ namespace detail {
         OptionalIddObject object = IddObject::load(objectName, currentGroup, text);
 
         // construct a new object and put it in the object vector
-        if (object) { m_objects.push_back(*object); }
+        if (object) { addObject(*object); }
         else { 
           LOG_AND_THROW("Unable to construct IddObject from text: " << std::endl << text);
         }
@@ -553,6 +589,11 @@ void IddFile::addObject(const IddObject& object)
   m_impl->addObject(object);
 }
 
+void IddFile::addObject(IddObjectType objectType, const std::function<IddObject ()>& createFunction)
+{
+  m_impl->addObject(objectType, createFunction);
+}
+
 // PRIVATE
 
 IddFile::IddFile(const std::shared_ptr<detail::IddFile_Impl>& impl) : m_impl(impl) {}
@@ -36,6 +36,7 @@
 #include "../core/Logger.hpp"
 #include "../core/Path.hpp"
 
+#include <functional>
 #include <string>
 #include <ostream>
 #include <vector>
@@ -153,6 +154,11 @@ class UTILITIES_API IddFile {
   /// add an object
   void addObject(const IddObject& object);
 
+  /** Add an object of objectType that is only created by calling createFunction the first time 
+   *  it is requested from this file. createFunction may be called from multiple threads, but at 
+   *  most once per file. */
+  void addObject(IddObjectType objectType, const std::function<IddObject ()>& createFunction);
+
  private:
   // impl
   std::shared_ptr<detail::IddFile_Impl> m_impl;
@@ -31,8 +31,13 @@
 
 #include "../UtilitiesAPI.hpp"
 #include "IddObject.hpp"
+#include "IddEnums.hpp"
+#include <utilities/idd/IddEnums.hxx>
 #include "../core/Logger.hpp"
 
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <ostream>
 #include <vector>
@@ -42,6 +47,38 @@
 namespace openstudio{
 namespace detail{
 
+  /** An IddObject entry in an IddFile that may be created on first access. The name and type 
+   *  are known up front so that lookups do not force the IddObject to be parsed. */
+  class UTILITIES_API LazyIddObject {
+   public:
+
+    /// entry for an already constructed object
+    explicit LazyIddObject(const IddObject& object);
+
+    /// entry for an object of objectType that is created by createFunction on first access
+    LazyIddObject(IddObjectType objectType, const std::function<IddObject ()>& createFunction);
+
+    /// object name, available without creating the object
+    const std::string& name() const;
+
+    /// object type, available without creating the object
+    IddObjectType type() const;
+
+    /// returns the object, creating it if necessary, thread-safe
+    const IddObject& get() const;
+
+   private:
+
+    LazyIddObject(const LazyIddObject& other) = delete;
+    LazyIddObject& operator=(const LazyIddObject& other) = delete;
+
+    std::string m_name;
+    IddObjectType m_type;
+    std::function<IddObject ()> m_createFunction;
+    mutable std::once_flag m_createFlag;
+    mutable boost::optional<IddObject> m_object;
+  };
+
   /// Implementation of IddFile
   class UTILITIES_API IddFile_Impl {
    public:
@@ -105,6 +142,9 @@ namespace detail{
     /// add an object
     void addObject(const IddObject& object);
 
+    /// add an object that is created on first access
+    void addObject(IddObjectType objectType, const std::function<IddObject ()>& createFunction);
+
     //@}
     /** @name Serialization */
     //@{
@@ -131,8 +171,8 @@ namespace detail{
     /// The first comment block in an IddFile is its header.
     std::string m_header;
 
-    /// The vector of IddObjects that constitute this IddFile.
-    std::vector<IddObject> m_objects; 
+    /// The IddObjects that constitute this IddFile, some of which may not be created yet.
+    std::vector<std::shared_ptr<LazyIddObject> > m_objects;
 
     /// Cache the Version IddObject
     mutable boost::optional<IddObject> m_versionObject;
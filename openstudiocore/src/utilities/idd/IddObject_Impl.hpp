@@ -193,8 +193,9 @@ namespace detail {
     IddFieldVector m_extensibleFields; // vector of extensible fields, forms single
                                        // extensible field group
     std::vector<unsigned> m_urlIdx;
-    // .first = hasNameField(); .second = nameFieldIndex
-    mutable boost::optional< std::pair<bool,unsigned> > m_nameFieldCache;
+    // .first = hasNameField(); .second = nameFieldIndex. set whenever m_fields changes rather than
+    // on first use, so that shared IddObjects can be queried from several threads
+    std::pair<bool,unsigned> m_nameFieldCache;
 
     // partial constructor used by load
     IddObject_Impl(const std::string& name, const std::string& group, IddObjectType type);
@@ -206,6 +207,7 @@ namespace detail {
     void parseProperty(const std::string& text);
     void parseFields(const std::string& text);
     void makeExtensible();
+    void cacheNameField();
 
     // configure logging
     REGISTER_LOGGER("utilities.idd.IddObject");
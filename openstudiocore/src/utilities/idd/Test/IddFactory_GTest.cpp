@@ -42,6 +42,10 @@
 
 #include <OpenStudio.hxx>
 
+#include <chrono>
+#include <iostream>
+#include <thread>
+
 using namespace openstudio;
 
 TEST_F(IddFixture,IddFactory_Version_Header) {
@@ -104,6 +108,86 @@ TEST_F(IddFixture,IddFactory_IddFile)
   EXPECT_TRUE(file.objects().size() == objects.size());
 }
 
+TEST_F(IddFixture,IddFactory_IddFile_LazyObjects)
+{
+  IddFile file = IddFactory::instance().getIddFile(IddFileType::EnergyPlus);
+
+  // objects are looked up by type and name without creating the rest of the file
+  OptionalIddObject candidate = file.getObject(IddObjectType::Lights);
+  ASSERT_TRUE(candidate);
+  EXPECT_TRUE(*candidate == IddFactory::instance().getObject(IddObjectType::Lights).get());
+  candidate = file.getObject("lIgHtS");
+  ASSERT_TRUE(candidate);
+  EXPECT_EQ(IddObjectType(IddObjectType::Lights), candidate->type());
+  EXPECT_FALSE(file.getObject("NotAnEnergyPlusObject"));
+  EXPECT_FALSE(file.getObject(IddObjectType::UserCustom));
+
+  OptionalIddObject versionObject = file.versionObject();
+  ASSERT_TRUE(versionObject);
+  EXPECT_EQ(IddObjectType(IddObjectType::Version), versionObject->type());
+
+  // all objects match the factory, in the same order
+  IddObjectVector objects = file.objects();
+  IddObjectVector factoryObjects = IddFactory::instance().getObjects(IddFileType::EnergyPlus);
+  ASSERT_EQ(factoryObjects.size(), objects.size());
+  for (unsigned i = 0, n = objects.size(); i < n; ++i) {
+    EXPECT_EQ(factoryObjects[i].type(), objects[i].type());
+    EXPECT_EQ(factoryObjects[i].name(), objects[i].name());
+  }
+}
+
+TEST_F(IddFixture,IddFactory_IddFile_LazyObjects_Threaded)
+{
+  IddFile file = IddFactory::instance().getIddFile(IddFileType::OpenStudio);
+  std::vector<IddObjectType> types{ IddObjectType::OS_Building, IddObjectType::OS_Space, IddObjectType::OS_Surface,
+                                    IddObjectType::OS_ThermalZone, IddObjectType::OS_Construction };
+
+  std::vector<IddObjectVector> results(8);
+  std::vector<std::thread> threads;
+  for (unsigned i = 0; i < results.size(); ++i) {
+    threads.push_back(std::thread([&file, &types, &results, i]() {
+      for (const IddObjectType& type : types) {
+        results[i].push_back(file.getObject(type).get());
+      }
+    }));
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  for (const IddObjectVector& result : results) {
+    ASSERT_EQ(types.size(), result.size());
+    for (unsigned j = 0; j < types.size(); ++j) {
+      EXPECT_TRUE(result[j] == results[0][j]);
+      EXPECT_EQ(types[j], result[j].type());
+    }
+  }
+}
+
+// Run by itself, e.g. --gtest_also_run_disabled_tests --gtest_filter=*Benchmark_Startup, since IddObjects are
+// only parsed once per process.
+TEST_F(IddFixture,DISABLED_IddFactory_Benchmark_Startup)
+{
+  std::vector<IddObjectType> types{ IddObjectType::OS_Version, IddObjectType::OS_Building, IddObjectType::OS_Space,
+                                    IddObjectType::OS_Surface, IddObjectType::OS_SubSurface, IddObjectType::OS_ThermalZone,
+                                    IddObjectType::OS_Construction, IddObjectType::OS_Material, IddObjectType::OS_Schedule_Ruleset,
+                                    IddObjectType::OS_Lights, IddObjectType::OS_People, IddObjectType::OS_ElectricEquipment };
+
+  auto start = std::chrono::steady_clock::now();
+  IddFile file = IddFactory::instance().getIddFile(IddFileType::OpenStudio);
+  for (const IddObjectType& type : types) {
+    EXPECT_TRUE(file.getObject(type));
+  }
+  auto typical = std::chrono::steady_clock::now();
+  IddObjectVector objects = file.objects();
+  auto done = std::chrono::steady_clock::now();
+
+  std::cout << "OpenStudio IddFile with " << types.size() << " objects used: "
+            << std::chrono::duration<double>(typical - start).count() << " s, "
+            << "all " << objects.size() << " objects: "
+            << std::chrono::duration<double>(done - start).count() << " s" << std::endl;
+}
+
 TEST_F(IddFixture,IddFactory_isInFile)
 {
   EXPECT_TRUE(IddFactory::instance().isInFile(IddObjectType::Building,IddFileType::EnergyPlus));
@@ -0,0 +1,279 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2017, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+
+#include "IdfFieldValue.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <unordered_set>
+
+namespace openstudio {
+namespace detail {
+
+  static_assert(sizeof(IdfFieldValue) == 16, "IdfFieldValue should be 16 bytes");
+
+  struct IdfFieldValue::SharedText
+  {
+    std::atomic<unsigned> references;
+    std::uint32_t size;
+    char text[1];
+  };
+
+  namespace {
+
+    struct FieldTextPool
+    {
+      std::mutex mutex;
+      std::unordered_set<std::string> texts;
+    };
+
+    FieldTextPool& fieldTextPool()
+    {
+      static FieldTextPool pool;
+      return pool;
+    }
+
+  }
+
+  IdfFieldValue::IdfFieldValue()
+    : m_tag(0)
+  {}
+
+  IdfFieldValue::IdfFieldValue(const std::string& text)
+    : m_tag(0)
+  {
+    assignText(text.data(), text.size());
+  }
+
+  IdfFieldValue::IdfFieldValue(const char* text)
+    : m_tag(0)
+  {
+    assignText(text, std::strlen(text));
+  }
+
+  IdfFieldValue::IdfFieldValue(const IdfFieldValue& other)
+    : m_tag(other.m_tag)
+  {
+    std::memcpy(m_data, other.m_data, sizeof(m_data));
+    if (m_tag == SharedTag){
+      sharedText()->references.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  IdfFieldValue::IdfFieldValue(IdfFieldValue&& other)
+    : m_tag(other.m_tag)
+  {
+    std::memcpy(m_data, other.m_data, sizeof(m_data));
+    other.m_tag = 0;
+  }
+
+  IdfFieldValue::~IdfFieldValue()
+  {
+    release();
+  }
+
+  IdfFieldValue& IdfFieldValue::operator=(const IdfFieldValue& other)
+  {
+    if (this != &other){
+      if (other.m_tag == SharedTag){
+        other.sharedText()->references.fetch_add(1, std::memory_order_relaxed);
+      }
+      release();
+      std::memcpy(m_data, other.m_data, sizeof(m_data));
+      m_tag = other.m_tag;
+    }
+    return *this;
+  }
+
+  IdfFieldValue& IdfFieldValue::operator=(IdfFieldValue&& other)
+  {
+    if (this != &other){
+      release();
+      std::memcpy(m_data, other.m_data, sizeof(m_data));
+      m_tag = other.m_tag;
+      other.m_tag = 0;
+    }
+    return *this;
+  }
+
+  IdfFieldValue IdfFieldValue::interned(const std::string& text)
+  {
+    IdfFieldValue result;
+    if (text.size() <= maxInlineSize){
+      result.assignText(text.data(), text.size());
+    }else{
+      FieldTextPool& pool = fieldTextPool();
+      std::lock_guard<std::mutex> lock(pool.mutex);
+      // elements of an unordered_set do not move when it grows
+      const std::string& pooled = *pool.texts.insert(text).first;
+      result.setExternal(InternedTag, pooled.data(), pooled.size());
+    }
+    return result;
+  }
+
+  std::size_t IdfFieldValue::numInterned()
+  {
+    FieldTextPool& pool = fieldTextPool();
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    return pool.texts.size();
+  }
+
+  bool IdfFieldValue::empty() const
+  {
+    return (m_tag == 0);
+  }
+
+  std::size_t IdfFieldValue::size() const
+  {
+    if (m_tag <= maxInlineSize){
+      return m_tag;
+    }
+    std::uint32_t result;
+    std::memcpy(&result, m_data + sizeof(void*), sizeof(result));
+    return result;
+  }
+
+  const char* IdfFieldValue::data() const
+  {
+    if (m_tag <= maxInlineSize){
+      return m_data;
+    }else if (m_tag == SharedTag){
+      return sharedText()->text;
+    }
+    return externalText();
+  }
+
+  std::string IdfFieldValue::str() const
+  {
+    return std::string(data(), size());
+  }
+
+  IdfFieldValue::operator std::string() const
+  {
+    return str();
+  }
+
+  bool IdfFieldValue::isInline() const
+  {
+    return (m_tag <= maxInlineSize);
+  }
+
+  bool IdfFieldValue::isInterned() const
+  {
+    return (m_tag == InternedTag);
+  }
+
+  const char* IdfFieldValue::externalText() const
+  {
+    const char* result;
+    std::memcpy(&result, m_data, sizeof(result));
+    return result;
+  }
+
+  IdfFieldValue::SharedText* IdfFieldValue::sharedText() const
+  {
+    SharedText* result;
+    std::memcpy(&result, m_data, sizeof(result));
+    return result;
+  }
+
+  void IdfFieldValue::setExternal(unsigned char tag, const void* pointer, std::size_t size)
+  {
+    std::uint32_t size32 = static_cast<std::uint32_t>(size);
+    std::memcpy(m_data, &pointer, sizeof(pointer));
+    std::memcpy(m_data + sizeof(void*), &size32, sizeof(size32));
+    m_tag = tag;
+  }
+
+  void IdfFieldValue::assignText(const char* text, std::size_t size)
+  {
+    if (size <= maxInlineSize){
+      std::memcpy(m_data, text, size);
+      m_tag = static_cast<unsigned char>(size);
+    }else{
+      void* memory = ::operator new(offsetof(SharedText, text) + size);
+      SharedText* shared = new (memory) SharedText;
+      shared->references.store(1, std::memory_order_relaxed);
+      shared->size = static_cast<std::uint32_t>(size);
+      std::memcpy(shared->text, text, size);
+      setExternal(SharedTag, shared, size);
+    }
+  }
+
+  void IdfFieldValue::release()
+  {
+    if (m_tag == SharedTag){
+      SharedText* shared = sharedText();
+      if (shared->references.fetch_sub(1, std::memory_order_acq_rel) == 1){
+        shared->~SharedText();
+        ::operator delete(shared);
+      }
+    }
+    m_tag = 0;
+  }
+
+  bool operator==(const IdfFieldValue& lhs, const IdfFieldValue& rhs)
+  {
+    return (lhs.size() == rhs.size()) && (std::memcmp(lhs.data(), rhs.data(), lhs.size()) == 0);
+  }
+
+  bool operator==(const IdfFieldValue& lhs, const std::string& rhs)
+  {
+    return (lhs.size() == rhs.size()) && (std::memcmp(lhs.data(), rhs.data(), rhs.size()) == 0);
+  }
+
+  bool operator==(const std::string& lhs, const IdfFieldValue& rhs)
+  {
+    return (rhs == lhs);
+  }
+
+  bool operator!=(const IdfFieldValue& lhs, const IdfFieldValue& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  bool operator!=(const IdfFieldValue& lhs, const std::string& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  bool operator!=(const std::string& lhs, const IdfFieldValue& rhs)
+  {
+    return !(rhs == lhs);
+  }
+
+  std::ostream& operator<<(std::ostream& os, const IdfFieldValue& value)
+  {
+    return os.write(value.data(), value.size());
+  }
+
+} // detail
+} // openstudio
@@ -0,0 +1,130 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2017, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+
+#ifndef UTILITIES_IDF_IDFFIELDVALUE_HPP
+#define UTILITIES_IDF_IDFFIELDVALUE_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+
+namespace openstudio {
+namespace detail {
+
+  /** IdfFieldValue holds the text of one IdfObject field in 16 bytes, half the size of a std::string.
+   *  Text of up to maxInlineSize characters, which covers most numbers and keys, is stored inline.
+   *  Longer text is either interned in a process wide pool, which is reserved for IDD keys since
+   *  it is never emptied, or kept in an immutable reference counted buffer shared by all copies. */
+  class UTILITIES_API IdfFieldValue {
+   public:
+
+    /// longest text that is stored inline
+    static const unsigned maxInlineSize = 14;
+
+    IdfFieldValue();
+
+    IdfFieldValue(const std::string& text);
+
+    IdfFieldValue(const char* text);
+
+    IdfFieldValue(const IdfFieldValue& other);
+
+    IdfFieldValue(IdfFieldValue&& other);
+
+    ~IdfFieldValue();
+
+    IdfFieldValue& operator=(const IdfFieldValue& other);
+
+    IdfFieldValue& operator=(IdfFieldValue&& other);
+
+    /// returns a value whose text is shared process wide, text is never released so only use for
+    /// text drawn from a bounded set such as IDD keys, short text is stored inline instead
+    static IdfFieldValue interned(const std::string& text);
+
+    /// returns the number of strings in the process wide pool
+    static std::size_t numInterned();
+
+    bool empty() const;
+
+    std::size_t size() const;
+
+    /// returns the characters of the text, which are not null terminated
+    const char* data() const;
+
+    std::string str() const;
+
+    operator std::string() const;
+
+    /// true if the text is stored inline
+    bool isInline() const;
+
+    /// true if the text is in the process wide pool
+    bool isInterned() const;
+
+   private:
+
+    struct SharedText;
+
+    // values of m_tag, values up to maxInlineSize are the size of inline text
+    enum Tag { InternedTag = 0x40, SharedTag = 0x80 };
+
+    const char* externalText() const;
+
+    SharedText* sharedText() const;
+
+    void setExternal(unsigned char tag, const void* pointer, std::size_t size);
+
+    void assignText(const char* text, std::size_t size);
+
+    void release();
+
+    // inline text, or the text pointer followed by its size
+    alignas(void*) char m_data[15];
+    unsigned char m_tag;
+  };
+
+  UTILITIES_API bool operator==(const IdfFieldValue& lhs, const IdfFieldValue& rhs);
+
+  UTILITIES_API bool operator==(const IdfFieldValue& lhs, const std::string& rhs);
+
+  UTILITIES_API bool operator==(const std::string& lhs, const IdfFieldValue& rhs);
+
+  UTILITIES_API bool operator!=(const IdfFieldValue& lhs, const IdfFieldValue& rhs);
+
+  UTILITIES_API bool operator!=(const IdfFieldValue& lhs, const std::string& rhs);
+
+  UTILITIES_API bool operator!=(const std::string& lhs, const IdfFieldValue& rhs);
+
+  UTILITIES_API std::ostream& operator<<(std::ostream& os, const IdfFieldValue& value);
+
+} // detail
+} // openstudio
+
+#endif // UTILITIES_IDF_IDFFIELDVALUE_HPP
@@ -468,44 +468,11 @@ std::ostream& IdfFile::print(std::ostream& os) const {
 }
 
 bool IdfFile::save(const openstudio::path& p, bool overwrite) {
-
-  // default extension
-  std::string expectedExtension;
-  bool enforceExtension = false;
-  OptionalIddFileType iddType = m_iddFileAndFactoryWrapper.iddFileType();
-  if (iddType) {
-    if (*iddType == IddFileType::EnergyPlus) { 
-      expectedExtension = "idf"; 
-      enforceExtension = true;
-    }
-    else if (*iddType == IddFileType::OpenStudio) {
-      std::string ext = getFileExtension(p);
-      if (ext == componentFileExtension()) {
-        expectedExtension = componentFileExtension();
-        // no need to enforce b/c already checked
-      }
-      else {
-        expectedExtension = modelFileExtension(); 
-        enforceExtension = true;
-      }
-    }
-  }
-  
-  // set extension if appropriate
-  path wp(p);
-  if (enforceExtension) {
-    wp = setFileExtension(p,expectedExtension,false,true);
-  }
-
-  // do not overwrite if not allowed
-  if (!overwrite) {
-    path temp = completePathToFile(wp,path());
-    if (!temp.empty()) { 
-      LOG(Info,"Save method failed because instructed not to overwrite path '" 
-        << toString(wp) << "'.");
-      return false;
-    }
+  boost::optional<path> owp = savePath(p,overwrite);
+  if (!owp) {
+    return false;
   }
+  path wp = *owp;
 
   if (makeParentFolder(wp)) {
     openstudio::filesystem::ofstream outFile(wp);
@@ -710,6 +677,49 @@ void IdfFile::setIddFileAndFactoryWrapper(
   m_iddFileAndFactoryWrapper = iddFileAndFactoryWrapper;
 }
 
+boost::optional<openstudio::path> IdfFile::savePath(const openstudio::path& p, bool overwrite) const {
+
+  // default extension
+  std::string expectedExtension;
+  bool enforceExtension = false;
+  OptionalIddFileType iddType = m_iddFileAndFactoryWrapper.iddFileType();
+  if (iddType) {
+    if (*iddType == IddFileType::EnergyPlus) { 
+      expectedExtension = "idf"; 
+      enforceExtension = true;
+    }
+    else if (*iddType == IddFileType::OpenStudio) {
+      std::string ext = getFileExtension(p);
+      if (ext == componentFileExtension()) {
+        expectedExtension = componentFileExtension();
+        // no need to enforce b/c already checked
+      }
+      else {
+        expectedExtension = modelFileExtension(); 
+        enforceExtension = true;
+      }
+    }
+  }
+  
+  // set extension if appropriate
+  path wp(p);
+  if (enforceExtension) {
+    wp = setFileExtension(p,expectedExtension,false,true);
+  }
+
+  // do not overwrite if not allowed
+  if (!overwrite) {
+    path temp = completePathToFile(wp,path());
+    if (!temp.empty()) { 
+      LOG(Info,"Save method failed because instructed not to overwrite path '" 
+        << toString(wp) << "'.");
+      return boost::none;
+    }
+  }
+
+  return wp;
+}
+
 // PRIVATE
 
 // SETTERS
@@ -225,6 +225,10 @@ class UTILITIES_API IdfFile {
 
   IddFileAndFactoryWrapper iddFileAndFactoryWrapper() const;
   void setIddFileAndFactoryWrapper(const IddFileAndFactoryWrapper& iddFileAndFactoryWrapper);
+
+  /** Returns the path that save(p,overwrite) writes to, with the default extension applied.
+   *  Returns an uninitialized path if the file exists and overwrite==false. */
+  boost::optional<openstudio::path> savePath(const openstudio::path& p, bool overwrite) const;
  private:
 
   std::string m_header;
@@ -58,11 +58,13 @@
  
 #include <boost/lexical_cast.hpp>
 #include <boost/numeric/conversion/cast.hpp>
+#include <boost/functional/hash.hpp>
 
 #include <iostream>
 #include <sstream>
 #include <iomanip>
 #include <algorithm>
+#include <atomic>
 #include <limits>
 
 using std::cout;
@@ -77,8 +79,9 @@ namespace detail {
   IdfObject_Impl::IdfObject_Impl(const IdfObject_Impl& other, bool keepHandle)
     : m_comment(other.comment()), 
       m_iddObject(other.iddObject()),
-      m_fields(other.fields()), 
-      m_fieldComments(other.fieldComments())
+      m_fields(other.m_fields), 
+      m_fieldComments(other.fieldComments()),
+      m_revision(nextRevision())
   {
     if (keepHandle){
       OS_ASSERT(!other.handle().isNull());
@@ -93,7 +96,8 @@ namespace detail {
   }
 
   IdfObject_Impl::IdfObject_Impl(IddObjectType type, bool fastName) 
-    : m_handle(openstudio::createUUID())
+    : m_handle(openstudio::createUUID()),
+      m_revision(nextRevision())
   {
     OptionalIddObject candidate = IddFactory::instance().getObject(type);
     OS_ASSERT(candidate);
@@ -116,7 +120,8 @@ namespace detail {
 
   IdfObject_Impl::IdfObject_Impl(const IddObject& iddObject, bool fastName)
     : m_handle(openstudio::createUUID()),
-      m_iddObject(iddObject)
+      m_iddObject(iddObject),
+      m_revision(nextRevision())
   {
     if (this->m_iddObject.hasHandleField()) {
       bool ok = setString(0,toString(m_handle));
@@ -135,7 +140,8 @@ namespace detail {
   }
 
   IdfObject_Impl::IdfObject_Impl(const IddObject& iddObject, bool fastName, bool minimal)
-    : m_iddObject(iddObject)
+    : m_iddObject(iddObject),
+      m_revision(nextRevision())
   {
     OS_ASSERT(!fastName);
     OS_ASSERT(minimal);
@@ -147,10 +153,29 @@ namespace detail {
                                  const StringVector& fields,
                                  const StringVector& fieldComments) 
     : m_handle(handle),    
+      m_comment(comment),
+      m_iddObject(iddObject),
+      m_fieldComments(fieldComments),
+      m_revision(nextRevision())
+  {
+    m_fields.reserve(fields.size());
+    for (unsigned index = 0, n = fields.size(); index < n; ++index) {
+      m_fields.push_back(fieldValue(index, fields[index]));
+    }
+    resizeToMinFields();
+  }
+
+  IdfObject_Impl::IdfObject_Impl(const Handle& handle,
+                                 const std::string& comment,
+                                 const IddObject& iddObject,
+                                 const std::vector<IdfFieldValue>& fields,
+                                 const StringVector& fieldComments)
+    : m_handle(handle),
       m_comment(comment),
       m_iddObject(iddObject),
       m_fields(fields),
-      m_fieldComments(fieldComments) 
+      m_fieldComments(fieldComments),
+      m_revision(nextRevision())
   {
     resizeToMinFields();
   }
@@ -169,6 +194,10 @@ namespace detail {
     return m_comment;
   }
 
+  unsigned long long IdfObject_Impl::revision() const {
+    return m_revision;
+  }
+
   boost::optional<std::string> IdfObject_Impl::fieldComment(unsigned index, 
                                                             bool returnDefault) const 
   {
@@ -257,7 +286,7 @@ namespace detail {
   {
     OptionalString result;
     if (index < m_fields.size()) {
-      result = m_fields[index];
+      result = m_fields[index].str();
     }
     if (returnDefault && ((result && result->empty()) || (!result))) {
       OptionalIddField iddField = m_iddObject.getField(index);
@@ -412,7 +441,7 @@ namespace detail {
       
       m_fieldComments[index] = makeComment(cmnt);
 
-      m_diffs.push_back(IdfObjectDiff(index, m_fields[index], m_fields[index]));
+      m_diffs.push_back(IdfObjectDiff(index, m_fields[index].str(), m_fields[index].str()));
       
       return true;
     }
@@ -471,7 +500,7 @@ namespace detail {
       if (n == 0 && i == 1) {
         OS_ASSERT(!m_handle.isNull());
         m_fields.push_back(toString(m_handle));
-        m_diffs.push_back(IdfObjectDiff(0u,boost::none,m_fields.back()));
+        m_diffs.push_back(IdfObjectDiff(0u,boost::none,m_fields.back().str()));
       }
       n = numFields();
       if (i < n) {
@@ -543,7 +572,7 @@ namespace detail {
         }
       }
       else {
-        oldValue = m_fields[index];
+        oldValue = m_fields[index].str();
       }
 
       if (!result) {
@@ -561,7 +590,7 @@ namespace detail {
 
       OS_ASSERT(index < m_fields.size());
 
-      m_fields[index] = value;
+      m_fields[index] = fieldValue(index, value);
       m_diffs.push_back(IdfObjectDiff(index, oldValue, value));
       return result;
     }
@@ -674,7 +703,7 @@ namespace detail {
     if (m_iddObject.isNonextensibleField(index) || 
         (m_iddObject.isExtensibleField(index) && (m_iddObject.properties().numExtensible == 1))) 
     {
-      m_fields.push_back(value);
+      m_fields.push_back(fieldValue(index, value));
       m_diffs.push_back(IdfObjectDiff(index, boost::none, value));
       return true;
     }
@@ -1218,6 +1247,33 @@ namespace detail {
     return true;
   }
 
+  std::size_t IdfObject_Impl::dataFieldsHash() const {
+    std::size_t result = std::hash<std::string>()(m_iddObject.name());
+    std::string text;
+    for (unsigned i : dataFields()) {
+      boost::hash_combine(result, i);
+      if (OptionalIddField oIddField = m_iddObject.getField(i)) {
+        // numbers and urls may be equal with different text
+        IddFieldType type = oIddField->properties().type;
+        if ((type == IddFieldType::IntegerType) ||
+            (type == IddFieldType::RealType) ||
+            (type == IddFieldType::URLType))
+        {
+          continue;
+        }
+      }
+      text.assign(m_fields[i].data(), m_fields[i].size());
+      if (text.find('&') != std::string::npos) {
+        text = decodeString(text);
+      }
+      // strings are compared without regard to case
+      std::transform(text.begin(), text.end(), text.begin(),
+                     [](char c) { return static_cast<char>(toupper(static_cast<unsigned char>(c))); });
+      boost::hash_combine(result, std::hash<std::string>()(text));
+    }
+    return result;
+  }
+
   bool IdfObject_Impl::objectListFieldsEqual(const IdfObject& other) const {
     if (m_iddObject != other.iddObject()) { return false; }
     UnsignedVector myFields = objectListFields();
@@ -1444,6 +1500,27 @@ namespace detail {
     this->onChange.nano_emit();
 
     m_diffs.clear();
+    m_revision = nextRevision();
+  }
+
+  // PROTECTED
+
+  unsigned long long IdfObject_Impl::nextRevision() {
+    static std::atomic<unsigned long long> counter(0);
+    return ++counter;
+  }
+
+  IdfFieldValue IdfObject_Impl::fieldValue(unsigned index, const std::string& text) const {
+    // short text is stored inline, so only look up keys for longer text
+    if (text.size() > IdfFieldValue::maxInlineSize) {
+      if (OptionalIddField iddField = m_iddObject.getField(index)) {
+        boost::optional<IddKey> key = iddField->getKey(text);
+        if (key && (key->name() == text)) {
+          return IdfFieldValue::interned(text);
+        }
+      }
+    }
+    return IdfFieldValue(text);
   }
 
   // PRIVATE
@@ -1600,7 +1677,7 @@ namespace detail {
       if (iddField) {
 
         // add this to our fields
-        m_fields.push_back(fieldText);
+        m_fields.push_back(fieldValue(iddFieldIndex, fieldText));
 
         if (!commentOrOtherText.empty()) {
           // drop default comments
@@ -2012,7 +2089,7 @@ void IdfObject_Impl::populateValidityReport(ValidityReport& report, bool checkNa
 
   std::vector<std::string> IdfObject_Impl::fields() const
   {
-    return m_fields;
+    return std::vector<std::string>(m_fields.begin(), m_fields.end());
   }
 
   std::vector<std::string> IdfObject_Impl::fieldComments() const
@@ -31,6 +31,7 @@
 
 #include <utilities/UtilitiesAPI.hpp>
 #include <utilities/idf/Handle.hpp>
+#include <utilities/idf/IdfFieldValue.hpp>
 #include <utilities/idf/IdfObjectDiff.hpp>
 #include <utilities/idd/IddObject.hpp>
 
@@ -85,6 +86,13 @@ namespace detail {
                    const StringVector& fields,
                    const StringVector& fieldComments);
 
+    /** Constructor from underlying data that shares the field text. Used by WorkspaceObject_Impl. */
+    IdfObject_Impl(const Handle& handle,
+                   const std::string& comment,
+                   const IddObject& iddObject,
+                   const std::vector<IdfFieldValue>& fields,
+                   const StringVector& fieldComments);
+
     virtual ~IdfObject_Impl() {}
 
     //@}
@@ -100,6 +108,10 @@ namespace detail {
     /** Returns the comment block associated with the object. */
     std::string comment() const;
 
+    /** Returns a number that changes each time changes to this object are signaled. Revisions
+     *  are drawn from a process wide counter, so no two objects or states share a revision. */
+    unsigned long long revision() const;
+
     /** Returns the comment associated with field index, if one exists. Optionally, if returnDefault
      *  is passed in as true, and no field comment exists for index, fieldComment will return a 
      *  comment-ized version of the IddField name, following a commonly used Idf convention. */
@@ -323,6 +335,11 @@ namespace detail {
      *  of name. */
     bool dataFieldsEqual(const IdfObject& other) const;
 
+    /** Returns a hash of iddObject() and the dataFields() that is equal for objects that are
+     *  dataFieldsEqual, other than through the exception for objects with the same handle. Numbers
+     *  and urls can be equal with different text, so only their indices are hashed. */
+    std::size_t dataFieldsHash() const;
+
     /** Checks for equality of objectListFields(). Prerequisite: iddObject()s must be 
      *  equal. */
     bool objectListFieldsEqual(const IdfObject& other) const;
@@ -404,13 +421,22 @@ namespace detail {
     // idd object definition
     IddObject m_iddObject;
 
-    // idf fields
-    std::vector<std::string> m_fields;
+    // idf fields, see IdfFieldValue
+    std::vector<IdfFieldValue> m_fields;
     std::vector<std::string> m_fieldComments; // only populated if encounter non-empty, non-default comment
 
     // idf differences
     std::vector<IdfObjectDiff> m_diffs;
 
+    // changes each time the diffs are emitted, see revision
+    unsigned long long m_revision;
+
+    // returns the next value of the process wide revision counter
+    static unsigned long long nextRevision();
+
+    // returns the value to store for text in field index, IDD keys are interned
+    IdfFieldValue fieldValue(unsigned index, const std::string& text) const;
+
     // GETTER HELPERS
 
     std::vector<std::string> fields() const;
@@ -434,7 +460,7 @@ namespace detail {
     
    private:
 
-    IdfObject_Impl(){}
+    IdfObject_Impl() : m_revision(nextRevision()) {}
 
     // CONSTRUCTION HELPERS
 
@@ -30,6 +30,7 @@
 #include "IdfFixture.hpp"
 #include "../IdfObject.hpp"
 #include "../IdfObject_Impl.hpp"
+#include "../IdfFieldValue.hpp"
 #include "../IdfExtensibleGroup.hpp"
 #include "../IdfRegex.hpp"
 #include <utilities/idd/IddFactory.hxx>
@@ -43,6 +44,7 @@
 #include "../../units/OSOptionalQuantity.hpp"
 
 #include <utilities/idd/OS_Building_FieldEnums.hxx>
+#include <utilities/idd/OS_Surface_FieldEnums.hxx>
 
 #include <resources.hxx>
 
@@ -51,6 +53,8 @@
 
 #include <boost/lexical_cast.hpp>
 
+#include <chrono>
+#include <fstream>
 #include <sstream>
 #include <limits>
 
@@ -743,3 +747,120 @@ TEST_F(IdfFixture, DoubleDisplayedAsString) {
   EXPECT_DOUBLE_EQ(value,roundTripValue);
 }
 
+
+TEST_F(IdfFixture, IdfFieldValue)
+{
+  using openstudio::detail::IdfFieldValue;
+
+  EXPECT_EQ(16u, sizeof(IdfFieldValue));
+
+  IdfFieldValue empty;
+  EXPECT_TRUE(empty.empty());
+  EXPECT_TRUE(empty.isInline());
+  EXPECT_EQ("", empty.str());
+
+  IdfFieldValue number("-12.3456789012");
+  EXPECT_TRUE(number.isInline());
+  EXPECT_EQ("-12.3456789012", number.str());
+
+  std::string text("A long surface name that does not fit inline");
+  IdfFieldValue shared(text);
+  EXPECT_FALSE(shared.isInline());
+  EXPECT_FALSE(shared.isInterned());
+  EXPECT_EQ(text, shared);
+
+  // copies share the buffer
+  IdfFieldValue copy(shared);
+  EXPECT_EQ(shared.data(), copy.data());
+  copy = IdfFieldValue("short");
+  EXPECT_EQ("short", copy.str());
+  EXPECT_EQ(text, shared);
+
+  IdfFieldValue moved(std::move(shared));
+  EXPECT_EQ(text, moved);
+  EXPECT_TRUE(shared.empty());
+
+  IdfFieldValue interned = IdfFieldValue::interned("GroundFCfactorMethod");
+  EXPECT_TRUE(interned.isInterned());
+  EXPECT_EQ(interned.data(), IdfFieldValue::interned("GroundFCfactorMethod").data());
+  EXPECT_TRUE(IdfFieldValue::interned("Wall").isInline());
+
+  // embedded nulls round trip
+  std::string binary("a\0b", 3);
+  EXPECT_EQ(binary, IdfFieldValue(binary).str());
+}
+
+TEST_F(IdfFixture, IdfObject_InternsChoiceKeys)
+{
+  using openstudio::detail::IdfFieldValue;
+
+  IdfObject surface(IddObjectType::OS_Surface);
+  EXPECT_TRUE(surface.setString(OS_SurfaceFields::OutsideBoundaryCondition, "GroundFCfactorMethod"));
+  std::size_t numInterned = IdfFieldValue::numInterned();
+
+  for (unsigned i = 0; i < 100; ++i) {
+    IdfObject other(IddObjectType::OS_Surface);
+    EXPECT_TRUE(other.setString(OS_SurfaceFields::OutsideBoundaryCondition, "GroundFCfactorMethod"));
+    // keys that differ from the IDD in case keep their own text
+    EXPECT_TRUE(other.setString(OS_SurfaceFields::OutsideBoundaryCondition, "groundfcfactormethod"));
+    ASSERT_TRUE(other.getString(OS_SurfaceFields::OutsideBoundaryCondition));
+    EXPECT_EQ("groundfcfactormethod", other.getString(OS_SurfaceFields::OutsideBoundaryCondition).get());
+    // names are never interned
+    EXPECT_TRUE(other.setName("Surface with a fairly long name " + std::to_string(i)));
+  }
+  EXPECT_EQ(numInterned, IdfFieldValue::numInterned());
+
+  IdfObject clone = surface.clone();
+  ASSERT_TRUE(clone.getString(OS_SurfaceFields::OutsideBoundaryCondition));
+  EXPECT_EQ("GroundFCfactorMethod", clone.getString(OS_SurfaceFields::OutsideBoundaryCondition).get());
+  ASSERT_EQ(surface.numFields(), clone.numFields());
+  for (unsigned i = 1; i < surface.numFields(); ++i) {
+    EXPECT_EQ(surface.getString(i), clone.getString(i));
+  }
+}
+
+namespace {
+
+  // resident set size of this process in kB, 0 where /proc is not available
+  long residentSetSize()
+  {
+    std::ifstream statm("/proc/self/statm");
+    long pages = 0;
+    long resident = 0;
+    if (statm >> pages >> resident) {
+      return resident * 4;
+    }
+    return 0;
+  }
+
+}
+
+TEST_F(IdfFixture, DISABLED_IdfObject_Memory_Benchmark)
+{
+  const unsigned numSurfaces = 200000;
+  long before = residentSetSize();
+  auto start = std::chrono::steady_clock::now();
+
+  std::vector<IdfObject> surfaces;
+  surfaces.reserve(numSurfaces);
+  for (unsigned i = 0; i < numSurfaces; ++i) {
+    IdfObject surface(IddObjectType::OS_Surface);
+    surface.setName("Surface " + std::to_string(i));
+    surface.setString(OS_SurfaceFields::SurfaceType, "Wall");
+    surface.setString(OS_SurfaceFields::OutsideBoundaryCondition, "GroundFCfactorMethod");
+    surface.setString(OS_SurfaceFields::SunExposure, "NoSun");
+    surface.setString(OS_SurfaceFields::WindExposure, "NoWind");
+    for (unsigned j = 0; j < 4; ++j) {
+      std::vector<std::string> vertex{std::to_string(j % 2 ? 10.0 : 0.0), std::to_string(j / 2 ? 10.0 : 0.0), "0"};
+      surface.pushExtensibleGroup(vertex);
+    }
+    surfaces.push_back(surface);
+  }
+
+  auto end = std::chrono::steady_clock::now();
+  long after = residentSetSize();
+
+  std::cout << numSurfaces << " surfaces created in "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms, "
+            << (after - before) / 1024 << " MB resident" << std::endl;
+}
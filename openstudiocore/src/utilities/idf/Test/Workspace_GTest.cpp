@@ -44,9 +44,11 @@
 #include <utilities/idd/IddFactory.hxx>
 #include <utilities/idd/Building_FieldEnums.hxx>
 #include <utilities/idd/Construction_FieldEnums.hxx>
+#include <utilities/idd/Material_FieldEnums.hxx>
 #include <utilities/idd/Zone_FieldEnums.hxx>
 #include <utilities/idd/Lights_FieldEnums.hxx>
 #include <utilities/idd/Output_Meter_FieldEnums.hxx>
+#include <utilities/idd/Output_Variable_FieldEnums.hxx>
 #include <utilities/idd/Schedule_Compact_FieldEnums.hxx>
 #include <utilities/idd/Wall_Exterior_FieldEnums.hxx>
 #include <utilities/idd/Wall_Adiabatic_FieldEnums.hxx>
@@ -54,6 +56,7 @@
 #include <utilities/idd/BuildingSurface_Detailed_FieldEnums.hxx>
 #include <utilities/idd/Sizing_Zone_FieldEnums.hxx>
 #include <utilities/idd/OS_WeatherFile_FieldEnums.hxx>
+#include <utilities/idd/OS_Lights_FieldEnums.hxx>
 #include "../WorkspaceWatcher.hpp"
 #include "IdfTestQObjects.hpp"
 
@@ -73,8 +76,34 @@
 
 using namespace openstudio;
 
+#include <chrono>
 #include <iostream>
 
+namespace {
+
+  // adds numObjects default objects of type to workspace, named quickly as in large models
+  std::vector<WorkspaceObject> addDefaultObjects(Workspace& workspace, IddObjectType type, unsigned numObjects)
+  {
+    workspace.setFastNaming(true);
+    return workspace.addObjects(IdfObjectVector(numObjects, IdfObject(type)));
+  }
+
+  // a workspace of numDefinitions OS:Lights, each pointing to its own OS:Lights:Definition
+  Workspace lightsWorkspace(unsigned numDefinitions)
+  {
+    Workspace workspace(StrictnessLevel::Draft, IddFileType::OpenStudio);
+    std::vector<WorkspaceObject> definitions = addDefaultObjects(workspace, IddObjectType::OS_Lights_Definition, numDefinitions);
+    std::vector<WorkspaceObject> lights = addDefaultObjects(workspace, IddObjectType::OS_Lights, numDefinitions);
+    EXPECT_EQ(numDefinitions, definitions.size());
+    EXPECT_EQ(numDefinitions, lights.size());
+    for (unsigned i = 0, n = std::min(definitions.size(), lights.size()); i < n; ++i) {
+      EXPECT_TRUE(lights[i].setPointer(OS_LightsFields::LightsDefinitionName, definitions[i].handle()));
+    }
+    return workspace;
+  }
+
+}
+
 TEST_F(IdfFixture, IdfFile_Workspace_DefaultConstructor)
 {
   Workspace workspaceNone(StrictnessLevel::None);
@@ -218,6 +247,43 @@ TEST_F(IdfFixture, Workspace_ValidityCheckingAndReports_3) {
   EXPECT_TRUE(errorFound);
 }
 
+TEST_F(IdfFixture, Workspace_ValidityReport_ManyObjects) {
+  // enough objects for the object-level checks to be split across threads
+  Workspace workspace(StrictnessLevel::None, IddFileType::EnergyPlus);
+  WorkspaceObjectVector lights = addDefaultObjects(workspace, IddObjectType::Lights, 5000);
+  ASSERT_EQ(5000u, lights.size());
+  for (unsigned i = 0; i < lights.size(); i += 3) {
+    EXPECT_TRUE(lights[i].setString(LightsFields::ReturnAirFraction, "2.0"));
+  }
+
+  ValidityReport expected(StrictnessLevel::Draft);
+  for (const WorkspaceObject& object : workspace.objects()) {
+    ValidityReport objectReport = object.validityReport(StrictnessLevel::Draft, false);
+    OptionalDataError oError = objectReport.nextError();
+    while (oError) {
+      expected.insertError(*oError);
+      oError = objectReport.nextError();
+    }
+  }
+  EXPECT_GT(expected.numErrors(), 0u);
+
+  ValidityReport report = workspace.validityReport(StrictnessLevel::Draft);
+  EXPECT_EQ(expected.numErrors(), report.numErrors());
+
+  // equivalent errors are reported once, for the same object every time
+  ValidityReport again = workspace.validityReport(StrictnessLevel::Draft);
+  ASSERT_EQ(report.numErrors(), again.numErrors());
+  OptionalDataError oError = report.nextError();
+  OptionalDataError oOtherError = again.nextError();
+  while (oError && oOtherError) {
+    EXPECT_TRUE(*oError == *oOtherError);
+    oError = report.nextError();
+    oOtherError = again.nextError();
+  }
+  EXPECT_FALSE(oError);
+  EXPECT_FALSE(oOtherError);
+}
+
 TEST_F(IdfFixture, Workspace_FollowingPointers) {
 
   ASSERT_TRUE(epIdfFile.objects().size() > 0);
@@ -539,6 +605,60 @@ TEST_F(IdfFixture, Workspace_Clone) {
   EXPECT_FALSE(cloneHandles == wsHandles);
 }
 
+TEST_F(IdfFixture, Workspace_Clone_Pointers) {
+  Workspace workspace(StrictnessLevel::Draft, IddFileType::OpenStudio);
+  std::vector<WorkspaceObject> definitions, lights;
+  for (unsigned i = 0; i < 5; ++i) {
+    definitions.push_back(*workspace.addObject(IdfObject(IddObjectType::OS_Lights_Definition)));
+    definitions.back().setName("Definition " + std::to_string(i));
+    lights.push_back(*workspace.addObject(IdfObject(IddObjectType::OS_Lights)));
+    lights.back().setName("Lights " + std::to_string(i));
+    EXPECT_TRUE(lights.back().setPointer(OS_LightsFields::LightsDefinitionName, definitions.back().handle()));
+  }
+  HandleVector order = workspace.handles();
+  std::reverse(order.begin(), order.end());
+  workspace.order().setDirectOrder(order);
+
+  for (bool keepHandles : {false, true}) {
+    Workspace clone = workspace.clone(keepHandles);
+    EXPECT_EQ(workspace.numObjects(), clone.numObjects());
+    EXPECT_EQ(workspace.getObjectsByType(IddObjectType::OS_Lights).size(),
+              clone.getObjectsByType(IddObjectType::OS_Lights).size());
+    std::vector<WorkspaceObject> referenced = clone.getObjectsByReference("LightsDefinitionNames");
+    EXPECT_EQ(definitions.size(), referenced.size());
+    for (const WorkspaceObject& object : referenced) {
+      EXPECT_TRUE(clone.isMember(object.handle()));
+      EXPECT_EQ(IddObjectType(IddObjectType::OS_Lights_Definition), object.iddObject().type());
+    }
+
+    for (unsigned i = 0; i < lights.size(); ++i) {
+      OptionalWorkspaceObject cloneLights = clone.getObjectByTypeAndName(IddObjectType::OS_Lights, "Lights " + std::to_string(i));
+      ASSERT_TRUE(cloneLights);
+      EXPECT_EQ(keepHandles, cloneLights->handle() == lights[i].handle());
+      OptionalWorkspaceObject target = cloneLights->getTarget(OS_LightsFields::LightsDefinitionName);
+      ASSERT_TRUE(target);
+      EXPECT_TRUE(clone.isMember(target->handle()));
+      ASSERT_TRUE(target->name());
+      EXPECT_EQ("Definition " + std::to_string(i), target->name().get());
+      std::vector<WorkspaceObject> sources = target->sources();
+      ASSERT_EQ(1u, sources.size());
+      EXPECT_EQ(cloneLights->handle(), sources[0].handle());
+    }
+
+    // the direct order is kept, under the clones' handles
+    OptionalHandleVector cloneOrder = clone.order().directOrder();
+    ASSERT_TRUE(cloneOrder);
+    ASSERT_EQ(order.size(), cloneOrder->size());
+    for (unsigned i = 0; i < order.size(); ++i) {
+      OptionalWorkspaceObject original = workspace.getObject(order[i]);
+      OptionalWorkspaceObject cloned = clone.getObject((*cloneOrder)[i]);
+      ASSERT_TRUE(original);
+      ASSERT_TRUE(cloned);
+      EXPECT_EQ(original->name().get(), cloned->name().get());
+    }
+  }
+}
+
 TEST_F(IdfFixture,Workspace_Insert) {
   Workspace workspace(epIdfFile,StrictnessLevel::None);
   unsigned n = workspace.handles().size();
@@ -1419,6 +1539,90 @@ TEST_F(IdfFixture,Workspace_AvoidingNameClashes_Insert) {
   ASSERT_EQ(static_cast<unsigned>(2),insertedObjects[0].numExtensibleGroups());
 }
 
+TEST_F(IdfFixture,Workspace_InsertEquivalentObjects) {
+  Workspace ws(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+
+  IdfObject material(IddObjectType::Material);
+  material.setName("Material 1");
+  EXPECT_TRUE(material.setString(MaterialFields::Roughness,"Rough"));
+  EXPECT_TRUE(material.setDouble(MaterialFields::Thickness,0.1));
+  IdfObject construction(IddObjectType::Construction);
+  construction.setName("Construction 1");
+  ASSERT_FALSE(construction.pushExtensibleGroup(StringVector(1u,"Material 1")).empty());
+  IdfObjectVector objects;
+  objects.push_back(construction);
+  objects.push_back(material);
+  WorkspaceObjectVector added = ws.addObjects(objects);
+  ASSERT_EQ(2u,added.size());
+
+  // same data, different text
+  IdfObject sameMaterial(IddObjectType::Material);
+  sameMaterial.setName("MATERIAL 1");
+  EXPECT_TRUE(sameMaterial.setString(MaterialFields::Roughness,"ROUGH"));
+  EXPECT_TRUE(sameMaterial.setString(MaterialFields::Thickness,"0.100"));
+  // different data, same name
+  IdfObject otherMaterial = material.clone();
+  EXPECT_TRUE(otherMaterial.setDouble(MaterialFields::Thickness,0.2));
+
+  objects.clear();
+  objects.push_back(construction.clone());
+  objects.push_back(sameMaterial);
+  objects.push_back(otherMaterial);
+  WorkspaceObjectVector inserted = ws.insertObjects(objects);
+  ASSERT_EQ(3u,inserted.size());
+  EXPECT_EQ(3u,ws.numObjects());
+  EXPECT_TRUE(inserted[0] == added[0]);
+  EXPECT_TRUE(inserted[1] == added[1]);
+  EXPECT_FALSE(inserted[2] == added[1]);
+  EXPECT_NE("Material 1",inserted[2].name().get());
+  EXPECT_DOUBLE_EQ(0.2,inserted[2].getDouble(MaterialFields::Thickness).get());
+}
+
+TEST_F(IdfFixture,Workspace_InsertManyEquivalentObjects) {
+  // enough objects of each type that they are looked up through an index, by name for the
+  // materials and by data fields for the output variables, which have no name
+  Workspace ws(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  IdfObjectVector objects;
+  for (unsigned i = 0; i < 20; ++i) {
+    IdfObject material(IddObjectType::Material);
+    material.setName("Material " + std::to_string(i));
+    EXPECT_TRUE(material.setString(MaterialFields::Roughness,"Rough"));
+    EXPECT_TRUE(material.setDouble(MaterialFields::Thickness,0.1 + 0.01*i));
+    objects.push_back(material);
+    IdfObject variable(IddObjectType::Output_Variable);
+    EXPECT_TRUE(variable.setString(Output_VariableFields::KeyValue,"*"));
+    EXPECT_TRUE(variable.setString(Output_VariableFields::VariableName,"Variable " + std::to_string(i)));
+    objects.push_back(variable);
+  }
+  WorkspaceObjectVector added = ws.addObjects(objects);
+  ASSERT_EQ(40u,added.size());
+
+  // equivalent objects with new handles, then one changed object of each type
+  IdfObjectVector toInsert;
+  for (const IdfObject& object : objects) {
+    IdfObject clone = object.clone();
+    if (clone.iddObject().type() == IddObjectType::Material) {
+      clone.setName(boost::to_upper_copy(clone.name().get()));
+    }
+    toInsert.push_back(clone);
+  }
+  IdfObject otherMaterial = objects[0].clone();
+  EXPECT_TRUE(otherMaterial.setDouble(MaterialFields::Thickness,0.5));
+  toInsert.push_back(otherMaterial);
+  IdfObject otherVariable = objects[1].clone();
+  EXPECT_TRUE(otherVariable.setString(Output_VariableFields::VariableName,"Other Variable"));
+  toInsert.push_back(otherVariable);
+
+  WorkspaceObjectVector inserted = ws.insertObjects(toInsert);
+  ASSERT_EQ(42u,inserted.size());
+  EXPECT_EQ(42u,ws.numObjects());
+  for (unsigned i = 0; i < 40; ++i) {
+    EXPECT_TRUE(inserted[i] == added[i]) << i;
+  }
+  EXPECT_DOUBLE_EQ(0.5,inserted[40].getDouble(MaterialFields::Thickness).get());
+  EXPECT_EQ("Other Variable",inserted[41].getString(Output_VariableFields::VariableName).get());
+}
+
 TEST_F(IdfFixture,Workspace_AddAndInsertIdfObjects) {
   // base workspace
   Workspace ws(StrictnessLevel::Draft, IddFileType::EnergyPlus);
@@ -2029,6 +2233,283 @@ TEST_F(IdfFixture, Workspace_Signals)
   delete reciever;
 }
 
+class WorkspaceSignalCounter {
+ public:
+
+  WorkspaceSignalCounter(const Workspace& workspace)
+    : numAdded(0), numRemoved(0), numRemovedSets(0), numChanged(0)
+  {
+    std::shared_ptr<openstudio::detail::Workspace_Impl> impl = workspace.getImpl<openstudio::detail::Workspace_Impl>();
+    impl->Workspace_Impl::addWorkspaceObject.connect<WorkspaceSignalCounter, &WorkspaceSignalCounter::addWorkspaceObject>(this);
+    impl->Workspace_Impl::removeWorkspaceObject.connect<WorkspaceSignalCounter, &WorkspaceSignalCounter::removeWorkspaceObject>(this);
+    impl->Workspace_Impl::removeWorkspaceObjects.connect<WorkspaceSignalCounter, &WorkspaceSignalCounter::removeWorkspaceObjects>(this);
+    impl->Workspace_Impl::onChange.connect<WorkspaceSignalCounter, &WorkspaceSignalCounter::change>(this);
+  }
+
+  void addWorkspaceObject(const WorkspaceObject& object, const openstudio::IddObjectType& iddObjectType, const openstudio::UUID& handle)
+  {
+    EXPECT_TRUE(object.initialized());
+    ++numAdded;
+  }
+
+  void removeWorkspaceObject(const WorkspaceObject& object, const openstudio::IddObjectType& iddObjectType, const openstudio::UUID& handle)
+  {
+    ++numRemoved;
+  }
+
+  void removeWorkspaceObjects(const std::vector<WorkspaceObject>& objects)
+  {
+    ++numRemovedSets;
+    lastRemovedSetSize = objects.size();
+  }
+
+  void change()
+  {
+    ++numChanged;
+  }
+
+  unsigned numAdded;
+  unsigned numRemoved;
+  unsigned numRemovedSets;
+  unsigned lastRemovedSetSize = 0;
+  unsigned numChanged;
+};
+
+TEST_F(IdfFixture, Workspace_BatchEdit)
+{
+  Workspace workspace(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  WorkspaceSignalCounter counter(workspace);
+  EXPECT_FALSE(workspace.isBatchEditing());
+
+  {
+    WorkspaceBatchEdit batch = workspace.batchEdit();
+    EXPECT_TRUE(workspace.isBatchEditing());
+
+    OptionalWorkspaceObject zone = workspace.addObject(IdfObject(IddObjectType::Zone));
+    ASSERT_TRUE(zone);
+    EXPECT_TRUE(zone->setName("Zone 1"));
+
+    // objects are usable during the batch edit
+    OptionalWorkspaceObject lights = workspace.addObject(IdfObject(IddObjectType::Lights));
+    ASSERT_TRUE(lights);
+    EXPECT_TRUE(lights->setPointer(LightsFields::ZoneorZoneListName, zone->handle()));
+    ASSERT_TRUE(lights->getTarget(LightsFields::ZoneorZoneListName));
+    EXPECT_EQ(zone->handle(), lights->getTarget(LightsFields::ZoneorZoneListName)->handle());
+    EXPECT_EQ(1u, workspace.getObjectsByType(IddObjectType::Zone).size());
+
+    // added and removed within the batch edit, never announced
+    OptionalWorkspaceObject temp = workspace.addObject(IdfObject(IddObjectType::Zone));
+    ASSERT_TRUE(temp);
+    EXPECT_FALSE(temp->remove().empty());
+
+    {
+      // nested batch edits close with the outermost one
+      WorkspaceBatchEdit inner(batch);
+      EXPECT_TRUE(workspace.addObject(IdfObject(IddObjectType::Zone)));
+    }
+    EXPECT_TRUE(workspace.isBatchEditing());
+
+    EXPECT_EQ(0u, counter.numAdded);
+    EXPECT_EQ(0u, counter.numRemoved);
+    EXPECT_EQ(0u, counter.numChanged);
+  }
+
+  EXPECT_FALSE(workspace.isBatchEditing());
+  EXPECT_EQ(3u, counter.numAdded);
+  EXPECT_EQ(0u, counter.numRemoved);
+  EXPECT_EQ(1u, counter.numChanged);
+  EXPECT_EQ(2u, workspace.getObjectsByType(IddObjectType::Zone).size());
+
+  // after the batch edit, signals are emitted immediately again
+  OptionalWorkspaceObject zone = workspace.addObject(IdfObject(IddObjectType::Zone));
+  ASSERT_TRUE(zone);
+  EXPECT_EQ(4u, counter.numAdded);
+  EXPECT_EQ(2u, counter.numChanged);
+  zone->setName("Zone 3");
+  EXPECT_EQ(3u, counter.numChanged);
+}
+
+TEST_F(IdfFixture, Workspace_RemoveObjects)
+{
+  Workspace workspace(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  ASSERT_TRUE(workspace.order().isDirectOrder());
+
+  std::vector<WorkspaceObject> zones;
+  std::vector<WorkspaceObject> lights;
+  for (unsigned i = 0; i < 10; ++i) {
+    zones.push_back(workspace.addObject(IdfObject(IddObjectType::Zone)).get());
+    lights.push_back(workspace.addObject(IdfObject(IddObjectType::Lights)).get());
+    EXPECT_TRUE(lights.back().setPointer(LightsFields::ZoneorZoneListName, zones.back().handle()));
+  }
+  EXPECT_EQ(20u, workspace.numObjects());
+
+  // remove every other zone, with duplicates and a handle that is not in the workspace
+  std::vector<Handle> toRemove;
+  for (unsigned i = 0; i < 10; i += 2) {
+    toRemove.push_back(zones[i].handle());
+  }
+  toRemove.push_back(zones[0].handle());
+  toRemove.push_back(createUUID());
+
+  WorkspaceSignalCounter counter(workspace);
+  EXPECT_TRUE(workspace.removeObjects(toRemove));
+  EXPECT_EQ(5u, counter.numRemoved);
+  EXPECT_EQ(1u, counter.numRemovedSets);
+  EXPECT_EQ(5u, counter.lastRemovedSetSize);
+  EXPECT_EQ(1u, counter.numChanged);
+
+  EXPECT_EQ(15u, workspace.numObjects());
+  EXPECT_EQ(5u, workspace.getObjectsByType(IddObjectType::Zone).size());
+  EXPECT_EQ(15u, workspace.order().directOrder()->size());
+
+  for (unsigned i = 0; i < 10; ++i) {
+    if (i % 2 == 0) {
+      EXPECT_FALSE(zones[i].initialized());
+      EXPECT_FALSE(lights[i].getTarget(LightsFields::ZoneorZoneListName));
+    }
+    else {
+      EXPECT_TRUE(zones[i].initialized());
+      ASSERT_TRUE(lights[i].getTarget(LightsFields::ZoneorZoneListName));
+      EXPECT_EQ(zones[i].handle(), lights[i].getTarget(LightsFields::ZoneorZoneListName)->handle());
+    }
+  }
+
+  // remaining objects keep their relative order
+  std::vector<Handle> order = *workspace.order().directOrder();
+  EXPECT_EQ(lights[0].handle(), order[0]);
+  EXPECT_EQ(zones[1].handle(), order[1]);
+  EXPECT_EQ(lights[1].handle(), order[2]);
+}
+
+TEST_F(IdfFixture, DISABLED_Workspace_RemoveObjects_Benchmark)
+{
+  const unsigned numZones = 50000;
+  Workspace workspace(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  std::vector<WorkspaceObject> zones = addDefaultObjects(workspace, IddObjectType::Zone, numZones);
+  ASSERT_EQ(numZones, zones.size());
+
+  std::vector<Handle> toRemove;
+  for (unsigned i = 0; i < numZones; i += 2) {
+    toRemove.push_back(zones[i].handle());
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  EXPECT_TRUE(workspace.removeObjects(toRemove));
+  auto end = std::chrono::steady_clock::now();
+
+  std::cout << "removeObjects: " << toRemove.size() << " of " << numZones << " objects in "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+  EXPECT_EQ(numZones - toRemove.size(), workspace.numObjects());
+}
+
+TEST_F(IdfFixture, DISABLED_Workspace_Handles_Benchmark)
+{
+  Workspace workspace = lightsWorkspace(50000);
+  IdfFile idfFile = workspace.toIdfFile();
+
+  // pointers are loaded from their handle text
+  auto start = std::chrono::steady_clock::now();
+  Workspace loaded(idfFile, StrictnessLevel::Draft);
+  auto end = std::chrono::steady_clock::now();
+  std::cout << "load: " << loaded.numObjects() << " objects in "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+  EXPECT_EQ(workspace.numObjects(), loaded.numObjects());
+
+  start = std::chrono::steady_clock::now();
+  Workspace clone = workspace.clone();
+  end = std::chrono::steady_clock::now();
+  std::cout << "clone: " << clone.numObjects() << " objects in "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+  EXPECT_EQ(workspace.numObjects(), clone.numObjects());
+
+  std::vector<Handle> handles = workspace.handles();
+  const unsigned numPasses = 20;
+  unsigned numFound = 0;
+  start = std::chrono::steady_clock::now();
+  for (unsigned pass = 0; pass < numPasses; ++pass) {
+    for (const Handle& handle : handles) {
+      if (workspace.getObject(handle)) {
+        ++numFound;
+      }
+    }
+  }
+  end = std::chrono::steady_clock::now();
+  std::cout << "getObject: " << numFound << " lookups in "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+  EXPECT_EQ(numPasses * handles.size(), numFound);
+}
+
+TEST_F(IdfFixture, DISABLED_Workspace_Clone_Benchmark)
+{
+  Workspace workspace = lightsWorkspace(50000);
+
+  for (bool keepHandles : {false, true}) {
+    auto start = std::chrono::steady_clock::now();
+    Workspace clone = workspace.clone(keepHandles);
+    auto end = std::chrono::steady_clock::now();
+    std::cout << "clone(" << (keepHandles ? "true" : "false") << "): " << clone.numObjects() << " objects in "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+    EXPECT_EQ(workspace.numObjects(), clone.numObjects());
+  }
+}
+
+TEST_F(IdfFixture, DISABLED_Workspace_InsertComponent_Benchmark)
+{
+  // a library of constructions and their materials, as in a large component
+  const unsigned numConstructions = 2500;
+  IdfObjectVector library;
+  for (unsigned i = 0; i < numConstructions; ++i) {
+    std::string materialName = "Material " + std::to_string(i);
+    IdfObject material(IddObjectType::Material);
+    material.setName(materialName);
+    material.setString(MaterialFields::Roughness,"Rough");
+    material.setDouble(MaterialFields::Thickness,0.01 * (i % 20 + 1));
+    IdfObject construction(IddObjectType::Construction);
+    construction.setName("Construction " + std::to_string(i));
+    construction.pushExtensibleGroup(StringVector(1u,materialName));
+    library.push_back(construction);
+    library.push_back(material);
+  }
+
+  Workspace ws(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  for (const char* pass : {"new", "equivalent"}) {
+    auto start = std::chrono::steady_clock::now();
+    WorkspaceObjectVector inserted = ws.insertObjects(library);
+    auto end = std::chrono::steady_clock::now();
+    std::cout << "insertObjects (" << pass << "): " << inserted.size() << " objects in "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+    EXPECT_EQ(library.size(),inserted.size());
+    EXPECT_EQ(library.size(),ws.numObjects());
+  }
+}
+
+TEST_F(IdfFixture, DISABLED_Workspace_ValidityReport_Benchmark)
+{
+  const unsigned numLights = 100000;
+  Workspace workspace(StrictnessLevel::None, IddFileType::EnergyPlus);
+  WorkspaceObjectVector lights = addDefaultObjects(workspace, IddObjectType::Lights, numLights);
+  ASSERT_EQ(numLights, lights.size());
+  for (unsigned i = 0; i < numLights; i += 10) {
+    EXPECT_TRUE(lights[i].setString(LightsFields::ReturnAirFraction, "2.0"));
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  unsigned numObjectErrors = 0;
+  for (const WorkspaceObject& object : lights) {
+    numObjectErrors += object.validityReport(StrictnessLevel::Final, false).numErrors();
+  }
+  auto end = std::chrono::steady_clock::now();
+  std::cout << "object validityReports: " << numObjectErrors << " errors in "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+
+  start = std::chrono::steady_clock::now();
+  ValidityReport report = workspace.validityReport(StrictnessLevel::Final);
+  end = std::chrono::steady_clock::now();
+  std::cout << "validityReport: " << report.numErrors() << " errors in "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+  EXPECT_GT(report.numErrors(), 0u);
+}
+
 TEST_F(IdfFixture,Workspace_Swap) {
   Workspace ws1, ws2;
   ws1.addObject(IdfObject(IddObjectType::OS_Building));
@@ -44,6 +44,9 @@
 #include "../core/URLHelpers.hpp"
 #include "../core/Compare.hpp"
 #include "../core/StringHelpers.hpp"
+#include "../core/PathHelpers.hpp"
+#include "../core/UUID.hpp"
+#include "../core/Parallel.hpp"
 
 #include <boost/algorithm/string.hpp>
 #include <boost/regex.hpp>
@@ -54,6 +57,8 @@
 #include <deque>
 #include <map>
 #include <list>
+#include <unordered_map>
+#include <unordered_set>
 
 using namespace std;
 using openstudio::istringEqual; // used for all name comparisons
@@ -62,12 +67,25 @@ namespace openstudio {
 
 namespace detail {
 
+  namespace {
+
+    // not worth starting a thread to check the validity of fewer objects than this
+    const unsigned minObjectsPerValidityThread = 1000;
+
+    // not worth indexing the objects of a type to find equivalents for fewer objects than this
+    const unsigned minLookupsForEquivalentIndex = 16;
+
+  }
+
   // CONSTRUCTORS
 
   Workspace_Impl::Workspace_Impl(StrictnessLevel level,IddFileType iddFileType) :
       m_strictnessLevel(level),
       m_iddFileAndFactoryWrapper(iddFileType),
       m_fastNaming(false),
+      m_batchEditDepth(0),
+      m_batchEditChanged(false),
+      m_changeCount(0),
       m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
           WorkspaceObjectOrder_Impl(HandleVector(),std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
   {}
@@ -78,6 +96,9 @@ namespace detail {
       m_header(idfFile.header()),
       m_iddFileAndFactoryWrapper(idfFile.iddFileAndFactoryWrapper()),
       m_fastNaming(false),
+      m_batchEditDepth(0),
+      m_batchEditChanged(false),
+      m_changeCount(0),
       m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
           WorkspaceObjectOrder_Impl(HandleVector(),std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
   {}
@@ -87,6 +108,9 @@ namespace detail {
     m_header(other.m_header),
     m_iddFileAndFactoryWrapper(other.m_iddFileAndFactoryWrapper),
     m_fastNaming(other.fastNaming()),
+    m_batchEditDepth(0),
+    m_batchEditChanged(false),
+    m_changeCount(0),
     m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
           WorkspaceObjectOrder_Impl(std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
   {
@@ -109,6 +133,9 @@ namespace detail {
       m_header(), // subset of original data--discard header
       m_iddFileAndFactoryWrapper(other.m_iddFileAndFactoryWrapper),
       m_fastNaming(other.fastNaming()),
+      m_batchEditDepth(0),
+      m_batchEditChanged(false),
+      m_changeCount(0),
       m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
           WorkspaceObjectOrder_Impl(hs,std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
   {
@@ -170,9 +197,7 @@ namespace detail {
     m_fastNaming = otherImpl->m_fastNaming;
     otherImpl->m_fastNaming = tfn;
 
-    WorkspaceObjectMap twop = m_workspaceObjectMap;
-    m_workspaceObjectMap = otherImpl->m_workspaceObjectMap;
-    otherImpl->m_workspaceObjectMap = twop;
+    m_workspaceObjectMap.swap(otherImpl->m_workspaceObjectMap);
 
     WorkspaceObjectOrder twoo = m_workspaceObjectOrder;
     m_workspaceObjectOrder = otherImpl->m_workspaceObjectOrder;
@@ -501,11 +526,15 @@ namespace detail {
     HandleVector newHandles;
     WorkspaceObjectVector newObjects;
 
+    // progress is not reported object by object during a batch edit
+    bool reportProgress = (m_batchEditDepth == 0);
     int i = 0;
     int N = objectImplPtrs.size();
-    this->progressRange.nano_emit(0, 3*N);
-    this->progressValue.nano_emit(0);
-    this->progressCaption.nano_emit("Adding Objects");
+    if (reportProgress) {
+      this->progressRange.nano_emit(0, 3*N);
+      this->progressValue.nano_emit(0);
+      this->progressCaption.nano_emit("Adding Objects");
+    }
 
     // step 1: add to maps
     bool ok = true;
@@ -518,14 +547,14 @@ namespace detail {
       else {
         LOG(Error,"Tried to add two objects with the same handle: " << ptr->handle());
       }
-      this->progressValue.nano_emit(++i);
+      if (reportProgress) { this->progressValue.nano_emit(++i); }
     }
 
     // step 2: replace string pointers
     if (ok){
       for (WorkspaceObject_ImplPtr& ptr : objectImplPtrs) {
         ptr->initializeOnAdd(expectToLosePointers);
-        this->progressValue.nano_emit(++i);
+        if (reportProgress) { this->progressValue.nano_emit(++i); }
       }
     }
 
@@ -539,7 +568,7 @@ namespace detail {
       for (WorkspaceObject_ImplPtr& ptr : objectImplPtrs) {
         ptr->setInitialized();
         newObjects.push_back(WorkspaceObject(ptr));
-        this->progressValue.nano_emit(++i);
+        if (reportProgress) { this->progressValue.nano_emit(++i); }
       }
     }
 
@@ -591,16 +620,20 @@ namespace detail {
       const std::vector<HUPointer>& pointersFromWorkspace,
       bool driverMethod)
   {
+    // progress is not reported object by object during a batch edit
+    bool reportProgress = (m_batchEditDepth == 0);
     int i = 0;
     int N = objectImplPtrs.size();
-    if (oldNewHandleMap.empty()) {
-      this->progressRange.nano_emit(0, 2*N);
-    }
-    else {
-      this->progressRange.nano_emit(0, 3*N);
+    if (reportProgress) {
+      if (oldNewHandleMap.empty()) {
+        this->progressRange.nano_emit(0, 2*N);
+      }
+      else {
+        this->progressRange.nano_emit(0, 3*N);
+      }
+      this->progressValue.nano_emit(0);
+      this->progressCaption.nano_emit("Cloning Objects");
     }
-    this->progressValue.nano_emit(0);
-    this->progressCaption.nano_emit("Cloning Objects");
 
     // step 1: add objects to maps
     HandleVector newHandles;
@@ -609,14 +642,14 @@ namespace detail {
       m_workspaceObjectMap.insert(WorkspaceObjectMap::value_type(newHandles.back(),ptr));
       insertIntoIddObjectTypeMap(ptr);
       insertIntoIdfReferencesMap(ptr);
-      this->progressValue.nano_emit(++i);
+      if (reportProgress) { this->progressValue.nano_emit(++i); }
     }
 
     // step 2: apply handle map to pointers
     if (!oldNewHandleMap.empty()) {
       for (const WorkspaceObject_ImplPtr& ptr : objectImplPtrs) {
         ptr->initializeOnClone(oldNewHandleMap);
-        this->progressValue.nano_emit(++i);
+        if (reportProgress) { this->progressValue.nano_emit(++i); }
       }
     }
 
@@ -647,7 +680,7 @@ namespace detail {
     for (WorkspaceObject_ImplPtr& ptr : objectImplPtrs) {
       ptr->setInitialized();
       newObjects.push_back(WorkspaceObject(ptr));
-      this->progressValue.nano_emit(++i);
+      if (reportProgress) { this->progressValue.nano_emit(++i); }
     }
 
     // step 6: check validity
@@ -817,8 +850,9 @@ namespace detail {
     UnsignedVector notFoundObjectIndices;
     WorkspaceObjectVector equivalentObjects;
     unsigned i = nAdd;
+    std::vector<OptionalWorkspaceObject> oEquivalents = getEquivalentObjects(objectsToInsert);
     for (unsigned i = nAdd, n = idfObjects.size(); i < n; ++i) {
-      OptionalWorkspaceObject oEquivalent = getEquivalentObject(idfObjects[i]);
+      const OptionalWorkspaceObject& oEquivalent = oEquivalents[i - nAdd];
       if (oEquivalent) {
         foundObjectIndices.push_back(i);
         equivalentObjects.push_back(*oEquivalent);
@@ -846,11 +880,27 @@ namespace detail {
                                               // directly added by this method
     i = 0; // step through all of the objects
     auto equivIt = equivalentObjects.begin();
-    UnsignedVector::const_iterator foundIndicesBegin = foundObjectIndices.begin();
-    UnsignedVector::const_iterator foundIndicesEnd = foundObjectIndices.end();
+    // positions in equivalentObjects and newObjects, by index in allObjects, and index of each
+    // working object, so targets can be located without searching
+    std::vector<int> equivalentPositions(n,-1);
+    for (unsigned k = 0, nFound = foundObjectIndices.size(); k < nFound; ++k) {
+      equivalentPositions[foundObjectIndices[k]] = k;
+    }
+    std::vector<unsigned> newObjectPositions(n,0);
+    for (unsigned k = 0; k < nAdd; ++k) {
+      newObjectPositions[k] = k;
+    }
+    for (unsigned k = 0, nNotFound = notFoundObjectIndices.size(); k < nNotFound; ++k) {
+      newObjectPositions[notFoundObjectIndices[k]] = nAdd + k;
+    }
+    std::unordered_map<Handle,unsigned> workingIndices;
+    workingIndices.reserve(wsObjects.size());
+    for (unsigned k = 0, nWorking = wsObjects.size(); k < nWorking; ++k) {
+      workingIndices.insert(std::make_pair(wsObjects[k].handle(),k));
+    }
     // loop through Workspace versions of idfObjects
     for (const WorkspaceObject& object : wsObjects) {
-      if (std::find(foundIndicesBegin,foundIndicesEnd,i) == foundIndicesEnd) {
+      if (equivalentPositions[i] < 0) {
         // no equivalent object in workspace -- create new object to add
         if (changes) {
           IdfObject mergedObject = object.idfObject();
@@ -867,36 +917,22 @@ namespace detail {
         // preserve idfObject[i] -> idfObject[j]
         WorkspaceObjectVector targets = object.targets();
         for (const WorkspaceObject& target : targets) {
-          OptionalUnsigned targetIndexInWorking = working.order().indexInOrder(target.handle());
-          OS_ASSERT(targetIndexInWorking);
+          auto targetInWorkingIt = workingIndices.find(target.handle());
+          OS_ASSERT(targetInWorkingIt != workingIndices.end());
+          unsigned targetIndexInWorking = targetInWorkingIt->second;
           UnsignedVector fieldIndicesObjectToTarget = object.getSourceIndices(target.handle());
           OS_ASSERT(!fieldIndicesObjectToTarget.empty());
-          auto targetInFoundObjectsIt = std::find(
-              foundIndicesBegin,foundIndicesEnd,*targetIndexInWorking);
-          if (targetInFoundObjectsIt == foundIndicesEnd) {
+          int targetIndexInEquivalentObjects = equivalentPositions[targetIndexInWorking];
+          if (targetIndexInEquivalentObjects < 0) {
             // target has no equivalent in this Workspace
             // get index target will have in newObjects vector
-            unsigned newObjectsIndexOfTarget(0);
-            if (*targetIndexInWorking < nAdd) {
-              newObjectsIndexOfTarget = *targetIndexInWorking;
-            }
-            else {
-              UnsignedVector::const_iterator targetInNotFoundObjectsIt =
-                  std::find(notFoundObjectIndices.begin(),
-                  notFoundObjectIndices.end(),
-                  *targetIndexInWorking);
-              OS_ASSERT(targetInNotFoundObjectsIt != notFoundObjectIndices.end());
-              newObjectsIndexOfTarget = nAdd +
-                  static_cast<unsigned>(targetInNotFoundObjectsIt - notFoundObjectIndices.begin());
-            }
+            unsigned newObjectsIndexOfTarget = newObjectPositions[targetIndexInWorking];
             for (unsigned index : fieldIndicesObjectToTarget) {
               pointersFromWorkspace.push_back(HUPointer(equivIt->handle(),index,newObjectsIndexOfTarget));
             }
           }
           else {
             // target has equivalent in this Workspace. make sure pointer is there or add it.
-            unsigned targetIndexInEquivalentObjects = static_cast<unsigned>(
-                targetInFoundObjectsIt - foundIndicesBegin);
             WorkspaceObject equivalentTarget = equivalentObjects[targetIndexInEquivalentObjects];
             UnsignedVector fieldIndicesFoundObjectToFoundTarget = equivIt->getSourceIndices(equivalentTarget.handle());
             for (unsigned index : fieldIndicesObjectToTarget) {
@@ -943,7 +979,7 @@ namespace detail {
     equivIt = equivalentObjects.begin();
     OS_ASSERT(addedObjects.size() + equivalentObjects.size() == n);
     for (unsigned i = 0; i < n; ++i) {
-      if (std::find(foundIndicesBegin,foundIndicesEnd,i) == foundIndicesEnd) {
+      if (equivalentPositions[i] < 0) {
         // no equivalent--added
         OS_ASSERT(addedIt != addedObjects.end());
         result.push_back(*addedIt);
@@ -1057,8 +1093,10 @@ namespace detail {
     UnsignedVector foundObjectIndices;
     UnsignedVector notFoundObjectIndices;
     WorkspaceObjectVector equivalentObjects;
+    std::vector<OptionalWorkspaceObject> oEquivalents = getEquivalentObjects(
+        IdfObjectVector(objectsToInsert.begin(),objectsToInsert.end()));
     for (unsigned i = nAdd, n = allObjects.size(); i < n; ++i) {
-      OptionalWorkspaceObject oEquivalent = getEquivalentObject(allObjects[i]);
+      const OptionalWorkspaceObject& oEquivalent = oEquivalents[i - nAdd];
       if (oEquivalent) {
         foundObjectIndices.push_back(i);
         equivalentObjects.push_back(*oEquivalent);
@@ -1086,6 +1124,11 @@ namespace detail {
     // merge objects into one vector and find equivalent objects for objectsToInsert
     unsigned nAdd = objectsToAdd.size();
     WorkspaceObjectVector allObjects = objectsToAdd;
+    IdfObjectVector groupObjects;
+    for (const std::vector<WorkspaceObject>& group : objectsToInsert) {
+      groupObjects.insert(groupObjects.end(),group.begin(),group.end());
+    }
+    std::vector<OptionalWorkspaceObject> oEquivalents = getEquivalentObjects(groupObjects);
     unsigned i(nAdd);
     unsigned nInsert(0);
     for (const std::vector<WorkspaceObject>& group : objectsToInsert) {
@@ -1094,7 +1137,7 @@ namespace detail {
       for (const WorkspaceObject& object : group) {
         groupIndices.push_back(i);
         allObjects.push_back(object);
-        OptionalWorkspaceObject oEquivalent = getEquivalentObject(allObjects[i]);
+        const OptionalWorkspaceObject& oEquivalent = oEquivalents[i - nAdd];
         if (oEquivalent) {
           tempEquivalents.push_back(*oEquivalent);
         }
@@ -1157,32 +1200,50 @@ namespace detail {
     unsigned i = 0; // step through all of the objects
     unsigned j = 0; // index for new objects
     auto equivIt = equivalentObjects.begin();
-    auto foundIndicesBegin = foundObjectIndices.begin();
-    auto foundIndicesEnd = foundObjectIndices.end();
+    // positions in equivalentObjects and newObjects, by index in allObjects, and index of each
+    // working object, so targets can be located without searching
+    std::vector<int> equivalentPositions(n,-1);
+    for (unsigned k = 0, nFound = foundObjectIndices.size(); k < nFound; ++k) {
+      equivalentPositions[foundObjectIndices[k]] = k;
+    }
+    std::vector<unsigned> newObjectPositions(n,0);
+    for (unsigned k = 0; k < nAdd; ++k) {
+      newObjectPositions[k] = k;
+    }
+    for (unsigned k = 0, nNotFound = notFoundObjectIndices.size(); k < nNotFound; ++k) {
+      newObjectPositions[notFoundObjectIndices[k]] = nAdd + k;
+    }
+    std::unordered_map<Handle,unsigned> workingIndices;
+    workingIndices.reserve(wsObjects.size());
+    for (unsigned k = 0, nWorking = wsObjects.size(); k < nWorking; ++k) {
+      workingIndices.insert(std::make_pair(wsObjects[k].handle(),k));
+    }
     // keep track of outward pointers if objects[0].workspace() == workspace()
     bool sameWorkspace = false;
+    std::unordered_set<Handle> allHandles;
     if (allObjects[0].workspace() == this->workspace()) {
       sameWorkspace = true;
+      for (const WorkspaceObject& object : allObjects) {
+        allHandles.insert(object.handle());
+      }
     }
     // loop through working versions of allObjects
     for (const WorkspaceObject& object : wsObjects) {
-      if (std::find(foundIndicesBegin,foundIndicesEnd,i) == foundIndicesEnd) {
+      if (equivalentPositions[i] < 0) {
         // no equivalent object in workspace, create new object
         newObjects.push_back(this->createObject(object.getImpl<detail::WorkspaceObject_Impl>(),false));
         oldNewHandleMap.insert(HandleMap::value_type(object.handle(),newObjects.back()->handle()));
         WorkspaceObjectVector objectTargets = object.targets();
         // preserve pointers to equivalent objects
         for (const WorkspaceObject target : objectTargets) {
-          OptionalUnsigned targetIndexInWorking = working.order().indexInOrder(target.handle());
-          OS_ASSERT(targetIndexInWorking);
-          auto targetInFoundObjectsIt = std::find(
-              foundIndicesBegin,foundIndicesEnd,*targetIndexInWorking);
-          if (targetInFoundObjectsIt != foundIndicesEnd) {
+          auto targetInWorkingIt = workingIndices.find(target.handle());
+          OS_ASSERT(targetInWorkingIt != workingIndices.end());
+          unsigned targetIndexInWorking = targetInWorkingIt->second;
+          int targetIndexInEquivalentObjects = equivalentPositions[targetIndexInWorking];
+          if (targetIndexInEquivalentObjects >= 0) {
             // set pointer(s) to equivalent object
             UnsignedVector fieldIndicesObjectToTarget = object.getSourceIndices(target.handle());
             OS_ASSERT(!fieldIndicesObjectToTarget.empty());
-            unsigned targetIndexInEquivalentObjects = static_cast<unsigned>(
-                targetInFoundObjectsIt - foundIndicesBegin);
             WorkspaceObject equivalentTarget = equivalentObjects[targetIndexInEquivalentObjects];
             for (unsigned index : fieldIndicesObjectToTarget) {
               pointersIntoWorkspace.push_back(UHPointer(j,index,equivalentTarget.handle()));
@@ -1193,7 +1254,7 @@ namespace detail {
           // preserve external targets too
           objectTargets = allObjects[i].targets();
           for (const WorkspaceObject target : objectTargets) {
-            if (std::find(allObjects.begin(),allObjects.end(),target) == allObjects.end()) {
+            if (allHandles.find(target.handle()) == allHandles.end()) {
               UnsignedVector fieldIndices = allObjects[i].getSourceIndices(target.handle());
               for (unsigned index : fieldIndices) {
                 pointersIntoWorkspace.push_back(UHPointer(j,index,target.handle()));
@@ -1209,36 +1270,22 @@ namespace detail {
         // preserve idfObject[i] -> idfObject[j]
         WorkspaceObjectVector targets = object.targets();
         for (const WorkspaceObject& target : targets) {
-          OptionalUnsigned targetIndexInWorking = working.order().indexInOrder(target.handle());
-          OS_ASSERT(targetIndexInWorking);
+          auto targetInWorkingIt = workingIndices.find(target.handle());
+          OS_ASSERT(targetInWorkingIt != workingIndices.end());
+          unsigned targetIndexInWorking = targetInWorkingIt->second;
           UnsignedVector fieldIndicesObjectToTarget = object.getSourceIndices(target.handle());
           OS_ASSERT(!fieldIndicesObjectToTarget.empty());
-          auto targetInFoundObjectsIt = std::find(
-              foundIndicesBegin,foundIndicesEnd,*targetIndexInWorking);
-          if (targetInFoundObjectsIt == foundIndicesEnd) {
+          int targetIndexInEquivalentObjects = equivalentPositions[targetIndexInWorking];
+          if (targetIndexInEquivalentObjects < 0) {
             // target has no equivalent in this Workspace
             // get index target will have in newObjects vector
-            unsigned newObjectsIndexOfTarget(0);
-            if (*targetIndexInWorking < nAdd) {
-              newObjectsIndexOfTarget = *targetIndexInWorking;
-            }
-            else {
-              auto targetInNotFoundObjectsIt =
-                  std::find(notFoundObjectIndices.begin(),
-                  notFoundObjectIndices.end(),
-                  *targetIndexInWorking);
-              OS_ASSERT(targetInNotFoundObjectsIt != notFoundObjectIndices.end());
-              newObjectsIndexOfTarget = nAdd +
-                  static_cast<unsigned>(targetInNotFoundObjectsIt - notFoundObjectIndices.begin());
-            }
+            unsigned newObjectsIndexOfTarget = newObjectPositions[targetIndexInWorking];
             for (unsigned index : fieldIndicesObjectToTarget) {
               pointersFromWorkspace.push_back(HUPointer(equivIt->handle(),index,newObjectsIndexOfTarget));
             }
           }
           else {
             // target has equivalent in this Workspace. make sure pointer is there or add it.
-            unsigned targetIndexInEquivalentObjects = static_cast<unsigned>(
-                targetInFoundObjectsIt - foundIndicesBegin);
             WorkspaceObject equivalentTarget = equivalentObjects[targetIndexInEquivalentObjects];
             UnsignedVector fieldIndicesFoundObjectToFoundTarget = equivIt->getSourceIndices(equivalentTarget.handle());
             for (unsigned index : fieldIndicesObjectToTarget) {
@@ -1286,7 +1333,7 @@ namespace detail {
     equivIt = equivalentObjects.begin();
     OS_ASSERT(addedObjects.size() + equivalentObjects.size() == unsigned(n));
     for (unsigned i = 0; i < n; ++i) {
-      if (std::find(foundIndicesBegin,foundIndicesEnd,i) == foundIndicesEnd) {
+      if (equivalentPositions[i] < 0) {
         OS_ASSERT(addedIt != addedObjects.end());
         result.push_back(*addedIt);
         ++addedIt;
@@ -1493,8 +1540,12 @@ namespace detail {
       return true;
     } // trivially satisfied
 
-    this->removeWorkspaceObject.nano_emit(WorkspaceObject(objectData->objectImplPtr), objectData->objectImplPtr->iddObject().type(), objectData->handle);
-    this->removeWorkspaceObjectPtr.nano_emit(objectData->objectImplPtr, objectData->objectImplPtr->iddObject().type(), objectData->handle);
+    if (announceRemovalOfObject(objectData->handle)) {
+      WorkspaceObject object(objectData->objectImplPtr);
+      this->removeWorkspaceObject.nano_emit(object, objectData->objectImplPtr->iddObject().type(), objectData->handle);
+      this->removeWorkspaceObjectPtr.nano_emit(objectData->objectImplPtr, objectData->objectImplPtr->iddObject().type(), objectData->handle);
+      this->removeWorkspaceObjects.nano_emit(WorkspaceObjectVector(1u, object));
+    }
 
     // actual work of removing from maps--is always successful
     WorkspaceObjectVector sources = nominallyRemoveObject(handle);
@@ -1502,9 +1553,10 @@ namespace detail {
 
     // can only be invalid if removal results in null and required
     if ((m_strictnessLevel < StrictnessLevel::Final) || isValid()) {
-      std::vector<Handle> removedHandles(1, handle);
+      std::unordered_set<Handle> removedHandles;
+      removedHandles.insert(handle);
       registerRemovalOfObject(objectData->objectImplPtr,sources,removedHandles);
-      this->onChange.nano_emit();
+      change();
       return true;
     }
     else {
@@ -1518,25 +1570,44 @@ namespace detail {
 
     if (handles.empty()) { return true; }
 
-    SavedWorkspaceObjectVector objectData;
+    // unique handles of objects in this workspace, in the order given
+    HandleVector removedHandles;
+    std::unordered_set<Handle> removedHandleSet;
     for (const Handle& handle : handles) {
-      OptionalSavedWorkspaceObject candidate = savedWorkspaceObject(handle);
-      if (candidate) {
-        objectData.push_back(*candidate);
+      if (isMember(handle) && removedHandleSet.insert(handle).second) {
+        removedHandles.push_back(handle);
       }
     }
+    if (removedHandles.empty()) { return true; } // trivially satisfied
 
-    for (SavedWorkspaceObject savedObject : objectData) {
-      this->removeWorkspaceObject.nano_emit(WorkspaceObject(savedObject.objectImplPtr), savedObject.objectImplPtr->iddObject().type(), savedObject.handle);
-      this->removeWorkspaceObjectPtr.nano_emit(savedObject.objectImplPtr, savedObject.objectImplPtr->iddObject().type(), savedObject.handle);
+    // order indices are found in one pass over the order rather than one pass per object
+    std::vector<OptionalUnsigned> orderIndices = m_workspaceObjectOrder.indicesInOrder(removedHandles);
+    SavedWorkspaceObjectVector objectData;
+    WorkspaceObjectVector announcedObjects;
+    for (unsigned i = 0, n = removedHandles.size(); i < n; ++i) {
+      SavedWorkspaceObject savedObject(removedHandles[i],m_workspaceObjectMap.find(removedHandles[i])->second);
+      savedObject.orderIndex = orderIndices[i];
+      objectData.push_back(savedObject);
+      if (announceRemovalOfObject(savedObject.handle)) {
+        announcedObjects.push_back(WorkspaceObject(savedObject.objectImplPtr));
+      }
+    }
+
+    for (const WorkspaceObject& object : announcedObjects) {
+      std::shared_ptr<WorkspaceObject_Impl> objectImplPtr = object.getImpl<WorkspaceObject_Impl>();
+      this->removeWorkspaceObject.nano_emit(object, objectImplPtr->iddObject().type(), objectImplPtr->handle());
+      this->removeWorkspaceObjectPtr.nano_emit(objectImplPtr, objectImplPtr->iddObject().type(), objectImplPtr->handle());
+    }
+    if (!announcedObjects.empty()) {
+      this->removeWorkspaceObjects.nano_emit(announcedObjects);
     }
 
     // actual work of removing from maps--is always successful
-    std::vector<WorkspaceObjectVector> sources = nominallyRemoveObjects(handles);
+    std::vector<WorkspaceObjectVector> sources = nominallyRemoveObjects(removedHandles);
 
     if ((m_strictnessLevel < StrictnessLevel::Final) || isValid()) {
-      registerRemovalOfObjects(objectData,sources,handles);
-      this->onChange.nano_emit();
+      registerRemovalOfObjects(objectData,sources,removedHandleSet);
+      change();
       return true;
     }
     else {
@@ -1618,6 +1689,47 @@ namespace detail {
     m_fastNaming = fastNaming;
   }
 
+  void Workspace_Impl::beginBatchEdit()
+  {
+    ++m_batchEditDepth;
+  }
+
+  void Workspace_Impl::endBatchEdit()
+  {
+    OS_ASSERT(m_batchEditDepth > 0);
+    if (--m_batchEditDepth > 0) {
+      return;
+    }
+
+    std::vector<WorkspaceObject> additions;
+    additions.swap(m_batchEditAdditions);
+    std::unordered_set<Handle> addedHandles;
+    addedHandles.swap(m_batchEditAddedHandles);
+    bool changed = m_batchEditChanged;
+    m_batchEditChanged = false;
+
+    for (const WorkspaceObject& object : additions) {
+      // skip objects that were removed before the batch edit closed, and announce each object once
+      if (addedHandles.erase(object.handle()) > 0) {
+        emitAdditionOfObject(object);
+      }
+    }
+
+    if (changed) {
+      this->onChange.nano_emit();
+    }
+  }
+
+  bool Workspace_Impl::isBatchEditing() const
+  {
+    return (m_batchEditDepth > 0);
+  }
+
+  unsigned long long Workspace_Impl::changeCount() const
+  {
+    return m_changeCount;
+  }
+
   // OBJECT ORDER
 
   WorkspaceObjectOrder Workspace_Impl::order() {
@@ -1739,8 +1851,11 @@ namespace detail {
     map<string,list <std::shared_ptr<WorkspaceObject_Impl> > > objectsRepeatNames;
 
     // by-object items
+    std::vector<std::shared_ptr<WorkspaceObject_Impl> > objects;
+    objects.reserve(m_workspaceObjectMap.size());
     for (const WorkspaceObjectMap::value_type& p : m_workspaceObjectMap)
     {
+      objects.push_back(p.second);
 
       //find all objects with the same name
 
@@ -1772,33 +1887,56 @@ namespace detail {
           mapOfNames[*oName] = pair<bool,std::shared_ptr<WorkspaceObject_Impl> >(false,p.second);
         }
       }
+    }
 
+    // object-level checks only read this workspace, so contiguous ranges of objects are checked
+    // on separate threads. errors are merged in object order, so the report is the same as if
+    // the objects were checked one at a time.
+    auto checkRange = [this, &objects, level](std::size_t begin, std::size_t end, std::vector<DataError>& errors) {
+      for (std::size_t j = begin; j < end; ++j) {
+        const std::shared_ptr<WorkspaceObject_Impl>& object = objects[j];
 
-      // object-level report
-      ValidityReport objectReport = p.second->validityReport(level,false);
-      OptionalDataError oError = objectReport.nextError();
-      while (oError) {
-        report.insertError(*oError);
-        oError = objectReport.nextError();
-      }
+        // object-level report
+        ValidityReport objectReport = object->validityReport(level,false);
+        OptionalDataError oError = objectReport.nextError();
+        while (oError) {
+          errors.push_back(*oError);
+          oError = objectReport.nextError();
+        }
 
-      // StrictnessLevel::Draft
-      if (level > StrictnessLevel::None) {
-        // DataErrorType::NoIdd
-        // object-level
-        if (iddFileType() == IddFileType::UserCustom) {
-          if (!m_iddFileAndFactoryWrapper.isInFile(p.second->iddObject().name())) {
-            report.insertError(DataError(WorkspaceObject(p.second),DataErrorType(DataErrorType::NoIdd)));
+        // StrictnessLevel::Draft
+        if (level > StrictnessLevel::None) {
+          // DataErrorType::NoIdd
+          // object-level
+          if (iddFileType() == IddFileType::UserCustom) {
+            if (!m_iddFileAndFactoryWrapper.isInFile(object->iddObject().name())) {
+              errors.push_back(DataError(WorkspaceObject(object),DataErrorType(DataErrorType::NoIdd)));
+            }
           }
-        }
-        else {
-          if (!m_iddFileAndFactoryWrapper.isInFile(p.second->iddObject().type())) {
-            report.insertError(DataError(WorkspaceObject(p.second),DataErrorType(DataErrorType::NoIdd)));
+          else {
+            if (!m_iddFileAndFactoryWrapper.isInFile(object->iddObject().type())) {
+              errors.push_back(DataError(WorkspaceObject(object),DataErrorType(DataErrorType::NoIdd)));
+            }
           }
-        }
-      } // StrictnessLevel::Draft
+        } // StrictnessLevel::Draft
+      }
+    };
 
-      this->progressValue.nano_emit(++i);
+    std::vector<IndexRange> ranges = threadRanges(objects.size(), 0, minObjectsPerValidityThread);
+    std::vector<std::vector<DataError> > rangeErrors(ranges.size());
+    if (ranges.size() > 1) {
+      LOG(Trace,"Checking validity of " << objects.size() << " objects on " << ranges.size() << " threads.");
+    }
+    runOnThreads(ranges, [&checkRange, &rangeErrors](std::size_t k, std::size_t begin, std::size_t end) {
+      checkRange(begin, end, rangeErrors[k]);
+    });
+
+    for (unsigned k = 0; k < ranges.size(); ++k) {
+      for (const DataError& error : rangeErrors[k]) {
+        report.insertError(error);
+      }
+      i = ranges[k].second;
+      this->progressValue.nano_emit(i);
     }
 
     // StrictnessLevel::Draft
@@ -1879,30 +2017,285 @@ namespace detail {
   // SERIALIZATION
 
   bool Workspace_Impl::save(const openstudio::path& p, bool overwrite) {
-    return toIdfFile().save(p,overwrite);
+    IdfFile idfFile = emptyIdfFile();
+    boost::optional<path> wp = idfFile.savePath(p,overwrite);
+    if (!wp) {
+      return false;
+    }
+
+    if (!makeParentFolder(*wp)) {
+      LOG(Error,"Unable to write file to path '" << toString(*wp) << "', because parent directory "
+          << "could not be created.");
+      return false;
+    }
+
+    // write next to the target and rename, so that the last saved file can be read while writing
+    path tp = toPath(toString(*wp) + ".tmp");
+    openstudio::filesystem::ofstream outFile(tp);
+    if (!outFile) {
+      LOG(Error,"Unable to write file to path '" << toString(*wp) << "'.");
+      return false;
+    }
+    openstudio::filesystem::ifstream savedFile;
+    if (!m_savedPath.empty()) {
+      savedFile.open(m_savedPath);
+    }
+
+    // copy unchanged objects from the last saved file, pointers are only stable if serialized as
+    // handles
+    std::unordered_map<Handle, SavedObject> savedObjects;
+    savedObjects.reserve(m_workspaceObjectMap.size());
+    std::string text;
+    idfFile.print(outFile);
+    for (const WorkspaceObject& object : serializationOrder()) {
+      SavedObject& savedObject = savedObjects[object.handle()];
+      savedObject.revision = object.getImpl<WorkspaceObject_Impl>()->revision();
+      bool copied = false;
+      auto it = m_savedObjects.find(object.handle());
+      if ((it != m_savedObjects.end()) && (it->second.revision == savedObject.revision) &&
+          (it->second.length > 0) && object.iddObject().hasHandleField() && savedFile.is_open())
+      {
+        text.resize(it->second.length);
+        savedFile.clear();
+        copied = (savedFile.seekg(it->second.offset) &&
+                  savedFile.read(&text[0], text.size()) &&
+                  (std::hash<std::string>()(text) == it->second.hash));
+        savedObject.hash = it->second.hash;
+      }
+      if (!copied) {
+        std::stringstream ss;
+        object.idfObject().print(ss);
+        text = ss.str();
+        savedObject.hash = std::hash<std::string>()(text);
+      }
+      savedObject.offset = outFile.tellp();
+      savedObject.length = text.size();
+      outFile << text;
+    }
+    savedFile.close();
+    outFile.close();
+
+    if (!outFile) {
+      LOG(Error,"Unable to write file to path '" << toString(*wp) << "'.");
+      openstudio::filesystem::remove(tp);
+      return false;
+    }
+    boost::system::error_code ec;
+    openstudio::filesystem::rename(tp, *wp, ec);
+    if (ec) {
+      LOG(Error,"Unable to write file to path '" << toString(*wp) << "': " << ec.message());
+      openstudio::filesystem::remove(tp);
+      return false;
+    }
+
+    m_savedObjects.swap(savedObjects);
+    m_savedPath = *wp;
+    m_journaledRevisions.clear();
+    for (const auto& savedObject : m_savedObjects) {
+      m_journaledRevisions.insert(m_journaledRevisions.end(), std::make_pair(savedObject.first, savedObject.second.revision));
+    }
+
+    path jp = journalPath(*wp);
+    if (openstudio::filesystem::exists(jp)) {
+      openstudio::filesystem::remove(jp);
+    }
+
+    return true;
   }
 
-  IdfFile Workspace_Impl::toIdfFile() {
+  bool Workspace_Impl::writeJournal(const openstudio::path& p) {
+    boost::optional<path> wp = emptyIdfFile().savePath(p,true);
+    OS_ASSERT(wp);
 
-    IdfFile result;
-    if (OptionalIdfObject vo = result.versionObject()) {
-      result.removeObject(*vo);
+    std::stringstream ss;
+    std::unordered_map<Handle, unsigned long long> journaledRevisions;
+    journaledRevisions.reserve(m_workspaceObjectMap.size());
+    for (const WorkspaceObject& object : serializationOrder()) {
+      if (!object.iddObject().hasHandleField()) {
+        LOG(Error,"Unable to journal changes to '" << toString(*wp) << "', because " << object.briefDescription()
+            << " has no handle field.");
+        return false;
+      }
+      unsigned long long revision = object.getImpl<WorkspaceObject_Impl>()->revision();
+      auto it = m_journaledRevisions.find(object.handle());
+      if ((it == m_journaledRevisions.end()) || (it->second != revision)) {
+        ss << "!@ set" << std::endl;
+        object.idfObject().print(ss);
+      }
+      journaledRevisions.insert(journaledRevisions.end(), std::make_pair(object.handle(), revision));
+    }
+    for (const auto& journaledRevision : m_journaledRevisions) {
+      if (journaledRevisions.find(journaledRevision.first) == journaledRevisions.end()) {
+        ss << "!@ remove " << toString(journaledRevision.first) << std::endl;
+      }
     }
 
-    // header
-    result.setHeader(m_header);
+    if (ss.tellp() > 0) {
+      // replayJournal only applies batches that end with a commit record
+      ss << "!@ commit" << std::endl;
+      openstudio::filesystem::ofstream outFile(journalPath(*wp), std::ios_base::out | std::ios_base::app);
+      if (!outFile) {
+        LOG(Error,"Unable to open journal for '" << toString(*wp) << "'.");
+        return false;
+      }
+      outFile << ss.rdbuf();
+      outFile.close();
+      if (!outFile) {
+        LOG(Error,"Unable to write journal for '" << toString(*wp) << "'.");
+        return false;
+      }
+    }
 
-    // specify IddFile
-    result.setIddFileAndFactoryWrapper(m_iddFileAndFactoryWrapper);
+    m_journaledRevisions.swap(journaledRevisions);
+    return true;
+  }
 
-    // add version object
-    if (OptionalWorkspaceObject vo = versionObject()) {
-      result.addObject(vo->idfObject());
+  std::vector<Handle> Workspace_Impl::handlesAddedSinceSave() const {
+    std::vector<Handle> result;
+    for (const auto& object : m_workspaceObjectMap) {
+      if (m_savedObjects.find(object.first) == m_savedObjects.end()) {
+        result.push_back(object.first);
+      }
+    }
+    return result;
+  }
+
+  std::vector<Handle> Workspace_Impl::handlesModifiedSinceSave() const {
+    std::vector<Handle> result;
+    for (const auto& object : m_workspaceObjectMap) {
+      auto it = m_savedObjects.find(object.first);
+      if ((it != m_savedObjects.end()) && (it->second.revision != object.second->revision())) {
+        result.push_back(object.first);
+      }
+    }
+    return result;
+  }
+
+  std::vector<Handle> Workspace_Impl::handlesRemovedSinceSave() const {
+    std::vector<Handle> result;
+    for (const auto& savedObject : m_savedObjects) {
+      if (m_workspaceObjectMap.find(savedObject.first) == m_workspaceObjectMap.end()) {
+        result.push_back(savedObject.first);
+      }
+    }
+    return result;
+  }
+
+  void Workspace_Impl::markAsSaved() {
+    m_savedObjects.clear();
+    m_savedPath.clear();
+    m_journaledRevisions.clear();
+    for (const auto& object : m_workspaceObjectMap) {
+      unsigned long long revision = object.second->revision();
+      SavedObject savedObject;
+      savedObject.revision = revision;
+      savedObject.offset = 0;
+      savedObject.length = 0;
+      savedObject.hash = 0;
+      m_savedObjects.insert(m_savedObjects.end(), std::make_pair(object.first, savedObject));
+      m_journaledRevisions.insert(m_journaledRevisions.end(), std::make_pair(object.first, revision));
+    }
+  }
+
+  openstudio::path Workspace_Impl::journalPath(const openstudio::path& p) {
+    return toPath(toString(p) + ".journal");
+  }
+
+  bool Workspace_Impl::replayJournal(IdfFile& idfFile, const openstudio::path& journalPath) {
+    openstudio::filesystem::ifstream inFile(journalPath);
+    if (!inFile) {
+      LOG(Error,"Unable to read journal '" << toString(journalPath) << "'.");
+      return false;
+    }
+
+    // final state of each journaled object, boost::none if removed
+    std::map<Handle, boost::optional<IdfObject> > committed;
+    std::vector<std::pair<Handle, boost::optional<IdfObject> > > batch;
+    std::string objectText;
+    bool inObject = false;
+    bool ok = true;
+
+    auto finishObject = [&]() {
+      if (!inObject) {
+        return true;
+      }
+      inObject = false;
+      // the type name follows any comment lines
+      std::string::size_type begin = 0;
+      while ((begin < objectText.size()) && (objectText[begin] == '!')) {
+        begin = objectText.find('\n',begin) + 1;
+      }
+      std::string typeName = objectText.substr(begin, objectText.find_first_of(",;",begin) - begin);
+      boost::trim(typeName);
+      if (OptionalIddObject iddObject = idfFile.iddFileAndFactoryWrapper().getObject(typeName)) {
+        if (OptionalIdfObject object = IdfObject::load(objectText,*iddObject)) {
+          batch.push_back(std::make_pair(object->handle(), object));
+          return true;
+        }
+      }
+      return false;
+    };
+
+    std::string line;
+    while (ok && std::getline(inFile,line)) {
+      if (boost::starts_with(line,"!@ ")) {
+        ok = finishObject();
+        std::string record = line.substr(3);
+        boost::trim(record);
+        if (record == "set") {
+          inObject = true;
+          objectText.clear();
+        }
+        else if (boost::starts_with(record,"remove ")) {
+          batch.push_back(std::make_pair(toUUID(record.substr(7)), boost::optional<IdfObject>()));
+        }
+        else if (record == "commit") {
+          for (const auto& entry : batch) {
+            committed[entry.first] = entry.second;
+          }
+          batch.clear();
+        }
+        else {
+          ok = false;
+        }
+      }
+      else if (inObject) {
+        objectText += line;
+        objectText += '\n';
+      }
+    }
+
+    if (!ok || !batch.empty() || inObject) {
+      LOG(Warn,"Ignoring incomplete records at the end of journal '" << toString(journalPath) << "'.");
+    }
+
+    std::vector<IdfObject> toRemove;
+    for (const IdfObject& object : idfFile.objects()) {
+      if (committed.find(object.handle()) != committed.end()) {
+        toRemove.push_back(object);
+      }
+    }
+    if (OptionalIdfObject versionObject = idfFile.versionObject()) {
+      if (committed.find(versionObject->handle()) != committed.end()) {
+        toRemove.push_back(*versionObject);
+      }
+    }
+    idfFile.removeObjects(toRemove);
+
+    for (const auto& entry : committed) {
+      if (entry.second) {
+        idfFile.addObject(*entry.second);
+      }
     }
 
+    return true;
+  }
+
+  IdfFile Workspace_Impl::toIdfFile() {
+    IdfFile result = emptyIdfFile();
+
     // add objects and replace handle pointers with names
-    WorkspaceObjectVector objs = objects(true); // sorted objects
-    for (const WorkspaceObject& obj : objs) {
+    for (const WorkspaceObject& obj : serializationOrder()) {
       result.addObject(obj.idfObject());
     }
 
@@ -1919,6 +2312,31 @@ namespace detail {
     return result;
   }
 
+  IdfFile Workspace_Impl::emptyIdfFile() const {
+    IdfFile result;
+    if (OptionalIdfObject vo = result.versionObject()) {
+      result.removeObject(*vo);
+    }
+
+    // header
+    result.setHeader(m_header);
+
+    // specify IddFile
+    result.setIddFileAndFactoryWrapper(m_iddFileAndFactoryWrapper);
+
+    return result;
+  }
+
+  std::vector<WorkspaceObject> Workspace_Impl::serializationOrder() const {
+    WorkspaceObjectVector result;
+    if (OptionalWorkspaceObject vo = versionObject()) {
+      result.push_back(*vo);
+    }
+    WorkspaceObjectVector objs = objects(true); // sorted objects
+    result.insert(result.end(), objs.begin(), objs.end());
+    return result;
+  }
+
   bool Workspace_Impl::baseNamesMatch(const std::string& baseName, const std::string& objectName) const {
     return istringEqual(baseName, getBaseName(objectName));
   }
@@ -2010,17 +2428,7 @@ namespace detail {
     OptionalWorkspaceObject result;
     OptionalWorkspaceObject wsOther = other.optionalCast<WorkspaceObject>();
     for (const WorkspaceObject& candidate : candidates) {
-      if (wsOther) {
-        if (candidate.dataFieldsEqual(*wsOther) &&
-            candidate.objectListFieldsNonConflicting(*wsOther))
-        {
-          result = candidate;
-          break;
-        }
-      }
-      else if (other.dataFieldsEqual(candidate) &&
-               other.objectListFieldsNonConflicting(candidate))
-      {
+      if (isEquivalentObject(candidate,other,wsOther)) {
         result = candidate;
         break;
       }
@@ -2029,6 +2437,104 @@ namespace detail {
     return result;
   }
 
+  std::vector<boost::optional<WorkspaceObject> > Workspace_Impl::getEquivalentObjects(
+      const std::vector<IdfObject>& others) const
+  {
+    std::vector<OptionalWorkspaceObject> result(others.size());
+
+    // group the lookups by type, unnamed objects of named types may match an object with the
+    // same handle but another name, and custom types share one IddObjectType, so these are
+    // always looked up one at a time
+    std::map<IddObjectType, std::vector<unsigned> > lookupsByType;
+    for (unsigned i = 0, n = others.size(); i < n; ++i) {
+      const IdfObject& other = others[i];
+      OptionalString oName = other.name();
+      if (other.iddObject().isVersionObject() ||
+          (other.iddObject().type() == IddObjectType::UserCustom) ||
+          ((!oName || oName->empty()) && other.iddObject().nameFieldIndex()))
+      {
+        result[i] = getEquivalentObject(other);
+      }
+      else {
+        lookupsByType[other.iddObject().type()].push_back(i);
+      }
+    }
+
+    for (const auto& lookups : lookupsByType) {
+      // indexing every object of the type only pays off for many lookups
+      if (lookups.second.size() < minLookupsForEquivalentIndex) {
+        for (unsigned i : lookups.second) {
+          result[i] = getEquivalentObject(others[i]);
+        }
+        continue;
+      }
+      auto loc = m_iddObjectTypeMap.find(lookups.first);
+      if (loc == m_iddObjectTypeMap.end()) {
+        continue;
+      }
+
+      if (others[lookups.second.front()].iddObject().nameFieldIndex()) {
+        // named objects are only compared with the first object of the same name, as in
+        // getEquivalentObject, so index them by name
+        std::unordered_map<std::string, WorkspaceObject_ImplPtr> byName;
+        byName.reserve(loc->second.size());
+        for (const WorkspaceObjectMap::value_type& p : loc->second) {
+          if (OptionalString candidateName = p.second->name()) {
+            byName.insert(std::make_pair(boost::to_upper_copy(*candidateName), p.second));
+          }
+        }
+        for (unsigned i : lookups.second) {
+          const IdfObject& other = others[i];
+          auto it = byName.find(boost::to_upper_copy(*other.name()));
+          if (it != byName.end()) {
+            WorkspaceObject candidate(it->second);
+            if (isEquivalentObject(candidate,other,other.optionalCast<WorkspaceObject>())) {
+              result[i] = candidate;
+            }
+          }
+        }
+      }
+      else {
+        // objects without names are compared with every object of the type, so only compare
+        // objects whose data fields hash the same, in the order getEquivalentObject would
+        std::unordered_map<std::size_t, std::vector<WorkspaceObject_ImplPtr> > byDataFields;
+        byDataFields.reserve(loc->second.size());
+        for (const WorkspaceObjectMap::value_type& p : loc->second) {
+          byDataFields[p.second->dataFieldsHash()].push_back(p.second);
+        }
+        for (unsigned i : lookups.second) {
+          const IdfObject& other = others[i];
+          auto it = byDataFields.find(other.getImpl<IdfObject_Impl>()->dataFieldsHash());
+          if (it == byDataFields.end()) {
+            continue;
+          }
+          OptionalWorkspaceObject wsOther = other.optionalCast<WorkspaceObject>();
+          for (const WorkspaceObject_ImplPtr& ptr : it->second) {
+            WorkspaceObject candidate(ptr);
+            if (isEquivalentObject(candidate,other,wsOther)) {
+              result[i] = candidate;
+              break;
+            }
+          }
+        }
+      }
+    }
+
+    return result;
+  }
+
+  bool Workspace_Impl::isEquivalentObject(const WorkspaceObject& candidate,
+                                          const IdfObject& other,
+                                          const boost::optional<WorkspaceObject>& wsOther) const
+  {
+    if (wsOther) {
+      return (candidate.dataFieldsEqual(*wsOther) &&
+              candidate.objectListFieldsNonConflicting(*wsOther));
+    }
+    return (other.dataFieldsEqual(candidate) &&
+            other.objectListFieldsNonConflicting(candidate));
+  }
+
   // SETTER HELPERS
 
   bool Workspace_Impl::setIddFile(const IddFileAndFactoryWrapper& iddFileAndFactoryWrapper) {
@@ -2235,7 +2741,7 @@ namespace detail {
     return result;
   }
 
-  std::vector<WorkspaceObject> Workspace_Impl::nominallyRemoveObject(const Handle& handle) {
+  std::vector<WorkspaceObject> Workspace_Impl::nominallyRemoveObject(const Handle& handle, bool eraseFromOrder) {
     // get object. should exist since call came from within Workspace.
     OptionalWorkspaceObject oObject = getObject(handle);
     if (!oObject) {
@@ -2294,7 +2800,7 @@ namespace detail {
     if (iotmLoc->second.empty()) { m_iddObjectTypeMap.erase(iotmLoc); }
 
     // WorkspaceObjectOrder
-    if (m_workspaceObjectOrder.isDirectOrder()) {
+    if (eraseFromOrder && m_workspaceObjectOrder.isDirectOrder()) {
       m_workspaceObjectOrder.erase(handle);
     }
 
@@ -2308,20 +2814,24 @@ namespace detail {
   std::vector<std::vector<WorkspaceObject> > Workspace_Impl::nominallyRemoveObjects(const std::vector<Handle>& handles) {
     std::vector<std::vector<WorkspaceObject> > sources;
     for (const Handle& handle : handles) {
-      sources.push_back(nominallyRemoveObject(handle));
+      sources.push_back(nominallyRemoveObject(handle,false));
+    }
+    // erasing from the direct order one handle at a time is quadratic
+    if (m_workspaceObjectOrder.isDirectOrder()) {
+      m_workspaceObjectOrder.erase(handles);
     }
     return sources;
   }
 
   void Workspace_Impl::registerRemovalOfObject(std::shared_ptr<WorkspaceObject_Impl> ptr,
                                                const std::vector<WorkspaceObject>& sources,
-                                               const std::vector<Handle>& removedHandles)
+                                               const std::unordered_set<Handle>& removedHandles)
   {
     //DLM@20110810: moved remove emits to occur before object is removed from workspace
     //ptr->emitChangeSignals(); // do not emit signals for changes that occurred during removal
     for (const WorkspaceObject& source : sources) {
       // do not emit signals if this source is also being removed
-      if (std::find(removedHandles.begin(), removedHandles.end(), source.handle()) == removedHandles.end()){
+      if (removedHandles.find(source.handle()) == removedHandles.end()){
         source.getImpl<detail::WorkspaceObject_Impl>()->emitChangeSignals();
       }
     }
@@ -2331,7 +2841,7 @@ namespace detail {
 
   void Workspace_Impl::registerRemovalOfObjects(std::vector<SavedWorkspaceObject>& savedObjects,
                                                 const std::vector<std::vector<WorkspaceObject> >& sources,
-                                                const std::vector<Handle>& removedHandles)
+                                                const std::unordered_set<Handle>& removedHandles)
   {
     for (int i = 0, n = savedObjects.size(); i < n; ++i) {
       registerRemovalOfObject(savedObjects[i].objectImplPtr,sources[i],removedHandles);
@@ -2339,11 +2849,32 @@ namespace detail {
   }
 
   void Workspace_Impl::registerAdditionOfObject(const WorkspaceObject& object) {
+    // connect right away so that changes made during a batch edit are counted
     object.getImpl<WorkspaceObject_Impl>().get()->WorkspaceObject_Impl::onChange.connect<Workspace_Impl, &Workspace_Impl::change>(this);
+    if (m_batchEditDepth > 0) {
+      // announced when the batch edit closes
+      if (m_batchEditAddedHandles.insert(object.handle()).second) {
+        m_batchEditAdditions.push_back(object);
+      }
+    }
+    else {
+      emitAdditionOfObject(object);
+    }
+    change();
+  }
+
+  void Workspace_Impl::emitAdditionOfObject(const WorkspaceObject& object) {
     auto sh_ptr = object.getImpl<WorkspaceObject_Impl>();
     this->addWorkspaceObject.nano_emit(object, object.iddObject().type(), object.handle());
     this->addWorkspaceObjectPtr.nano_emit(sh_ptr, object.iddObject().type(), object.handle());
-    this->onChange.nano_emit();
+  }
+
+  bool Workspace_Impl::announceRemovalOfObject(const Handle& handle) {
+    if (m_batchEditDepth == 0) {
+      return true;
+    }
+    // an object added and removed within the same batch edit is never announced
+    return (m_batchEditAddedHandles.erase(handle) == 0);
   }
 
   void Workspace_Impl::restoreObject(SavedWorkspaceObject& savedObject) {
@@ -2648,6 +3179,11 @@ namespace detail {
   }
 
   void Workspace_Impl::change() {
+    ++m_changeCount;
+    if (m_batchEditDepth > 0) {
+      m_batchEditChanged = true;
+      return;
+    }
     this->onChange.nano_emit();
   }
 
@@ -2656,16 +3192,108 @@ namespace detail {
       std::shared_ptr<detail::Workspace_Impl> cloneImpl,
       bool keepHandles) const
   {
+    // the clone holds exactly this workspace's objects, so rather than adding the clones one at a
+    // time through addClones, the object maps are copied wholesale and pointers are remapped
+    // through a single table keyed by the original handles
+    std::unordered_map<Handle, WorkspaceObject_ImplPtr> clones;
+    clones.reserve(m_workspaceObjectMap.size());
     detail::WorkspaceObject_ImplPtrVector newObjectImplPtrs;
-    HandleMap oldNewHandleMap;
-    for (const WorkspaceObject& object : allObjects()) {
-      newObjectImplPtrs.push_back(cloneImpl->createObject(
-          object.getImpl<detail::WorkspaceObject_Impl>(),keepHandles));
-      Handle h = newObjectImplPtrs.back()->handle();
-      if (!keepHandles) { oldNewHandleMap.insert(HandleMap::value_type(object.handle(),h)); }
+    newObjectImplPtrs.reserve(m_workspaceObjectMap.size());
+    HandleVector newHandles;
+    newHandles.reserve(m_workspaceObjectMap.size());
+    for (const WorkspaceObjectMap::value_type& p : m_workspaceObjectMap) {
+      newObjectImplPtrs.push_back(cloneImpl->createObject(p.second,keepHandles));
+      newHandles.push_back(newObjectImplPtrs.back()->handle());
+      clones.insert(std::make_pair(p.first,newObjectImplPtrs.back()));
+    }
+
+    // same progress as addClones: one step per object for the maps, the pointers and initialization
+    bool reportProgress = (cloneImpl->m_batchEditDepth == 0);
+    int i = 0;
+    int N = newObjectImplPtrs.size();
+    if (reportProgress) {
+      if (keepHandles) {
+        cloneImpl->progressRange.nano_emit(0, 2*N);
+      }
+      else {
+        cloneImpl->progressRange.nano_emit(0, 3*N);
+      }
+      cloneImpl->progressValue.nano_emit(0);
+      cloneImpl->progressCaption.nano_emit("Cloning Objects");
+    }
+
+    auto cloneOf = [&clones](const Handle& h) -> const WorkspaceObject_ImplPtr& {
+      auto it = clones.find(h);
+      OS_ASSERT(it != clones.end());
+      return it->second;
+    };
+
+    cloneImpl->m_workspaceObjectMap.reserve(newObjectImplPtrs.size());
+    for (const WorkspaceObject_ImplPtr& ptr : newObjectImplPtrs) {
+      cloneImpl->m_workspaceObjectMap.insert(WorkspaceObjectMap::value_type(ptr->handle(),ptr));
+    }
+    for (const IddObjectTypeMap::value_type& p : m_iddObjectTypeMap) {
+      WorkspaceObjectMap& objectMap = cloneImpl->m_iddObjectTypeMap[p.first];
+      objectMap.reserve(p.second.size());
+      for (const WorkspaceObjectMap::value_type& q : p.second) {
+        const WorkspaceObject_ImplPtr& ptr = cloneOf(q.first);
+        objectMap.insert(WorkspaceObjectMap::value_type(ptr->handle(),ptr));
+      }
+    }
+    // includes the targets registered by forwardReferences
+    for (const IdfReferencesMap::value_type& p : m_idfReferencesMap) {
+      WorkspaceObjectMap& objectMap = cloneImpl->m_idfReferencesMap[p.first];
+      objectMap.reserve(p.second.size());
+      for (const WorkspaceObjectMap::value_type& q : p.second) {
+        const WorkspaceObject_ImplPtr& ptr = cloneOf(q.first);
+        objectMap.insert(WorkspaceObjectMap::value_type(ptr->handle(),ptr));
+      }
+    }
+    if (reportProgress) {
+      i += N;
+      cloneImpl->progressValue.nano_emit(i);
+    }
+
+    // with new handles, pointers and the direct order are remapped, otherwise they are already right
+    if (!keepHandles) {
+      for (const WorkspaceObject_ImplPtr& ptr : newObjectImplPtrs) {
+        ptr->initializeOnCollectionClone(clones);
+        if (reportProgress) { cloneImpl->progressValue.nano_emit(++i); }
+      }
+      if (cloneImpl->m_workspaceObjectOrder.isDirectOrder()) {
+        HandleVector mappedOrder;
+        for (const Handle& h : cloneImpl->order().directOrder().get()) {
+          auto it = clones.find(h);
+          if (it != clones.end()) {
+            mappedOrder.push_back(it->second->handle());
+          }
+        }
+        cloneImpl->m_workspaceObjectOrder.setDirectOrder(mappedOrder);
+      }
+    }
+
+    WorkspaceObjectVector newObjects;
+    newObjects.reserve(newObjectImplPtrs.size());
+    for (const WorkspaceObject_ImplPtr& ptr : newObjectImplPtrs) {
+      ptr->setInitialized();
+      newObjects.push_back(WorkspaceObject(ptr));
+      if (reportProgress) { cloneImpl->progressValue.nano_emit(++i); }
+    }
+
+    // as in addClones, a collection clone is only checked at StrictnessLevel::Final
+    if ((cloneImpl->strictnessLevel() == StrictnessLevel::Final) && !cloneImpl->isValid()) {
+      LOG(Info,"Unable to add cloned objects to Workspace. The validity report is: " <<
+          std::endl << cloneImpl->validityReport());
+      cloneImpl->nominallyRemoveObjects(newHandles); // no validity check
+      for (const WorkspaceObject_ImplPtr& ptr : newObjectImplPtrs) {
+        ptr->disconnect();
+      }
+      return;
+    }
+
+    for (const WorkspaceObject& newObject : newObjects) {
+      cloneImpl->registerAdditionOfObject(newObject);
     }
-    // add Object_ImplPtrs to clone's Workspace_Impl
-    cloneImpl->addClones(newObjectImplPtrs,oldNewHandleMap,true);
   }
 
   void Workspace_Impl::createAndAddSubsetClonedObjects(
@@ -2942,6 +3570,16 @@ void Workspace::setFastNaming(bool fastNaming)
   m_impl->setFastNaming(fastNaming);
 }
 
+WorkspaceBatchEdit Workspace::batchEdit()
+{
+  return WorkspaceBatchEdit(*this);
+}
+
+bool Workspace::isBatchEditing() const
+{
+  return m_impl->isBatchEditing();
+}
+
 // ORDER
 
 WorkspaceObjectOrder Workspace::order() {
@@ -3049,10 +3687,30 @@ bool Workspace::save(const openstudio::path& p, bool overwrite) {
   return m_impl->save(p,overwrite);
 }
 
+bool Workspace::writeJournal(const openstudio::path& p) {
+  return m_impl->writeJournal(p);
+}
+
+std::vector<Handle> Workspace::handlesAddedSinceSave() const {
+  return m_impl->handlesAddedSinceSave();
+}
+
+std::vector<Handle> Workspace::handlesModifiedSinceSave() const {
+  return m_impl->handlesModifiedSinceSave();
+}
+
+std::vector<Handle> Workspace::handlesRemovedSinceSave() const {
+  return m_impl->handlesRemovedSinceSave();
+}
+
+openstudio::path Workspace::journalPath(const openstudio::path& p) {
+  return detail::Workspace_Impl::journalPath(p);
+}
+
 boost::optional<Workspace> Workspace::load(const openstudio::path& p) {
   OptionalIdfFile oIdfFile = IdfFile::load(p);
   if (oIdfFile) {
-    return Workspace(*oIdfFile);
+    return loadFromIdfFile(*oIdfFile,p);
   }
   return boost::none;
 }
@@ -3062,7 +3720,7 @@ boost::optional<Workspace> Workspace::load(const openstudio::path& p,
 {
   OptionalIdfFile oIdfFile = IdfFile::load(p,iddFileType);
   if (oIdfFile) {
-    return Workspace(*oIdfFile);
+    return loadFromIdfFile(*oIdfFile,p);
   }
   return boost::none;
 }
@@ -3072,11 +3730,22 @@ boost::optional<Workspace> Workspace::load(const openstudio::path& p,
 {
   OptionalIdfFile oIdfFile = IdfFile::load(p,iddFile);
   if (oIdfFile) {
-    return Workspace(*oIdfFile);
+    return loadFromIdfFile(*oIdfFile,p);
   }
   return boost::none;
 }
 
+Workspace Workspace::loadFromIdfFile(IdfFile& idfFile, const openstudio::path& p)
+{
+  openstudio::path jp = journalPath(p);
+  if (openstudio::filesystem::exists(jp)) {
+    detail::Workspace_Impl::replayJournal(idfFile,jp);
+  }
+  Workspace result(idfFile);
+  result.getImpl<detail::Workspace_Impl>()->markAsSaved();
+  return result;
+}
+
 IdfFile Workspace::toIdfFile() const {
   return m_impl->toIdfFile();
 }
@@ -3110,6 +3779,23 @@ void Workspace::addVersionObject() {
   }
 }
 
+WorkspaceBatchEdit::WorkspaceBatchEdit(const Workspace& workspace)
+  : m_impl(workspace.getImpl<detail::Workspace_Impl>())
+{
+  m_impl->beginBatchEdit();
+}
+
+WorkspaceBatchEdit::WorkspaceBatchEdit(const WorkspaceBatchEdit& other)
+  : m_impl(other.m_impl)
+{
+  m_impl->beginBatchEdit();
+}
+
+WorkspaceBatchEdit::~WorkspaceBatchEdit()
+{
+  m_impl->endBatchEdit();
+}
+
 std::ostream& operator<<(std::ostream& os, const Workspace& workspace)
 {
   os << workspace.toIdfFile();
@@ -59,6 +59,7 @@ class VersionString;
 class Quantity;
 
 class ProgressBar;
+class WorkspaceBatchEdit;
 
 namespace detail {
   class Workspace_Impl;
@@ -341,6 +342,23 @@ class UTILITIES_API Workspace {
    *  handle. */
   void setFastNaming(bool fastNaming);
 
+  /** Opens a batch edit that lasts as long as the returned WorkspaceBatchEdit (or any copy of it)
+   *  is alive. Objects added during the batch edit are fully usable right away, but progress
+   *  reporting is skipped, addWorkspaceObject is emitted for them only when the batch edit
+   *  closes, and all changes are announced by a single onChange. Use when creating many objects
+   *  at once, e.g.
+   *
+   *  \code
+   *  {
+   *    WorkspaceBatchEdit batch = model.batchEdit();
+   *    for (...) { Surface surface(vertices, model); }
+   *  } // signals are emitted here
+   *  \endcode */
+  WorkspaceBatchEdit batchEdit();
+
+  /** Returns true if a batch edit is open on this Workspace. */
+  bool isBatchEditing() const;
+
   //@}
   /** @name Object Order */
   //@{
@@ -413,9 +431,30 @@ class UTILITIES_API Workspace {
   /** Save this Workspace to path p. Will construct the parent folder if necessary and if its
    *  parent folder already exists. Will only overwrite an existing file if overwrite==true. If no
    *  extension is provided will use modelFileExtension() for files using IddFileType::OpenStudio,
-   *  and 'idf' otherwise. Returns true if the save operation is successful; false otherwise. */
+   *  and 'idf' otherwise. Returns true if the save operation is successful; false otherwise.
+   *  Objects that have not changed since the last save are copied from the file written then
+   *  rather than printed again. The file is written to p + ".tmp" and renamed to p. A successful
+   *  save removes the journal for p. */
   bool save(const openstudio::path& p, bool overwrite=false);
 
+  /** Appends the objects added, modified or removed since the last save, load or journal write to
+   *  journalPath(p), without rewriting the file saved at p. The journal is replayed when p is
+   *  loaded, so it can be written often to guard against crashes. Only supported if the objects
+   *  have handle fields, as in the OpenStudio IDD. Returns false if the journal cannot be written. */
+  bool writeJournal(const openstudio::path& p);
+
+  /** Returns the handles of objects added since this Workspace was last saved or loaded. */
+  std::vector<Handle> handlesAddedSinceSave() const;
+
+  /** Returns the handles of objects modified since this Workspace was last saved or loaded. */
+  std::vector<Handle> handlesModifiedSinceSave() const;
+
+  /** Returns the handles of objects removed since this Workspace was last saved or loaded. */
+  std::vector<Handle> handlesRemovedSinceSave() const;
+
+  /** Returns the path of the journal kept for a file saved at p. */
+  static openstudio::path journalPath(const openstudio::path& p);
+
   /** Load a Workspace from path using the IddFactory, and choosing iddFileType based on file
    *  extension, if possible. (IddFileType::OpenStudio if extension is modelFileExtension() or
    *  componentFileExtension(), IddFileType::EnergyPlus otherwise.) */
@@ -506,10 +545,30 @@ class UTILITIES_API Workspace {
   // configure logging
   REGISTER_LOGGER("utilities.idf.Workspace");
 
+  // Replays the journal for p into idfFile, if there is one, and constructs the loaded Workspace.
+  static Workspace loadFromIdfFile(IdfFile& idfFile, const openstudio::path& p);
+
   // pointer to implementation
   std::shared_ptr<detail::Workspace_Impl> m_impl;
 };
 
+/** WorkspaceBatchEdit keeps a batch edit of a Workspace open for its lifetime. Batch edits nest,
+ *  and copies share the batch edit, which closes when the last one is destroyed. Obtain one from
+ *  Workspace::batchEdit(). */
+class UTILITIES_API WorkspaceBatchEdit {
+ public:
+  explicit WorkspaceBatchEdit(const Workspace& workspace);
+
+  WorkspaceBatchEdit(const WorkspaceBatchEdit& other);
+
+  ~WorkspaceBatchEdit();
+
+ private:
+  WorkspaceBatchEdit& operator=(const WorkspaceBatchEdit& other);
+
+  std::shared_ptr<detail::Workspace_Impl> m_impl;
+};
+
 /** \relates Workspace */
 typedef boost::optional<Workspace> OptionalWorkspace;
 
@@ -183,6 +183,35 @@ namespace detail {
     }
   }
 
+  void WorkspaceObject_Impl::initializeOnCollectionClone(
+      const std::unordered_map<Handle, std::shared_ptr<WorkspaceObject_Impl> >& clones)
+  {
+    OS_ASSERT(m_workspace);
+    if (m_sourceData) {
+      SourceData::pointer_set mappedPointers;
+      for (const ForwardPointer& fp : m_sourceData->pointers) {
+        Handle th;
+        auto it = clones.find(fp.targetHandle);
+        if (it != clones.end()) {
+          th = it->second->handle();
+        }
+        // ordered by field index, which does not change
+        mappedPointers.insert(mappedPointers.end(),ForwardPointer(fp.fieldIndex,th));
+      }
+      m_sourceData->pointers.swap(mappedPointers);
+    }
+    if (m_targetData) {
+      TargetData::pointer_set mappedPointers;
+      for (const ReversePointer& rp : m_targetData->reversePointers) {
+        auto it = clones.find(rp.sourceHandle);
+        if (it != clones.end()) {
+          mappedPointers.insert(ReversePointer(it->second->handle(),rp.fieldIndex));
+        }
+      }
+      m_targetData->reversePointers.swap(mappedPointers);
+    }
+  }
+
   // GETTERS
 
   Workspace_Impl* WorkspaceObject_Impl::workspaceImpl() const {
@@ -965,6 +994,7 @@ namespace detail {
     this->onChange.nano_emit();
 
     m_diffs.clear();
+    m_revision = nextRevision();
   }
 
   // PROTECTED
@@ -1141,7 +1171,7 @@ namespace detail {
     // last field must be nonextensible, and final size must satisfy minimum number of fields
     if ((index >= minFields()) && (numExtensibleGroups() == 0)) {
       // delete field
-      m_diffs.push_back(IdfObjectDiff(index, m_fields[index], boost::none));
+      m_diffs.push_back(IdfObjectDiff(index, m_fields[index].str(), boost::none));
       m_fields.pop_back();
       if (m_fieldComments.size() > m_fields.size()) {
         m_fieldComments.resize(m_fields.size());
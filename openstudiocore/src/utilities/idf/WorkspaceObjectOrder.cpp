@@ -34,6 +34,11 @@
 
 #include "../core/Assert.hpp"
 
+#include <algorithm>
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+
 namespace openstudio {
 
 namespace detail {
@@ -137,6 +142,15 @@ namespace detail {
     return true;
   }
 
+  bool WorkspaceObjectOrder_Impl::erase(const std::vector<Handle>& handles) {
+    if (!m_directOrder) { return false; }
+    std::unordered_set<Handle> toErase(handles.begin(),handles.end());
+    m_directOrder->erase(std::remove_if(m_directOrder->begin(),m_directOrder->end(),
+                                        [&toErase](const Handle& h) { return toErase.find(h) != toErase.end(); }),
+                         m_directOrder->end());
+    return true;
+  }
+
   void WorkspaceObjectOrder_Impl::setOrderByIddEnum() {
     ObjectOrderBase::setOrderByIddEnum();
     m_directOrder = boost::none;
@@ -245,6 +259,31 @@ namespace detail {
     return boost::none;
   }
 
+  std::vector<boost::optional<unsigned> > WorkspaceObjectOrder_Impl::indicesInOrder(
+      const std::vector<Handle>& handles) const
+  {
+    std::vector<boost::optional<unsigned> > result(handles.size());
+    if (m_directOrder && !handles.empty()) {
+      std::unordered_map<Handle,unsigned> positions;
+      for (unsigned i = 0, n = handles.size(); i < n; ++i) {
+        positions.insert(std::make_pair(handles[i],i));
+      }
+      unsigned index = 0;
+      for (const Handle& h : *m_directOrder) {
+        auto it = positions.find(h);
+        if ((it != positions.end()) && !result[it->second]) {
+          result[it->second] = index;
+        }
+        ++index;
+      }
+      // duplicates in handles share the first occurrence's index
+      for (unsigned i = 0, n = handles.size(); i < n; ++i) {
+        result[i] = result[positions[handles[i]]];
+      }
+    }
+    return result;
+  }
+
   // PROTECTED
 
   void WorkspaceObjectOrder_Impl::setObjectGetter(const ObjectGetter& getter) {
@@ -424,6 +463,10 @@ bool WorkspaceObjectOrder::erase(const Handle& handle) {
   return m_impl->erase(handle);
 }
 
+bool WorkspaceObjectOrder::erase(const std::vector<Handle>& handles) {
+  return m_impl->erase(handles);
+}
+
 // SORTING
 
 std::vector<Handle> WorkspaceObjectOrder::sort(const std::vector<Handle>& handles) const {
@@ -446,6 +489,12 @@ boost::optional<unsigned> WorkspaceObjectOrder::indexInOrder(const Handle& handl
   return m_impl->indexInOrder(handle);
 }
 
+std::vector<boost::optional<unsigned> > WorkspaceObjectOrder::indicesInOrder(
+    const std::vector<Handle>& handles) const
+{
+  return m_impl->indicesInOrder(handles);
+}
+
 // PROTECTED
 
 // CONSTRUCTORS
@@ -80,6 +80,8 @@ namespace detail {
     bool swap(const Handle& handle1, const Handle& handle2);
     /// returns false if not ordering directly, or request is otherwise invalid
     bool erase(const Handle& handle);
+    /// erases all of handles in a single pass, returns false if not ordering directly
+    bool erase(const std::vector<Handle>& handles);
 
     /// deletes other ordering options and orders by IddObjectType
     virtual void setOrderByIddEnum() override;
@@ -115,6 +117,9 @@ namespace detail {
     /** Returns index of handle in order, if its order is directly specified. */
     boost::optional<unsigned> indexInOrder(const Handle& handle) const;
 
+    /** Returns indexInOrder for each of handles, in a single pass over the order. */
+    std::vector<boost::optional<unsigned> > indicesInOrder(const std::vector<Handle>& handles) const;
+
    protected:
     friend class Workspace_Impl;
 
@@ -230,6 +235,8 @@ class UTILITIES_API WorkspaceObjectOrder {
   bool swap(const Handle& handle1, const Handle& handle2);
   /// returns false if not ordering directly, or request is otherwise invalid
   bool erase(const Handle& handle);
+  /// erases all of handles in a single pass, returns false if not ordering directly
+  bool erase(const std::vector<Handle>& handles);
 
   // SORTING
 
@@ -245,6 +252,9 @@ class UTILITIES_API WorkspaceObjectOrder {
   /** Returns index of handle in order, if its order is directly specified. */
   boost::optional<unsigned> indexInOrder(const Handle& handle) const;
 
+  /** Returns indexInOrder for each of handles, in a single pass over the order. */
+  std::vector<boost::optional<unsigned> > indicesInOrder(const std::vector<Handle>& handles) const;
+
  protected:
   friend class Workspace;
   friend class detail::Workspace_Impl;
@@ -35,6 +35,8 @@
 #include <utilities/idf/IdfObject_Impl.hpp>
 #include <utilities/idf/ObjectPointer.hpp>
 
+#include <unordered_map>
+
 namespace openstudio {
 
 // forward declarations
@@ -132,6 +134,12 @@ namespace detail {
     /** Complete copy construction process by updating pointer handles. */
     virtual void initializeOnClone(const HandleMap& oldNewHandleMap);
 
+    /** Complete copy construction when the whole workspace is cloned with new handles. clones maps
+     *  each original handle to the clone of that object, so every pointer is remapped by a single
+     *  lookup. */
+    void initializeOnCollectionClone(
+        const std::unordered_map<Handle, std::shared_ptr<WorkspaceObject_Impl> >& clones);
+
     virtual ~WorkspaceObject_Impl();
 
     /// remove the object from the workspace
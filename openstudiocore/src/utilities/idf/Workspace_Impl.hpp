@@ -46,6 +46,8 @@
 #include <vector>
 #include <set>
 #include <map>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace openstudio {
 
@@ -350,6 +352,22 @@ namespace detail {
      */
     void setFastNaming(bool fastNaming);
 
+    /** Opens a batch edit. Batch edits nest; signals are deferred until the outermost batch edit
+     *  is closed. See WorkspaceBatchEdit. */
+    void beginBatchEdit();
+
+    /** Closes a batch edit. When the outermost batch edit closes, addWorkspaceObject is emitted
+     *  for each object added (and not removed) during the batch, followed by a single onChange. */
+    void endBatchEdit();
+
+    /** Returns true if a batch edit is open. */
+    bool isBatchEditing() const;
+
+    /** Returns the number of changes made to this workspace and its objects so far, including changes
+     *  made during a batch edit. Caches derived from workspace data can compare this value to detect
+     *  that they are stale. */
+    unsigned long long changeCount() const;
+
     /** Resolve name conflicts within other, and between this workspace and other by renaming objects
      *  in other. */
     bool resolvePotentialNameConflicts(Workspace& other);
@@ -426,9 +444,37 @@ namespace detail {
 
     /** Save Workspace to path. Will construct parent folder, but no further up the chain. Will
      *  only overwrite an existing file if overwrite==true. If no extension is provided will use
-     *  .idf or modelFileExtension() depending on the underlying IddFileType. */
+     *  .idf or modelFileExtension() depending on the underlying IddFileType. Objects that have not
+     *  changed since the last save are written from the text kept at that save instead of being
+     *  printed again. A successful save removes the journal for the saved path. */
     virtual bool save(const openstudio::path& p, bool overwrite=false);
 
+    /** Appends the objects added, modified or removed since the last save, load or journal write
+     *  to journalPath(p), without rewriting the file saved at p. Only supported if the objects have
+     *  handle fields, as in the OpenStudio IDD. */
+    bool writeJournal(const openstudio::path& p);
+
+    /** Returns the handles of objects added since the last save or load. */
+    std::vector<Handle> handlesAddedSinceSave() const;
+
+    /** Returns the handles of objects modified since the last save or load. */
+    std::vector<Handle> handlesModifiedSinceSave() const;
+
+    /** Returns the handles of objects removed since the last save or load. */
+    std::vector<Handle> handlesRemovedSinceSave() const;
+
+    /** Treats all current objects as saved, for use right after loading. They are still printed
+     *  in full at the next save. */
+    void markAsSaved();
+
+    /** Returns the path of the journal kept for a file saved at p. */
+    static openstudio::path journalPath(const openstudio::path& p);
+
+    /** Applies each complete batch of records in the journal at journalPath to idfFile. An
+     *  incomplete batch at the end of the journal, as left by a crash, is ignored. Returns false if
+     *  the journal cannot be read. */
+    static bool replayJournal(IdfFile& idfFile, const openstudio::path& journalPath);
+
     /** Creates an IdfFile from the collection, naming objects if necessary. To print out IDF text,
      *  use this method, then IdfFile.print(ostream). */
     IdfFile toIdfFile();
@@ -468,6 +514,12 @@ namespace detail {
     // void removeWorkspaceObjectPtr(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>, const openstudio::IddObjectType& iddObjectType, const openstudio::UUID& handle) const;
     mutable Nano::Signal<void(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>, const openstudio::IddObjectType&, const openstudio::UUID&)> removeWorkspaceObjectPtr;
 
+    /** Sends all objects being deleted by one call to removeObject or removeObjects, after
+     *  removeWorkspaceObject has been emitted for each of them. Listeners that only need to know
+     *  the removed set should prefer this signal. */
+    // void removeWorkspaceObjects(const std::vector<WorkspaceObject>& objects) const;
+    mutable Nano::Signal<void(const std::vector<WorkspaceObject>&)> removeWorkspaceObjects;
+
     /** Sends an object just added to the Workspace. */
     // void addWorkspaceObject(const WorkspaceObject& object, const openstudio::IddObjectType& iddObjectType, const openstudio::UUID& handle) const;
     mutable Nano::Signal<void(const WorkspaceObject&, const openstudio::IddObjectType&, const openstudio::UUID&)> addWorkspaceObject;
@@ -504,7 +556,29 @@ namespace detail {
     IddFileAndFactoryWrapper m_iddFileAndFactoryWrapper; // IDD file to be used for validity checking
     bool m_fastNaming;
 
-    typedef std::map<Handle, std::shared_ptr<WorkspaceObject_Impl> > WorkspaceObjectMap;
+    // batch edit state, see beginBatchEdit
+    unsigned m_batchEditDepth;
+    bool m_batchEditChanged;
+    std::vector<WorkspaceObject> m_batchEditAdditions;
+    std::unordered_set<Handle> m_batchEditAddedHandles;
+
+    // incremented by change(), see changeCount
+    unsigned long long m_changeCount;
+
+    // an object's revision as of the last save, and where it was printed in m_savedPath, see save
+    struct SavedObject {
+      unsigned long long revision;
+      std::streamoff offset;
+      std::size_t length; // 0 if the object was not printed, e.g. because it was loaded
+      std::size_t hash;   // of the printed text, to detect that m_savedPath was changed by others
+    };
+    std::unordered_map<Handle, SavedObject> m_savedObjects;
+    openstudio::path m_savedPath;
+
+    // object revisions as of the last save, load or journal write, see writeJournal
+    std::unordered_map<Handle, unsigned long long> m_journaledRevisions;
+
+    typedef std::unordered_map<Handle, std::shared_ptr<WorkspaceObject_Impl> > WorkspaceObjectMap;
     WorkspaceObjectMap m_workspaceObjectMap;
 
     // object for ordering objects in the collection.
@@ -544,6 +618,22 @@ namespace detail {
 
     boost::optional<WorkspaceObject> getEquivalentObject(const IdfObject& other) const;
 
+    /** Returns getEquivalentObject for each of others. When many of others share a type, the
+     *  objects of that type are indexed once, by name for named types and otherwise by
+     *  IdfObject_Impl::dataFieldsHash, instead of being searched for each of others. */
+    std::vector<boost::optional<WorkspaceObject> > getEquivalentObjects(const std::vector<IdfObject>& others) const;
+
+    // true if candidate is equivalent to other, wsOther is other as a WorkspaceObject if it is one
+    bool isEquivalentObject(const WorkspaceObject& candidate,
+                            const IdfObject& other,
+                            const boost::optional<WorkspaceObject>& wsOther) const;
+
+    // Returns an IdfFile with this workspace's header and IDD, but no objects.
+    IdfFile emptyIdfFile() const;
+
+    // Returns the objects in the order they are serialized, starting with the version object.
+    std::vector<WorkspaceObject> serializationOrder() const;
+
     // SETTERS
 
     // Replace m_iddFactoryWrapper if workspace remains valid.
@@ -581,7 +671,8 @@ namespace detail {
 
     OptionalSavedWorkspaceObject savedWorkspaceObject(const Handle& handle);
 
-    std::vector<WorkspaceObject> nominallyRemoveObject(const Handle& handle);
+    // erasing from the direct order can be left to the caller by passing eraseFromOrder = false
+    std::vector<WorkspaceObject> nominallyRemoveObject(const Handle& handle, bool eraseFromOrder = true);
 
     std::vector<std::vector<WorkspaceObject> > nominallyRemoveObjects(const std::vector<Handle>& handles);
 
@@ -589,12 +680,18 @@ namespace detail {
 
     void restoreObjects(SavedWorkspaceObjectVector& savedObjects);
 
-    void registerRemovalOfObject(std::shared_ptr<WorkspaceObject_Impl> ptr,const std::vector<WorkspaceObject>& sources,const std::vector<Handle>& removedHandles);
+    void registerRemovalOfObject(std::shared_ptr<WorkspaceObject_Impl> ptr,const std::vector<WorkspaceObject>& sources,const std::unordered_set<Handle>& removedHandles);
 
-    void registerRemovalOfObjects(std::vector<SavedWorkspaceObject>& savedObjects,const std::vector<std::vector<WorkspaceObject> >& sources,const std::vector<Handle>& removedHandles);
+    void registerRemovalOfObjects(std::vector<SavedWorkspaceObject>& savedObjects,const std::vector<std::vector<WorkspaceObject> >& sources,const std::unordered_set<Handle>& removedHandles);
 
     void registerAdditionOfObject(const WorkspaceObject& object);
 
+    void emitAdditionOfObject(const WorkspaceObject& object);
+
+    // returns false if the removal of handle should not be announced because its addition was
+    // deferred by the current batch edit and has not been announced either
+    bool announceRemovalOfObject(const Handle& handle);
+
     // QUERIES
 
     /** Returns name with the next available integer suffix. */
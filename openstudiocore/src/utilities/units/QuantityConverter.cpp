@@ -506,52 +506,106 @@ boost::optional<Quantity> QuantityConverterSingleton::m_convertToTargetFromSI(
   return converted;
 }
 
-boost::optional<double> convert(double original, const std::string& originalUnits, const std::string& finalUnits)
+boost::optional<UnitConversion> QuantityConverterSingleton::unitConversion(const std::string& originalUnits,
+                                                                           const std::string& finalUnits) const
 {
-  if (originalUnits == finalUnits){
-    return original;
+  std::lock_guard<std::mutex> lock(m_unitConversionsMutex);
+
+  std::pair<std::string,std::string> key(originalUnits,finalUnits);
+  auto it = m_unitConversions.find(key);
+  if (it != m_unitConversions.end()) {
+    return it->second;
   }
 
+  boost::optional<UnitConversion> result;
+
   //create the units from the strings
   boost::optional<Unit> originalUnit = UnitFactory::instance().createUnit(originalUnits);
   boost::optional<Unit> finalUnit = UnitFactory::instance().createUnit(finalUnits);
 
   //make sure both unit strings were valid
   if (originalUnit && finalUnit) {
+    // conversions are affine, so converting 0 and 1 determines the transform
+    OptionalQuantity offset = convert(Quantity(0.0, *originalUnit), *finalUnit);
+    if (offset) {
+      OptionalQuantity factorPlusOffset = convert(Quantity(1.0, *originalUnit), *finalUnit);
+      OS_ASSERT(factorPlusOffset);
+      UnitConversion conversion;
+      conversion.factor = factorPlusOffset->value() - offset->value();
+      conversion.offset = offset->value();
+      result = conversion;
+    }
+  }
+
+  m_unitConversions.insert(UnitConversionMap::value_type(key,result));
+  return result;
+}
 
-    //make the original quantity
-    Quantity originalQuant = Quantity(original, *originalUnit);
+boost::optional<double> convert(double original, const std::string& originalUnits, const std::string& finalUnits)
+{
+  if (originalUnits == finalUnits){
+    return original;
+  }
 
-    //convert to final units
-    boost::optional<Quantity> finalQuant = QuantityConverter::instance().convert(originalQuant, *finalUnit);
-  
-    //if the conversion 
-    if (finalQuant) {
-      return finalQuant->value();
-    }
+  if (boost::optional<UnitConversion> conversion = QuantityConverter::instance().unitConversion(originalUnits, finalUnits)) {
+    return conversion->apply(original);
   }
 
   return boost::none;
 }
 
+boost::optional<std::vector<double> > convert(const std::vector<double>& original,
+                                              const std::string& originalUnits,
+                                              const std::string& finalUnits)
+{
+  if (originalUnits == finalUnits){
+    return original;
+  }
+
+  boost::optional<UnitConversion> conversion = QuantityConverter::instance().unitConversion(originalUnits, finalUnits);
+  if (!conversion) {
+    return boost::none;
+  }
+
+  std::vector<double> result(original.size());
+  const double factor = conversion->factor;
+  const double offset = conversion->offset;
+  for (size_t i = 0, n = original.size(); i < n; ++i) {
+    result[i] = factor * original[i] + offset;
+  }
+  return result;
+}
+
+namespace {
+
+  // factor * values + offset, in place
+  std::vector<double> applyConversion(std::vector<double> values, double factor, double offset) {
+    for (double& value : values) {
+      value = factor * value + offset;
+    }
+    return values;
+  }
+
+}
+
 boost::optional<Quantity> convert(const Quantity &q, UnitSystem sys) {
   return QuantityConverter::instance().convert(q,sys);
 }
 
 OSQuantityVector convert(const OSQuantityVector& original, UnitSystem sys) {
-  OSQuantityVector result;
   Quantity testQuantity(0.0,original.units());
   OptionalQuantity offset = convert(testQuantity,sys);
   if (!offset) {
-    return result;
+    return OSQuantityVector();
   }
   testQuantity.setValue(1.0);
   OptionalQuantity factorPlusOffset = convert(testQuantity,sys);
   OS_ASSERT(factorPlusOffset);
   OS_ASSERT(offset->units() == factorPlusOffset->units());
-  result = OSQuantityVector(offset->units(),original.values());
-  result = result * (factorPlusOffset->value() - offset->value()) + offset.get();
-  return result;
+  return OSQuantityVector(offset->units(),
+                          applyConversion(original.values(),
+                                          factorPlusOffset->value() - offset->value(),
+                                          offset->value()));
 }
 
 boost::optional<Quantity> convert(const Quantity& original, const Unit& targetUnits) {
@@ -559,19 +613,19 @@ boost::optional<Quantity> convert(const Quantity& original, const Unit& targetUn
 }
 
 OSQuantityVector convert(const OSQuantityVector& original, const Unit& targetUnits) {
-  OSQuantityVector result;
   Quantity testQuantity(0.0,original.units());
   OptionalQuantity offset = convert(testQuantity,targetUnits);
   if (!offset) {
-    return result;
+    return OSQuantityVector();
   }
   testQuantity.setValue(1.0);
   OptionalQuantity factorPlusOffset = convert(testQuantity,targetUnits);
   OS_ASSERT(factorPlusOffset);
   OS_ASSERT(offset->units() == factorPlusOffset->units());
-  result = OSQuantityVector(offset->units(),original.values());
-  result = result * (factorPlusOffset->value() - offset->value()) + offset.get();
-  return result;
+  return OSQuantityVector(offset->units(),
+                          applyConversion(original.values(),
+                                          factorPlusOffset->value() - offset->value(),
+                                          offset->value()));
 }
 
 }// namespace openstudio
@@ -36,6 +36,8 @@
 #include "Unit.hpp"
 #include <string>
 #include <map>
+#include <mutex>
+#include <vector>
 
 class QDomElement;
 
@@ -83,6 +85,15 @@ struct baseUnitConversionFactor {
   double offset;
 };
 
+/** The affine transform that converts values from one set of units to another,
+ *  finalValue = factor * originalValue + offset. */
+struct UTILITIES_API UnitConversion {
+  double factor;
+  double offset;
+
+  double apply(double value) const { return factor * value + offset; }
+};
+
 /** Singleton for converting quantities to different \link UnitSystem unit systems \endlink or
  *  to targeted \link Unit units \endlink */
 class UTILITIES_API QuantityConverterSingleton {
@@ -95,6 +106,12 @@ class UTILITIES_API QuantityConverterSingleton {
 
   boost::optional<Quantity> convert(const Quantity &original, const Unit& targetUnits) const;
 
+  /** Returns the transform from originalUnits to finalUnits, or boost::none if either string is
+   *  not a valid unit or the units are not compatible. Each pair of unit strings is parsed and
+   *  converted only once; later calls are served from a cache. Thread-safe. */
+  boost::optional<UnitConversion> unitConversion(const std::string& originalUnits,
+                                                 const std::string& finalUnits) const;
+
  private:
   REGISTER_LOGGER("openstudio.units.QuantityConverter");
   QuantityConverterSingleton();
@@ -105,6 +122,11 @@ class UTILITIES_API QuantityConverterSingleton {
   BaseUnitConversionMap m_toSImap;
   UnitSystemConversionMultiMap m_fromSIBySystemMap;
 
+  typedef std::map<std::pair<std::string,std::string>, boost::optional<UnitConversion> > UnitConversionMap;
+
+  mutable UnitConversionMap m_unitConversions;
+  mutable std::mutex m_unitConversionsMutex;
+
   boost::optional<Quantity> m_convertToSI(const Quantity& original) const;
 
   Quantity m_convertFromSI(const Quantity& original, const UnitSystem& targetSys) const;
@@ -117,21 +139,28 @@ class UTILITIES_API QuantityConverterSingleton {
 /** \relates QuantityConverterSingleton */
 typedef openstudio::Singleton<QuantityConverterSingleton> QuantityConverter;
 
-/** Non-member function to simplify interface for users. \relates QuantityConverterSingleton */
+/** Non-member function to simplify interface for users. Uses the cached
+ *  QuantityConverterSingleton::unitConversion. \relates QuantityConverterSingleton */
 UTILITIES_API boost::optional<double> convert(double original, const std::string& originalUnits, const std::string& finalUnits);
 
+/** Converts all of original from originalUnits to finalUnits in a single pass. Returns
+ *  boost::none if the units cannot be converted. \relates QuantityConverterSingleton */
+UTILITIES_API boost::optional<std::vector<double> > convert(const std::vector<double>& original,
+                                                            const std::string& originalUnits,
+                                                            const std::string& finalUnits);
+
 /** Non-member function to simplify interface for users. \relates QuantityConverterSingleton */
 UTILITIES_API boost::optional<Quantity> convert(const Quantity& original, UnitSystem sys);
 
 /** Non-member function that uses just two calls to QuantityConverter to convert an entire 
- *  OSQuantityVector. \relates QuantityConverterSingleton \relates OSQuantityVector */
+ *  OSQuantityVector in a single pass. \relates QuantityConverterSingleton \relates OSQuantityVector */
 UTILITIES_API OSQuantityVector convert(const OSQuantityVector& original, UnitSystem sys);
 
 /** Non-member function to simplify interface for users. \relates QuantityConverterSingleton */
 UTILITIES_API boost::optional<Quantity> convert(const Quantity& original, const Unit& targetUnits);
 
 /** Non-member function that uses just two calls to QuantityConverter to convert an entire 
- *  OSQuantityVector. \relates QuantityConverterSingleton \relates OSQuantityVector */
+ *  OSQuantityVector in a single pass. \relates QuantityConverterSingleton \relates OSQuantityVector */
 UTILITIES_API OSQuantityVector convert(const OSQuantityVector& original, const Unit& targetUnits);
 
 }// namespace openstudio
@@ -43,6 +43,9 @@
 #include "../SIUnit.hpp"
 #include "../Unit.hpp"
 
+#include <chrono>
+#include <iostream>
+
 using namespace openstudio;
 
 TEST_F(UnitsFixture, QuantityConverter_IPandSIUsingSystem)
@@ -267,3 +270,77 @@ TEST_F(UnitsFixture,QuantityConverter_Profiling_QuantityVectorBaseCase) {
 TEST_F(UnitsFixture,QuantityConverter_Profiling_OSQuantityVector) {
   OSQuantityVector result = convert(testOSQuantityVector,UnitSystem(UnitSystem::Wh));
 }
+
+TEST_F(UnitsFixture,QuantityConverter_UnitConversion) {
+  double tol = 1.0E-10;
+
+  // scale only
+  boost::optional<UnitConversion> conversion = QuantityConverter::instance().unitConversion("m","ft");
+  ASSERT_TRUE(conversion);
+  EXPECT_NEAR(3.28084,conversion->factor,1.0E-5);
+  EXPECT_DOUBLE_EQ(0.0,conversion->offset);
+
+  // scale and offset
+  conversion = QuantityConverter::instance().unitConversion("C","F");
+  ASSERT_TRUE(conversion);
+  EXPECT_NEAR(1.8,conversion->factor,tol);
+  EXPECT_NEAR(32.0,conversion->offset,tol);
+  EXPECT_NEAR(212.0,conversion->apply(100.0),tol);
+
+  // invalid and incompatible units
+  EXPECT_FALSE(QuantityConverter::instance().unitConversion("m","kg"));
+  EXPECT_FALSE(QuantityConverter::instance().unitConversion("m","not a unit"));
+  EXPECT_FALSE(QuantityConverter::instance().unitConversion("m","kg"));
+
+  // scalar and vector conversions agree with the Quantity conversion
+  std::vector<double> values;
+  for (int i = -10; i < 10; ++i) {
+    values.push_back(i * 3.7);
+  }
+  boost::optional<std::vector<double> > converted = convert(values,"C","F");
+  ASSERT_TRUE(converted);
+  ASSERT_EQ(values.size(),converted->size());
+  for (unsigned i = 0; i < values.size(); ++i) {
+    OptionalQuantity q = convert(Quantity(values[i],createCelsiusTemperature()),createFahrenheitTemperature());
+    ASSERT_TRUE(q);
+    EXPECT_NEAR(q->value(),(*converted)[i],tol);
+    boost::optional<double> value = convert(values[i],"C","F");
+    ASSERT_TRUE(value);
+    EXPECT_DOUBLE_EQ((*converted)[i],*value);
+  }
+
+  converted = convert(values,"W/m^2","W/ft^2");
+  ASSERT_TRUE(converted);
+  boost::optional<double> value = convert(values[0],"W/m^2","W/ft^2");
+  ASSERT_TRUE(value);
+  EXPECT_DOUBLE_EQ(*value,(*converted)[0]);
+  EXPECT_FALSE(convert(values,"m","kg"));
+  converted = convert(values,"m","m");
+  ASSERT_TRUE(converted);
+  EXPECT_EQ(values,*converted);
+}
+
+TEST_F(UnitsFixture,DISABLED_QuantityConverter_Benchmark) {
+  std::vector<double> values(10000000);
+  for (unsigned i = 0; i < values.size(); ++i) {
+    values[i] = 0.001 * i;
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  double sum = 0.0;
+  for (double value : values) {
+    sum += convert(value,"W/m^2","W/ft^2").get();
+  }
+  auto scalarEnd = std::chrono::steady_clock::now();
+  boost::optional<std::vector<double> > converted = convert(values,"W/m^2","W/ft^2");
+  auto vectorEnd = std::chrono::steady_clock::now();
+  OSQuantityVector quantities = convert(OSQuantityVector(createSIPowerDensity(),values),UnitSystem(UnitSystem::IP));
+  auto osQuantityVectorEnd = std::chrono::steady_clock::now();
+
+  ASSERT_TRUE(converted);
+  EXPECT_EQ(values.size(),quantities.size());
+  std::cout << values.size() << " values: scalar convert " << std::chrono::duration<double,std::milli>(scalarEnd - start).count()
+            << " ms, std::vector convert " << std::chrono::duration<double,std::milli>(vectorEnd - scalarEnd).count()
+            << " ms, OSQuantityVector convert " << std::chrono::duration<double,std::milli>(osQuantityVectorEnd - vectorEnd).count()
+            << " ms (checksum " << sum << ")" << std::endl;
+}